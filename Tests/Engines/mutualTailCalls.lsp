@@ -0,0 +1,34 @@
+;mutualTailCalls.lsp: Calls in tail position between different functions, within loops and with different return types.
+(bool even ((int n)) (
+    (if (= n 0) (return (= 1 1)))
+    (return (odd (- n 1)))
+))
+(bool odd ((int n)) (
+    (if (= n 0) (return (= 1 0)))
+    (return (even (- n 1)))
+))
+(void countdown ((int n)) (
+    (if (> n 0) (
+        (println n)
+        (return (countdown (- n 1)))
+    ))
+))
+(int sum ((int n)(int acc)) (
+    (int step 7)
+    (while (> n 0) (
+        (return (sum (- n 1) (+ acc step)))
+    ))
+    (return acc)
+))
+(int truncated ((int a)) (
+    (return (half a))
+))
+(double half ((int a)) (
+    (return (/ a 2.0))
+))
+(void main () (
+    (println (odd 300001))
+    (countdown 3)
+    (println (sum 200000 0))
+    (println (truncated 3))
+))
@@ -0,0 +1,9 @@
+;tailCalls.lsp: Listing 013 of "Documentation/Lisp/Functions.md".
+(void main () (
+    (print (count 0 1000000))
+))
+
+(int count ((int i)(int n)) (
+    (if (>= i n) (return i))
+    (return (count (+ i 1) n)) ;The call is in tail position.
+))
@@ -0,0 +1,31 @@
+;arithmetic.lsp: Integer loops, comparisons and a division, whose double result cannot be returned as an integer (error 27).
+(int sumto (int n) (
+    (int i)
+    (int s)
+    (set i 0)
+    (set s 0)
+    (while (< i n) (
+        (set s (+ s (* i 2) 1))
+        (set i (+ i 1))
+    ))
+    (return s)
+))
+(double avg ((double a)(double b)) (
+    (return (/ (+ a b) 2))
+))
+(bool between ((int x)(int lo)(int hi)) (
+    (return (& (>= x lo) (<= x hi)))
+))
+(int idiv ((int a)(int b)) (
+    (return (/ a b))
+))
+(int neg (int a) (
+    (return (- a))
+))
+(void main () (
+    (println (sumto 300000))
+    (println (avg 1.5 2.25))
+    (println (between 5 1 10) (between 11 1 10))
+    (println (idiv 7 2) " " (idiv -7 2) " " (neg 5))
+    (println (idiv 7 0))
+))
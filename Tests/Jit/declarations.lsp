@@ -0,0 +1,28 @@
+;declarations.lsp: Variables, which are declared within branches, and a conversion error in main.
+(void main () (
+    (double r (geo 1.0 30))
+    (println r)
+    (println (nest 5))
+    (int q (loopy 3))
+    (println q)
+    (bool b (gt 1.5 2))
+    (println b)
+    (int e (bad 2))
+))
+(double geo ((double a)(int n)) (
+    (while (> n 0) ((set a (* a 1.5)) (set n (- n 1))))
+    (return a)
+))
+(int nest (int n) (
+    (if (> n 0) ((int t1 (nest (- n 1))) (return (+ t1 n))) ((return 0)))
+))
+(int loopy (int n) (
+    (int c 0)
+    (while (> n 0) (
+        (if (= (- n 2) 0) ((int z 7) (set c (+ c z))) ((int z 1) (set c (+ c z))))
+        (set n (- n 1))
+    ))
+    (return c)
+))
+(bool gt ((double a)(int b)) ((return (>= a b))))
+(int bad (int n) ((return (+ n (/ 1 0)))))
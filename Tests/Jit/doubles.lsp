@@ -0,0 +1,25 @@
+;doubles.lsp: Lexemes of doubles, which are returned without arithmetic.
+(void main () (
+    (println (h0 0) " " (h0 3))
+    (println (cp 2) " " (cp 0))
+    (println (dd) " " (ne 1.5))
+))
+(double h0 (int n) (
+    (double acc 0.0)
+    (while (> n 0) ((set acc (+ acc 0.5)) (set n (- n 1))))
+    (return acc)
+))
+(double cp (int n) (
+    (double a 2.50)
+    (double b 1.0)
+    (if (> n 1) ((set b a)) ((set b (* a 2))))
+    (return b)
+))
+(double dd () (
+    (double x)
+    (return x)
+))
+(bool ne (double v) (
+    (double w 1.50)
+    (return (! v w))
+))
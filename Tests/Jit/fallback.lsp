@@ -0,0 +1,12 @@
+;fallback.lsp: Functions, which print or return nil, are executed by the interpreter.
+(void main () (
+    (println (a 3))
+    (nop 2)
+    (println (b 4))
+    (println (c 2))
+))
+(int a (int n) ((return (+ (p n) 1))))
+(int p (int n) ((println "p" n) (return n)))
+(void nop (int n) ((int q (* n 2)) (return q)))
+(int b (int n) ((nop n) (return (* n n))))
+(bool c (int n) ((if t ((return (> n 1))) ((return nil)))))
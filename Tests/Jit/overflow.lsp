@@ -0,0 +1,51 @@
+;overflow.lsp: Integer overflow, rounding of doubles, mixed operands and recursion.
+(int ovf ((int a)(int b)) (
+    (return (* a b))
+))
+(int addo ((int a)(int b)) (
+    (return (+ a b))
+))
+(double dd ((double a)(double b)) (
+    (double r (* a b))
+    (set r (+ r 0.0000004))
+    (return (/ r 3))
+))
+(double mix ((int a)(double b)) (
+    (return (+ a b))
+))
+(int toint (double a) (
+    (int x)
+    (set x 3)
+    (return x)
+))
+(bool cmp ((double a)(double b)) (
+    (return (| (< a b) (= a b)))
+))
+(int loop (int n) (
+    (int s 0)
+    (while (> n 0) (
+        (if (= (- n (* 2 (- n 1))) 0) (set s (+ s 1)) (set s (- s 1)))
+        (set n (- n 1))
+    ))
+    (return s)
+))
+(int rec (int n) (
+    (if (<= n 0) (return 0))
+    (return (+ n (rec (- n 1))))
+))
+(int negdiv ((int a)(int b)) (
+    (double q (/ a b))
+    (return a)
+))
+(double hd (int a) (
+    (return (/ a 7))
+))
+(void main () (
+    (println (ovf 65536 65536) " " (ovf 100000 30000) " " (addo 2147483647 1))
+    (println (dd 1.1 2.2) " " (dd 0.1 0.1) " " (dd 123456.789 1000.5))
+    (println (mix 3 0.25) " " (mix -3 0.0000005))
+    (println (cmp 1.0 1.0) (cmp 2.5 1.5))
+    (println (loop 10) " " (rec 1000))
+    (println (negdiv 5 0))
+    (println (hd 22) " " (hd -22))
+))
@@ -0,0 +1,20 @@
+;recursion.lsp: Recursive calls of compiled functions and operations, which are not compiled.
+(int fib (int n) (
+    (if (< n 2) (return n))
+    (return (+ (fib (- n 1)) (fib (- n 2))))
+))
+(double half (double x) (
+    (return (/ x 2))
+))
+(void main () (
+    (int i)
+    (set i 0)
+    (while (< i 5) (
+        (println "fib " i " = " (fib i))
+        (set i (+ i 1))
+    ))
+    (println (half 5.0))
+    (println (+ 1 2 3) " " (* 2 3.5) " " (/ 7 2) " " (- 10))
+    (println (& t nil) (| nil t))
+    (println (+ "a" "b" 1))
+))
@@ -0,0 +1,18 @@
+;tailCalls.lsp: Calls in tail position and a loop over doubles.
+(int count ((int n)(int acc)) (
+    (if (= n 0) (return acc))
+    (return (count (- n 1) (+ acc 1)))
+))
+(double harm (int n) (
+    (double acc 0.0)
+    (int i 1)
+    (while (<= i n) (
+        (set acc (+ acc (/ 1 i)))
+        (set i (+ i 1))
+    ))
+    (return acc)
+))
+(void main () (
+    (println (count 100000 0))
+    (println (harm 30000))
+))
@@ -0,0 +1,15 @@
+;tailCalls.lsp: Pure functions, which call themselves in tail position one million times, and a naive fibonacci function.
+(int count ((int i)(int n)) (
+    (if (>= i n) (return i))
+    (return (count (+ i 1) n))
+))
+(int fib ((int n)) (
+    (if (< n 2) (return n))
+    (return (+ (fib (- n 1)) (fib (- n 2))))
+))
+(void main () (
+    (println (count 0 1000000))
+    (println (count 999990 1000000))
+    (println (count 1000000 2000000))
+    (println (fib 40))
+))
@@ -0,0 +1,30 @@
+;blockedTasks.lsp: More tasks wait for a channel than there are threads, while the task, which sends the values, is still queued.
+(void relay ((int c) (int out)) (
+	(send out (recv c))
+))
+(void produce ((int c)) (
+	(int i 0)
+	(while (< i 12) (
+		(send c i)
+		(set i (+ i 1))
+	))
+))
+(void main () (
+	(int c (make-channel 1))
+	(int out (make-channel 1))
+	(int i 0)
+	(while (< i 12) (
+		(spawn (relay c out))
+		(set i (+ i 1))
+	))
+	(int k 0)
+	(while (< k 100000) (set k (+ k 1)))
+	(spawn (produce c))
+	(int sum 0)
+	(set i 0)
+	(while (< i 12) (
+		(set sum (+ sum (recv out)))
+		(set i (+ i 1))
+	))
+	(println sum)
+))
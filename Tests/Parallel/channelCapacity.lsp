@@ -0,0 +1,9 @@
+;channelCapacity.lsp: A channel stores exactly as many values as requested, even if the capacity is no power of two.
+(void main () (
+	(int one (make-channel 1))
+	(println (try-send one 1) " " (try-send one 2))
+	(int five (make-channel 5))
+	(println (try-send five 1) (try-send five 2) (try-send five 3) (try-send five 4) (try-send five 5) " " (try-send five 6))
+	(int x 0)
+	(println (try-recv five x) " " x " " (try-send five 6))
+))
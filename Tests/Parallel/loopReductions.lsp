@@ -0,0 +1,12 @@
+;loopReductions.lsp: The rounded results of reductions over doubles do not depend on the number of threads.
+(void main () (
+	(double product 1.0)
+	(pfor i 1 20 (* product) ((set product (* product 1.1))))
+	(println product)
+	(double harmonic 0.0)
+	(pfor i 0 100000 dynamic (+ harmonic) ((set harmonic (+ harmonic (/ 1.0 (+ i 1))))))
+	(println harmonic)
+	(double squares 0.0)
+	(pfor i 0 1000 (+ squares) ((set squares (+ squares (* 0.1 i i)))))
+	(println squares)
+))
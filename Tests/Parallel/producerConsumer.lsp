@@ -0,0 +1,25 @@
+;producerConsumer.lsp: Tasks, which exchange values through a channel, also run alongside each other with a single thread.
+(int produce ((int channel)) (
+	(int i 1)
+	(while (<= i 100) (
+		(send channel i)
+		(set i (+ i 1))
+	))
+	(send channel 0)
+	(return 100)
+))
+(int consume ((int channel)) (
+	(int sum 0)
+	(int value (recv channel))
+	(while (! value 0) (
+		(set sum (+ sum value))
+		(set value (recv channel))
+	))
+	(return sum)
+))
+(void main () (
+	(int channel (make-channel 1))
+	(int consumer (spawn (consume channel)))
+	(int producer (spawn (produce channel)))
+	(println (await producer) " " (await consumer))
+))
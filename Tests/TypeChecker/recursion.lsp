@@ -0,0 +1,12 @@
+;recursion.lsp: Recursive functions, which are typed correctly, do not cause errors.
+(int fib (int n) (
+	(if (< n 2) (
+		(return n)
+	))
+	(return (+ (fib (- n 1)) (fib (- n 2))))
+))
+(void main () (
+	(int x (fib 10))
+	(set x (+ x 1))
+	(println x)
+))
@@ -0,0 +1,8 @@
+;selfCall.lsp: A recursive function does not hide the type errors of its own statements.
+(int f (int a) (
+	(println (- a "xy"))
+	(return (- a "xy"))
+))
+(void main () (
+	(println (f 3))
+))
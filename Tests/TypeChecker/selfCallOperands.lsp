@@ -0,0 +1,10 @@
+;selfCallOperands.lsp: The name of a function is no call, which hides the type errors of its return value.
+(int f (int a) (
+	(if (< a 1) (
+		(return (f (+ a 1)))
+	))
+	(return (+ a "x"))
+))
+(void main () (
+	(println (f 3))
+))
@@ -0,0 +1,6 @@
+;undefinedCall.lsp: A call of an undefined function does not hide the type errors of main.
+(void main () (
+	(int x 1)
+	(undefined x)
+	(set x "abc")
+))
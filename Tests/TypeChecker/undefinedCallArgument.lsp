@@ -0,0 +1,6 @@
+;undefinedCallArgument.lsp: A call of an undefined function within an argument does not hide the type errors of main.
+(void main () (
+	(int x 1)
+	(println (undefined))
+	(set x "abc")
+))
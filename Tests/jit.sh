@@ -0,0 +1,39 @@
+#!/bin/bash
+#
+# FILE:		jit.sh
+#
+# REMARKS:	Executes every program of the directory "Jit" once with the engine "interpreter" and once with the engine "jit"
+#			and compares the output (including the error messages) of both executions.
+#
+# USAGE:	Tests/jit.sh [interpreter]
+#			The interpreter is the compiled executable of "src/main.cpp".
+#
+
+cd "$(dirname "$0")" || exit 1
+if [ $# -ne 1 ] || [ ! -x "$1" ]; then
+	echo "Usage: $0 [interpreter]" >&2
+	exit 2
+fi
+INTERPRETER="$(cd "$(dirname "$1")" && pwd)/$(basename "$1")"
+
+#Executes the passed file with the passed engine and prints everything after the confirmation of the engine:
+execute() {
+	printf "engine %s\nexecute %s\nexit\n" "$2" "$1" | (cd Jit && "$INTERPRETER" 2>&1) | sed -e '1,/is now executed by/d' -e 's/^interpreter>//' | tail -n +2
+}
+
+nFailed=0
+nPassed=0
+for sFile in Jit/*.lsp; do
+	sName="$(basename "$sFile")"
+	sExpected="$(execute "$sName" interpreter)"
+	sActual="$(execute "$sName" jit)"
+	if [ "$sExpected" == "$sActual" ]; then
+		nPassed=$((nPassed + 1))
+	else
+		nFailed=$((nFailed + 1))
+		echo "FAILED: $sName"
+		diff <(echo "$sExpected") <(echo "$sActual") | head -20
+	fi
+done
+echo "$nPassed passed, $nFailed failed."
+[ $nFailed -eq 0 ]
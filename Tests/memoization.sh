@@ -0,0 +1,43 @@
+#!/bin/bash
+#
+# FILE:		memoization.sh
+#
+# REMARKS:	Executes every program of the directory "Memoization" with enabled memoization and the engines "interpreter"
+#			and "jit" and compares the output (including the error messages) with the file of the same name and the
+#			extension ".txt". Every execution may only use 48 MB of virtual memory, so that an execution fails, whose
+#			memoization does not run in constant memory (e.g. for a tail-recursive function).
+#
+# USAGE:	Tests/memoization.sh [interpreter]
+#			The interpreter is the compiled executable of "src/main.cpp".
+#
+
+cd "$(dirname "$0")" || exit 1
+if [ $# -ne 1 ] || [ ! -x "$1" ]; then
+	echo "Usage: $0 [interpreter]" >&2
+	exit 2
+fi
+INTERPRETER="$(cd "$(dirname "$1")" && pwd)/$(basename "$1")"
+
+#Executes the passed file with the passed engine and prints everything after the confirmation of the engine:
+execute() {
+	printf "memoize on\nengine %s\nexecute %s\nexit\n" "$2" "$1" | (cd Memoization && ulimit -v 49152 && timeout 60 "$INTERPRETER" 2>&1) | sed -e '1,/is now executed by/d' -e 's/^interpreter>//' | tail -n +2
+}
+
+nFailed=0
+nPassed=0
+for sFile in Memoization/*.lsp; do
+	sName="$(basename "$sFile")"
+	sExpected="$(cat "${sFile%.lsp}.txt")"
+	for sEngine in interpreter jit; do
+		sActual="$(execute "$sName" $sEngine)"
+		if [ "$sExpected" == "$sActual" ]; then
+			nPassed=$((nPassed + 1))
+		else
+			nFailed=$((nFailed + 1))
+			echo "FAILED: $sName with engine $sEngine"
+			diff <(echo "$sExpected") <(echo "$sActual") | head -20
+		fi
+	done
+done
+echo "$nPassed passed, $nFailed failed."
+[ $nFailed -eq 0 ]
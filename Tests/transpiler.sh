@@ -0,0 +1,76 @@
+#!/bin/bash
+#
+# FILE:		transpiler.sh
+#
+# REMARKS:	Transpiles every example of the documentation (every Lisp-codeblock of "Documentation/Lisp", which contains a
+#			main-function) with the command "TRANSPILE", compiles the C++ sourcecode and compares the output (including
+#			the error messages) of the compiled program with the output of the command "EXECUTE". Examples, which cannot
+#			be transpiled (e.g. because they spawn tasks), are skipped.
+#
+# USAGE:	Tests/transpiler.sh [interpreter]
+#			The interpreter is the compiled executable of "src/main.cpp". The C++ compiler can be changed through the
+#			environment variable CXX (g++ by default).
+#
+
+cd "$(dirname "$0")" || exit 1
+if [ $# -ne 1 ] || [ ! -x "$1" ]; then
+	echo "Usage: $0 [interpreter]" >&2
+	exit 2
+fi
+INTERPRETER="$(cd "$(dirname "$1")" && pwd)/$(basename "$1")"
+COMPILER="${CXX:-g++}"
+WORK="$(mktemp -d)"
+trap 'rm -rf "$WORK"' EXIT
+
+#Writes every Lisp-codeblock of the passed markdown file into a file of it's own:
+extract() {
+	awk -v sPrefix="$WORK/$2" '
+		/^```[Ll]isp/ { bCode = 1; nBlock++; sFile = sprintf("%s-%02d.lsp", sPrefix, nBlock); next }
+		/^```/ { bCode = 0; next }
+		bCode { sub(/\r$/, ""); print > sFile }
+	' "$1"
+}
+
+for sDocument in ../Documentation/Lisp/*.md; do
+	sName="$(basename "$sDocument" .md)"
+	extract "$sDocument" "${sName// /}"
+done
+
+nFailed=0
+nPassed=0
+nSkipped=0
+sSkipped=""
+cd "$WORK" || exit 1
+for sFile in *.lsp; do
+	if ! grep -q "main" "$sFile"; then
+		#The codeblock is no complete program:
+		rm "$sFile"
+		continue
+	fi
+	sName="$(basename "$sFile" .lsp)"
+	#The interpreter crashes on some erroneous examples (which are skipped then):
+	(printf "transpile %s %s.cpp\nexit\n" "$sFile" "$sName" | "$INTERPRETER") > /dev/null 2>&1
+	if [ ! -f "$sName.cpp" ]; then
+		nSkipped=$((nSkipped + 1))
+		sSkipped="$sSkipped $sName"
+		continue
+	fi
+	if ! "$COMPILER" -std=c++17 -O2 "$sName.cpp" -o "$sName" 2> "$sName.log"; then
+		nFailed=$((nFailed + 1))
+		echo "FAILED: $sName does not compile:"
+		head -10 "$sName.log"
+		continue
+	fi
+	sExpected="$(printf "engine interpreter\nexecute %s\nexit\n" "$sFile" | "$INTERPRETER" 2>&1 | sed -e '1,/is now executed by/d' -e 's/^interpreter>//' | tail -n +2)"
+	sActual="$(./"$sName" 2>&1)"
+	if [ "$sExpected" == "$sActual" ]; then
+		nPassed=$((nPassed + 1))
+	else
+		nFailed=$((nFailed + 1))
+		echo "FAILED: $sName"
+		diff <(echo "$sExpected") <(echo "$sActual") | head -20
+	fi
+done
+[ $nSkipped -gt 0 ] && echo "Skipped:$sSkipped"
+echo "$nPassed passed, $nFailed failed, $nSkipped skipped."
+[ $nFailed -eq 0 ]
@@ -0,0 +1,39 @@
+#!/bin/bash
+#
+# FILE:		typechecker.sh
+#
+# REMARKS:	Checks the types of every program of the directory "TypeChecker" with the command "CHECK" and compares the
+#			reported errors with the file of the same name and the extension ".txt".
+#
+# USAGE:	Tests/typechecker.sh [interpreter]
+#			The interpreter is the compiled executable of "src/main.cpp".
+#
+
+cd "$(dirname "$0")" || exit 1
+if [ $# -ne 1 ] || [ ! -x "$1" ]; then
+	echo "Usage: $0 [interpreter]" >&2
+	exit 2
+fi
+INTERPRETER="$(cd "$(dirname "$1")" && pwd)/$(basename "$1")"
+
+#Checks the passed file and prints everything after the banner of the command prompt:
+check() {
+	printf "check %s\nexit\n" "$1" | (cd TypeChecker && "$INTERPRETER" 2>&1) | sed -e '1,/^=====/d' | tail -n +2 | sed -e 's/^interpreter>//'
+}
+
+nFailed=0
+nPassed=0
+for sFile in TypeChecker/*.lsp; do
+	sName="$(basename "$sFile")"
+	sExpected="$(cat "${sFile%.lsp}.txt")"
+	sActual="$(check "$sName")"
+	if [ "$sExpected" == "$sActual" ]; then
+		nPassed=$((nPassed + 1))
+	else
+		nFailed=$((nFailed + 1))
+		echo "FAILED: $sName"
+		diff <(echo "$sExpected") <(echo "$sActual") | head -20
+	fi
+done
+echo "$nPassed passed, $nFailed failed."
+[ $nFailed -eq 0 ]
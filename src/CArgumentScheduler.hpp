@@ -0,0 +1,215 @@
+/*
+FILE:		CArgumentScheduler.hpp
+
+REMARKS:	This file contains the class "CArgumentScheduler", which marks the arguments of function calls and the operands of
+			operations, that are evaluated by the CThreadPool.
+*/
+#pragma once
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "CAbstractSyntaxTree.hpp"
+#include "CFunction.hpp"
+#include "CLinkedList.hpp"
+#include "CRV.hpp"
+#include "CSourceAnalyzer.hpp"
+#include "CToken.hpp"
+#include "Variables/ErrorMessages.hpp"
+#include "Variables/OpcodeTypes.hpp"
+
+using namespace std;
+#define PARALLEL_COST_THRESHOLD 5000
+
+
+
+/**
+* The class "CArgumentScheduler" finds the function calls, whose arguments can be evaluated simultaneously. This is the
+* case, if every argument of the call is pure (see "CSourceAnalyzer::isPureArgument()"): Since the arguments neither print
+* anything nor change any variables, the order in which they are evaluated cannot be observed. Since the CInliner replaces
+* many calls with the operations of the called function, the operands of arithmetic and relational operations are
+* scheduled in the same way (the operands of "&" and "|" are not, since they are evaluated lazily).
+* Handing an argument over to another thread only pays off, if the argument is expensive. Therefore, only the arguments,
+* whose estimated cost reaches PARALLEL_COST_THRESHOLD, are forked, and a node is only marked as parallel, if at least two
+* of it's arguments are expensive. Every other argument is evaluated by the thread, which evaluates the node.
+* The opcodes of the abstract syntax trees have to be resolved before (see COpcodeResolver).
+*
+* @author	Christian-2003
+* @version	19.10.2026
+*/
+class CArgumentScheduler {
+private:
+	/**
+	* Stores the name of every function.
+	*/
+	vector<string> vsNames;
+
+	/**
+	* Stores whether each function is pure (same index as vsNames).
+	*/
+	vector<bool> vbPure;
+
+	/**
+	* Stores the estimated cost of each function (same index as vsNames).
+	*/
+	vector<unsigned long long> vnCosts;
+
+	/**
+	* Stores the number of parallel nodes.
+	*/
+	unsigned int nParallelNodes;
+
+	/**
+	* Stores the number of forked arguments.
+	*/
+	unsigned int nForkedArguments;
+
+	/**
+	* Analyzes the effects and costs of the arguments.
+	*/
+	CSourceAnalyzer analyzer;
+
+
+
+public:
+	/**
+	* The default constructor instantiates a new scheduler.
+	*/
+	CArgumentScheduler() {
+		nParallelNodes = 0;
+		nForkedArguments = 0;
+	}
+
+
+
+public:
+	/**
+	* This function marks every call and operation within the passed abstract syntax trees, whose arguments are evaluated
+	* simultaneously, together with the arguments, that are evaluated by other threads. If the functions cannot be read,
+	* the abstract syntax trees are returned unchanged, so that the error is reported by the CInterpreter.
+	*
+	* @param pltASTs	Abstract syntax trees, which resemble Lisp-functions.
+	* @return			Marked abstract syntax trees.
+	*/
+	CLinkedList<CAbstractSyntaxTree<CToken>> schedule(CLinkedList<CAbstractSyntaxTree<CToken>> pltASTs) {
+		CLinkedList<CFunction> lFunctions; //Stores every function.
+		for (unsigned int i = 0; i < pltASTs.size(); i++) {
+			CFunction function;
+			if (function.evaluateFunctionSourceCode(pltASTs[i]).getErrorMessage() != Error::SUCCESS) {
+				return pltASTs;
+			}
+			lFunctions.add(function);
+			vsNames.push_back(function.getName());
+		}
+		vbPure = analyzer.findPureFunctions(lFunctions);
+		vnCosts = analyzer.estimateCosts(lFunctions);
+
+		CLinkedList<CAbstractSyntaxTree<CToken>> ltScheduled; //Stores the marked abstract syntax trees.
+		for (unsigned int i = 0; i < pltASTs.size(); i++) {
+			CAbstractSyntaxTree<CToken> tFunction = pltASTs[i];
+			scheduleNode(tFunction);
+			ltScheduled.add(tFunction);
+		}
+		return ltScheduled;
+	}
+
+	/**
+	* Returns the number of calls and operations, whose arguments are evaluated simultaneously.
+	*
+	* @return	Number of parallel nodes.
+	*/
+	unsigned int getParallelNodes() {
+		return nParallelNodes;
+	}
+
+	/**
+	* Returns the number of arguments, which are evaluated by other threads.
+	*
+	* @return	Number of forked arguments.
+	*/
+	unsigned int getForkedArguments() {
+		return nForkedArguments;
+	}
+
+
+
+private:
+	/**
+	* This function marks the subtrees of the passed node and the node itself, if it's arguments are evaluated
+	* simultaneously.
+	*
+	* @param pAST	Abstract syntax tree, which is marked.
+	*/
+	void scheduleNode(CAbstractSyntaxTree<CToken>& pAST) {
+		CLinkedList<CAbstractSyntaxTree<CToken>> ltSubTrees = pAST.getSubTrees();
+		vector<CAbstractSyntaxTree<CToken>> vtSubTrees; //Stores the marked subtrees.
+		for (unsigned int i = 0; i < ltSubTrees.size(); i++) {
+			vtSubTrees.push_back(ltSubTrees[i]);
+			scheduleNode(vtSubTrees[i]);
+		}
+
+		CToken content = pAST.getContent();
+		vector<bool> vbForked = findForkedArguments(content, vtSubTrees); //Stores whether each argument is evaluated by another thread.
+		CLinkedList<CAbstractSyntaxTree<CToken>> ltScheduled; //Stores the subtrees of the node.
+		for (unsigned int i = 0; i < vtSubTrees.size(); i++) {
+			if (vbForked[i]) {
+				CToken argument = vtSubTrees[i].getContent();
+				argument.setForked(true);
+				vtSubTrees[i] = CAbstractSyntaxTree<CToken>(argument, vtSubTrees[i].getSubTrees());
+				content.setParallel(true);
+				nForkedArguments++;
+			}
+			ltScheduled.add(vtSubTrees[i]);
+		}
+		nParallelNodes += content.isParallel() ? 1 : 0;
+		pAST = CAbstractSyntaxTree<CToken>(content, ltScheduled);
+	}
+
+	/**
+	* This function finds the arguments of the passed node, which are evaluated by other threads. If the arguments of
+	* the node cannot be evaluated simultaneously, no argument is found.
+	*
+	* @param pContent		Head node.
+	* @param pvtArguments	Subtrees of the node.
+	* @return				Whether each subtree is evaluated by another thread.
+	*/
+	vector<bool> findForkedArguments(CToken& pContent, vector<CAbstractSyntaxTree<CToken>>& pvtArguments) {
+		vector<bool> vbExpensive(pvtArguments.size(), false); //Stores whether each argument is expensive.
+		bool bCall = pContent.getOpcode() == Opcode::OPCODE_IDENTIFIER && isFunction(pContent.getLexeme()); //Stores whether the node is a call.
+		bool bOperation = pContent.getOpcode() >= Opcode::OPCODE_ADD && pContent.getOpcode() <= Opcode::OPCODE_LESS_EQUAL; //Stores whether the node is an eager operation.
+		if (!(bCall || bOperation) || pvtArguments.size() < 2) {
+			//The node does not have multiple arguments, which are evaluated eagerly:
+			return vbExpensive;
+		}
+		unsigned int nExpensive = 0; //Stores the number of expensive arguments.
+		for (unsigned int i = 0; i < pvtArguments.size(); i++) {
+			if (!analyzer.isPureArgument(pvtArguments[i], vsNames, vbPure)) {
+				//The order of the arguments can be observed:
+				return vector<bool>(pvtArguments.size(), false);
+			}
+			vbExpensive[i] = analyzer.estimateCost(pvtArguments[i], vsNames, vnCosts) >= PARALLEL_COST_THRESHOLD;
+			nExpensive += vbExpensive[i] ? 1 : 0;
+		}
+		if (nExpensive < 2) {
+			//Only one thread would be busy:
+			return vector<bool>(pvtArguments.size(), false);
+		}
+		return vbExpensive;
+	}
+
+	/**
+	* This function returns whether a function has the passed name.
+	*
+	* @param psName	Name of the function.
+	* @return		Whether the function exists.
+	*/
+	bool isFunction(string psName) {
+		for (unsigned int i = 0; i < vsNames.size(); i++) {
+			if (vsNames[i] == psName) {
+				return true;
+			}
+		}
+		return false;
+	}
+};
@@ -0,0 +1,323 @@
+/*
+FILE:		CChannel.hpp
+
+REMARKS:	This file contains the class "CChannel", which is a bounded queue, through which multiple threads send values to
+			multiple other threads without locking each other.
+*/
+#pragma once
+
+#include <iostream>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "CThreadPool.hpp"
+#include "CToken.hpp"
+
+using namespace std;
+#define CHANNEL_SPIN_ITERATIONS 64
+#define CHANNEL_CACHE_LINE 64
+
+
+
+/**
+* The class "CChannel" stores the values, which have been sent but not received yet, in a ring buffer, whose size is a
+* power of two. Every cell of the ring buffer has a sequence number, which tells the senders and the receivers, whether
+* the cell is free or stores a value:
+*	- A sender reserves the cell at position n by incrementing the position of the senders from n to n + 1, if the
+*	  sequence number of the cell equals n. After the value has been stored, the sequence number is set to n + 1.
+*	- A receiver reserves the cell at position n by incrementing the position of the receivers from n to n + 1, if the
+*	  sequence number of the cell equals n + 1. After the value has been taken, the sequence number is set to the next
+*	  position of a sender, that will use the cell (n + size).
+* A sender does not reserve a cell, while the channel already stores as many values as requested, since the size of the
+* ring buffer may exceed the requested capacity.
+* Therefore, neither a send nor a receive needs a lock, as long as the channel is neither full nor empty. The positions of
+* the senders and of the receivers are stored in different cache lines, so that the senders do not slow down the
+* receivers.
+* The blocking functions retry for CHANNEL_SPIN_ITERATIONS times, before the thread sleeps until another thread
+* receives or sends a value. Since only sleeping threads take the lock, a thread, which sends or receives a value,
+* only wakes up the other threads, if one of them sleeps.
+*
+* @author	Christian-2003
+* @version	19.10.2026
+*/
+class CChannel {
+private:
+	/**
+	* The class "CCell" stores a single value of the ring buffer.
+	*/
+	class CCell {
+	public:
+		/**
+		* Stores the sequence number, which tells whether the cell is free or stores a value.
+		*/
+		atomic<size_t> nSequence;
+
+		/**
+		* Stores the value, which has been sent.
+		*/
+		CToken value;
+	};
+
+
+
+private:
+	/**
+	* Stores the cells of the ring buffer.
+	*/
+	vector<CCell> vCells;
+
+	/**
+	* Stores the size of the ring buffer minus one, with which a position is converted into the index of a cell.
+	*/
+	size_t nMask;
+
+	/**
+	* Stores the number of values, which can be stored by the channel.
+	*/
+	size_t nCapacity;
+
+	/**
+	* Stores the position, at which the next value is sent.
+	*/
+	alignas(CHANNEL_CACHE_LINE) atomic<size_t> nSendPosition;
+
+	/**
+	* Stores the position, from which the next value is received.
+	*/
+	alignas(CHANNEL_CACHE_LINE) atomic<size_t> nReceivePosition;
+
+	/**
+	* Stores the number of threads, which sleep until a value is received or sent.
+	*/
+	alignas(CHANNEL_CACHE_LINE) atomic<unsigned int> nSleepingThreads;
+
+	/**
+	* Locks the sleeping threads, so that they cannot miss a notification.
+	*/
+	mutex sleepLock;
+
+	/**
+	* Wakes up the sleeping threads, if a value is received or sent.
+	*/
+	condition_variable changed;
+
+
+
+public:
+	/**
+	* This constructor instantiates a new channel, which can store the passed number of values.
+	*
+	* @param pnCapacity	Capacity of the channel (at least 1).
+	*/
+	CChannel(size_t pnCapacity) : vCells(roundCapacity(pnCapacity)) {
+		nMask = vCells.size() - 1;
+		nCapacity = pnCapacity > 0 ? pnCapacity : 1;
+		for (size_t i = 0; i < vCells.size(); i++) {
+			vCells[i].nSequence.store(i, memory_order_relaxed);
+		}
+		nSendPosition = 0;
+		nReceivePosition = 0;
+		nSleepingThreads = 0;
+	}
+
+
+
+public:
+	/**
+	* This function sends the passed value, if the channel is not full.
+	*
+	* @param pValue	Value, which is sent.
+	* @return		Whether the value has been sent.
+	*/
+	bool trySend(const CToken& pValue) {
+		if (!push(pValue)) {
+			return false;
+		}
+		wakeUp();
+		return true;
+	}
+
+	/**
+	* This function receives a value, if the channel is not empty.
+	*
+	* @param pValue	Token, into which the received value is moved.
+	* @return		Whether a value has been received.
+	*/
+	bool tryReceive(CToken& pValue) {
+		if (!pop(pValue)) {
+			return false;
+		}
+		wakeUp();
+		return true;
+	}
+
+	/**
+	* This function sends the passed value, once the channel is not full. A thread of the passed pool hands it's slot over
+	* to another thread, while it sleeps.
+	*
+	* @param pValue	Value, which is sent.
+	* @param ppPool	Thread pool, which executes the tasks of the program (nullptr, if there is none).
+	*/
+	void send(const CToken& pValue, CThreadPool* ppPool) {
+		wait([this, &pValue]() { return push(pValue); }, ppPool);
+		wakeUp();
+	}
+
+	/**
+	* This function receives a value, once the channel is not empty. A thread of the passed pool hands it's slot over to
+	* another thread, while it sleeps.
+	*
+	* @param ppPool	Thread pool, which executes the tasks of the program (nullptr, if there is none).
+	* @return		Received value.
+	*/
+	CToken receive(CThreadPool* ppPool) {
+		CToken value;
+		wait([this, &value]() { return pop(value); }, ppPool);
+		wakeUp();
+		return value;
+	}
+
+	/**
+	* Returns the number of values, which can be stored by the channel.
+	*
+	* @return	Capacity of the channel.
+	*/
+	size_t getCapacity() {
+		return nCapacity;
+	}
+
+
+
+private:
+	/**
+	* This function stores the passed value in the next cell, if the cell is free and the channel stores less values than
+	* it's capacity. The sleeping threads are not woken up, since the function is retried by a sleeping thread while it
+	* holds the lock.
+	*
+	* @param pValue	Value, which is sent.
+	* @return		Whether the value has been stored.
+	*/
+	bool push(const CToken& pValue) {
+		size_t nPosition = nSendPosition.load(memory_order_relaxed); //Stores the position, which is reserved.
+		CCell* pCell; //Stores the cell at the position.
+		while (true) {
+			size_t nReceived = nReceivePosition.load(memory_order_acquire); //Stores the position of the receivers.
+			if (nPosition >= nReceived && nPosition - nReceived >= nCapacity) {
+				//The channel stores as many values as requested (the receivers only move forward, so that the check
+				//cannot admit too many values):
+				return false;
+			}
+			pCell = &vCells[nPosition & nMask];
+			size_t nSequence = pCell->nSequence.load(memory_order_acquire);
+			long long nDifference = (long long)nSequence - (long long)nPosition;
+			if (nDifference == 0) {
+				if (nSendPosition.compare_exchange_weak(nPosition, nPosition + 1, memory_order_relaxed)) {
+					break;
+				}
+			}
+			else if (nDifference < 0) {
+				//The cell still stores the value, which has been sent one round before:
+				return false;
+			}
+			else {
+				//Another sender has reserved the cell:
+				nPosition = nSendPosition.load(memory_order_relaxed);
+			}
+		}
+		pCell->value = pValue;
+		pCell->nSequence.store(nPosition + 1, memory_order_release);
+		return true;
+	}
+
+	/**
+	* This function takes the value from the next cell, if the cell stores a value. The sleeping threads are not woken
+	* up, since the function is retried by a sleeping thread while it holds the lock.
+	*
+	* @param pValue	Token, into which the value is moved.
+	* @return		Whether a value has been taken.
+	*/
+	bool pop(CToken& pValue) {
+		size_t nPosition = nReceivePosition.load(memory_order_relaxed); //Stores the position, which is reserved.
+		CCell* pCell; //Stores the cell at the position.
+		while (true) {
+			pCell = &vCells[nPosition & nMask];
+			size_t nSequence = pCell->nSequence.load(memory_order_acquire);
+			long long nDifference = (long long)nSequence - (long long)(nPosition + 1);
+			if (nDifference == 0) {
+				if (nReceivePosition.compare_exchange_weak(nPosition, nPosition + 1, memory_order_relaxed)) {
+					break;
+				}
+			}
+			else if (nDifference < 0) {
+				//No value has been sent to the cell yet:
+				return false;
+			}
+			else {
+				//Another receiver has reserved the cell:
+				nPosition = nReceivePosition.load(memory_order_relaxed);
+			}
+		}
+		pValue = move(pCell->value);
+		pCell->nSequence.store(nPosition + nMask + 1, memory_order_release);
+		return true;
+	}
+
+	/**
+	* This function retries the passed operation until it succeeds. After CHANNEL_SPIN_ITERATIONS attempts, the thread
+	* sleeps until another thread has received or sent a value.
+	*
+	* @param pOperation	Send or receive, which returns whether it succeeded.
+	* @param ppPool		Thread pool, whose slot is handed over while sleeping (nullptr, if there is none).
+	*/
+	template<typename T>
+	void wait(T pOperation, CThreadPool* ppPool) {
+		for (unsigned int i = 0; i < CHANNEL_SPIN_ITERATIONS; i++) {
+			if (pOperation()) {
+				return;
+			}
+			this_thread::yield();
+		}
+		if (ppPool != nullptr) {
+			ppPool->suspend();
+		}
+		{
+			unique_lock<mutex> lock(sleepLock);
+			nSleepingThreads++;
+			//The operation is retried after the counter has been incremented, so that no notification is missed:
+			atomic_thread_fence(memory_order_seq_cst);
+			changed.wait(lock, pOperation);
+			nSleepingThreads--;
+		}
+		if (ppPool != nullptr) {
+			ppPool->resume();
+		}
+	}
+
+	/**
+	* This function wakes up the sleeping threads, after a value has been received or sent.
+	*/
+	void wakeUp() {
+		atomic_thread_fence(memory_order_seq_cst);
+		if (nSleepingThreads.load(memory_order_relaxed) > 0) {
+			lock_guard<mutex> lock(sleepLock);
+			changed.notify_all();
+		}
+	}
+
+	/**
+	* This function rounds the passed capacity up to the next power of two, which is the size of the ring buffer.
+	*
+	* @param pnCapacity	Requested capacity.
+	* @return			Size of the ring buffer.
+	*/
+	static size_t roundCapacity(size_t pnCapacity) {
+		size_t nSize = 2; //Stores the size of the ring buffer.
+		while (nSize < pnCapacity) {
+			nSize *= 2;
+		}
+		return nSize;
+	}
+};
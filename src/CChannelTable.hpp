@@ -0,0 +1,97 @@
+/*
+FILE:		CChannelTable.hpp
+
+REMARKS:	This file contains the class "CChannelTable", which stores every channel, that has been created by the
+			Lisp-sourcecode.
+*/
+#pragma once
+
+#include <iostream>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "CChannel.hpp"
+
+using namespace std;
+
+
+
+/**
+* The class "CChannelTable" stores every channel, which has been created during the execution of a program. A channel is
+* identified by it's handle, which is the integer, that is returned by "make-channel" and passed to "send" and "recv".
+* Like the handles of tasks, handles start at 1, so that a variable, which has been declared without a value, cannot
+* resemble a channel.
+* The table is shared by the interpreters of every thread, therefore it is locked, whenever a channel is added or found.
+* The channels themselves are never removed until the table is cleared, so that they can be used without the lock.
+*
+* @author	Christian-2003
+* @version	19.10.2026
+*/
+class CChannelTable {
+private:
+	/**
+	* Stores every channel (the channel with handle n is stored at index n - 1).
+	*/
+	deque<unique_ptr<CChannel>> lChannels;
+
+	/**
+	* Locks the channels, since they are created by multiple threads.
+	*/
+	mutex lock;
+
+
+
+public:
+	/**
+	* This function adds a new channel with the passed capacity to the table.
+	*
+	* @param pnCapacity	Capacity of the channel.
+	* @return			Handle of the channel.
+	*/
+	unsigned int add(size_t pnCapacity) {
+		unique_ptr<CChannel> channel = make_unique<CChannel>(pnCapacity);
+		lock_guard<mutex> guard(lock);
+		lChannels.push_back(move(channel));
+		return lChannels.size();
+	}
+
+	/**
+	* This function returns the channel with the passed handle.
+	*
+	* @param pnHandle	Handle of the channel.
+	* @return			Channel or nullptr, if no channel has the handle.
+	*/
+	CChannel* find(unsigned long long pnHandle) {
+		lock_guard<mutex> guard(lock);
+		if (pnHandle == 0 || pnHandle > lChannels.size()) {
+			return nullptr;
+		}
+		return lChannels[pnHandle - 1].get();
+	}
+
+	/**
+	* This function returns the channel, whose handle is stored in the passed lexeme.
+	*
+	* @param psHandle	Lexeme of an integer.
+	* @return			Channel or nullptr, if no channel has the handle.
+	*/
+	CChannel* find(string psHandle) {
+		try {
+			return find(stoull(psHandle));
+		}
+		catch (const exception&) {
+			//The integer is negative or out of range:
+			return nullptr;
+		}
+	}
+
+	/**
+	* This function removes every channel, before a new program is executed.
+	*/
+	void clear() {
+		lock_guard<mutex> guard(lock);
+		lChannels.clear();
+	}
+};
@@ -0,0 +1,1615 @@
+/*
+FILE:		CClosureCompiler.hpp
+
+REMARKS:	This file contains the class "CClosureCompiler", which converts every Lisp-function into a tree of pre-bound C++
+			callables, which can be executed without evaluating the abstract syntax trees again.
+*/
+#pragma once
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <functional>
+
+#include "CAbstractSyntaxTree.hpp"
+#include "CFunction.hpp"
+#include "CLinkedList.hpp"
+#include "CRV.hpp"
+#include "CToken.hpp"
+#include "CValue.hpp"
+#include "CValueOperations.hpp"
+#include "Variables/ErrorMessages.hpp"
+#include "Variables/KeywordTypes.hpp"
+#include "Variables/TokenTypes.hpp"
+
+using namespace std;
+
+
+
+class CCompiledFunction;
+
+
+
+/**
+* Instances of this class resemble the variables of a single function call. Every variable is resolved to a slot
+* within the frame while compiling, so that no variable needs to be searched by it's name.
+*
+* @author	Christian-2003
+* @version	19.10.2026
+*/
+class CClosureFrame {
+private:
+	/**
+	* Stores the value of every variable (parameters first).
+	*/
+	vector<CValue> lSlots;
+
+	/**
+	* Stores the function, which is called in tail position and executed within this frame.
+	*/
+	CCompiledFunction* pTailFunction;
+
+
+
+public:
+	/**
+	* This constructor instantiates a new frame with the passed number of slots.
+	*
+	* @param pnSize	Number of slots.
+	*/
+	CClosureFrame(unsigned int pnSize) : lSlots(pnSize) {
+		pTailFunction = nullptr;
+	}
+
+
+
+public:
+	/**
+	* Returns the slot at the passed index.
+	*
+	* @param pnIndex	Index of the slot.
+	* @return			Value of the slot.
+	*/
+	CValue& getSlot(unsigned int pnIndex) {
+		return lSlots[pnIndex];
+	}
+
+	/**
+	* Returns the function, which has been called in tail position.
+	*
+	* @return	Function, which is executed within this frame.
+	*/
+	CCompiledFunction* getTailFunction() {
+		return pTailFunction;
+	}
+
+	/**
+	* Reuses the frame for the passed function, which is called in tail position. The variables of the calling function
+	* are discarded, the passed arguments occupy the first slots.
+	*
+	* @param pFunction		Called function.
+	* @param pnSize			Number of slots, which are needed for a call of the function.
+	* @param plArguments	Arguments of the call.
+	*/
+	void reuse(CCompiledFunction* pFunction, unsigned int pnSize, vector<CValue>& plArguments) {
+		lSlots.assign(pnSize, CValue());
+		for (unsigned int i = 0; i < plArguments.size(); i++) {
+			lSlots[i] = plArguments[i];
+		}
+		pTailFunction = pFunction;
+	}
+};
+
+
+
+/**
+* A closure evaluates a single node of an abstract syntax tree. The result (or the token which caused an error) is written
+* into the passed value, while the error message is returned.
+*/
+typedef function<short int(CClosureFrame&, CValue&)> Closure;
+
+
+
+/**
+* Instances of this class resemble a compiled expression together with the type of the value it produces. The type
+* is only known if the expression produces a primitive datatype, otherwise it is Token::UNKNOWN.
+*
+* @author	Christian-2003
+* @version	19.10.2026
+*/
+class CCompiledExpression {
+private:
+	/**
+	* Stores the closure of the expression.
+	*/
+	Closure closure;
+
+	/**
+	* Stores the type of the expression's value.
+	*/
+	short int nType;
+
+
+
+public:
+	/**
+	* This default constructor is just in place in order not to get an error message when used as template-type of an CRV.
+	*/
+	CCompiledExpression() {
+		nType = Token::UNKNOWN;
+	}
+
+	/**
+	* This constructor instantiates a new compiled expression.
+	*
+	* @param pClosure	Closure of the expression.
+	* @param pnType		Type of the expression's value.
+	*/
+	CCompiledExpression(Closure pClosure, short int pnType) {
+		closure = pClosure;
+		nType = pnType;
+	}
+
+
+
+public:
+	/**
+	* Returns the closure of the expression.
+	*
+	* @return	Closure.
+	*/
+	Closure getClosure() {
+		return closure;
+	}
+
+	/**
+	* Returns the type of the expression's value.
+	*
+	* @return	Type of the value.
+	*/
+	short int getType() {
+		return nType;
+	}
+};
+
+
+
+/**
+* Instances of this class resemble a compiled Lisp-function.
+*
+* @author	Christian-2003
+* @version	19.10.2026
+*/
+class CCompiledFunction {
+private:
+	/**
+	* Stores the return type of the function.
+	*/
+	short int nReturnType;
+
+	/**
+	* Stores the types of every parameter.
+	*/
+	vector<short int> lParameterTypes;
+
+	/**
+	* Stores the number of slots, which are needed for a call of this function.
+	*/
+	unsigned int nFrameSize;
+
+	/**
+	* Stores the closure of every expression of the function.
+	*/
+	vector<Closure> lBody;
+
+
+
+public:
+	/**
+	* The default constructor instantiates a new empty function.
+	*/
+	CCompiledFunction() {
+		nReturnType = Token::U_VOID;
+		nFrameSize = 0;
+	}
+
+
+
+public:
+	/**
+	* Returns the return type of the function.
+	*
+	* @return	Return type.
+	*/
+	short int getReturnType() {
+		return nReturnType;
+	}
+
+	/**
+	* Returns the types of the function's parameters.
+	*
+	* @return	Types of the parameters.
+	*/
+	vector<short int>& getParameterTypes() {
+		return lParameterTypes;
+	}
+
+	/**
+	* Returns the number of slots, which are needed for a call of this function.
+	*
+	* @return	Size of the frame.
+	*/
+	unsigned int getFrameSize() {
+		return nFrameSize;
+	}
+
+	/**
+	* Returns the closures of the function's expressions.
+	*
+	* @return	Body of the function.
+	*/
+	vector<Closure>& getBody() {
+		return lBody;
+	}
+
+	/**
+	* Changes the return type of the function.
+	*
+	* @param pnReturnType	Return type.
+	*/
+	void setReturnType(short int pnReturnType) {
+		nReturnType = pnReturnType;
+	}
+
+	/**
+	* Changes the number of slots, which are needed for a call of this function.
+	*
+	* @param pnFrameSize	Size of the frame.
+	*/
+	void setFrameSize(unsigned int pnFrameSize) {
+		nFrameSize = pnFrameSize;
+	}
+};
+
+
+
+/**
+* The class "CClosureCompiler" converts every node of the abstract syntax trees of the Lisp-functions exactly once into a
+* closure. Operators, the number of operands, the types of the operands and the slots of the variables are resolved while
+* compiling, so that the execution is a chain of calls without any string comparisons.
+* The compiled code behaves exactly like the CInterpreter (including the error messages). If the sourcecode contains a
+* construct, whose behaviour depends on the interpreter's list of variables in a way which cannot be resolved while
+* compiling, the compilation returns Error::Interpreter::INFO_ENGINE_UNSUPPORTED and the sourcecode should be executed
+* by the CInterpreter instead.
+*
+* @author	Christian-2003
+* @version	19.10.2026
+*/
+class CClosureCompiler {
+private:
+	/**
+	* Stores every Lisp-function, which is compiled.
+	*/
+	vector<CFunction> lFunctions;
+
+	/**
+	* Stores every compiled function (same index as lFunctions).
+	*/
+	vector<CCompiledFunction> lCompiledFunctions;
+
+	/**
+	* Stores the name and slot of every variable, which is visible at the currently compiled node.
+	*/
+	vector<pair<string, unsigned int>> lScope;
+
+	/**
+	* Stores the declared type of every slot of the currently compiled function.
+	*/
+	vector<short int> lSlotTypes;
+
+	/**
+	* Stores whether the currently compiled function returns a value whose type is not known while compiling.
+	*/
+	bool bUnknownReturnType;
+
+	/**
+	* Stores the index of the currently compiled function.
+	*/
+	unsigned int nFunction;
+
+	/**
+	* Stores the filename of the sourcecode.
+	*/
+	string sFilename;
+
+	/**
+	* Implements the operations.
+	*/
+	CValueOperations operations;
+
+	/**
+	* Stores the stream, into which the compiled program prints it's output.
+	*/
+	ostream* pOutput;
+
+
+
+public:
+	/**
+	* The default constructor instantiates a new closure compiler.
+	*/
+	CClosureCompiler() {
+		bUnknownReturnType = false;
+		nFunction = 0;
+		sFilename = "";
+		pOutput = &cout;
+	}
+
+	/**
+	* The closures reference the compiler, which is why it must never be copied.
+	*/
+	CClosureCompiler(const CClosureCompiler&) = delete;
+
+
+
+public:
+	/**
+	* This function changes, whether the compiled operations "&" and "|" skip their remaining operands once the result is
+	* decided.
+	*
+	* @param pbShortCircuit	Whether the operands are evaluated lazily.
+	*/
+	void setShortCircuit(bool pbShortCircuit) {
+		operations.setShortCircuit(pbShortCircuit);
+	}
+
+	/**
+	* This function changes the stream, into which the compiled "print" and "println" print the values. It has to be
+	* changed before the functions are compiled.
+	*
+	* @param pOutputStream	Stream, into which the output is printed.
+	*/
+	void setOutput(ostream& pOutputStream) {
+		pOutput = &pOutputStream;
+	}
+
+
+
+public:
+	/**
+	* This function compiles every passed Lisp-function.
+	*
+	* @param plFunctions	Lisp-functions, which should be compiled.
+	* @return				Error message (Error::Interpreter::INFO_ENGINE_UNSUPPORTED if the sourcecode cannot be compiled).
+	*/
+	short int compile(CLinkedList<CFunction> plFunctions) {
+		lFunctions.clear();
+		for (CFunction current : plFunctions) {
+			lFunctions.push_back(current);
+		}
+		lCompiledFunctions.clear();
+		lCompiledFunctions.resize(lFunctions.size());
+
+		//Resolve the signature of every function, before any function call is compiled:
+		for (unsigned int i = 0; i < lFunctions.size(); i++) {
+			lCompiledFunctions[i].setReturnType(lFunctions[i].getReturnType());
+			CLinkedList<CVariable> lParameters = lFunctions[i].getParameters();
+			for (CVariable parameter : lParameters) {
+				if (!isPrimitive(parameter.getType())) {
+					//Parameter has no valid type:
+					return Error::Interpreter::INFO_ENGINE_UNSUPPORTED;
+				}
+				lCompiledFunctions[i].getParameterTypes().push_back(parameter.getType());
+			}
+		}
+
+		//Compile the function's expressions:
+		for (unsigned int i = 0; i < lFunctions.size(); i++) {
+			short int nErrorMessage = compileFunction(i);
+			if (nErrorMessage != Error::SUCCESS) {
+				return nErrorMessage;
+			}
+		}
+		return Error::SUCCESS;
+	}
+
+	/**
+	* This function executes the compiled function at the passed index, as the interpreter executes the main-function.
+	*
+	* @param pnFunctionIndex	Index of the function.
+	* @return					Error message and token, which caused the error.
+	*/
+	CRV<CToken> execute(unsigned int pnFunctionIndex) {
+		CCompiledFunction& function = lCompiledFunctions[pnFunctionIndex];
+		CClosureFrame frame(function.getFrameSize());
+		CValue result;
+		for (unsigned int i = 0; i < function.getBody().size(); i++) {
+			short int nErrorMessage = function.getBody()[i](frame, result);
+			if (nErrorMessage == Error::Interpreter::INFO_TAIL_CALL) {
+				//The returned call is executed, before the return statement terminates the main-function:
+				CValue name = result;
+				nErrorMessage = call(frame.getTailFunction(), frame, result, name);
+				if (nErrorMessage == Error::SUCCESS) {
+					nErrorMessage = Error::Interpreter::INFO_RETURN_STATEMENT_ENCOUNTERED;
+				}
+			}
+			if (nErrorMessage != Error::SUCCESS) {
+				//An error occured:
+				return CRV<CToken>(result.toToken(sFilename), nErrorMessage);
+			}
+		}
+		return CRV<CToken>(CToken(), Error::SUCCESS);
+	}
+
+
+
+private:
+	/**
+	* This function compiles the function at the passed index.
+	*
+	* @param pnIndex	Index of the function.
+	* @return			Error message.
+	*/
+	short int compileFunction(unsigned int pnIndex) {
+		CFunction function = lFunctions[pnIndex];
+		lScope.clear();
+		lSlotTypes.clear();
+		bUnknownReturnType = false;
+		nFunction = pnIndex;
+
+		//Parameters occupy the first slots:
+		CLinkedList<CVariable> lParameters = function.getParameters();
+		for (CVariable parameter : lParameters) {
+			if (findVariable(parameter.getName()) >= 0) {
+				//Multiple parameters with identical name:
+				return Error::Interpreter::INFO_ENGINE_UNSUPPORTED;
+			}
+			declareVariable(parameter.getName(), parameter.getType());
+		}
+
+		CLinkedList<CAbstractSyntaxTree<CToken>> lExpressions = function.getExpressions();
+		for (CAbstractSyntaxTree<CToken> expression : lExpressions) {
+			CRV<CCompiledExpression> rvCompiled = compileExpression(expression);
+			if (rvCompiled.getErrorMessage() != Error::SUCCESS) {
+				return rvCompiled.getErrorMessage();
+			}
+			lCompiledFunctions[pnIndex].getBody().push_back(rvCompiled.getContent().getClosure());
+		}
+
+		if (function.getReturnType() != Token::U_VOID && (!function.alwaysReturns() || bUnknownReturnType)) {
+			//The interpreter would return a value of unknown type:
+			return Error::Interpreter::INFO_ENGINE_UNSUPPORTED;
+		}
+		lCompiledFunctions[pnIndex].setFrameSize(lSlotTypes.size());
+		return Error::SUCCESS;
+	}
+
+
+
+private:
+	/**
+	* This function compiles an expression (equivalent to "CInterpreter::interpretExpression()").
+	*
+	* @param pAST	Abstract syntax tree of the expression.
+	* @return		Compiled expression.
+	*/
+	CRV<CCompiledExpression> compileExpression(CAbstractSyntaxTree<CToken> pAST) {
+		short int nType = pAST.getContent().getType();
+		if (pAST.getContent().getFilename() != "") {
+			sFilename = pAST.getContent().getFilename();
+		}
+		if (nType == Token::OPERATOR_ARITHMETIC || nType == Token::OPERATOR_RELATIONAL || nType == Token::OPERATOR_BOOL) {
+			return compileOperation(pAST);
+		}
+		else if (nType == Token::KEYWORD) {
+			return compileKeyword(pAST);
+		}
+		else if (nType == Token::IDENTIFIER) {
+			return compileIdentifier(pAST, false);
+		}
+		//Incorrect token found:
+		return constant(CValue(), Error::Interpreter::SYNTAX_I);
+	}
+
+
+
+private:
+	/**
+	* This function compiles an operation (equivalent to "CInterpreter::evaluateOperation()").
+	*
+	* @param pAST	Abstract syntax tree of the operation.
+	* @return		Compiled operation.
+	*/
+	CRV<CCompiledExpression> compileOperation(CAbstractSyntaxTree<CToken> pAST) {
+		CToken headNode = pAST.getContent();
+		CRV<CValue> rvHead = convertToken(headNode);
+		if (rvHead.getErrorMessage() != Error::SUCCESS) {
+			return CRV<CCompiledExpression>(CCompiledExpression(), rvHead.getErrorMessage());
+		}
+		if (!pAST.hasSubTrees()) {
+			//The AST has no subtrees -> The current node is returned:
+			return constant(rvHead.getContent(), Error::SUCCESS);
+		}
+
+		//Compile the operands:
+		vector<CCompiledExpression> lOperands;
+		CLinkedList<CAbstractSyntaxTree<CToken>> lSubTrees = pAST.getSubTrees();
+		for (CAbstractSyntaxTree<CToken> current : lSubTrees) {
+			CRV<CCompiledExpression> rvOperand;
+			if (isPrimitive(current.getContent().getType())) {
+				rvOperand = literal(current.getContent(), Error::SUCCESS);
+			}
+			else if (current.getContent().getType() == Token::IDENTIFIER) {
+				rvOperand = compileExpression(current);
+			}
+			else {
+				rvOperand = compileOperation(current);
+			}
+			if (rvOperand.getErrorMessage() != Error::SUCCESS) {
+				return rvOperand;
+			}
+			lOperands.push_back(rvOperand.getContent());
+		}
+
+		short int nHeadType = headNode.getType();
+		if (nHeadType == Token::OPERATOR_ARITHMETIC) {
+			return CRV<CCompiledExpression>(compileArithmetic(headNode.getLexeme(), lOperands), Error::SUCCESS);
+		}
+		else if (nHeadType == Token::OPERATOR_RELATIONAL) {
+			return CRV<CCompiledExpression>(compileRelational(headNode.getLexeme(), rvHead.getContent(), lOperands), Error::SUCCESS);
+		}
+		else if (nHeadType == Token::OPERATOR_BOOL) {
+			return CRV<CCompiledExpression>(compileLogical(headNode.getLexeme(), rvHead.getContent(), lOperands), Error::SUCCESS);
+		}
+
+		//Found invalid token -> The operands are evaluated nonetheless:
+		vector<Closure> lClosures = getClosures(lOperands);
+		CValue head = rvHead.getContent();
+		Closure closure = [lClosures, head](CClosureFrame& frame, CValue& result) {
+			for (unsigned int i = 0; i < lClosures.size(); i++) {
+				short int nErrorMessage = lClosures[i](frame, result);
+				if (nErrorMessage != Error::SUCCESS) {
+					return nErrorMessage;
+				}
+			}
+			result = head;
+			return (short int)Error::Interpreter::INCORRECT_TOKEN;
+		};
+		return CRV<CCompiledExpression>(CCompiledExpression(closure, Token::UNKNOWN), Error::SUCCESS);
+	}
+
+	/**
+	* This function compiles an arithmetic operation. If the types of the operands are known, the closure computes the
+	* result directly, otherwise the operands are checked while executing.
+	*
+	* @param psOperator	Arithmetic operator.
+	* @param plOperands	Compiled operands.
+	* @return			Compiled operation.
+	*/
+	CCompiledExpression compileArithmetic(string psOperator, vector<CCompiledExpression>& plOperands) {
+		char chOperator = psOperator[0];
+		vector<Closure> lClosures = getClosures(plOperands);
+		bool bIntegers = true;
+		bool bNumbers = true;
+		for (unsigned int i = 0; i < plOperands.size(); i++) {
+			bIntegers = bIntegers && plOperands[i].getType() == Token::U_INT;
+			bNumbers = bNumbers && (plOperands[i].getType() == Token::U_INT || plOperands[i].getType() == Token::U_DOUBLE);
+		}
+
+		if (bIntegers && plOperands.size() >= 2 && chOperator != '/') {
+			//Every operand is an integer:
+			Closure closure = [lClosures, chOperator](CClosureFrame& frame, CValue& result) {
+				short int nErrorMessage = lClosures[0](frame, result);
+				if (nErrorMessage != Error::SUCCESS) {
+					return nErrorMessage;
+				}
+				unsigned int nValue = (unsigned int)result.getInt();
+				CValue operand;
+				for (unsigned int i = 1; i < lClosures.size(); i++) {
+					nErrorMessage = lClosures[i](frame, operand);
+					if (nErrorMessage != Error::SUCCESS) {
+						result = operand;
+						return nErrorMessage;
+					}
+					switch (chOperator) {
+					case '+':
+						nValue += (unsigned int)operand.getInt();
+						break;
+					case '-':
+						nValue -= (unsigned int)operand.getInt();
+						break;
+					default:
+						nValue *= (unsigned int)operand.getInt();
+						break;
+					}
+				}
+				result.setInt((int)nValue);
+				return (short int)Error::SUCCESS;
+			};
+			return CCompiledExpression(closure, Token::U_INT);
+		}
+
+		else if (bNumbers && plOperands.size() >= 2) {
+			//Every operand is numeric and at least one is a double (or division):
+			Closure closure = [lClosures, chOperator](CClosureFrame& frame, CValue& result) {
+				short int nErrorMessage = lClosures[0](frame, result);
+				if (nErrorMessage != Error::SUCCESS) {
+					return nErrorMessage;
+				}
+				double dValue = result.getNumber();
+				if (chOperator == '/') {
+					//Every operand needs to be evaluated before checking for division by zero:
+					vector<CValue> lOperands(lClosures.size());
+					for (unsigned int i = 1; i < lClosures.size(); i++) {
+						nErrorMessage = lClosures[i](frame, lOperands[i]);
+						if (nErrorMessage != Error::SUCCESS) {
+							result = lOperands[i];
+							return nErrorMessage;
+						}
+					}
+					for (unsigned int i = 1; i < lClosures.size(); i++) {
+						if (lOperands[i].getNumber() == 0) {
+							result = lOperands[i];
+							return (short int)Error::Interpreter::CANNOT_DIVIDE_BY_ZERO;
+						}
+					}
+					for (unsigned int i = 1; i < lClosures.size(); i++) {
+						dValue = CValue::normalizeDouble(dValue / lOperands[i].getNumber());
+					}
+				}
+				else {
+					CValue operand;
+					for (unsigned int i = 1; i < lClosures.size(); i++) {
+						nErrorMessage = lClosures[i](frame, operand);
+						if (nErrorMessage != Error::SUCCESS) {
+							result = operand;
+							return nErrorMessage;
+						}
+						switch (chOperator) {
+						case '+':
+							dValue = CValue::normalizeDouble(dValue + operand.getNumber());
+							break;
+						case '-':
+							dValue = CValue::normalizeDouble(dValue - operand.getNumber());
+							break;
+						default:
+							dValue = CValue::normalizeDouble(dValue * operand.getNumber());
+							break;
+						}
+					}
+				}
+				result.setDouble(dValue);
+				return (short int)Error::SUCCESS;
+			};
+			return CCompiledExpression(closure, Token::U_DOUBLE);
+		}
+
+		//Types are checked while executing:
+		short int nType = Token::UNKNOWN;
+		if (chOperator == '/' || (bNumbers && (!bIntegers || plOperands.size() == 1))) {
+			nType = chOperator == '/' ? Token::U_DOUBLE : (bIntegers ? Token::U_INT : Token::U_DOUBLE);
+		}
+		else if (chOperator == '+' && (plOperands[0].getType() == Token::U_STRING || plOperands[0].getType() == Token::U_CHAR)) {
+			nType = Token::U_STRING;
+		}
+		if (nType == Token::U_INT && chOperator != '/' && plOperands.size() == 1 && plOperands[0].getType() != Token::U_INT) {
+			nType = Token::UNKNOWN;
+		}
+		Closure closure = [this, lClosures, chOperator](CClosureFrame& frame, CValue& result) {
+			vector<CValue> lOperands(lClosures.size());
+			for (unsigned int i = 0; i < lClosures.size(); i++) {
+				short int nErrorMessage = lClosures[i](frame, lOperands[i]);
+				if (nErrorMessage != Error::SUCCESS) {
+					result = lOperands[i];
+					return nErrorMessage;
+				}
+			}
+			switch (chOperator) {
+			case '+':
+				return operations.add(lOperands, result);
+			case '-':
+				return operations.subtract(lOperands, result);
+			case '*':
+				return operations.multiply(lOperands, result);
+			default:
+				return operations.divide(lOperands, result);
+			}
+		};
+		return CCompiledExpression(closure, nType);
+	}
+
+	/**
+	* This function compiles a relational operation.
+	*
+	* @param psOperator	Relational operator.
+	* @param pHead		Head node of the operation.
+	* @param plOperands	Compiled operands.
+	* @return			Compiled operation.
+	*/
+	CCompiledExpression compileRelational(string psOperator, CValue pHead, vector<CCompiledExpression>& plOperands) {
+		vector<Closure> lClosures = getClosures(plOperands);
+		if (plOperands.size() == 2 && isNumeric(plOperands[0].getType()) && isNumeric(plOperands[1].getType())) {
+			//Both operands are numeric:
+			Closure first = lClosures[0];
+			Closure second = lClosures[1];
+			unsigned int nLine = pHead.getLine();
+			short int nComparison = psOperator == "=" ? 0 : psOperator == "!" ? 1 : psOperator == ">" ? 2 : psOperator == "<" ? 3 : psOperator == ">=" ? 4 : 5;
+			Closure closure = [this, first, second, nComparison, nLine](CClosureFrame& frame, CValue& result) {
+				short int nErrorMessage = first(frame, result);
+				if (nErrorMessage != Error::SUCCESS) {
+					return nErrorMessage;
+				}
+				CValue operand;
+				nErrorMessage = second(frame, operand);
+				if (nErrorMessage != Error::SUCCESS) {
+					result = operand;
+					return nErrorMessage;
+				}
+				bool bResult = false;
+				switch (nComparison) {
+				case 0:
+					bResult = result.getNumber() == operand.getNumber();
+					break;
+				case 1:
+					bResult = !operations.equalLexemes(result, operand);
+					break;
+				case 2:
+					bResult = result.getNumber() > operand.getNumber();
+					break;
+				case 3:
+					bResult = result.getNumber() < operand.getNumber();
+					break;
+				case 4:
+					bResult = result.getNumber() >= operand.getNumber();
+					break;
+				default:
+					bResult = result.getNumber() <= operand.getNumber();
+					break;
+				}
+				result.setBool(bResult);
+				result.setLine(nLine);
+				return (short int)Error::SUCCESS;
+			};
+			return CCompiledExpression(closure, Token::U_BOOL);
+		}
+
+		//Types are checked while executing:
+		Closure closure = [this, lClosures, psOperator, pHead](CClosureFrame& frame, CValue& result) mutable {
+			vector<CValue> lOperands(lClosures.size());
+			for (unsigned int i = 0; i < lClosures.size(); i++) {
+				short int nErrorMessage = lClosures[i](frame, lOperands[i]);
+				if (nErrorMessage != Error::SUCCESS) {
+					result = lOperands[i];
+					return nErrorMessage;
+				}
+			}
+			return operations.compare(psOperator, pHead, lOperands, result);
+		};
+		return CCompiledExpression(closure, plOperands.size() == 2 && plOperands[0].getType() == plOperands[1].getType() && isPrimitive(plOperands[0].getType()) ? Token::U_BOOL : Token::UNKNOWN);
+	}
+
+	/**
+	* This function compiles a boolean operation.
+	*
+	* @param psOperator	Boolean operator.
+	* @param pHead		Head node of the operation.
+	* @param plOperands	Compiled operands.
+	* @return			Compiled operation.
+	*/
+	CCompiledExpression compileLogical(string psOperator, CValue pHead, vector<CCompiledExpression>& plOperands) {
+		vector<Closure> lClosures = getClosures(plOperands);
+		Closure closure = [this, lClosures, psOperator, pHead](CClosureFrame& frame, CValue& result) mutable {
+			vector<CValue> lOperands(lClosures.size());
+			for (unsigned int i = 0; i < lClosures.size(); i++) {
+				short int nErrorMessage = lClosures[i](frame, lOperands[i]);
+				if (nErrorMessage != Error::SUCCESS) {
+					result = lOperands[i];
+					return nErrorMessage;
+				}
+				if (i + 1 < lClosures.size() && operations.isDecided(psOperator, lOperands[i])) {
+					//The skipped operands are replaced with the deciding operand:
+					for (unsigned int j = i + 1; j < lClosures.size(); j++) {
+						lOperands[j] = lOperands[i];
+					}
+					break;
+				}
+			}
+			return operations.logical(psOperator, pHead, lOperands, result);
+		};
+		return CCompiledExpression(closure, plOperands.size() >= 2 ? Token::U_BOOL : Token::UNKNOWN);
+	}
+
+
+
+private:
+	/**
+	* This function compiles a keyword (equivalent to "CInterpreter::evaluateKeyword()").
+	*
+	* @param pAST	Abstract syntax tree of the keyword.
+	* @return		Compiled keyword.
+	*/
+	CRV<CCompiledExpression> compileKeyword(CAbstractSyntaxTree<CToken> pAST) {
+		CToken headNode = pAST.getContent();
+		CValue head(headNode);
+		if (!pAST.hasSubTrees()) {
+			//Erorr: The AST has no subtrees:
+			return constant(head, Error::Interpreter::EMPTY_AST_I);
+		}
+		CLinkedList<CAbstractSyntaxTree<CToken>> lASTs = pAST.getSubTrees();
+		string sKeyword = headNode.getLexeme();
+
+		if (sKeyword == Keyword::INT || sKeyword == Keyword::DOUBLE || sKeyword == Keyword::BOOL || sKeyword == Keyword::CHAR || sKeyword == Keyword::STRING) {
+			return compileDeclaration(pAST);
+		}
+		else if (sKeyword == Keyword::SET) {
+			return compileSet(pAST);
+		}
+		else if (sKeyword == Keyword::PRINT || sKeyword == Keyword::PRINTLN) {
+			vector<Closure> lClosures;
+			for (CAbstractSyntaxTree<CToken> current : lASTs) {
+				CRV<CCompiledExpression> rvArgument;
+				if (current.hasSubTrees() || current.getContent().getType() == Token::IDENTIFIER) {
+					rvArgument = compileExpression(current);
+				}
+				else if (isPrimitive(current.getContent().getType())) {
+					rvArgument = literal(current.getContent(), Error::SUCCESS);
+				}
+				else {
+					//Encountered invalid token:
+					rvArgument = literal(current.getContent(), Error::Interpreter::INCORRECT_TOKEN);
+				}
+				if (rvArgument.getErrorMessage() != Error::SUCCESS) {
+					return rvArgument;
+				}
+				lClosures.push_back(rvArgument.getContent().getClosure());
+			}
+			bool bLineBreak = sKeyword == Keyword::PRINTLN;
+			ostream* pStream = pOutput; //Stores the stream, into which the values are printed.
+			Closure closure = [lClosures, head, bLineBreak, pStream](CClosureFrame& frame, CValue& result) {
+				for (unsigned int i = 0; i < lClosures.size(); i++) {
+					short int nErrorMessage = lClosures[i](frame, result);
+					if (nErrorMessage != Error::SUCCESS) {
+						return nErrorMessage;
+					}
+					*pStream << result.getLexeme();
+				}
+				if (bLineBreak) {
+					*pStream << "\n";
+				}
+				result = head;
+				return (short int)Error::SUCCESS;
+			};
+			return CRV<CCompiledExpression>(CCompiledExpression(closure, Token::KEYWORD), Error::SUCCESS);
+		}
+		else if (sKeyword == Keyword::IF) {
+			return compileIf(pAST);
+		}
+		else if (sKeyword == Keyword::WHILE) {
+			return compileWhile(pAST);
+		}
+		else if (sKeyword == Keyword::RETURN) {
+			if (lASTs.size() != 1) {
+				//Too many values encountered which could be returned:
+				return constant(head, Error::Interpreter::TOO_MANY_VALUES_TO_RETURN);
+			}
+			CAbstractSyntaxTree<CToken> tReturnValue = lASTs.front();
+			if (!tReturnValue.hasSubTrees() && isPrimitive(tReturnValue.getContent().getType())) {
+				return literal(tReturnValue.getContent(), Error::Interpreter::INFO_RETURN_STATEMENT_ENCOUNTERED);
+			}
+			CRV<CCompiledExpression> rvValue;
+			if (tReturnValue.getContent().getType() == Token::IDENTIFIER) {
+				//A returned call may reuse the frame of the function:
+				rvValue = compileIdentifier(tReturnValue, true);
+			}
+			else {
+				rvValue = compileExpression(tReturnValue);
+			}
+			if (rvValue.getErrorMessage() != Error::SUCCESS) {
+				return rvValue;
+			}
+			if (!isPrimitive(rvValue.getContent().getType())) {
+				bUnknownReturnType = true;
+			}
+			Closure value = rvValue.getContent().getClosure();
+			Closure closure = [value](CClosureFrame& frame, CValue& result) {
+				short int nErrorMessage = value(frame, result);
+				if (nErrorMessage != Error::SUCCESS) {
+					return nErrorMessage;
+				}
+				return (short int)Error::Interpreter::INFO_RETURN_STATEMENT_ENCOUNTERED;
+			};
+			return CRV<CCompiledExpression>(CCompiledExpression(closure, Token::UNKNOWN), Error::SUCCESS);
+		}
+		//Found invalid keyword:
+		return constant(head, Error::Interpreter::INCORRECT_TOKEN);
+	}
+
+	/**
+	* This function compiles the declaration of a variable.
+	*
+	* @param pAST	Abstract syntax tree of the declaration.
+	* @return		Compiled declaration.
+	*/
+	CRV<CCompiledExpression> compileDeclaration(CAbstractSyntaxTree<CToken> pAST) {
+		CToken headNode = pAST.getContent();
+		CLinkedList<CAbstractSyntaxTree<CToken>> lASTs = pAST.getSubTrees();
+		CValue variableValue; //Stores the standard value of the new variable.
+		if (headNode.getLexeme() == Keyword::INT) {
+			variableValue = CValue(CToken("0", Token::U_INT));
+		}
+		else if (headNode.getLexeme() == Keyword::DOUBLE) {
+			variableValue = CValue(CToken("0.0", Token::U_DOUBLE));
+		}
+		else if (headNode.getLexeme() == Keyword::BOOL) {
+			variableValue = CValue(CToken("nil", Token::U_BOOL));
+		}
+		else if (headNode.getLexeme() == Keyword::CHAR) {
+			variableValue = CValue(CToken(" ", Token::U_CHAR));
+		}
+		else {
+			variableValue = CValue(CToken("", Token::U_STRING));
+		}
+		short int nVariableType = variableValue.getType();
+
+		if (lASTs.front().getContent().getType() != Token::IDENTIFIER) {
+			//Error: Incorrect token found:
+			return literal(lASTs.front().getContent(), Error::Interpreter::INCORRECT_TOKEN);
+		}
+		CValue variableName(lASTs.retrieve(0).getContent());
+		if (lASTs.size() > 1) {
+			//There are too many arguments with this declaration:
+			return constant(CValue(headNode), Error::Interpreter::TOO_MANY_ARGUMENTS);
+		}
+
+		Closure initializer;
+		if (lASTs.size() == 1) {
+			CToken initializerToken = lASTs.front().getContent();
+			if (isPrimitive(initializerToken.getType())) {
+				//Value can be used directly:
+				if (initializerToken.getType() != nVariableType) {
+					return literal(initializerToken, Error::produceConvertError(initializerToken.getType(), nVariableType));
+				}
+				CRV<CCompiledExpression> rvLiteral = literal(initializerToken, Error::SUCCESS);
+				if (rvLiteral.getErrorMessage() != Error::SUCCESS) {
+					return rvLiteral;
+				}
+				initializer = rvLiteral.getContent().getClosure();
+			}
+			else {
+				//Need to evaluate the token:
+				CRV<CCompiledExpression> rvValue = compileExpression(lASTs.front());
+				if (rvValue.getErrorMessage() != Error::SUCCESS) {
+					return rvValue;
+				}
+				if (!isPrimitive(rvValue.getContent().getType())) {
+					//The interpreter would not declare the variable, depending on the value's type:
+					return CRV<CCompiledExpression>(CCompiledExpression(), Error::Interpreter::INFO_ENGINE_UNSUPPORTED);
+				}
+				Closure value = rvValue.getContent().getClosure();
+				if (rvValue.getContent().getType() != nVariableType) {
+					short int nConvertError = Error::produceConvertError(rvValue.getContent().getType(), nVariableType);
+					Closure closure = [value, nConvertError](CClosureFrame& frame, CValue& result) {
+						short int nErrorMessage = value(frame, result);
+						if (nErrorMessage != Error::SUCCESS) {
+							return nErrorMessage;
+						}
+						return nConvertError;
+					};
+					return CRV<CCompiledExpression>(CCompiledExpression(closure, Token::UNKNOWN), Error::SUCCESS);
+				}
+				initializer = value;
+			}
+		}
+
+		if (findVariable(variableName.getLexeme()) >= 0) {
+			//Variable's name does already exist:
+			Closure closure = [initializer, variableName](CClosureFrame& frame, CValue& result) {
+				if (initializer) {
+					short int nErrorMessage = initializer(frame, result);
+					if (nErrorMessage != Error::SUCCESS) {
+						return nErrorMessage;
+					}
+				}
+				result = variableName;
+				return (short int)Error::Interpreter::VARIABLE_NAME_ALREADY_IN_USE;
+			};
+			return CRV<CCompiledExpression>(CCompiledExpression(closure, Token::IDENTIFIER), Error::SUCCESS);
+		}
+
+		unsigned int nSlot = declareVariable(variableName.getLexeme(), nVariableType);
+		Closure closure = [initializer, variableValue, variableName, nSlot](CClosureFrame& frame, CValue& result) {
+			if (initializer) {
+				short int nErrorMessage = initializer(frame, result);
+				if (nErrorMessage != Error::SUCCESS) {
+					return nErrorMessage;
+				}
+				frame.getSlot(nSlot) = result;
+			}
+			else {
+				frame.getSlot(nSlot) = variableValue;
+			}
+			result = variableName;
+			return (short int)Error::SUCCESS;
+		};
+		return CRV<CCompiledExpression>(CCompiledExpression(closure, Token::IDENTIFIER), Error::SUCCESS);
+	}
+
+	/**
+	* This function compiles the set-keyword.
+	*
+	* @param pAST	Abstract syntax tree of the set-keyword.
+	* @return		Compiled keyword.
+	*/
+	CRV<CCompiledExpression> compileSet(CAbstractSyntaxTree<CToken> pAST) {
+		CToken headNode = pAST.getContent();
+		CLinkedList<CAbstractSyntaxTree<CToken>> lASTs = pAST.getSubTrees();
+		if (lASTs.size() < 2) {
+			return constant(CValue(headNode), Error::Interpreter::NOT_ENOUGH_ARGUMENTS);
+		}
+		else if (lASTs.size() > 2) {
+			return constant(CValue(headNode), Error::Interpreter::TOO_MANY_ARGUMENTS);
+		}
+		else if (lASTs.front().getContent().getType() != Token::IDENTIFIER) {
+			return literal(lASTs.front().getContent(), Error::Interpreter::INCORRECT_TOKEN);
+		}
+		CValue variableName(lASTs.retrieve(0).getContent());
+
+		//Get the new value for the variable:
+		CRV<CCompiledExpression> rvValue;
+		if (isPrimitive(lASTs.front().getContent().getType())) {
+			rvValue = literal(lASTs.front().getContent(), Error::SUCCESS);
+		}
+		else {
+			rvValue = compileExpression(lASTs.front());
+		}
+		if (rvValue.getErrorMessage() != Error::SUCCESS) {
+			return rvValue;
+		}
+		Closure value = rvValue.getContent().getClosure();
+
+		int nSlot = findVariable(variableName.getLexeme());
+		if (nSlot < 0) {
+			//Variable does not exist:
+			Closure closure = [value, variableName](CClosureFrame& frame, CValue& result) {
+				short int nErrorMessage = value(frame, result);
+				if (nErrorMessage != Error::SUCCESS) {
+					return nErrorMessage;
+				}
+				result = variableName;
+				return (short int)Error::Interpreter::VARIABLE_DOES_NOT_EXIST;
+			};
+			return CRV<CCompiledExpression>(CCompiledExpression(closure, Token::IDENTIFIER), Error::SUCCESS);
+		}
+
+		short int nVariableType = lSlotTypes[nSlot];
+		Closure closure = [value, variableName, nSlot, nVariableType](CClosureFrame& frame, CValue& result) {
+			short int nErrorMessage = value(frame, result);
+			if (nErrorMessage != Error::SUCCESS) {
+				return nErrorMessage;
+			}
+			if (result.getType() != nVariableType) {
+				//Error: New value has different data-type:
+				nErrorMessage = Error::produceConvertError(result.getType(), nVariableType);
+			}
+			else {
+				frame.getSlot(nSlot) = result;
+			}
+			result = variableName;
+			return nErrorMessage;
+		};
+		return CRV<CCompiledExpression>(CCompiledExpression(closure, Token::IDENTIFIER), Error::SUCCESS);
+	}
+
+
+
+private:
+	/**
+	* This function compiles the condition of an if-statement or while-loop. The closure returns Error::SUCCESS and the value
+	* "t" or "nil" if the condition could be evaluated. If the condition cannot be converted into a boolean, the closure
+	* returns the error message of the interpreter, which is Error::SUCCESS for some datatypes. Therefore, the type of the
+	* returned value needs to be checked as well.
+	*
+	* @param pCondition	Abstract syntax tree of the condition.
+	* @return			Compiled condition.
+	*/
+	CRV<CCompiledExpression> compileCondition(CAbstractSyntaxTree<CToken> pCondition) {
+		if (!pCondition.hasSubTrees()) {
+			//No further evaluation needed:
+			CToken condToken = pCondition.getContent();
+			if (condToken.getType() != Token::U_BOOL) {
+				return literal(condToken, Error::produceConvertError(condToken.getType(), Token::U_BOOL));
+			}
+			return literal(condToken, Error::SUCCESS);
+		}
+		CRV<CCompiledExpression> rvCondition = compileExpression(pCondition);
+		if (rvCondition.getErrorMessage() != Error::SUCCESS) {
+			return rvCondition;
+		}
+		Closure condition = rvCondition.getContent().getClosure();
+		if (rvCondition.getContent().getType() == Token::U_BOOL) {
+			return rvCondition;
+		}
+		Closure closure = [condition](CClosureFrame& frame, CValue& result) {
+			short int nErrorMessage = condition(frame, result);
+			if (nErrorMessage != Error::SUCCESS) {
+				return nErrorMessage;
+			}
+			if (result.getType() != Token::U_BOOL) {
+				//Error: Incorrect datatype encountered:
+				return Error::produceConvertError(result.getType(), Token::U_BOOL);
+			}
+			return (short int)Error::SUCCESS;
+		};
+		return CRV<CCompiledExpression>(CCompiledExpression(closure, Token::UNKNOWN), Error::SUCCESS);
+	}
+
+	/**
+	* This function compiles the body of an if-statement or while-loop within a new scope.
+	*
+	* @param pBody	Abstract syntax tree of the body.
+	* @return		Compiled body.
+	*/
+	CRV<CCompiledExpression> compileBody(CAbstractSyntaxTree<CToken> pBody) {
+		unsigned int nScopeSize = lScope.size();
+		vector<Closure> lClosures;
+		if (pBody.getContent().getType() != Token::BRANCH) {
+			//Only one expression is represented in the body:
+			CRV<CCompiledExpression> rvExpression = compileExpression(pBody);
+			if (rvExpression.getErrorMessage() != Error::SUCCESS) {
+				return rvExpression;
+			}
+			lClosures.push_back(rvExpression.getContent().getClosure());
+		}
+		else {
+			CLinkedList<CAbstractSyntaxTree<CToken>> ltBodyExpressions = pBody.getSubTrees();
+			for (CAbstractSyntaxTree<CToken> current : ltBodyExpressions) {
+				CRV<CCompiledExpression> rvExpression = compileExpression(current);
+				if (rvExpression.getErrorMessage() != Error::SUCCESS) {
+					return rvExpression;
+				}
+				lClosures.push_back(rvExpression.getContent().getClosure());
+			}
+		}
+		lScope.resize(nScopeSize); //Variables of the body are erased afterwards.
+
+		Closure closure = [lClosures](CClosureFrame& frame, CValue& result) {
+			for (unsigned int i = 0; i < lClosures.size(); i++) {
+				short int nErrorMessage = lClosures[i](frame, result);
+				if (nErrorMessage != Error::SUCCESS) {
+					return nErrorMessage;
+				}
+			}
+			return (short int)Error::SUCCESS;
+		};
+		return CRV<CCompiledExpression>(CCompiledExpression(closure, Token::UNKNOWN), Error::SUCCESS);
+	}
+
+	/**
+	* This function compiles an if-statement (equivalent to "CInterpreter::ifStatement()").
+	*
+	* @param pAST	Abstract syntax tree of the if-statement.
+	* @return		Compiled if-statement.
+	*/
+	CRV<CCompiledExpression> compileIf(CAbstractSyntaxTree<CToken> pAST) {
+		CValue head(pAST.getContent());
+		CLinkedList<CAbstractSyntaxTree<CToken>> lSubTrees = pAST.getSubTrees();
+		CRV<CCompiledExpression> rvCondition = compileCondition(lSubTrees.front());
+		if (rvCondition.getErrorMessage() != Error::SUCCESS) {
+			return rvCondition;
+		}
+		Closure condition = rvCondition.getContent().getClosure();
+		if (lSubTrees.size() < 2) {
+			//Error no body found:
+			Closure closure = [condition, head](CClosureFrame& frame, CValue& result) {
+				short int nErrorMessage = condition(frame, result);
+				if (nErrorMessage != Error::SUCCESS || result.getType() != Token::U_BOOL) {
+					return nErrorMessage;
+				}
+				result = head;
+				return (short int)Error::Interpreter::MISSING_BODY;
+			};
+			return CRV<CCompiledExpression>(CCompiledExpression(closure, Token::UNKNOWN), Error::SUCCESS);
+		}
+
+		CRV<CCompiledExpression> rvBody = compileBody(lSubTrees[1]);
+		if (rvBody.getErrorMessage() != Error::SUCCESS) {
+			return rvBody;
+		}
+		Closure body = rvBody.getContent().getClosure();
+		Closure elseBody;
+		if (lSubTrees.size() >= 3) {
+			CRV<CCompiledExpression> rvElseBody = compileBody(lSubTrees[2]);
+			if (rvElseBody.getErrorMessage() != Error::SUCCESS) {
+				return rvElseBody;
+			}
+			elseBody = rvElseBody.getContent().getClosure();
+		}
+
+		Closure closure = [condition, body, elseBody, head](CClosureFrame& frame, CValue& result) {
+			short int nErrorMessage = condition(frame, result);
+			if (nErrorMessage != Error::SUCCESS || result.getType() != Token::U_BOOL) {
+				return nErrorMessage;
+			}
+			if (result.getBool()) {
+				nErrorMessage = body(frame, result);
+			}
+			else if (elseBody) {
+				nErrorMessage = elseBody(frame, result);
+			}
+			if (nErrorMessage != Error::SUCCESS) {
+				return nErrorMessage;
+			}
+			result = head;
+			return (short int)Error::SUCCESS;
+		};
+		return CRV<CCompiledExpression>(CCompiledExpression(closure, Token::KEYWORD), Error::SUCCESS);
+	}
+
+	/**
+	* This function compiles a while-loop (equivalent to "CInterpreter::whileLoop()").
+	*
+	* @param pAST	Abstract syntax tree of the while-loop.
+	* @return		Compiled while-loop.
+	*/
+	CRV<CCompiledExpression> compileWhile(CAbstractSyntaxTree<CToken> pAST) {
+		CValue head(pAST.getContent());
+		CLinkedList<CAbstractSyntaxTree<CToken>> lSubTrees = pAST.getSubTrees();
+		CRV<CCompiledExpression> rvCondition = compileCondition(lSubTrees.front());
+		if (rvCondition.getErrorMessage() != Error::SUCCESS) {
+			return rvCondition;
+		}
+		Closure condition = rvCondition.getContent().getClosure();
+
+		Closure body;
+		if (lSubTrees.size() < 2) {
+			//Error: The body is missing:
+			body = [head](CClosureFrame&, CValue& result) {
+				result = head;
+				return (short int)Error::Interpreter::MISSING_BODY;
+			};
+		}
+		else if (lSubTrees.size() > 2) {
+			//Error: The statement has too many arguments:
+			CRV<CValue> rvArgument = convertToken(lSubTrees[2].getContent());
+			if (rvArgument.getErrorMessage() != Error::SUCCESS) {
+				return CRV<CCompiledExpression>(CCompiledExpression(), rvArgument.getErrorMessage());
+			}
+			CValue argument = rvArgument.getContent();
+			body = [argument](CClosureFrame&, CValue& result) {
+				result = argument;
+				return (short int)Error::Interpreter::TOO_MANY_ARGUMENTS;
+			};
+		}
+		else {
+			CRV<CCompiledExpression> rvBody = compileBody(lSubTrees[1]);
+			if (rvBody.getErrorMessage() != Error::SUCCESS) {
+				return rvBody;
+			}
+			body = rvBody.getContent().getClosure();
+		}
+
+		Closure closure = [condition, body, head](CClosureFrame& frame, CValue& result) {
+			//The condition is evaluated once before the loop begins:
+			short int nErrorMessage = condition(frame, result);
+			if (nErrorMessage != Error::SUCCESS || result.getType() != Token::U_BOOL) {
+				return nErrorMessage;
+			}
+			while (true) {
+				nErrorMessage = condition(frame, result);
+				if (nErrorMessage != Error::SUCCESS || result.getType() != Token::U_BOOL) {
+					return nErrorMessage;
+				}
+				if (!result.getBool()) {
+					break;
+				}
+				nErrorMessage = body(frame, result);
+				if (nErrorMessage != Error::SUCCESS) {
+					return nErrorMessage;
+				}
+			}
+			result = head;
+			return (short int)Error::SUCCESS;
+		};
+		return CRV<CCompiledExpression>(CCompiledExpression(closure, Token::KEYWORD), Error::SUCCESS);
+	}
+
+
+
+private:
+	/**
+	* This function compiles an identifier (equivalent to "CInterpreter::evaluateIdentifier()"). Every variable is
+	* resolved to it's slot, every function call to the called function.
+	* A call in tail position, whose function has the same return type as the compiled function, is executed within the
+	* frame of the compiled function (equivalent to "CInterpreter::callFunction()").
+	*
+	* @param pAST			Abstract syntax tree of the identifier.
+	* @param pbTailCall		Whether the identifier is the value of a return statement.
+	* @return				Compiled identifier.
+	*/
+	CRV<CCompiledExpression> compileIdentifier(CAbstractSyntaxTree<CToken> pAST, bool pbTailCall) {
+		CValue name(pAST.getContent());
+		if (!pAST.hasSubTrees()) {
+			int nSlot = findVariable(name.getLexeme());
+			if (nSlot >= 0) {
+				//Identifier resembles variable name:
+				unsigned int nLine = name.getLine();
+				Closure closure = [nSlot, nLine](CClosureFrame& frame, CValue& result) {
+					result = frame.getSlot(nSlot);
+					result.setLine(nLine);
+					return (short int)Error::SUCCESS;
+				};
+				return CRV<CCompiledExpression>(CCompiledExpression(closure, lSlotTypes[nSlot]), Error::SUCCESS);
+			}
+		}
+
+		//Identifier resembles a function name:
+		vector<CCompiledExpression> lArguments;
+		CLinkedList<CAbstractSyntaxTree<CToken>> lSubTrees = pAST.getSubTrees();
+		for (CAbstractSyntaxTree<CToken> current : lSubTrees) {
+			CRV<CCompiledExpression> rvArgument;
+			if (current.hasSubTrees() || !isPrimitive(current.getContent().getType())) {
+				rvArgument = compileExpression(current);
+			}
+			else {
+				rvArgument = literal(current.getContent(), Error::SUCCESS);
+			}
+			if (rvArgument.getErrorMessage() != Error::SUCCESS) {
+				return rvArgument;
+			}
+			lArguments.push_back(rvArgument.getContent());
+		}
+		vector<Closure> lClosures = getClosures(lArguments);
+
+		//Find the function:
+		int nFunctionIndex = -1;
+		for (unsigned int i = 0; i < lFunctions.size(); i++) {
+			if (lFunctions[i].getName() == name.getLexeme()) {
+				nFunctionIndex = i;
+				break;
+			}
+		}
+		short int nCallError = Error::SUCCESS;
+		unsigned int nErrorArgument = 0;
+		if (nFunctionIndex < 0) {
+			//The called function does not exist:
+			nCallError = Error::Interpreter::FUNCTION_DOES_NOT_EXIST;
+		}
+		else if (lCompiledFunctions[nFunctionIndex].getParameterTypes().size() != lArguments.size()) {
+			//Incorrect number of arguments are passed:
+			nCallError = Error::Interpreter::INCORRECT_NUMBER_OF_ARGUMENTS_PASSED;
+		}
+		else {
+			vector<short int>& lParameterTypes = lCompiledFunctions[nFunctionIndex].getParameterTypes();
+			for (unsigned int i = 0; i < lArguments.size(); i++) {
+				if (!isPrimitive(lArguments[i].getType())) {
+					//The interpreter's behaviour depends on the argument's type:
+					return CRV<CCompiledExpression>(CCompiledExpression(), Error::Interpreter::INFO_ENGINE_UNSUPPORTED);
+				}
+				if (lArguments[i].getType() != lParameterTypes[i]) {
+					//Error: The passed type is not identical with the parameter type:
+					nCallError = Error::produceConvertError(lArguments[i].getType(), lParameterTypes[i]);
+					nErrorArgument = i;
+					break;
+				}
+			}
+		}
+
+		if (nCallError != Error::SUCCESS) {
+			//The arguments are evaluated before the error occurs:
+			Closure closure = [lClosures, name, nCallError, nErrorArgument](CClosureFrame& frame, CValue& result) {
+				vector<CValue> lValues(lClosures.size());
+				for (unsigned int i = 0; i < lClosures.size(); i++) {
+					short int nErrorMessage = lClosures[i](frame, lValues[i]);
+					if (nErrorMessage != Error::SUCCESS) {
+						result = lValues[i];
+						return nErrorMessage;
+					}
+				}
+				if (nCallError == Error::Interpreter::FUNCTION_DOES_NOT_EXIST || nCallError == Error::Interpreter::INCORRECT_NUMBER_OF_ARGUMENTS_PASSED) {
+					result = name;
+				}
+				else {
+					result = lValues[nErrorArgument];
+				}
+				return nCallError;
+			};
+			return CRV<CCompiledExpression>(CCompiledExpression(closure, Token::UNKNOWN), Error::SUCCESS);
+		}
+
+		CCompiledFunction* pFunction = &lCompiledFunctions[nFunctionIndex];
+		short int nType = pFunction->getReturnType() != Token::U_VOID ? pFunction->getReturnType() : (short int)Token::IDENTIFIER;
+		if (pbTailCall && pFunction->getReturnType() == lCompiledFunctions[nFunction].getReturnType()) {
+			//The conversion of the return value cannot fail -> Reuse the frame of the calling function:
+			Closure closure = [lClosures, name, pFunction](CClosureFrame& frame, CValue& result) {
+				vector<CValue> lValues(lClosures.size());
+				for (unsigned int i = 0; i < lClosures.size(); i++) {
+					short int nErrorMessage = lClosures[i](frame, lValues[i]);
+					if (nErrorMessage != Error::SUCCESS) {
+						result = lValues[i];
+						return nErrorMessage;
+					}
+				}
+				frame.reuse(pFunction, pFunction->getFrameSize(), lValues);
+				result = name;
+				return (short int)Error::Interpreter::INFO_TAIL_CALL;
+			};
+			return CRV<CCompiledExpression>(CCompiledExpression(closure, nType), Error::SUCCESS);
+		}
+		Closure closure = [lClosures, name, pFunction](CClosureFrame& frame, CValue& result) {
+			CClosureFrame calleeFrame(pFunction->getFrameSize());
+			for (unsigned int i = 0; i < lClosures.size(); i++) {
+				short int nErrorMessage = lClosures[i](frame, calleeFrame.getSlot(i));
+				if (nErrorMessage != Error::SUCCESS) {
+					result = calleeFrame.getSlot(i);
+					return nErrorMessage;
+				}
+			}
+			return call(pFunction, calleeFrame, result, name);
+		};
+		return CRV<CCompiledExpression>(CCompiledExpression(closure, nType), Error::SUCCESS);
+	}
+
+
+
+private:
+	/**
+	* This function executes the expressions of the passed function within the passed frame, whose first slots contain
+	* the arguments. Every function, which is called in tail position, is executed within the same frame.
+	*
+	* @param pFunction	Called function.
+	* @param pFrame		Frame of the call.
+	* @param pResult	Return value or token, which caused an error.
+	* @param pName		Name of the called function, which is returned by void-functions.
+	* @return			Error message.
+	*/
+	static short int call(CCompiledFunction* pFunction, CClosureFrame& pFrame, CValue& pResult, const CValue& pName) {
+		CCompiledFunction* pCalled = pFunction; //Stores the function, which is executed within the frame.
+		while (true) {
+			//Execute the function's expressions:
+			short int nErrorMessage = Error::SUCCESS;
+			vector<Closure>& lBody = pCalled->getBody();
+			for (unsigned int i = 0; i < lBody.size(); i++) {
+				nErrorMessage = lBody[i](pFrame, pResult);
+				if (nErrorMessage != Error::SUCCESS) {
+					break;
+				}
+			}
+			if (nErrorMessage == Error::Interpreter::INFO_TAIL_CALL) {
+				//The frame has been reused for the called function:
+				pCalled = pFrame.getTailFunction();
+				continue;
+			}
+			if (nErrorMessage == Error::Interpreter::INFO_RETURN_STATEMENT_ENCOUNTERED) {
+				//The function's execution was terminated through a return statement:
+				if (pCalled->getReturnType() == Token::U_VOID) {
+					break;
+				}
+				if (pResult.getType() != pCalled->getReturnType()) {
+					return Error::produceConvertError(pResult.getType(), pCalled->getReturnType());
+				}
+				return (short int)Error::SUCCESS;
+			}
+			else if (nErrorMessage != Error::SUCCESS) {
+				return nErrorMessage;
+			}
+			break;
+		}
+		pResult = pName;
+		return (short int)Error::SUCCESS;
+	}
+
+	/**
+	* Creates a compiled expression, which returns the passed value and error message.
+	*
+	* @param pValue			Value, which is returned.
+	* @param pnErrorMessage	Error message, which is returned.
+	* @return				Compiled expression.
+	*/
+	CRV<CCompiledExpression> constant(CValue pValue, short int pnErrorMessage) {
+		Closure closure = [pValue, pnErrorMessage](CClosureFrame&, CValue& result) {
+			result = pValue;
+			return pnErrorMessage;
+		};
+		return CRV<CCompiledExpression>(CCompiledExpression(closure, pnErrorMessage == Error::SUCCESS ? pValue.getType() : (short int)Token::UNKNOWN), Error::SUCCESS);
+	}
+
+	/**
+	* Creates a compiled expression, which returns the passed token and error message.
+	*
+	* @param pToken			Token, which is returned.
+	* @param pnErrorMessage	Error message, which is returned.
+	* @return				Compiled expression.
+	*/
+	CRV<CCompiledExpression> literal(CToken pToken, short int pnErrorMessage) {
+		CRV<CValue> rvValue = convertToken(pToken);
+		if (rvValue.getErrorMessage() != Error::SUCCESS) {
+			return CRV<CCompiledExpression>(CCompiledExpression(), rvValue.getErrorMessage());
+		}
+		return constant(rvValue.getContent(), pnErrorMessage);
+	}
+
+	/**
+	* Converts the passed token into a value.
+	*
+	* @param pToken	Token, which should be converted.
+	* @return		Value (or Error::Interpreter::INFO_ENGINE_UNSUPPORTED if the number cannot be converted).
+	*/
+	CRV<CValue> convertToken(CToken pToken) {
+		if (pToken.getFilename() != "") {
+			sFilename = pToken.getFilename();
+		}
+		try {
+			return CRV<CValue>(CValue(pToken), Error::SUCCESS);
+		}
+		catch (const exception&) {
+			//The interpreter would crash while converting the number:
+			return CRV<CValue>(CValue(), Error::Interpreter::INFO_ENGINE_UNSUPPORTED);
+		}
+	}
+
+	/**
+	* Returns the closures of the passed compiled expressions.
+	*
+	* @param plExpressions	Compiled expressions.
+	* @return				Closures.
+	*/
+	vector<Closure> getClosures(vector<CCompiledExpression>& plExpressions) {
+		vector<Closure> lClosures;
+		for (unsigned int i = 0; i < plExpressions.size(); i++) {
+			lClosures.push_back(plExpressions[i].getClosure());
+		}
+		return lClosures;
+	}
+
+
+
+private:
+	/**
+	* Returns the slot of the visible variable with the passed name.
+	*
+	* @param psName	Name of the variable.
+	* @return		Slot of the variable or -1, if the variable does not exist.
+	*/
+	int findVariable(string psName) {
+		for (unsigned int i = 0; i < lScope.size(); i++) {
+			if (lScope[i].first == psName) {
+				return lScope[i].second;
+			}
+		}
+		return -1;
+	}
+
+	/**
+	* Declares a new variable within the current scope.
+	*
+	* @param psName	Name of the variable.
+	* @param pnType	Type of the variable.
+	* @return		Slot of the variable.
+	*/
+	unsigned int declareVariable(string psName, short int pnType) {
+		unsigned int nSlot = lSlotTypes.size();
+		lSlotTypes.push_back(pnType);
+		lScope.push_back(pair<string, unsigned int>(psName, nSlot));
+		return nSlot;
+	}
+
+	/**
+	* Returns whether the passed type resembles a primitive datatype.
+	*
+	* @param pnType	Type.
+	* @return		Whether the type is primitive.
+	*/
+	bool isPrimitive(short int pnType) {
+		return pnType == Token::U_INT || pnType == Token::U_DOUBLE || pnType == Token::U_BOOL || pnType == Token::U_CHAR || pnType == Token::U_STRING;
+	}
+
+	/**
+	* Returns whether the passed type resembles a number.
+	*
+	* @param pnType	Type.
+	* @return		Whether the type is numeric.
+	*/
+	bool isNumeric(short int pnType) {
+		return pnType == Token::U_INT || pnType == Token::U_DOUBLE;
+	}
+};
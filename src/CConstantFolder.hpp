@@ -0,0 +1,711 @@
+/*
+FILE:		CConstantFolder.hpp
+
+REMARKS:	This file contains the class "CConstantFolder", which simplifies the abstract syntax trees before they are executed.
+*/
+#pragma once
+
+#include <iostream>
+#include <string>
+
+#include "CAbstractSyntaxTree.hpp"
+#include "CLinkedList.hpp"
+#include "COpcodeResolver.hpp"
+#include "COperationEvaluator.hpp"
+#include "CRV.hpp"
+#include "CSourceAnalyzer.hpp"
+#include "CToken.hpp"
+#include "CVariable.hpp"
+#include "Variables/ErrorMessages.hpp"
+#include "Variables/KeywordTypes.hpp"
+#include "Variables/OpcodeTypes.hpp"
+#include "Variables/TokenTypes.hpp"
+
+using namespace std;
+
+
+
+/**
+* The class "CConstantFolder" simplifies the abstract syntax trees of the Lisp-functions before they are executed:
+*	- Operations, whose operands are values, are replaced with their result.
+*	- Neutral operands of integer operations are removed ("(+ x 0)" and "(* x 1)" become "x") and integer
+*	  multiplications with 0 are replaced with 0.
+*	- If-statements and while-loops, whose condition is a value, are replaced with the executed body.
+*	- Statements after a return-statement are removed.
+* Only the first of these simplifications is done, if the simplifications are disabled through "setSimplification()".
+* Every simplification produces exactly the same output and the same errors as the original sourcecode. Operations, that
+* cause an error (e.g. a division by zero), are never folded, so that the error is still reported, when the operation
+* is executed.
+*
+* @author	Christian-2003
+* @version	19.10.2026
+*/
+class CConstantFolder {
+private:
+	/**
+	* Stores the name and the return type of every Lisp-function.
+	*/
+	CLinkedList<CVariable> lFunctions;
+
+	/**
+	* Stores the name and the type of every variable, that is declared at the currently folded node.
+	*/
+	CLinkedList<CVariable> lScope;
+
+	/**
+	* Stores whether every integer of the sourcecode is written in it's default form (e.g. "7" instead of "007"). Only in
+	* this case, every integer value, that is computed at runtime, has the same lexeme as the result of an operation.
+	*/
+	bool bCanonicalIntegers;
+
+	/**
+	* Stores whether the declared variables of the currently folded function are known exactly. This is not the case, if
+	* variables are declared within expressions (e.g. "(print (int x 1))") or if parameters share the same name.
+	*/
+	bool bTrackVariables;
+
+	/**
+	* Stores whether operands, if-statements, while-loops and statements are removed, or whether only operations with
+	* constant operands are folded.
+	*/
+	bool bSimplify;
+
+	/**
+	* Stores the number of nodes, that have been changed.
+	*/
+	unsigned int nChangedNodes;
+
+	/**
+	* Resolves the opcodes of the nodes.
+	*/
+	COpcodeResolver resolver;
+
+	/**
+	* Evaluates operations with constant operands.
+	*/
+	COperationEvaluator operations;
+
+	/**
+	* Analyzes the functions.
+	*/
+	CSourceAnalyzer analyzer;
+
+
+
+public:
+	/**
+	* The default constructor instantiates a new folder.
+	*/
+	CConstantFolder() {
+		bCanonicalIntegers = false;
+		bTrackVariables = false;
+		bSimplify = true;
+		nChangedNodes = 0;
+	}
+
+
+
+public:
+	/**
+	* This function simplifies the passed abstract syntax trees, each of which resembles a Lisp-function. If any function
+	* cannot be evaluated by the interpreter, the abstract syntax trees are returned unchanged, so that the interpreter
+	* reports the error.
+	*
+	* @param pltASTs	List of abstract syntax trees, which resemble Lisp-functions.
+	* @return			Simplified abstract syntax trees.
+	*/
+	CLinkedList<CAbstractSyntaxTree<CToken>> fold(CLinkedList<CAbstractSyntaxTree<CToken>> pltASTs) {
+		nChangedNodes = 0;
+		lFunctions.clear();
+		bCanonicalIntegers = true;
+		for (unsigned int i = 0; i < pltASTs.size(); i++) {
+			CAbstractSyntaxTree<CToken> tFunction = pltASTs[i];
+			short int nReturnType = analyzer.typeOf(tFunction.getContent());
+			if (nReturnType == Token::UNKNOWN || tFunction.getSubTreeNumber() < 2 || analyzer.readParameters(tFunction).getErrorMessage() != Error::SUCCESS) {
+				//The function is invalid:
+				return pltASTs;
+			}
+			CAbstractSyntaxTree<CToken> tName = tFunction.getSubTreeAtIndex(0);
+			if (tName.getContent().getType() != Token::IDENTIFIER || tName.hasSubTrees()) {
+				//The function's name is invalid:
+				return pltASTs;
+			}
+			lFunctions.add(CVariable(tName.getContent().getLexeme(), "", nReturnType));
+			bCanonicalIntegers = bCanonicalIntegers && analyzer.hasCanonicalIntegers(tFunction);
+		}
+
+		CLinkedList<CAbstractSyntaxTree<CToken>> ltFolded; //Stores the simplified functions.
+		for (unsigned int i = 0; i < pltASTs.size(); i++) {
+			ltFolded.add(foldFunction(pltASTs[i]));
+		}
+		return ltFolded;
+	}
+
+	/**
+	* This function returns the number of nodes, that have been changed.
+	*
+	* @return	Number of changed nodes.
+	*/
+	unsigned int getChangedNodes() {
+		return nChangedNodes;
+	}
+
+	/**
+	* This function changes whether the folder simplifies the abstract syntax trees beyond folding constant operations.
+	*
+	* @param pbSimplify	Whether neutral operands, constant branches and unreachable statements should be removed.
+	*/
+	void setSimplification(bool pbSimplify) {
+		bSimplify = pbSimplify;
+	}
+
+
+
+private:
+	/**
+	* This function simplifies the body of the passed Lisp-function. The function's name and parameters are not changed.
+	*
+	* @param pAST	Abstract syntax tree of the function.
+	* @return		Simplified abstract syntax tree.
+	*/
+	CAbstractSyntaxTree<CToken> foldFunction(CAbstractSyntaxTree<CToken> pAST) {
+		CLinkedList<CAbstractSyntaxTree<CToken>> ltSubTrees; //Stores the subtrees of the function.
+		ltSubTrees.addAll(pAST.getSubTrees());
+		CAbstractSyntaxTree<CToken> tBody = ltSubTrees[ltSubTrees.size() - 1]; //The last subtree resembles the function's body.
+
+		CLinkedList<CVariable> lParameters = analyzer.readParameters(pAST).getContent();
+		lScope.clear();
+		lScope.addAll(lParameters);
+		bTrackVariables = !analyzer.declaresInExpression(tBody) && analyzer.hasUniqueNames(lParameters);
+
+		CLinkedList<CAbstractSyntaxTree<CToken>> ltFolded; //Stores the subtrees of the simplified function.
+		for (unsigned int i = 0; i < ltSubTrees.size() - 1; i++) {
+			ltFolded.add(ltSubTrees[i]);
+		}
+		ltFolded.add(foldBody(tBody));
+		return CAbstractSyntaxTree<CToken>(pAST.getContent(), ltFolded);
+	}
+
+
+
+	/**
+	* This function simplifies the body of a function, an if-statement or a while-loop. The variables, that are declared
+	* within the body, are removed from the scope afterwards.
+	*
+	* @param pAST	Abstract syntax tree of the body.
+	* @return		Simplified body.
+	*/
+	CAbstractSyntaxTree<CToken> foldBody(CAbstractSyntaxTree<CToken> pAST) {
+		unsigned int nScope = lScope.size(); //Stores the number of variables, that are declared outside of the body.
+		CAbstractSyntaxTree<CToken> tFolded;
+		if (pAST.getContent().getType() != Token::BRANCH) {
+			//The body consists of a single statement:
+			tFolded = foldStatement(pAST);
+		}
+		else {
+			//The body consists of multiple statements:
+			CLinkedList<CAbstractSyntaxTree<CToken>> ltStatements; //Stores the statements of the body.
+			ltStatements.addAll(pAST.getSubTrees());
+			CLinkedList<CAbstractSyntaxTree<CToken>> ltFolded; //Stores the simplified statements.
+			for (unsigned int i = 0; i < ltStatements.size(); i++) {
+				CAbstractSyntaxTree<CToken> tStatement = foldStatement(ltStatements[i]);
+				bool bReturns = false; //Stores whether the function returns after the statement.
+				if (bSimplify && isConstantBranch(tStatement)) {
+					//Replace the statement with the executed body:
+					CLinkedList<CAbstractSyntaxTree<CToken>> ltBranch = selectBranch(tStatement);
+					nChangedNodes++;
+					for (unsigned int j = 0; j < ltBranch.size() && !bReturns; j++) {
+						ltFolded.add(ltBranch[j]);
+						bReturns = resolver.resolveOpcode(ltBranch[j].getContent()) == Opcode::OPCODE_RETURN;
+					}
+				}
+				else {
+					ltFolded.add(tStatement);
+					bReturns = resolver.resolveOpcode(tStatement.getContent()) == Opcode::OPCODE_RETURN;
+				}
+				if (bReturns && bSimplify) {
+					//Remove every statement after the return-statement:
+					nChangedNodes += ltStatements.size() - i - 1;
+					break;
+				}
+			}
+			tFolded = CAbstractSyntaxTree<CToken>(pAST.getContent(), ltFolded);
+		}
+		while (lScope.size() > nScope) {
+			lScope.remove(lScope.size() - 1);
+		}
+		return tFolded;
+	}
+
+
+
+	/**
+	* This function simplifies a statement. The statement itself is never replaced with a value, since values cannot be
+	* executed as statements.
+	*
+	* @param pAST	Abstract syntax tree of the statement.
+	* @return		Simplified statement.
+	*/
+	CAbstractSyntaxTree<CToken> foldStatement(CAbstractSyntaxTree<CToken> pAST) {
+		CToken content = pAST.getContent();
+		CLinkedList<CAbstractSyntaxTree<CToken>> ltSubTrees; //Stores the subtrees of the statement.
+		ltSubTrees.addAll(pAST.getSubTrees());
+		CLinkedList<CAbstractSyntaxTree<CToken>> ltFolded; //Stores the simplified subtrees.
+
+		switch (resolver.resolveOpcode(content)) {
+		case Opcode::OPCODE_ADD:
+		case Opcode::OPCODE_SUBTRACT:
+		case Opcode::OPCODE_MULTIPLY:
+		case Opcode::OPCODE_DIVIDE:
+		case Opcode::OPCODE_EQUAL:
+		case Opcode::OPCODE_NOT_EQUAL:
+		case Opcode::OPCODE_GREATER:
+		case Opcode::OPCODE_LESS:
+		case Opcode::OPCODE_GREATER_EQUAL:
+		case Opcode::OPCODE_LESS_EQUAL:
+		case Opcode::OPCODE_AND:
+		case Opcode::OPCODE_OR:
+			//Operation, whose result is discarded:
+			for (unsigned int i = 0; i < ltSubTrees.size(); i++) {
+				ltFolded.add(foldOperand(ltSubTrees[i]));
+			}
+			break;
+
+		case Opcode::OPCODE_IDENTIFIER:
+		case Opcode::OPCODE_PRINT:
+		case Opcode::OPCODE_PRINTLN:
+		case Opcode::OPCODE_RETURN:
+			//Every subtree is evaluated:
+			for (unsigned int i = 0; i < ltSubTrees.size(); i++) {
+				ltFolded.add(foldExpression(ltSubTrees[i], false));
+			}
+			break;
+
+		case Opcode::OPCODE_DECLARE_INT:
+		case Opcode::OPCODE_DECLARE_DOUBLE:
+		case Opcode::OPCODE_DECLARE_BOOL:
+		case Opcode::OPCODE_DECLARE_CHAR:
+		case Opcode::OPCODE_DECLARE_STRING:
+		case Opcode::OPCODE_SET:
+			//The first subtree resembles the variable's name:
+			for (unsigned int i = 0; i < ltSubTrees.size(); i++) {
+				ltFolded.add(i == 0 ? ltSubTrees[i] : foldExpression(ltSubTrees[i], false));
+			}
+			if (resolver.resolveOpcode(content) != Opcode::OPCODE_SET && ltSubTrees.size() >= 1 && ltSubTrees[0].getContent().getType() == Token::IDENTIFIER && findVariable(ltSubTrees[0].getContent().getLexeme()).getErrorMessage() != Error::SUCCESS) {
+				//The variable is declared after the initializer was evaluated:
+				lScope.add(CVariable(ltSubTrees[0].getContent().getLexeme(), "", analyzer.typeOf(content)));
+			}
+			break;
+
+		case Opcode::OPCODE_IF:
+			//Condition, body and else-body:
+			for (unsigned int i = 0; i < ltSubTrees.size(); i++) {
+				if (i == 0) {
+					ltFolded.add(foldExpression(ltSubTrees[i], true));
+				}
+				else if (i <= 2) {
+					ltFolded.add(foldBody(ltSubTrees[i]));
+				}
+				else {
+					ltFolded.add(ltSubTrees[i]);
+				}
+			}
+			break;
+
+		case Opcode::OPCODE_WHILE:
+			//Condition and body:
+			for (unsigned int i = 0; i < ltSubTrees.size(); i++) {
+				if (i == 0) {
+					ltFolded.add(foldExpression(ltSubTrees[i], true));
+				}
+				else if (i == 1) {
+					ltFolded.add(foldBody(ltSubTrees[i]));
+				}
+				else {
+					ltFolded.add(ltSubTrees[i]);
+				}
+			}
+			break;
+
+		case Opcode::OPCODE_FOR:
+		case Opcode::OPCODE_PFOR: {
+			//Counter, range, clauses and body, within which the counter is an integer:
+			unsigned int nScope = lScope.size(); //Stores the number of variables, that are declared outside of the loop.
+			for (unsigned int i = 0; i < ltSubTrees.size(); i++) {
+				if (i == 1 || i == 2) {
+					ltFolded.add(foldExpression(ltSubTrees[i], false));
+				}
+				else if (i >= 3 && i + 1 == ltSubTrees.size()) {
+					if (ltSubTrees[0].getContent().getType() == Token::IDENTIFIER) {
+						lScope.add(CVariable(ltSubTrees[0].getContent().getLexeme(), "", Token::U_INT));
+					}
+					ltFolded.add(foldBody(ltSubTrees[i]));
+				}
+				else {
+					ltFolded.add(ltSubTrees[i]);
+				}
+			}
+			while (lScope.size() > nScope) {
+				lScope.remove(lScope.size() - 1);
+			}
+			break;
+		}
+
+		default:
+			//The statement cannot be simplified:
+			return pAST;
+		}
+		return CAbstractSyntaxTree<CToken>(content, ltFolded);
+	}
+
+
+
+	/**
+	* This function simplifies an expression, whose value is used by a statement (e.g. the value of a print-statement or
+	* the argument of a function call).
+	*
+	* @param pAST			Abstract syntax tree of the expression.
+	* @param pbCondition	Whether the expression resembles the condition of an if-statement or a while-loop. Conditions
+	*						cannot be replaced with identifiers, since they must be a value or an operation.
+	* @return				Simplified expression.
+	*/
+	CAbstractSyntaxTree<CToken> foldExpression(CAbstractSyntaxTree<CToken> pAST, bool pbCondition) {
+		switch (resolver.resolveOpcode(pAST.getContent())) {
+		case Opcode::OPCODE_ADD:
+		case Opcode::OPCODE_SUBTRACT:
+		case Opcode::OPCODE_MULTIPLY:
+		case Opcode::OPCODE_DIVIDE:
+		case Opcode::OPCODE_EQUAL:
+		case Opcode::OPCODE_NOT_EQUAL:
+		case Opcode::OPCODE_GREATER:
+		case Opcode::OPCODE_LESS:
+		case Opcode::OPCODE_GREATER_EQUAL:
+		case Opcode::OPCODE_LESS_EQUAL:
+		case Opcode::OPCODE_AND:
+		case Opcode::OPCODE_OR:
+			return foldOperation(pAST, pbCondition);
+
+		case Opcode::OPCODE_NONE:
+			//Value:
+			return pAST;
+
+		default:
+			//Function call or keyword, that is executed like a statement:
+			return foldStatement(pAST);
+		}
+	}
+
+
+
+	/**
+	* This function simplifies the operand of an operation. Operands, that are neither values, nor identifiers, nor
+	* operations, are evaluated as operations by the interpreter and are therefore not changed.
+	*
+	* @param pAST	Abstract syntax tree of the operand.
+	* @return		Simplified operand.
+	*/
+	CAbstractSyntaxTree<CToken> foldOperand(CAbstractSyntaxTree<CToken> pAST) {
+		if (!pAST.hasSubTrees()) {
+			//Value, variable or function call without arguments:
+			return pAST;
+		}
+		switch (resolver.resolveOpcode(pAST.getContent())) {
+		case Opcode::OPCODE_ADD:
+		case Opcode::OPCODE_SUBTRACT:
+		case Opcode::OPCODE_MULTIPLY:
+		case Opcode::OPCODE_DIVIDE:
+		case Opcode::OPCODE_EQUAL:
+		case Opcode::OPCODE_NOT_EQUAL:
+		case Opcode::OPCODE_GREATER:
+		case Opcode::OPCODE_LESS:
+		case Opcode::OPCODE_GREATER_EQUAL:
+		case Opcode::OPCODE_LESS_EQUAL:
+		case Opcode::OPCODE_AND:
+		case Opcode::OPCODE_OR:
+			return foldOperation(pAST, false);
+
+		case Opcode::OPCODE_IDENTIFIER:
+			return foldStatement(pAST);
+
+		default:
+			return pAST;
+		}
+	}
+
+
+
+	/**
+	* This function simplifies an operation. If every operand is a value, the operation is replaced with it's result,
+	* unless the operation causes an error.
+	*
+	* @param pAST			Abstract syntax tree of the operation.
+	* @param pbCondition	Whether the operation resembles a condition.
+	* @return				Simplified operation.
+	*/
+	CAbstractSyntaxTree<CToken> foldOperation(CAbstractSyntaxTree<CToken> pAST, bool pbCondition) {
+		if (!pAST.hasSubTrees()) {
+			//The interpreter evaluates the operator itself:
+			return pAST;
+		}
+		CLinkedList<CAbstractSyntaxTree<CToken>> ltSubTrees; //Stores the subtrees of the operation.
+		ltSubTrees.addAll(pAST.getSubTrees());
+		CLinkedList<CAbstractSyntaxTree<CToken>> ltOperands; //Stores the simplified operands.
+		CLinkedList<CToken> lValues; //Stores the operands, if they are values.
+		for (unsigned int i = 0; i < ltSubTrees.size(); i++) {
+			CAbstractSyntaxTree<CToken> tOperand = foldOperand(ltSubTrees[i]);
+			ltOperands.add(tOperand);
+			if (!tOperand.hasSubTrees() && analyzer.isValue(tOperand.getContent().getType())) {
+				lValues.add(tOperand.getContent());
+			}
+		}
+
+		CToken headNode = resolver.resolveToken(pAST.getContent(), ltOperands.size());
+		if (lValues.size() == ltOperands.size()) {
+			//Every operand is a value:
+			try {
+				CRV<CToken> rvResult = operations.evaluate(headNode, lValues);
+				if (rvResult.getErrorMessage() == Error::SUCCESS) {
+					nChangedNodes++;
+					return CAbstractSyntaxTree<CToken>(rvResult.getContent());
+				}
+			}
+			catch (const exception&) {
+				//The operands cannot be converted (e.g. an integer is out of range) -> The interpreter reports the error.
+			}
+			//The operation causes an error when it is executed:
+			return CAbstractSyntaxTree<CToken>(pAST.getContent(), ltOperands);
+		}
+		else if (!bSimplify) {
+			return CAbstractSyntaxTree<CToken>(pAST.getContent(), ltOperands);
+		}
+		return simplify(pAST.getContent(), headNode.getOpcode(), ltOperands, pbCondition);
+	}
+
+
+
+	/**
+	* This function removes the neutral operands of integer additions and multiplications and replaces integer
+	* multiplications with 0. This is only done, if every operand is certainly an integer, since the operation would
+	* otherwise convert the result or cause an error.
+	*
+	* @param pContent		Token of the operation.
+	* @param pnOpcode		Opcode of the operation.
+	* @param pltOperands	Operands of the operation.
+	* @param pbCondition	Whether the operation resembles a condition.
+	* @return				Simplified operation.
+	*/
+	CAbstractSyntaxTree<CToken> simplify(CToken pContent, short int pnOpcode, CLinkedList<CAbstractSyntaxTree<CToken>> pltOperands, bool pbCondition) {
+		if (!bCanonicalIntegers || (pnOpcode != Opcode::OPCODE_ADD && pnOpcode != Opcode::OPCODE_MULTIPLY) || pltOperands.size() < 2) {
+			return CAbstractSyntaxTree<CToken>(pContent, pltOperands);
+		}
+		for (unsigned int i = 0; i < pltOperands.size(); i++) {
+			if (!isKnownInteger(pltOperands[i])) {
+				//The operand might not be an integer:
+				return CAbstractSyntaxTree<CToken>(pContent, pltOperands);
+			}
+		}
+
+		if (pnOpcode == Opcode::OPCODE_MULTIPLY) {
+			bool bZero = false; //Stores whether an operand is 0.
+			bool bPure = true; //Stores whether every operand can be omitted.
+			for (unsigned int i = 0; i < pltOperands.size(); i++) {
+				if (isIntegerValue(pltOperands[i], "0")) {
+					bZero = true;
+				}
+				else if (!isPureInteger(pltOperands[i])) {
+					bPure = false;
+				}
+			}
+			if (bZero && bPure) {
+				//The result is 0 (located at the first operand, like the result of the interpreter):
+				CToken firstOperand = pltOperands[0].getContent();
+				nChangedNodes++;
+				return CAbstractSyntaxTree<CToken>(CToken("0", Token::U_INT, firstOperand.getFilename(), firstOperand.getLine()));
+			}
+		}
+
+		//Remove the neutral operands (The first operand is kept, since the result is located at it):
+		string sNeutral = pnOpcode == Opcode::OPCODE_ADD ? "0" : "1"; //Stores the neutral element of the operation.
+		CLinkedList<CAbstractSyntaxTree<CToken>> ltRemaining; //Stores the remaining operands.
+		ltRemaining.add(pltOperands[0]);
+		for (unsigned int i = 1; i < pltOperands.size(); i++) {
+			if (isIntegerValue(pltOperands[i], sNeutral)) {
+				nChangedNodes++;
+			}
+			else {
+				ltRemaining.add(pltOperands[i]);
+			}
+		}
+		if (ltRemaining.size() == 1 && ltRemaining.size() < pltOperands.size() && !pbCondition) {
+			//The operation returns it's only operand:
+			return ltRemaining[0];
+		}
+		return CAbstractSyntaxTree<CToken>(pContent, ltRemaining);
+	}
+
+
+
+private:
+	/**
+	* This function returns whether the passed statement is an if-statement or a while-loop, whose condition is a value,
+	* and which can be replaced with the executed body. Bodies, that declare variables, are not replaced, since the
+	* variables would otherwise remain declared after the body.
+	*
+	* @param pAST	Abstract syntax tree of the statement.
+	* @return		Whether the statement can be replaced.
+	*/
+	bool isConstantBranch(CAbstractSyntaxTree<CToken> pAST) {
+		short int nOpcode = resolver.resolveOpcode(pAST.getContent());
+		if ((nOpcode != Opcode::OPCODE_IF && nOpcode != Opcode::OPCODE_WHILE) || !pAST.hasSubTrees()) {
+			return false;
+		}
+		CAbstractSyntaxTree<CToken> tCondition = pAST.getSubTreeAtIndex(0);
+		if (tCondition.hasSubTrees() || tCondition.getContent().getType() != Token::U_BOOL) {
+			//The condition is no boolean value:
+			return false;
+		}
+		bool bCondition = tCondition.getContent().getLexeme() == "t";
+		if (nOpcode == Opcode::OPCODE_WHILE) {
+			//A while-loop, whose condition is false, does nothing:
+			return !bCondition;
+		}
+		else if (pAST.getSubTreeNumber() < 2) {
+			//The interpreter reports the missing body:
+			return false;
+		}
+		else if (bCondition) {
+			return !analyzer.containsDeclaration(pAST.getSubTreeAtIndex(1));
+		}
+		return pAST.getSubTreeNumber() < 3 || !analyzer.containsDeclaration(pAST.getSubTreeAtIndex(2));
+	}
+
+	/**
+	* This function returns the statements of the body, that is executed by an if-statement or a while-loop, whose
+	* condition is a value.
+	*
+	* @param pAST	Abstract syntax tree of the statement.
+	* @return		Statements, that are executed.
+	*/
+	CLinkedList<CAbstractSyntaxTree<CToken>> selectBranch(CAbstractSyntaxTree<CToken> pAST) {
+		CLinkedList<CAbstractSyntaxTree<CToken>> ltStatements; //Stores the executed statements.
+		if (resolver.resolveOpcode(pAST.getContent()) == Opcode::OPCODE_WHILE) {
+			return ltStatements;
+		}
+		unsigned int nBody = pAST.getSubTreeAtIndex(0).getContent().getLexeme() == "t" ? 1 : 2; //Stores the index of the executed body.
+		if (nBody >= pAST.getSubTreeNumber()) {
+			//There is no else-body:
+			return ltStatements;
+		}
+		CAbstractSyntaxTree<CToken> tBody = pAST.getSubTreeAtIndex(nBody);
+		if (tBody.getContent().getType() == Token::BRANCH) {
+			ltStatements.addAll(tBody.getSubTrees());
+		}
+		else {
+			ltStatements.add(tBody);
+		}
+		return ltStatements;
+	}
+
+
+
+private:
+	/**
+	* This function returns whether the passed expression certainly evaluates to an integer (or causes an error).
+	*
+	* @param pAST	Abstract syntax tree of the expression.
+	* @return		Whether the expression is an integer.
+	*/
+	bool isKnownInteger(CAbstractSyntaxTree<CToken> pAST) {
+		CToken content = pAST.getContent();
+		switch (resolver.resolveOpcode(content)) {
+		case Opcode::OPCODE_NONE:
+			return content.getType() == Token::U_INT && !pAST.hasSubTrees();
+
+		case Opcode::OPCODE_IDENTIFIER:
+			if (!pAST.hasSubTrees()) {
+				//Variable or function call without arguments:
+				if (!bTrackVariables) {
+					return false;
+				}
+				CRV<CVariable> rvVariable = findVariable(content.getLexeme());
+				if (rvVariable.getErrorMessage() == Error::SUCCESS) {
+					return rvVariable.getContent().getType() == Token::U_INT;
+				}
+			}
+			//Function call, which returns the function's return type:
+			for (unsigned int i = 0; i < lFunctions.size(); i++) {
+				if (lFunctions[i].getName() == content.getLexeme()) {
+					return lFunctions[i].getType() == Token::U_INT;
+				}
+			}
+			return false;
+
+		case Opcode::OPCODE_ADD:
+		case Opcode::OPCODE_SUBTRACT:
+		case Opcode::OPCODE_MULTIPLY:
+			//Operations on integers return integers:
+			if (!pAST.hasSubTrees()) {
+				return false;
+			}
+			for (unsigned int i = 0; i < pAST.getSubTreeNumber(); i++) {
+				if (!isKnownInteger(pAST.getSubTreeAtIndex(i))) {
+					return false;
+				}
+			}
+			return true;
+
+		default:
+			return false;
+		}
+	}
+
+	/**
+	* This function returns whether the passed expression is an integer value or an integer variable, which can be
+	* omitted without changing the output or the errors of the program.
+	*
+	* @param pAST	Abstract syntax tree of the expression.
+	* @return		Whether the expression can be omitted.
+	*/
+	bool isPureInteger(CAbstractSyntaxTree<CToken> pAST) {
+		if (pAST.hasSubTrees()) {
+			return false;
+		}
+		else if (pAST.getContent().getType() == Token::U_INT) {
+			return true;
+		}
+		else if (pAST.getContent().getType() != Token::IDENTIFIER || !bTrackVariables) {
+			return false;
+		}
+		CRV<CVariable> rvVariable = findVariable(pAST.getContent().getLexeme());
+		return rvVariable.getErrorMessage() == Error::SUCCESS && rvVariable.getContent().getType() == Token::U_INT;
+	}
+
+	/**
+	* This function returns whether the passed expression is the passed integer value.
+	*
+	* @param pAST		Abstract syntax tree of the expression.
+	* @param psValue	Integer value.
+	* @return			Whether the expression is the value.
+	*/
+	bool isIntegerValue(CAbstractSyntaxTree<CToken> pAST, string psValue) {
+		return !pAST.hasSubTrees() && pAST.getContent().getType() == Token::U_INT && pAST.getContent().getLexeme() == psValue;
+	}
+
+
+
+private:
+	/**
+	* This function returns the variable of the current scope, which has the passed name.
+	*
+	* @param psName	Name of the variable.
+	* @return		Variable.
+	*/
+	CRV<CVariable> findVariable(string psName) {
+		for (unsigned int i = 0; i < lScope.size(); i++) {
+			if (lScope[i].getName() == psName) {
+				return CRV<CVariable>(lScope[i], Error::SUCCESS);
+			}
+		}
+		return CRV<CVariable>(CVariable(), Error::Interpreter::VARIABLE_DOES_NOT_EXIST);
+	}
+};
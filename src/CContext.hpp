@@ -0,0 +1,256 @@
+/*
+FILE:		CContext.hpp
+
+REMARKS:	This file contains the class "CContext", which stores the log, the output and the configuration of a single
+			execution of sourcecode.
+*/
+#pragma once
+
+#include <iostream>
+#include <memory>
+#include <mutex>
+
+#include "CContinuationEvaluator.hpp"
+#include "CLog.hpp"
+#include "CMemoCache.hpp"
+#include "Variables/ExecutionModes.hpp"
+
+using namespace std;
+
+
+
+/**
+* The class "CContext" stores everything, that the tokenizer, the parser, the pass manager and the interpreter share while
+* sourcecode is executed: The log, into which the events are written, the streams, into which the program prints it's
+* output and errors, and the configuration of the interpreter. Since every component gets it's own copy of the context,
+* multiple programs can be executed simultaneously by different threads, as long as each of them has a context of it's
+* own.
+* Copies of a context share the log and the lock of the output, so that the threads of a single program write their
+* lines one after another. The log is shared by every context of the terminal and locks itself.
+*
+* @author	Christian-2003
+* @version	19.10.2026
+*/
+class CContext {
+private:
+	/**
+	* Stores the log, into which the events are written.
+	*/
+	shared_ptr<CLog> pLog;
+
+	/**
+	* Stores the stream, into which the program prints it's output.
+	*/
+	ostream* pOutput;
+
+	/**
+	* Stores the stream, into which the errors are printed.
+	*/
+	ostream* pErrors;
+
+	/**
+	* Locks the output, while a thread writes it's lines.
+	*/
+	shared_ptr<mutex> pOutputLock;
+
+	/**
+	* Stores the execution engine, with which the main-function is executed.
+	*/
+	short int nExecutionMode;
+
+	/**
+	* Stores the number of Lisp-functions, which can be executed within each other by the continuation evaluator.
+	*/
+	unsigned int nMaximumDepth;
+
+	/**
+	* Stores the number of threads, which evaluate arguments and execute tasks.
+	*/
+	unsigned int nThreads;
+
+	/**
+	* Stores whether "&" and "|" skip their remaining operands once the result is decided.
+	*/
+	bool bShortCircuit;
+
+	/**
+	* Stores the cache, in which the return values of pure functions are memoized (nullptr, if there is none).
+	*/
+	CMemoCache* pMemoCache;
+
+
+
+public:
+	/**
+	* The default constructor instantiates a new context, which prints into the console and does not log anything.
+	*/
+	CContext() {
+		pLog = make_shared<CLog>();
+		pOutput = &cout;
+		pErrors = &cerr;
+		pOutputLock = make_shared<mutex>();
+		nExecutionMode = ExecutionMode::TREE_WALKING;
+		nMaximumDepth = CONTINUATION_DEFAULT_MAXIMUM_DEPTH;
+		nThreads = 1;
+		bShortCircuit = true;
+		pMemoCache = nullptr;
+	}
+
+
+
+public:
+	/**
+	* This function returns a copy of this context, which prints it's output and errors into the passed stream. The copy
+	* gets a lock of it's own, since it does not write into the console.
+	*
+	* @param pOutputStream	Stream, into which the output and the errors are printed.
+	* @return				Context with the same log and configuration.
+	*/
+	CContext redirect(ostream& pOutputStream) {
+		CContext context = *this;
+		context.pOutput = &pOutputStream;
+		context.pErrors = &pOutputStream;
+		context.pOutputLock = make_shared<mutex>();
+		return context;
+	}
+
+	/**
+	* Returns whether the output is printed into the console, so that it's color can be changed.
+	*
+	* @return	Whether the output is the console.
+	*/
+	bool isConsole() {
+		return pOutput == &cout;
+	}
+
+
+
+public:
+	/**
+	* Returns the log, into which the events are written.
+	*
+	* @return	Log.
+	*/
+	CLog& getLog() {
+		return *pLog;
+	}
+
+	/**
+	* Returns the stream, into which the program prints it's output.
+	*
+	* @return	Output.
+	*/
+	ostream& getOutput() {
+		return *pOutput;
+	}
+
+	/**
+	* Returns the stream, into which the errors are printed.
+	*
+	* @return	Errors.
+	*/
+	ostream& getErrors() {
+		return *pErrors;
+	}
+
+	/**
+	* Returns the lock of the output, which is shared by every thread of the program.
+	*
+	* @return	Lock of the output.
+	*/
+	mutex& getOutputLock() {
+		return *pOutputLock;
+	}
+
+	/**
+	* Returns the execution engine, with which the main-function is executed.
+	*
+	* @return	Execution mode.
+	*/
+	short int getExecutionMode() {
+		return nExecutionMode;
+	}
+
+	/**
+	* This function changes the execution engine, with which the main-function is executed.
+	*
+	* @param pnExecutionMode	New execution mode.
+	*/
+	void setExecutionMode(short int pnExecutionMode) {
+		nExecutionMode = pnExecutionMode;
+	}
+
+	/**
+	* Returns the number of Lisp-functions, which can be executed within each other by the continuation evaluator.
+	*
+	* @return	Maximum depth.
+	*/
+	unsigned int getMaximumDepth() {
+		return nMaximumDepth;
+	}
+
+	/**
+	* This function changes the number of Lisp-functions, which can be executed within each other by the continuation
+	* evaluator.
+	*
+	* @param pnMaximumDepth	New maximum depth.
+	*/
+	void setMaximumDepth(unsigned int pnMaximumDepth) {
+		nMaximumDepth = pnMaximumDepth;
+	}
+
+	/**
+	* Returns the number of threads, which evaluate arguments and execute tasks.
+	*
+	* @return	Number of threads.
+	*/
+	unsigned int getThreads() {
+		return nThreads;
+	}
+
+	/**
+	* This function changes the number of threads, which evaluate arguments and execute tasks.
+	*
+	* @param pnThreads	Number of threads.
+	*/
+	void setThreads(unsigned int pnThreads) {
+		nThreads = pnThreads;
+	}
+
+	/**
+	* Returns whether "&" and "|" skip their remaining operands once the result is decided.
+	*
+	* @return	Whether boolean operations are short-circuited.
+	*/
+	bool isShortCircuit() {
+		return bShortCircuit;
+	}
+
+	/**
+	* This function changes whether "&" and "|" skip their remaining operands once the result is decided.
+	*
+	* @param pbShortCircuit	Whether boolean operations are short-circuited.
+	*/
+	void setShortCircuit(bool pbShortCircuit) {
+		bShortCircuit = pbShortCircuit;
+	}
+
+	/**
+	* Returns the cache, in which the return values of pure functions are memoized.
+	*
+	* @return	Cache or nullptr.
+	*/
+	CMemoCache* getMemoCache() {
+		return pMemoCache;
+	}
+
+	/**
+	* This function changes the cache, in which the return values of pure functions are memoized. The cache is not
+	* synchronized, therefore it must not be shared by contexts, which are used simultaneously.
+	*
+	* @param ppMemoCache	Cache or nullptr.
+	*/
+	void setMemoCache(CMemoCache* ppMemoCache) {
+		pMemoCache = ppMemoCache;
+	}
+};
@@ -0,0 +1,1651 @@
+/*
+FILE:		CContinuationEvaluator.hpp
+
+REMARKS:	This file contains the class "CContinuationEvaluator", which executes Lisp-functions through an explicit stack of
+			continuations, so that the depth of the executed Lisp-functions is not limited by the stack of the C++ program
+			and the execution can be suspended, while the host executes a function.
+*/
+#pragma once
+
+#include <iostream>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "CAbstractSyntaxTree.hpp"
+#include "CFunction.hpp"
+#include "CLinkedList.hpp"
+#include "COperationEvaluator.hpp"
+#include "CRV.hpp"
+#include "CToken.hpp"
+#include "CVariable.hpp"
+#include "Variables/ContinuationKinds.hpp"
+#include "Variables/ErrorMessages.hpp"
+#include "Variables/OpcodeTypes.hpp"
+#include "Variables/TokenTypes.hpp"
+
+using namespace std;
+
+
+
+/**
+* Stores the number of Lisp-functions, which can be executed within each other by default, before the continuation evaluator
+* reports a stack overflow.
+*/
+#define CONTINUATION_DEFAULT_MAXIMUM_DEPTH 100000
+
+
+
+/**
+* Instances of this class resemble a node of an abstract syntax tree. The subtrees are referenced through their index within
+* the nodes of the evaluator, which is why a continuation only needs to store the index of it's node.
+*
+* @author	Christian-2003
+* @version	19.10.2026
+*/
+class CContinuationNode {
+private:
+	/**
+	* Stores the token of the node.
+	*/
+	CToken token;
+
+	/**
+	* Stores the index of every subtree.
+	*/
+	vector<unsigned int> lSubTrees;
+
+
+
+public:
+	/**
+	* This constructor instantiates a new node without subtrees.
+	*
+	* @param pToken	Token of the node.
+	*/
+	CContinuationNode(CToken pToken) {
+		token = pToken;
+	}
+
+
+
+public:
+	/**
+	* Returns the token of the node.
+	*
+	* @return	Token.
+	*/
+	CToken& getToken() {
+		return token;
+	}
+
+	/**
+	* Returns the index of every subtree.
+	*
+	* @return	Indices of the subtrees.
+	*/
+	vector<unsigned int>& getSubTrees() {
+		return lSubTrees;
+	}
+};
+
+
+
+/**
+* Instances of this class resemble a Lisp-function, whose statements are stored as nodes of the evaluator.
+*
+* @author	Christian-2003
+* @version	19.10.2026
+*/
+class CContinuationFunction {
+private:
+	/**
+	* Stores the name of the function.
+	*/
+	string sName;
+
+	/**
+	* Stores the return type of the function.
+	*/
+	short int nReturnType;
+
+	/**
+	* Stores the parameters of the function.
+	*/
+	vector<CVariable> lParameters;
+
+	/**
+	* Stores the index of the node of every statement.
+	*/
+	vector<unsigned int> lBody;
+
+
+
+public:
+	/**
+	* This constructor instantiates a new function without parameters and statements.
+	*
+	* @param psName			Name of the function.
+	* @param pnReturnType	Return type of the function.
+	*/
+	CContinuationFunction(string psName, short int pnReturnType) {
+		sName = psName;
+		nReturnType = pnReturnType;
+	}
+
+
+
+public:
+	/**
+	* Returns the name of the function.
+	*
+	* @return	Name.
+	*/
+	string& getName() {
+		return sName;
+	}
+
+	/**
+	* Returns the return type of the function.
+	*
+	* @return	Return type.
+	*/
+	short int getReturnType() {
+		return nReturnType;
+	}
+
+	/**
+	* Returns the parameters of the function.
+	*
+	* @return	Parameters.
+	*/
+	vector<CVariable>& getParameters() {
+		return lParameters;
+	}
+
+	/**
+	* Returns the index of the node of every statement.
+	*
+	* @return	Statements.
+	*/
+	vector<unsigned int>& getBody() {
+		return lBody;
+	}
+};
+
+
+
+/**
+* Instances of this class resemble a continuation, which stores everything, that is needed to resume the evaluation of a
+* node after one of it's subtrees has been evaluated. This is the state, that the interpreter keeps within the local
+* variables of it's recursive functions.
+*
+* @author	Christian-2003
+* @version	19.10.2026
+*/
+class CContinuation {
+private:
+	/**
+	* Stores the kind of the continuation (see Variables/ContinuationKinds.hpp).
+	*/
+	short int nKind;
+
+	/**
+	* Stores the index of the node, which is evaluated.
+	*/
+	unsigned int nNode;
+
+	/**
+	* Stores the index of the node of the body, which is executed by an if-statement or while-loop.
+	*/
+	unsigned int nBody;
+
+	/**
+	* Stores the step, at which the evaluation is resumed.
+	*/
+	unsigned int nState;
+
+	/**
+	* Stores the index of the subtree or statement, which is evaluated next.
+	*/
+	unsigned int nIndex;
+
+	/**
+	* Stores the number of variables, to which the variables are restored after the body of an if-statement or while-loop.
+	*/
+	unsigned int nScope;
+
+	/**
+	* Stores the index of the function, which is executed by a function call.
+	*/
+	unsigned int nFunction;
+
+	/**
+	* Stores whether the arguments are evaluated for a call in tail position.
+	*/
+	bool bTailCall;
+
+	/**
+	* Stores whether the variables of the calling function have been saved.
+	*/
+	bool bFrameCreated;
+
+	/**
+	* Stores the evaluated operands of an operation or the evaluated arguments of a function call.
+	*/
+	CLinkedList<CToken> lValues;
+
+	/**
+	* Stores the name of the function, that has been called (The frame of this function might be reused by other functions).
+	*/
+	CToken name;
+
+	/**
+	* Stores the name of the function, which is currently executed within the frame.
+	*/
+	CToken calledName;
+
+	/**
+	* Stores the variables of the calling function.
+	*/
+	vector<CVariable> lSavedVariables;
+
+
+
+public:
+	/**
+	* This constructor instantiates a new continuation, which starts to evaluate the passed node.
+	*
+	* @param pnKind	Kind of the continuation.
+	* @param pnNode	Index of the node.
+	*/
+	CContinuation(short int pnKind, unsigned int pnNode) {
+		nKind = pnKind;
+		nNode = pnNode;
+		nBody = 0;
+		nState = 0;
+		nIndex = 0;
+		nScope = 0;
+		nFunction = 0;
+		bTailCall = false;
+		bFrameCreated = false;
+	}
+
+
+
+public:
+	/**
+	* Returns the kind of the continuation.
+	*
+	* @return	Kind.
+	*/
+	short int& getKind() {
+		return nKind;
+	}
+
+	/**
+	* Returns the index of the node.
+	*
+	* @return	Node.
+	*/
+	unsigned int& getNode() {
+		return nNode;
+	}
+
+	/**
+	* Returns the index of the node of the body.
+	*
+	* @return	Body.
+	*/
+	unsigned int& getBody() {
+		return nBody;
+	}
+
+	/**
+	* Returns the step, at which the evaluation is resumed.
+	*
+	* @return	State.
+	*/
+	unsigned int& getState() {
+		return nState;
+	}
+
+	/**
+	* Returns the index of the subtree or statement, which is evaluated next.
+	*
+	* @return	Index.
+	*/
+	unsigned int& getIndex() {
+		return nIndex;
+	}
+
+	/**
+	* Returns the number of variables before the body of an if-statement or while-loop.
+	*
+	* @return	Number of variables.
+	*/
+	unsigned int& getScope() {
+		return nScope;
+	}
+
+	/**
+	* Returns the index of the executed function.
+	*
+	* @return	Index of the function.
+	*/
+	unsigned int& getFunction() {
+		return nFunction;
+	}
+
+	/**
+	* Returns whether the arguments are evaluated for a call in tail position.
+	*
+	* @return	Whether the call is in tail position.
+	*/
+	bool& isTailCall() {
+		return bTailCall;
+	}
+
+	/**
+	* Returns whether the variables of the calling function have been saved.
+	*
+	* @return	Whether the frame has been created.
+	*/
+	bool& isFrameCreated() {
+		return bFrameCreated;
+	}
+
+	/**
+	* Returns the evaluated operands or arguments.
+	*
+	* @return	Values.
+	*/
+	CLinkedList<CToken>& getValues() {
+		return lValues;
+	}
+
+	/**
+	* Returns the name of the function, that has been called.
+	*
+	* @return	Name of the function.
+	*/
+	CToken& getName() {
+		return name;
+	}
+
+	/**
+	* Returns the name of the function, which is executed within the frame.
+	*
+	* @return	Name of the function.
+	*/
+	CToken& getCalledName() {
+		return calledName;
+	}
+
+	/**
+	* Returns the variables of the calling function.
+	*
+	* @return	Saved variables.
+	*/
+	vector<CVariable>& getSavedVariables() {
+		return lSavedVariables;
+	}
+};
+
+
+
+/**
+* Instances of this class resemble the Lisp-functions of a program, whose abstract syntax trees have been flattened into
+* nodes. A program is built once and is not changed afterwards, therefore it can be shared by every evaluator, which
+* executes it's functions.
+*
+* @author	Christian-2003
+* @version	19.10.2026
+*/
+class CContinuationProgram {
+private:
+	/**
+	* Stores every node of the program.
+	*/
+	vector<CContinuationNode> lNodes;
+
+	/**
+	* Stores every Lisp-function.
+	*/
+	vector<CContinuationFunction> lFunctions;
+
+
+
+public:
+	/**
+	* This function flattens every passed Lisp-function into nodes.
+	*
+	* @param plFunctions	Lisp-functions.
+	*/
+	void build(const CLinkedList<CFunction>& plFunctions) {
+		lNodes.clear();
+		lFunctions.clear();
+		for (const CFunction& function : plFunctions) {
+			CContinuationFunction flattened(function.getName(), function.getReturnType());
+			for (const CVariable& parameter : function.getParameters()) {
+				flattened.getParameters().push_back(parameter);
+			}
+			for (const CAbstractSyntaxTree<CToken>& expression : function.getExpressions()) {
+				flattened.getBody().push_back(flatten(expression));
+			}
+			lFunctions.push_back(flattened);
+		}
+	}
+
+	/**
+	* Returns every node of the program.
+	*
+	* @return	Nodes.
+	*/
+	vector<CContinuationNode>& getNodes() {
+		return lNodes;
+	}
+
+	/**
+	* Returns every Lisp-function of the program.
+	*
+	* @return	Functions.
+	*/
+	vector<CContinuationFunction>& getFunctions() {
+		return lFunctions;
+	}
+
+	/**
+	* This function returns the index of the first function with the passed name.
+	*
+	* @param psName	Name of the function.
+	* @return		Index of the function or -1, if the function does not exist.
+	*/
+	int findFunction(const string& psName) {
+		for (unsigned int i = 0; i < lFunctions.size(); i++) {
+			if (lFunctions[i].getName() == psName) {
+				return i;
+			}
+		}
+		return -1;
+	}
+
+
+
+private:
+	/**
+	* This function adds the passed abstract syntax tree and every subtree to the nodes.
+	*
+	* @param pAST	Abstract syntax tree.
+	* @return		Index of the node.
+	*/
+	unsigned int flatten(CAbstractSyntaxTree<CToken> pAST) {
+		unsigned int nNode = lNodes.size();
+		lNodes.push_back(CContinuationNode(pAST.getContent()));
+		CLinkedList<CAbstractSyntaxTree<CToken>> ltSubTrees = pAST.getSubTrees();
+		for (CAbstractSyntaxTree<CToken> subTree : ltSubTrees) {
+			unsigned int nSubTree = flatten(subTree);
+			lNodes[nNode].getSubTrees().push_back(nSubTree);
+		}
+		return nNode;
+	}
+};
+
+
+
+/**
+* The class "CContinuationEvaluator" executes Lisp-functions with the same semantics as the interpreter. Instead of calling
+* itself for every subtree, it pushes a continuation onto a stack, which is allocated on the heap, and resumes the
+* continuation, once the subtree has been evaluated. The depth of the Lisp-functions is therefore only limited through
+* the maximum depth, after which Error::Interpreter::STACK_OVERFLOW is reported.
+* The abstract syntax trees are flattened into a list of nodes once (see CContinuationProgram), so that no abstract syntax
+* tree is copied during the execution. Since the whole state of an execution is stored within the stack of continuations,
+* an execution can be suspended at a call of a function, which is executed by the host, and resumed later, without
+* occupying a thread in between.
+*
+* @author	Christian-2003
+* @version	19.10.2026
+*/
+class CContinuationEvaluator {
+private:
+	/**
+	* Stores the program, whose functions are executed.
+	*/
+	shared_ptr<CContinuationProgram> pProgram;
+
+	/**
+	* Stores the variables of the currently executed function. Declarations append variables, which is why the variables of
+	* an enclosing body are restored by removing every variable after it's number of variables.
+	*/
+	vector<CVariable> lVariables;
+
+	/**
+	* Stores the stack of continuations.
+	*/
+	vector<CContinuation> lContinuations;
+
+	/**
+	* Stores the result of the latest evaluated node.
+	*/
+	CToken result;
+
+	/**
+	* Stores the error message of the latest evaluated node.
+	*/
+	short int nResult;
+
+	/**
+	* Stores the number of Lisp-functions, which are currently executed.
+	*/
+	unsigned int nCallDepth;
+
+	/**
+	* Stores the number of Lisp-functions, which can be executed within each other.
+	*/
+	unsigned int nMaximumDepth;
+
+	/**
+	* Stores the name of the function, which is called in tail position, until the frame of the calling function is reused.
+	*/
+	CToken tailCallName;
+
+	/**
+	* Stores the evaluated arguments of the function, which is called in tail position.
+	*/
+	CLinkedList<CToken> lTailCallArguments;
+
+	/**
+	* Applies the operators of operations to their evaluated operands.
+	*/
+	COperationEvaluator operations;
+
+	/**
+	* Stores the stream, into which the program prints it's output.
+	*/
+	ostream* pOutput;
+
+	/**
+	* Stores whether a call of a function, which does not exist, suspends the execution.
+	*/
+	bool bHostCalls;
+
+	/**
+	* Stores whether the execution waits for the result of a function, which is executed by the host.
+	*/
+	bool bSuspended;
+
+
+
+public:
+	/**
+	* The default constructor instantiates a new evaluator with the default maximum depth.
+	*/
+	CContinuationEvaluator() {
+		pProgram = make_shared<CContinuationProgram>();
+		nResult = Error::SUCCESS;
+		nCallDepth = 0;
+		nMaximumDepth = CONTINUATION_DEFAULT_MAXIMUM_DEPTH;
+		pOutput = &cout;
+		bHostCalls = false;
+		bSuspended = false;
+	}
+
+
+
+public:
+	/**
+	* This function changes the number of Lisp-functions, which can be executed within each other.
+	*
+	* @param pnMaximumDepth	Maximum depth.
+	*/
+	void setMaximumDepth(unsigned int pnMaximumDepth) {
+		nMaximumDepth = pnMaximumDepth;
+	}
+
+	/**
+	* This function changes whether "&" and "|" stop evaluating their operands, as soon as an operand decides the result.
+	*
+	* @param pbShortCircuit	Whether boolean operations are short-circuited.
+	*/
+	void setShortCircuit(bool pbShortCircuit) {
+		operations.setShortCircuit(pbShortCircuit);
+	}
+
+	/**
+	* This function changes the stream, into which "print" and "println" print the values.
+	*
+	* @param pOutputStream	Stream, into which the output is printed.
+	*/
+	void setOutput(ostream& pOutputStream) {
+		pOutput = &pOutputStream;
+	}
+
+	/**
+	* This function flattens every passed Lisp-function into the nodes of a new program.
+	*
+	* @param plFunctions	Lisp-functions.
+	*/
+	void build(const CLinkedList<CFunction>& plFunctions) {
+		pProgram = make_shared<CContinuationProgram>();
+		pProgram->build(plFunctions);
+	}
+
+	/**
+	* This function changes the program, whose functions are executed. A program, which has been built once, can be shared
+	* by any number of evaluators.
+	*
+	* @param ppProgram	Program.
+	*/
+	void setProgram(shared_ptr<CContinuationProgram> ppProgram) {
+		pProgram = ppProgram;
+	}
+
+	/**
+	* This function changes whether a call of a function, which does not exist, suspends the execution, so that the host
+	* can execute the function and resume the execution with it's result (see "resume()").
+	*
+	* @param pbHostCalls	Whether unknown functions are executed by the host.
+	*/
+	void setHostCalls(bool pbHostCalls) {
+		bHostCalls = pbHostCalls;
+	}
+
+	/**
+	* This function executes the function at the passed index, as the interpreter executes the main-function.
+	*
+	* @param pnFunctionIndex	Index of the function.
+	* @return					Error message and token, which caused the error.
+	*/
+	CRV<CToken> execute(unsigned int pnFunctionIndex) {
+		lVariables.clear();
+		lContinuations.clear();
+		nCallDepth = 0;
+		bSuspended = false;
+		lContinuations.push_back(CContinuation(ContinuationKind::CONTINUATION_MAIN, 0));
+		lContinuations.back().getFunction() = pnFunctionIndex;
+
+		return run(false);
+	}
+
+	/**
+	* This function calls the function with the passed name, as the interpreter calls a function (see "CInterpreter::call()").
+	* If the function or any function, which it calls, is executed by the host, the execution is suspended and
+	* Error::Interpreter::INFO_HOST_CALL is returned together with the name of the function. The arguments can be found
+	* through "getHostArguments()".
+	*
+	* @param psFunction		Name of the function.
+	* @param plArguments	Arguments of the call.
+	* @return				Return value of the function (it's name for void-functions) or error message.
+	*/
+	CRV<CToken> call(string psFunction, CLinkedList<CToken> plArguments) {
+		lVariables.clear();
+		lContinuations.clear();
+		nCallDepth = 0;
+		bSuspended = false;
+		lContinuations.push_back(CContinuation(ContinuationKind::CONTINUATION_CALL, 0));
+		lContinuations.back().getName() = CToken(psFunction, Token::IDENTIFIER);
+		lContinuations.back().getCalledName() = lContinuations.back().getName();
+		lContinuations.back().getValues() = move(plArguments);
+		return run(false);
+	}
+
+	/**
+	* This function resumes a suspended execution with the result of the function, which has been executed by the host.
+	*
+	* @param pResult		Return value of the function (or the token, which caused the error).
+	* @param pnErrorMessage	Error message of the function.
+	* @return				Return value of the called function, error message or Error::Interpreter::INFO_HOST_CALL, if
+	*						the execution has been suspended again.
+	*/
+	CRV<CToken> resume(CToken pResult, short int pnErrorMessage) {
+		if (!bSuspended) {
+			return CRV<CToken>(result, nResult);
+		}
+		bSuspended = false;
+		finish(pResult, pnErrorMessage);
+		return run(true);
+	}
+
+	/**
+	* Returns whether the execution waits for the result of a function, which is executed by the host.
+	*
+	* @return	Whether the execution is suspended.
+	*/
+	bool isSuspended() {
+		return bSuspended;
+	}
+
+	/**
+	* Returns the name of the function, which is executed by the host, while the execution is suspended.
+	*
+	* @return	Name of the function.
+	*/
+	CToken& getHostCall() {
+		return lContinuations.back().getCalledName();
+	}
+
+	/**
+	* Returns the arguments of the function, which is executed by the host, while the execution is suspended.
+	*
+	* @return	Arguments.
+	*/
+	CLinkedList<CToken>& getHostArguments() {
+		return lContinuations.back().getValues();
+	}
+
+
+
+private:
+	/**
+	* This function resumes the topmost continuation, until the stack of continuations is empty or the execution is
+	* suspended.
+	*
+	* @param pbReturned	Whether the topmost continuation receives the result of a finished continuation.
+	* @return			Result of the execution or Error::Interpreter::INFO_HOST_CALL, if the execution is suspended.
+	*/
+	CRV<CToken> run(bool pbReturned) {
+		bool bReturned = pbReturned; //Stores whether the topmost continuation receives the result of a finished continuation.
+		while (!lContinuations.empty()) {
+			short int nKind = lContinuations.back().getKind();
+			if (bReturned && nResult != Error::SUCCESS && nKind != ContinuationKind::CONTINUATION_CALL && nKind != ContinuationKind::CONTINUATION_MAIN) {
+				//The error is passed on until a function handles it:
+				lContinuations.pop_back();
+				continue;
+			}
+			size_t nSize = lContinuations.size();
+			switch (nKind) {
+			case ContinuationKind::CONTINUATION_MAIN:
+				resumeMain();
+				break;
+			case ContinuationKind::CONTINUATION_OPERATION:
+				resumeOperation();
+				break;
+			case ContinuationKind::CONTINUATION_DECLARATION:
+				resumeDeclaration();
+				break;
+			case ContinuationKind::CONTINUATION_SET:
+				resumeSet();
+				break;
+			case ContinuationKind::CONTINUATION_PRINT:
+				resumePrint();
+				break;
+			case ContinuationKind::CONTINUATION_IF:
+				resumeIf();
+				break;
+			case ContinuationKind::CONTINUATION_WHILE:
+				resumeWhile();
+				break;
+			case ContinuationKind::CONTINUATION_RETURN:
+				resumeReturn();
+				break;
+			case ContinuationKind::CONTINUATION_ARGUMENTS:
+				resumeArguments();
+				break;
+			default:
+				resumeCall();
+				break;
+			}
+			if (bSuspended) {
+				//The host executes the called function:
+				return CRV<CToken>(lContinuations.back().getCalledName(), Error::Interpreter::INFO_HOST_CALL);
+			}
+			bReturned = lContinuations.size() < nSize;
+		}
+		return CRV<CToken>(result, nResult);
+	}
+
+
+
+private:
+	/**
+	* This function starts to evaluate the passed node (equivalent to "CInterpreter::interpretExpression()"). If the result
+	* is available immediately, it is stored as result, otherwise a continuation is pushed.
+	*
+	* @param pnNode	Index of the node.
+	* @return		Whether a continuation has been pushed.
+	*/
+	bool evaluate(unsigned int pnNode) {
+		CContinuationNode& node = pProgram->getNodes()[pnNode];
+		switch (node.getToken().getOpcode()) {
+		case Opcode::OPCODE_ADD:
+		case Opcode::OPCODE_SUBTRACT:
+		case Opcode::OPCODE_MULTIPLY:
+		case Opcode::OPCODE_DIVIDE:
+		case Opcode::OPCODE_EQUAL:
+		case Opcode::OPCODE_NOT_EQUAL:
+		case Opcode::OPCODE_GREATER:
+		case Opcode::OPCODE_LESS:
+		case Opcode::OPCODE_GREATER_EQUAL:
+		case Opcode::OPCODE_LESS_EQUAL:
+		case Opcode::OPCODE_AND:
+		case Opcode::OPCODE_OR:
+			//Operation found:
+			return evaluateOperation(pnNode);
+
+		case Opcode::OPCODE_DECLARE_INT:
+		case Opcode::OPCODE_DECLARE_DOUBLE:
+		case Opcode::OPCODE_DECLARE_BOOL:
+		case Opcode::OPCODE_DECLARE_CHAR:
+		case Opcode::OPCODE_DECLARE_STRING:
+		case Opcode::OPCODE_SET:
+		case Opcode::OPCODE_PRINT:
+		case Opcode::OPCODE_PRINTLN:
+		case Opcode::OPCODE_IF:
+		case Opcode::OPCODE_WHILE:
+		case Opcode::OPCODE_RETURN:
+		case Opcode::OPCODE_KEYWORD:
+			//Keyword found:
+			if (node.getSubTrees().empty()) {
+				return immediate(node.getToken(), Error::Interpreter::EMPTY_AST_I);
+			}
+			else if (node.getToken().getType() != Token::KEYWORD) {
+				return immediate(node.getToken(), Error::Interpreter::SYNTAX_I);
+			}
+			switch (node.getToken().getOpcode()) {
+			case Opcode::OPCODE_SET:
+				return push(ContinuationKind::CONTINUATION_SET, pnNode);
+			case Opcode::OPCODE_PRINT:
+			case Opcode::OPCODE_PRINTLN:
+				return push(ContinuationKind::CONTINUATION_PRINT, pnNode);
+			case Opcode::OPCODE_IF:
+				return push(ContinuationKind::CONTINUATION_IF, pnNode);
+			case Opcode::OPCODE_WHILE:
+				return push(ContinuationKind::CONTINUATION_WHILE, pnNode);
+			case Opcode::OPCODE_RETURN:
+				return push(ContinuationKind::CONTINUATION_RETURN, pnNode);
+			case Opcode::OPCODE_KEYWORD:
+				//Found invalid keyword:
+				return immediate(node.getToken(), Error::Interpreter::INCORRECT_TOKEN);
+			default:
+				return push(ContinuationKind::CONTINUATION_DECLARATION, pnNode);
+			}
+
+		case Opcode::OPCODE_IDENTIFIER:
+			//Identifier found:
+			if (node.getSubTrees().empty()) {
+				int nVariable = findVariable(node.getToken().getLexeme());
+				if (nVariable >= 0) {
+					//Identifier resembles variable name:
+					return immediate(CToken(lVariables[nVariable].getValue(), lVariables[nVariable].getType(), node.getToken().getFilename(), node.getToken().getLine()), Error::SUCCESS);
+				}
+			}
+			//Identifier resembles a function name:
+			return push(ContinuationKind::CONTINUATION_ARGUMENTS, pnNode);
+
+		default:
+			//Incorrect token found:
+			return immediate(CToken(), Error::Interpreter::SYNTAX_I);
+		}
+	}
+
+	/**
+	* This function starts to evaluate the passed node as operation (equivalent to "CInterpreter::evaluateOperation()").
+	*
+	* @param pnNode	Index of the node.
+	* @return		Whether a continuation has been pushed.
+	*/
+	bool evaluateOperation(unsigned int pnNode) {
+		if (pProgram->getNodes()[pnNode].getSubTrees().empty()) {
+			//The node has no subtrees -> The node itself is returned:
+			return immediate(pProgram->getNodes()[pnNode].getToken(), Error::SUCCESS);
+		}
+		return push(ContinuationKind::CONTINUATION_OPERATION, pnNode);
+	}
+
+	/**
+	* This function starts to evaluate the passed node as operand of an operation.
+	*
+	* @param pnNode	Index of the node.
+	* @return		Whether a continuation has been pushed.
+	*/
+	bool evaluateOperand(unsigned int pnNode) {
+		CToken& token = pProgram->getNodes()[pnNode].getToken();
+		if (isValue(token.getType())) {
+			return immediate(token, Error::SUCCESS);
+		}
+		else if (token.getType() == Token::IDENTIFIER) {
+			return evaluate(pnNode);
+		}
+		return evaluateOperation(pnNode);
+	}
+
+	/**
+	* This function stores the passed result, which is available without pushing a continuation.
+	*
+	* @param pResult		Result.
+	* @param pnErrorMessage	Error message.
+	* @return				Always false, since no continuation is pushed.
+	*/
+	bool immediate(const CToken& pResult, short int pnErrorMessage) {
+		result = pResult;
+		nResult = pnErrorMessage;
+		return false;
+	}
+
+	/**
+	* This function pushes a new continuation for the passed node.
+	*
+	* @param pnKind	Kind of the continuation.
+	* @param pnNode	Index of the node.
+	* @return		Always true.
+	*/
+	bool push(short int pnKind, unsigned int pnNode) {
+		lContinuations.push_back(CContinuation(pnKind, pnNode));
+		return true;
+	}
+
+	/**
+	* This function removes the topmost continuation, whose evaluation ends with the passed result.
+	*
+	* @param pResult		Result.
+	* @param pnErrorMessage	Error message.
+	*/
+	void finish(CToken pResult, short int pnErrorMessage) {
+		result = pResult;
+		nResult = pnErrorMessage;
+		lContinuations.pop_back();
+	}
+
+	/**
+	* This function removes the topmost continuation, whose evaluation ends with the current result.
+	*/
+	void finish() {
+		lContinuations.pop_back();
+	}
+
+
+
+private:
+	/**
+	* This function resumes the execution of the main-function.
+	*/
+	void resumeMain() {
+		CContinuation& continuation = lContinuations.back();
+		if (continuation.getState() == 1) {
+			//A statement has been executed:
+			if (nResult != Error::SUCCESS) {
+				//An error occured:
+				finish();
+				return;
+			}
+			continuation.getIndex()++;
+		}
+		continuation.getState() = 1;
+		vector<unsigned int>& lBody = pProgram->getFunctions()[continuation.getFunction()].getBody();
+		while (continuation.getIndex() < lBody.size()) {
+			if (evaluate(lBody[continuation.getIndex()])) {
+				return;
+			}
+			else if (nResult != Error::SUCCESS) {
+				//An error occured:
+				finish();
+				return;
+			}
+			continuation.getIndex()++;
+		}
+		finish(CToken(), Error::SUCCESS);
+	}
+
+	/**
+	* This function resumes the evaluation of the operands of an operation.
+	*/
+	void resumeOperation() {
+		CContinuation& continuation = lContinuations.back();
+		CContinuationNode& node = pProgram->getNodes()[continuation.getNode()];
+		if (continuation.getState() == 1) {
+			//An operand has been evaluated:
+			continuation.getValues().add(result);
+			continuation.getIndex()++;
+		}
+		continuation.getState() = 1;
+		while (continuation.getIndex() < node.getSubTrees().size()) {
+			if (!continuation.getValues().empty() && operations.isDecided(node.getToken(), continuation.getValues().back())) {
+				//The remaining operands of "&" or "|" cannot change the result:
+				break;
+			}
+			if (evaluateOperand(node.getSubTrees()[continuation.getIndex()])) {
+				return;
+			}
+			else if (nResult != Error::SUCCESS) {
+				//An error occured:
+				finish();
+				return;
+			}
+			continuation.getValues().add(result);
+			continuation.getIndex()++;
+		}
+		//Apply the operator to the operands:
+		CRV<CToken> rvOperation = operations.evaluate(node.getToken(), continuation.getValues());
+		finish(rvOperation.getContent(), rvOperation.getErrorMessage());
+	}
+
+	/**
+	* This function resumes a declaration.
+	*/
+	void resumeDeclaration() {
+		CContinuation& continuation = lContinuations.back();
+		CContinuationNode& node = pProgram->getNodes()[continuation.getNode()];
+		CToken& variableName = pProgram->getNodes()[node.getSubTrees()[0]].getToken();
+		short int nType = getDeclaredType(node.getToken().getOpcode());
+		if (continuation.getState() == 0) {
+			if (variableName.getType() != Token::IDENTIFIER) {
+				//Error: Incorrect token found:
+				finish(variableName, Error::Interpreter::INCORRECT_TOKEN);
+				return;
+			}
+			if (node.getSubTrees().size() != 2) {
+				if (node.getToken().getArityError() != Error::SUCCESS) {
+					//There are too many arguments with this declaration:
+					finish(node.getToken(), node.getToken().getArityError());
+					return;
+				}
+				//Initialize the variable with the standard value:
+				declare(variableName, getDefaultValue(nType), nType);
+				return;
+			}
+			CToken& initializer = pProgram->getNodes()[node.getSubTrees()[1]].getToken();
+			if (isValue(initializer.getType())) {
+				//Value can be used directly:
+				if (initializer.getType() != nType) {
+					finish(initializer, Error::produceConvertError(initializer.getType(), nType));
+					return;
+				}
+				declare(variableName, initializer.getLexeme(), nType);
+				return;
+			}
+			continuation.getState() = 1;
+			if (evaluate(node.getSubTrees()[1])) {
+				return;
+			}
+			else if (nResult != Error::SUCCESS) {
+				//An error occured:
+				finish();
+				return;
+			}
+		}
+		//The initializer has been evaluated:
+		if (result.getType() != nType) {
+			finish(result, Error::produceConvertError(result.getType(), nType));
+			return;
+		}
+		declare(variableName, result.getLexeme(), nType);
+	}
+
+	/**
+	* This function resumes the change of a variable through "set".
+	*/
+	void resumeSet() {
+		CContinuation& continuation = lContinuations.back();
+		CContinuationNode& node = pProgram->getNodes()[continuation.getNode()];
+		if (continuation.getState() == 0) {
+			if (node.getToken().getArityError() != Error::SUCCESS) {
+				//Error: Not enough or too many arguments:
+				finish(node.getToken(), node.getToken().getArityError());
+				return;
+			}
+			else if (pProgram->getNodes()[node.getSubTrees()[0]].getToken().getType() != Token::IDENTIFIER) {
+				//Error: Incorrect token found:
+				finish(pProgram->getNodes()[node.getSubTrees()[0]].getToken(), Error::Interpreter::INCORRECT_TOKEN);
+				return;
+			}
+			CToken& initializer = pProgram->getNodes()[node.getSubTrees()[1]].getToken();
+			if (isValue(initializer.getType())) {
+				//Value can be used directly:
+				assign(pProgram->getNodes()[node.getSubTrees()[0]].getToken(), initializer);
+				return;
+			}
+			continuation.getState() = 1;
+			if (evaluate(node.getSubTrees()[1])) {
+				return;
+			}
+			else if (nResult != Error::SUCCESS) {
+				//An error occured:
+				finish();
+				return;
+			}
+		}
+		//The new value has been evaluated:
+		assign(pProgram->getNodes()[node.getSubTrees()[0]].getToken(), result);
+	}
+
+	/**
+	* This function resumes "print" or "println".
+	*/
+	void resumePrint() {
+		CContinuation& continuation = lContinuations.back();
+		CContinuationNode& node = pProgram->getNodes()[continuation.getNode()];
+		if (continuation.getState() == 1) {
+			//An argument has been evaluated:
+			*pOutput << result.getLexeme();
+			continuation.getIndex()++;
+		}
+		continuation.getState() = 1;
+		while (continuation.getIndex() < node.getSubTrees().size()) {
+			CContinuationNode& argument = pProgram->getNodes()[node.getSubTrees()[continuation.getIndex()]];
+			if (!argument.getSubTrees().empty() || argument.getToken().getType() == Token::IDENTIFIER) {
+				//Further evaluation needed:
+				if (evaluate(node.getSubTrees()[continuation.getIndex()])) {
+					return;
+				}
+				else if (nResult != Error::SUCCESS) {
+					//An error occured:
+					finish();
+					return;
+				}
+				*pOutput << result.getLexeme();
+			}
+			else if (isValue(argument.getToken().getType())) {
+				//Element resembles value which can be printed:
+				*pOutput << argument.getToken().getLexeme();
+			}
+			else {
+				//Encountered invalid token:
+				finish(argument.getToken(), Error::Interpreter::INCORRECT_TOKEN);
+				return;
+			}
+			continuation.getIndex()++;
+		}
+		if (node.getToken().getOpcode() == Opcode::OPCODE_PRINTLN) {
+			*pOutput << "\n";
+		}
+		finish(node.getToken(), Error::SUCCESS);
+	}
+
+	/**
+	* This function resumes an if-statement. The state is 1 while the condition is evaluated and 2 while the body is executed.
+	*/
+	void resumeIf() {
+		CContinuation& continuation = lContinuations.back();
+		CContinuationNode& node = pProgram->getNodes()[continuation.getNode()];
+		if (continuation.getState() == 2) {
+			//A statement of the body has been executed:
+			continuation.getIndex()++;
+		}
+		else {
+			if (continuation.getState() == 0) {
+				continuation.getState() = 1;
+				if (!startCondition(node.getSubTrees()[0])) {
+					return;
+				}
+			}
+			//The condition has been evaluated:
+			if (result.getType() != Token::U_BOOL) {
+				//Error: Incorrect datatype encountered:
+				finish(result, Error::produceConvertError(result.getType(), Token::U_BOOL));
+				return;
+			}
+			bool bCondition = result.getLexeme() == "t";
+			continuation.getScope() = lVariables.size();
+			if (node.getSubTrees().size() < 2) {
+				//Error no body found:
+				finish(node.getToken(), Error::Interpreter::MISSING_BODY);
+				return;
+			}
+			else if (!bCondition && node.getSubTrees().size() < 3) {
+				//There is no else body -> terminate the execution:
+				finish(node.getToken(), Error::SUCCESS);
+				return;
+			}
+			continuation.getBody() = node.getSubTrees()[bCondition ? 1 : 2];
+			continuation.getState() = 2;
+		}
+		if (executeBody(continuation)) {
+			//Every statement was successfully executed -> Remove the variables of the body:
+			lVariables.resize(continuation.getScope());
+			finish(node.getToken(), Error::SUCCESS);
+		}
+	}
+
+	/**
+	* This function resumes a while-loop. The state is 1 while the condition is evaluated before the loop, 3 while the
+	* condition is evaluated before each iteration and 4 while the body is executed.
+	*/
+	void resumeWhile() {
+		CContinuation& continuation = lContinuations.back();
+		CContinuationNode& node = pProgram->getNodes()[continuation.getNode()];
+		while (true) {
+			if (continuation.getState() == 4) {
+				//A statement of the body has been executed:
+				continuation.getIndex()++;
+				if (!executeBody(continuation)) {
+					return;
+				}
+				//Every statement was successfully executed -> Remove the variables of the body:
+				lVariables.resize(continuation.getScope());
+				continuation.getState() = 2;
+			}
+			if (continuation.getState() == 0 || continuation.getState() == 2) {
+				continuation.getState()++;
+				if (!startCondition(node.getSubTrees()[0])) {
+					return;
+				}
+			}
+			//The condition has been evaluated:
+			if (result.getType() != Token::U_BOOL) {
+				//Error: Incorrect datatype encountered:
+				finish(result, Error::produceConvertError(result.getType(), Token::U_BOOL));
+				return;
+			}
+			if (continuation.getState() == 1) {
+				//The condition is evaluated again before the first iteration:
+				continuation.getScope() = lVariables.size();
+				continuation.getState() = 2;
+				continue;
+			}
+			if (result.getLexeme() != "t") {
+				//The condition is false -> End the iteration of the while-loop:
+				finish(node.getToken(), Error::SUCCESS);
+				return;
+			}
+			else if (node.getSubTrees().size() < 2) {
+				//Error: The body is missing:
+				finish(node.getToken(), Error::Interpreter::MISSING_BODY);
+				return;
+			}
+			else if (node.getSubTrees().size() > 2) {
+				//Error: The statement has too many arguments:
+				finish(pProgram->getNodes()[node.getSubTrees()[2]].getToken(), Error::Interpreter::TOO_MANY_ARGUMENTS);
+				return;
+			}
+			continuation.getBody() = node.getSubTrees()[1];
+			continuation.getState() = 4;
+			continuation.getIndex() = 0;
+			if (!executeBody(continuation)) {
+				return;
+			}
+			lVariables.resize(continuation.getScope());
+			continuation.getState() = 2;
+		}
+	}
+
+	/**
+	* This function resumes a return-statement.
+	*/
+	void resumeReturn() {
+		CContinuation& continuation = lContinuations.back();
+		CContinuationNode& node = pProgram->getNodes()[continuation.getNode()];
+		if (continuation.getState() == 0) {
+			if (node.getToken().getArityError() != Error::SUCCESS) {
+				//Too many values encountered which could be returned:
+				finish(node.getToken(), node.getToken().getArityError());
+				return;
+			}
+			unsigned int nValue = node.getSubTrees()[0];
+			CContinuationNode& value = pProgram->getNodes()[nValue];
+			if (nCallDepth > 0 && value.getToken().getOpcode() == Opcode::OPCODE_IDENTIFIER && (!value.getSubTrees().empty() || findVariable(value.getToken().getLexeme()) < 0)) {
+				//The returned value is computed by a call in tail position, which is executed by the calling function:
+				continuation = CContinuation(ContinuationKind::CONTINUATION_ARGUMENTS, nValue);
+				continuation.isTailCall() = true;
+				return;
+			}
+			if (value.getSubTrees().empty() && isValue(value.getToken().getType())) {
+				finish(value.getToken(), Error::Interpreter::INFO_RETURN_STATEMENT_ENCOUNTERED);
+				return;
+			}
+			//Further evaluation needed for return value:
+			continuation.getState() = 1;
+			if (evaluate(nValue)) {
+				return;
+			}
+			else if (nResult != Error::SUCCESS) {
+				//An error occured:
+				finish();
+				return;
+			}
+		}
+		finish(result, Error::Interpreter::INFO_RETURN_STATEMENT_ENCOUNTERED);
+	}
+
+	/**
+	* This function resumes the evaluation of the arguments of a function call. Afterwards the continuation is replaced
+	* with the call, or the call in tail position is passed on to the calling function.
+	*/
+	void resumeArguments() {
+		CContinuation& continuation = lContinuations.back();
+		CContinuationNode& node = pProgram->getNodes()[continuation.getNode()];
+		if (continuation.getState() == 1) {
+			//An argument has been evaluated:
+			continuation.getValues().add(result);
+			continuation.getIndex()++;
+		}
+		continuation.getState() = 1;
+		while (continuation.getIndex() < node.getSubTrees().size()) {
+			CContinuationNode& argument = pProgram->getNodes()[node.getSubTrees()[continuation.getIndex()]];
+			if (!argument.getSubTrees().empty() || !isValue(argument.getToken().getType())) {
+				//Further evaluation neccessary:
+				if (evaluate(node.getSubTrees()[continuation.getIndex()])) {
+					return;
+				}
+				else if (nResult != Error::SUCCESS) {
+					//An error occured:
+					finish();
+					return;
+				}
+				continuation.getValues().add(result);
+			}
+			else {
+				continuation.getValues().add(argument.getToken());
+			}
+			continuation.getIndex()++;
+		}
+
+		if (continuation.isTailCall()) {
+			tailCallName = node.getToken();
+			lTailCallArguments = move(continuation.getValues());
+			finish(tailCallName, Error::Interpreter::INFO_TAIL_CALL);
+			return;
+		}
+		//Call the function:
+		continuation.getKind() = ContinuationKind::CONTINUATION_CALL;
+		continuation.getName() = node.getToken();
+		continuation.getCalledName() = node.getToken();
+		continuation.getState() = 0;
+		continuation.getIndex() = 0;
+	}
+
+	/**
+	* This function resumes a function call (equivalent to "CInterpreter::callFunction()"). The state is 1 while the
+	* statements are executed and 2 while a function, which is called in tail position and has another return type, is
+	* executed.
+	*/
+	void resumeCall() {
+		CContinuation& continuation = lContinuations.back();
+		CToken returnValue;
+		while (true) {
+			bool bCompleted = true; //Stores whether every statement has been executed.
+			if (continuation.getState() == 0) {
+				//Find the function:
+				int nFunction = pProgram->findFunction(continuation.getCalledName().getLexeme());
+				if (nFunction < 0 && bHostCalls) {
+					//The host executes the function and resumes the execution with it's result:
+					continuation.getState() = 3;
+					bSuspended = true;
+					return;
+				}
+				else if (nFunction < 0) {
+					//The called function does not exist:
+					finish(continuation.getCalledName(), Error::Interpreter::FUNCTION_DOES_NOT_EXIST);
+					return;
+				}
+				CContinuationFunction& function = pProgram->getFunctions()[nFunction];
+				CLinkedList<CToken>& lArguments = continuation.getValues();
+				if (function.getParameters().size() != lArguments.size()) {
+					//Incorrect number of arguments are passed:
+					finish(continuation.getCalledName(), Error::Interpreter::INCORRECT_NUMBER_OF_ARGUMENTS_PASSED);
+					return;
+				}
+				vector<CVariable> lParameters; //Stores the parameters with the passed arguments.
+				lParameters.reserve(lArguments.size());
+				unsigned int i = 0;
+				for (CToken& argument : lArguments) {
+					if (function.getParameters()[i].getType() != argument.getType()) {
+						//Error: The passed type is not identical with the parameter type:
+						finish(argument, Error::produceConvertError(argument.getType(), function.getParameters()[i].getType()));
+						return;
+					}
+					lParameters.push_back(CVariable(function.getParameters()[i].getName(), argument.getLexeme(), argument.getType()));
+					i++;
+				}
+
+				//Save the variables of the currently executed function:
+				if (!continuation.isFrameCreated()) {
+					if (nCallDepth >= nMaximumDepth) {
+						//Too many functions are executed within each other:
+						finish(continuation.getCalledName(), Error::Interpreter::STACK_OVERFLOW);
+						return;
+					}
+					continuation.getSavedVariables() = move(lVariables);
+					continuation.isFrameCreated() = true;
+				}
+				lVariables = move(lParameters);
+				continuation.getFunction() = nFunction;
+				continuation.getIndex() = 0;
+				continuation.getState() = 1;
+				nCallDepth++;
+			}
+			else if (continuation.getState() == 1) {
+				//A statement has been executed:
+				if (nResult == Error::SUCCESS) {
+					continuation.getIndex()++;
+				}
+				else {
+					bCompleted = false;
+				}
+			}
+
+			if (continuation.getState() == 1) {
+				//Execute the function's statements:
+				vector<unsigned int>& lBody = pProgram->getFunctions()[continuation.getFunction()].getBody();
+				while (bCompleted && continuation.getIndex() < lBody.size()) {
+					if (evaluate(lBody[continuation.getIndex()])) {
+						return;
+					}
+					else if (nResult != Error::SUCCESS) {
+						bCompleted = false;
+						break;
+					}
+					continuation.getIndex()++;
+				}
+				nCallDepth--;
+				returnValue = CToken();
+				if (bCompleted) {
+					//The function ends without a return statement...
+				}
+				else if (nResult == Error::Interpreter::INFO_RETURN_STATEMENT_ENCOUNTERED) {
+					//The function's execution was terminated through a return statement:
+					returnValue = result;
+				}
+				else if (nResult == Error::Interpreter::INFO_TAIL_CALL) {
+					//The function's execution was terminated through a return statement with a call:
+					int nTailFunction = pProgram->findFunction(tailCallName.getLexeme());
+					if (nTailFunction >= 0 && pProgram->getFunctions()[nTailFunction].getReturnType() == pProgram->getFunctions()[continuation.getFunction()].getReturnType()) {
+						//Reuse the frame for the called function:
+						continuation.getCalledName() = tailCallName;
+						continuation.getValues() = move(lTailCallArguments);
+						continuation.getState() = 0;
+						continue;
+					}
+					//The return value of the called function needs to be converted:
+					continuation.getState() = 2;
+					lContinuations.push_back(CContinuation(ContinuationKind::CONTINUATION_CALL, 0));
+					lContinuations.back().getName() = tailCallName;
+					lContinuations.back().getCalledName() = tailCallName;
+					lContinuations.back().getValues() = move(lTailCallArguments);
+					return;
+				}
+				else {
+					//An error occured:
+					finish();
+					return;
+				}
+			}
+			else {
+				//The function, which has been called in tail position, has returned:
+				if (nResult != Error::SUCCESS) {
+					//An error occured:
+					finish();
+					return;
+				}
+				returnValue = result;
+			}
+			break;
+		}
+
+		CContinuationFunction& function = pProgram->getFunctions()[continuation.getFunction()];
+		if (function.getReturnType() == Token::U_VOID) {
+			//No return value expected -> Restore variables of old function call:
+			lVariables = move(continuation.getSavedVariables());
+			finish(continuation.getName(), Error::SUCCESS);
+			return;
+		}
+		else if (returnValue.getType() != function.getReturnType()) {
+			//The returned value's type is not identical with the function's return type:
+			finish(returnValue, Error::produceConvertError(returnValue.getType(), function.getReturnType()));
+			return;
+		}
+		//Restore variables of old function call:
+		lVariables = move(continuation.getSavedVariables());
+		finish(returnValue, Error::SUCCESS);
+	}
+
+
+
+private:
+	/**
+	* This function starts to evaluate the condition of an if-statement or while-loop.
+	*
+	* @param pnCondition	Index of the node of the condition.
+	* @return				Whether the condition is available as result.
+	*/
+	bool startCondition(unsigned int pnCondition) {
+		if (pProgram->getNodes()[pnCondition].getSubTrees().empty()) {
+			//No further evaluation needed:
+			result = pProgram->getNodes()[pnCondition].getToken();
+			return true;
+		}
+		else if (evaluate(pnCondition)) {
+			return false;
+		}
+		else if (nResult != Error::SUCCESS) {
+			//An error occured:
+			finish();
+			return false;
+		}
+		return true;
+	}
+
+	/**
+	* This function executes the statements of the body of the passed continuation from the current index. The body is
+	* either a single statement or a branch of statements.
+	*
+	* @param pContinuation	Continuation of an if-statement or while-loop.
+	* @return				Whether every statement has been executed.
+	*/
+	bool executeBody(CContinuation& pContinuation) {
+		unsigned int nBody = pContinuation.getBody();
+		bool bBranch = pProgram->getNodes()[nBody].getToken().getType() == Token::BRANCH;
+		unsigned int nStatements = bBranch ? pProgram->getNodes()[nBody].getSubTrees().size() : 1;
+		while (pContinuation.getIndex() < nStatements) {
+			if (evaluate(bBranch ? pProgram->getNodes()[nBody].getSubTrees()[pContinuation.getIndex()] : nBody)) {
+				return false;
+			}
+			else if (nResult != Error::SUCCESS) {
+				//An error occured:
+				finish();
+				return false;
+			}
+			pContinuation.getIndex()++;
+		}
+		return true;
+	}
+
+	/**
+	* This function declares a new variable.
+	*
+	* @param pName		Token with the name of the variable.
+	* @param psValue	Value of the variable.
+	* @param pnType		Type of the variable.
+	*/
+	void declare(CToken pName, string psValue, short int pnType) {
+		if (findVariable(pName.getLexeme()) >= 0) {
+			//Variable's name does already exist:
+			finish(pName, Error::Interpreter::VARIABLE_NAME_ALREADY_IN_USE);
+			return;
+		}
+		lVariables.push_back(CVariable(pName.getLexeme(), psValue, pnType));
+		finish(pName, Error::SUCCESS);
+	}
+
+	/**
+	* This function changes the value of a variable. The variable keeps it's position, so that variables, which are
+	* declared afterwards, can still be removed by the enclosing body.
+	*
+	* @param pName	Token with the name of the variable.
+	* @param pValue	New value of the variable.
+	*/
+	void assign(CToken pName, CToken pValue) {
+		int nVariable = findVariable(pName.getLexeme());
+		if (nVariable < 0) {
+			finish(pName, Error::Interpreter::VARIABLE_DOES_NOT_EXIST);
+			return;
+		}
+		else if (lVariables[nVariable].getType() != pValue.getType()) {
+			//Error: New value has different data-type:
+			finish(pName, Error::produceConvertError(pValue.getType(), lVariables[nVariable].getType()));
+			return;
+		}
+		lVariables[nVariable].changeValue(pValue.getLexeme());
+		finish(pName, Error::SUCCESS);
+	}
+
+
+
+private:
+	/**
+	* This function returns the index of the variable with the passed name.
+	*
+	* @param psName	Name of the variable.
+	* @return		Index of the variable or -1, if the variable does not exist.
+	*/
+	int findVariable(const string& psName) {
+		for (unsigned int i = 0; i < lVariables.size(); i++) {
+			if (lVariables[i].getName() == psName) {
+				return i;
+			}
+		}
+		return -1;
+	}
+
+	/**
+	* This function returns whether the passed token type resembles a value.
+	*
+	* @param pnType	Type of the token.
+	* @return		Whether the token is a value.
+	*/
+	bool isValue(short int pnType) {
+		return pnType == Token::U_INT || pnType == Token::U_DOUBLE || pnType == Token::U_BOOL || pnType == Token::U_CHAR || pnType == Token::U_STRING;
+	}
+
+	/**
+	* This function returns the type of the variable, which is declared with the passed opcode.
+	*
+	* @param pnOpcode	Opcode of the declaration.
+	* @return			Type of the variable.
+	*/
+	short int getDeclaredType(short int pnOpcode) {
+		switch (pnOpcode) {
+		case Opcode::OPCODE_DECLARE_INT:
+			return Token::U_INT;
+		case Opcode::OPCODE_DECLARE_DOUBLE:
+			return Token::U_DOUBLE;
+		case Opcode::OPCODE_DECLARE_BOOL:
+			return Token::U_BOOL;
+		case Opcode::OPCODE_DECLARE_CHAR:
+			return Token::U_CHAR;
+		default:
+			return Token::U_STRING;
+		}
+	}
+
+	/**
+	* This function returns the standard value of a variable with the passed type.
+	*
+	* @param pnType	Type of the variable.
+	* @return		Standard value.
+	*/
+	string getDefaultValue(short int pnType) {
+		switch (pnType) {
+		case Token::U_INT:
+			return "0";
+		case Token::U_DOUBLE:
+			return "0.0";
+		case Token::U_BOOL:
+			return "nil";
+		case Token::U_CHAR:
+			return " ";
+		default:
+			return "";
+		}
+	}
+};
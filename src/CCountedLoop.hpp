@@ -0,0 +1,308 @@
+/*
+FILE:		CCountedLoop.hpp
+
+REMARKS:	This file contains the class "CCountedLoop", which reads the parts of a for-loop or a parallel loop and combines
+			the results of the reductions.
+*/
+#pragma once
+
+#include <algorithm>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "CAbstractSyntaxTree.hpp"
+#include "CRV.hpp"
+#include "CToken.hpp"
+#include "Variables/ErrorMessages.hpp"
+#include "Variables/KeywordTypes.hpp"
+#include "Variables/OpcodeTypes.hpp"
+#include "Variables/TokenTypes.hpp"
+
+using namespace std;
+#define LOOP_CHUNKS 64 //Number of chunks, into which the range of a parallel loop is split.
+
+
+
+/**
+* The class "CCountedLoop" stores the parts of a counted loop: "(for i 0 10 (...))" executes the body for every integer
+* from the first value up to (excluding) the last value, "(pfor i 0 10 (+ sum) (...))" does the same with multiple
+* threads. The clauses between the range and the body are only allowed in parallel loops:
+*	- "static" or "dynamic":	Schedule of the loop. A static loop hands a block of consecutive chunks to every
+*								thread, a dynamic loop hands the chunks to the threads, that are idle (default is
+*								"static").
+*	- "(+ x)", "(* x)":			Sum or product of the values, to which x is set by the iterations.
+*	- "(min x)", "(max x)":		Smallest or largest value, to which x is set by the iterations.
+* The range is split into LOOP_CHUNKS chunks, whose boundaries only depend on the number of iterations. Every chunk starts
+* with the neutral value of each reduction, the results of the chunks are combined with the value of the variable before
+* the loop in the order of the chunks, so that rounded sums and products of doubles do not depend on the number of threads.
+*
+* @author	Christian-2003
+* @version	19.10.2026
+*/
+class CCountedLoop {
+private:
+	/**
+	* Stores the name of the counter.
+	*/
+	string sCounter;
+
+	/**
+	* Stores whether the iterations are executed by multiple threads.
+	*/
+	bool bParallel;
+
+	/**
+	* Stores whether the chunks are handed to the threads, that are idle.
+	*/
+	bool bDynamic;
+
+	/**
+	* Stores the kind of every reduction: OPCODE_ADD, OPCODE_MULTIPLY, OPCODE_LESS (min) or OPCODE_GREATER (max).
+	*/
+	vector<short int> vnReductions;
+
+	/**
+	* Stores the variable of every reduction (same index as vnReductions).
+	*/
+	vector<string> vsReductions;
+
+
+
+public:
+	/**
+	* The default constructor instantiates a new loop without reductions.
+	*/
+	CCountedLoop() {
+		sCounter = "";
+		bParallel = false;
+		bDynamic = false;
+	}
+
+
+
+public:
+	/**
+	* This function reads the counter and the clauses of the passed loop, whose opcodes have been resolved.
+	*
+	* @param pAST	Abstract syntax tree of the loop.
+	* @return		Error message including the token, which caused the error.
+	*/
+	CRV<CToken> read(CAbstractSyntaxTree<CToken> pAST) {
+		CToken headNode = pAST.getContent();
+		if (headNode.getArityError() != Error::SUCCESS) {
+			//Error: The counter, the range or the body is missing:
+			return CRV<CToken>(headNode, headNode.getArityError());
+		}
+		CAbstractSyntaxTree<CToken> tCounter = pAST.getSubTreeAtIndex(0); //Stores the counter.
+		if (tCounter.getContent().getType() != Token::IDENTIFIER || tCounter.hasSubTrees()) {
+			//Error: The counter is no name:
+			return CRV<CToken>(tCounter.getContent(), Error::Interpreter::INCORRECT_TOKEN);
+		}
+		sCounter = tCounter.getContent().getLexeme();
+		bParallel = headNode.getOpcode() == Opcode::OPCODE_PFOR;
+		bDynamic = false;
+		vnReductions.clear();
+		vsReductions.clear();
+		for (unsigned int i = 3; i + 1 < pAST.getSubTreeNumber(); i++) {
+			CAbstractSyntaxTree<CToken> tClause = pAST.getSubTreeAtIndex(i); //Stores the current clause.
+			CToken clause = tClause.getContent();
+			if (!tClause.hasSubTrees() && clause.getType() == Token::IDENTIFIER && (clause.getLexeme() == Keyword::STATIC || clause.getLexeme() == Keyword::DYNAMIC)) {
+				//Found schedule:
+				bDynamic = clause.getLexeme() == Keyword::DYNAMIC;
+				continue;
+			}
+			short int nReduction = Opcode::OPCODE_NONE; //Stores the kind of the reduction.
+			if (clause.getOpcode() == Opcode::OPCODE_ADD || clause.getOpcode() == Opcode::OPCODE_MULTIPLY) {
+				nReduction = clause.getOpcode();
+			}
+			else if (clause.getType() == Token::IDENTIFIER && clause.getLexeme() == Keyword::MIN) {
+				nReduction = Opcode::OPCODE_LESS;
+			}
+			else if (clause.getType() == Token::IDENTIFIER && clause.getLexeme() == Keyword::MAX) {
+				nReduction = Opcode::OPCODE_GREATER;
+			}
+			if (nReduction == Opcode::OPCODE_NONE || tClause.getSubTreeNumber() != 1 || tClause.getSubTreeAtIndex(0).hasSubTrees() || tClause.getSubTreeAtIndex(0).getContent().getType() != Token::IDENTIFIER) {
+				//Error: Unknown clause:
+				return CRV<CToken>(clause, Error::Interpreter::INVALID_LOOP_CLAUSE);
+			}
+			string sVariable = tClause.getSubTreeAtIndex(0).getContent().getLexeme(); //Stores the name of the variable.
+			if (sVariable == sCounter || findReduction(sVariable) >= 0) {
+				//Error: The variable is reduced twice or is the counter:
+				return CRV<CToken>(tClause.getSubTreeAtIndex(0).getContent(), Error::Interpreter::INVALID_LOOP_CLAUSE);
+			}
+			vnReductions.push_back(nReduction);
+			vsReductions.push_back(sVariable);
+		}
+		return CRV<CToken>(headNode, Error::SUCCESS);
+	}
+
+	/**
+	* This function returns the index of the reduction of the passed variable.
+	*
+	* @param psVariable	Name of the variable.
+	* @return			Index of the reduction or -1, if the variable is not reduced.
+	*/
+	int findReduction(string psVariable) {
+		for (unsigned int i = 0; i < vsReductions.size(); i++) {
+			if (vsReductions[i] == psVariable) {
+				return i;
+			}
+		}
+		return -1;
+	}
+
+	/**
+	* This function returns the number of iterations of every chunk (only the last chunk can be smaller). The size does not
+	* depend on the number of threads, since the order, in which the results of the chunks are combined, would change the
+	* rounding of doubles otherwise.
+	*
+	* @param pnIterations	Number of iterations of the loop.
+	* @return				Number of iterations of a chunk.
+	*/
+	long long getChunkSize(long long pnIterations) {
+		return max<long long>(1, (pnIterations + LOOP_CHUNKS - 1) / LOOP_CHUNKS);
+	}
+
+	/**
+	* This function returns the neutral value of the passed reduction, with which every chunk starts.
+	*
+	* @param pnReduction	Index of the reduction.
+	* @param pnType			Type of the variable (Token::U_INT or Token::U_DOUBLE).
+	* @return				Neutral value.
+	*/
+	CToken identity(unsigned int pnReduction, short int pnType) {
+		bool bInteger = pnType == Token::U_INT; //Stores whether the variable is an integer.
+		string sValue; //Stores the lexeme of the value.
+		switch (vnReductions[pnReduction]) {
+		case Opcode::OPCODE_ADD:
+			sValue = bInteger ? "0" : "0.0";
+			break;
+
+		case Opcode::OPCODE_MULTIPLY:
+			sValue = bInteger ? "1" : "1.0";
+			break;
+
+		case Opcode::OPCODE_LESS:
+			sValue = bInteger ? to_string(numeric_limits<int>::max()) : to_string(numeric_limits<double>::max());
+			break;
+
+		default:
+			sValue = bInteger ? to_string(numeric_limits<int>::min()) : to_string(numeric_limits<double>::lowest());
+			break;
+		}
+		return CToken(sValue, pnType);
+	}
+
+	/**
+	* This function combines the passed values of a reduction in the same way, in which the operators "+" and "*" would
+	* combine them.
+	*
+	* @param pnReduction	Index of the reduction.
+	* @param pFirst			Value of the variable or the previous chunks.
+	* @param pSecond		Result of the next chunk (same type as pFirst).
+	* @return				Combined value.
+	*/
+	CToken combine(unsigned int pnReduction, CToken pFirst, CToken pSecond) {
+		string sValue; //Stores the lexeme of the combined value.
+		if (pFirst.getType() == Token::U_INT) {
+			int nFirst = stoi(pFirst.getLexeme());
+			int nSecond = stoi(pSecond.getLexeme());
+			switch (vnReductions[pnReduction]) {
+			case Opcode::OPCODE_ADD:
+				sValue = to_string(nFirst + nSecond);
+				break;
+
+			case Opcode::OPCODE_MULTIPLY:
+				sValue = to_string(nFirst * nSecond);
+				break;
+
+			case Opcode::OPCODE_LESS:
+				return nSecond < nFirst ? pSecond : pFirst;
+
+			default:
+				return nSecond > nFirst ? pSecond : pFirst;
+			}
+		}
+		else {
+			double nFirst = stod(pFirst.getLexeme());
+			double nSecond = stod(pSecond.getLexeme());
+			switch (vnReductions[pnReduction]) {
+			case Opcode::OPCODE_ADD:
+				sValue = to_string(nFirst + nSecond);
+				break;
+
+			case Opcode::OPCODE_MULTIPLY:
+				sValue = to_string(nFirst * nSecond);
+				break;
+
+			case Opcode::OPCODE_LESS:
+				return nSecond < nFirst ? pSecond : pFirst;
+
+			default:
+				return nSecond > nFirst ? pSecond : pFirst;
+			}
+		}
+		return CToken(sValue, pFirst.getType(), pFirst.getFilename(), pFirst.getLine());
+	}
+
+
+
+public:
+	/**
+	* Returns the name of the counter.
+	*
+	* @return	Name of the counter.
+	*/
+	string getCounter() {
+		return sCounter;
+	}
+
+	/**
+	* Returns whether the iterations are executed by multiple threads.
+	*
+	* @return	Whether the loop is parallel.
+	*/
+	bool isParallel() {
+		return bParallel;
+	}
+
+	/**
+	* Returns whether the chunks are handed to the threads, that are idle.
+	*
+	* @return	Whether the schedule is dynamic.
+	*/
+	bool isDynamic() {
+		return bDynamic;
+	}
+
+	/**
+	* Returns the number of reductions.
+	*
+	* @return	Number of reductions.
+	*/
+	unsigned int getReductions() {
+		return vsReductions.size();
+	}
+
+	/**
+	* Returns the kind of the reduction at the passed index.
+	*
+	* @param pnReduction	Index of the reduction.
+	* @return				OPCODE_ADD, OPCODE_MULTIPLY, OPCODE_LESS (min) or OPCODE_GREATER (max).
+	*/
+	short int getReduction(unsigned int pnReduction) {
+		return vnReductions[pnReduction];
+	}
+
+	/**
+	* Returns the variable of the reduction at the passed index.
+	*
+	* @param pnReduction	Index of the reduction.
+	* @return				Name of the variable.
+	*/
+	string getReductionVariable(unsigned int pnReduction) {
+		return vsReductions[pnReduction];
+	}
+};
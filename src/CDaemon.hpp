@@ -0,0 +1,317 @@
+/*
+FILE:		CDaemon.hpp
+
+REMARKS:	This file contains the class "CDaemon", which executes sourcecode, that is submitted through a local Unix domain
+			socket, without starting a new interpreter for every submission.
+*/
+#pragma once
+
+#include <iostream>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <string>
+
+#if !defined(_WIN32)
+#include <cerrno>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+#include "CSocket.hpp"
+#include "Variables/ErrorMessages.hpp"
+
+using namespace std;
+#define DAEMON_BACKLOG 64
+
+
+
+/**
+* This enumeration contains the requests, which can be sent to a daemon.
+*/
+enum DaemonRequest : const unsigned int {
+	DAEMON_EXECUTE = 0, //The passed sourcecode is executed.
+	DAEMON_STOP = 1 //The daemon stops accepting submissions.
+};
+
+
+
+/**
+* The class "CDaemon" listens on a Unix domain socket for sourcecode, which is submitted by clients. Every submission is
+* executed by the function, which is passed to the daemon, and the status, the time and the output are sent back to the
+* client. The daemon is started after the terminal has prepared everything, that is shared by the submissions (e.g. the
+* parsed functions of a prelude), so that a submission only needs to prepare it's own sourcecode.
+* In fork mode, every submission is executed by a child process, which is forked from the daemon after the submission has
+* been received. The child shares the prepared memory of the daemon (copy-on-write) and cannot change or crash it.
+* Multiple submissions are executed simultaneously. In reset mode, the daemon executes every submission itself, one
+* after another, with a new interpreter, which avoids the time of the fork.
+* A message consists of a header with integers of fixed width followed by the sourcecode or the output. Unix domain
+* sockets and fork() are only available on POSIX-systems, on MS Windows "isSupported()" returns false.
+*
+* @author	Christian-2003
+* @version	19.10.2026
+*/
+class CDaemon {
+private:
+	/**
+	* The struct "SRequest" stores the header of a submission.
+	*/
+	struct SRequest {
+		uint32_t nType; //Stores the type of the request (see DaemonRequest).
+		uint32_t nLength; //Stores the length of the sourcecode.
+	};
+
+	/**
+	* The struct "SResponse" stores the header of the result of a submission.
+	*/
+	struct SResponse {
+		int64_t nMicroseconds; //Stores the time, which the execution needed within the daemon.
+		int32_t nStatus; //Stores the error message of the submission.
+		uint32_t nLength; //Stores the length of the output.
+	};
+
+
+
+private:
+	/**
+	* Stores the function, which executes the sourcecode (passed as first argument) of a submission and writes the output
+	* into the second argument.
+	*/
+	function<short int(const string&, string&)> execute;
+
+	/**
+	* Stores whether every submission is executed by a forked child process.
+	*/
+	bool bFork;
+
+	/**
+	* Stores the number of submissions, which have been executed.
+	*/
+	unsigned long long nSubmissions;
+
+
+
+public:
+	/**
+	* This constructor instantiates a new daemon.
+	*
+	* @param pExecute	Function, which executes the sourcecode of a submission and returns it's error message.
+	* @param pbFork		Whether every submission is executed by a forked child process.
+	*/
+	CDaemon(function<short int(const string&, string&)> pExecute, bool pbFork) : execute(pExecute) {
+		bFork = pbFork;
+		nSubmissions = 0;
+	}
+
+
+
+public:
+	/**
+	* Returns whether a daemon can be started on this platform.
+	*
+	* @return	Whether daemons are supported.
+	*/
+	static bool isSupported() {
+#if defined(_WIN32)
+		return false;
+#else
+		return true;
+#endif
+	}
+
+	/**
+	* This function listens on the passed socket and executes every submission, until a client stops the daemon.
+	*
+	* @param psSocket	Path of the socket, which is created (an existing socket is replaced, while any other existing file
+	*					is kept and the daemon does not listen).
+	* @return			Whether the daemon could listen on the socket.
+	*/
+	bool serve(string psSocket) {
+#if defined(_WIN32)
+		return false;
+#else
+		sockaddr_un address;
+		if (!createAddress(psSocket, address)) {
+			return false;
+		}
+		struct stat status; //Stores the type of the file, which already exists at the path.
+		if (lstat(psSocket.c_str(), &status) == 0) {
+			if (!S_ISSOCK(status.st_mode)) {
+				//Error: Only a socket, which has been left behind by another daemon, is replaced:
+				return false;
+			}
+			unlink(psSocket.c_str());
+		}
+		int nListener = socket(AF_UNIX, SOCK_STREAM, 0); //Stores the socket, on which the daemon listens.
+		if (nListener < 0) {
+			return false;
+		}
+		if (bind(nListener, (sockaddr*)&address, sizeof(address)) != 0 || listen(nListener, DAEMON_BACKLOG) != 0) {
+			close(nListener);
+			return false;
+		}
+		bool bRunning = true; //Stores whether the daemon accepts further submissions.
+		while (bRunning) {
+			int nClient = accept(nListener, nullptr, nullptr); //Stores the socket of the client.
+			if (nClient < 0) {
+				if (errno == EINTR || errno == ECONNABORTED) {
+					continue;
+				}
+				break;
+			}
+			//Collect the children, which have finished their submissions:
+			while (waitpid(-1, nullptr, WNOHANG) > 0);
+			SRequest request;
+			string sSourcecode = "";
+			if (!CSocket::receive(nClient, &request, sizeof(request)) || !CSocket::receiveString(nClient, request.nLength, sSourcecode)) {
+				close(nClient);
+				continue;
+			}
+			if (request.nType == DaemonRequest::DAEMON_STOP) {
+				respond(nClient, Error::SUCCESS, 0, "");
+				bRunning = false;
+			}
+			else if (bFork) {
+				//The child executes the submission, while the daemon accepts the next one:
+				cout.flush();
+				cerr.flush();
+				pid_t nProcess = fork();
+				if (nProcess == 0) {
+					close(nListener);
+					run(nClient, sSourcecode);
+					_exit(0);
+				}
+				else if (nProcess < 0) {
+					respond(nClient, Error::Interpreter::PROCESS_CRASHED, 0, "The process could not be forked.\n");
+				}
+			}
+			else {
+				run(nClient, sSourcecode);
+			}
+			nSubmissions += request.nType == DaemonRequest::DAEMON_EXECUTE ? 1 : 0;
+			close(nClient);
+		}
+		close(nListener);
+		unlink(psSocket.c_str());
+		while (waitpid(-1, nullptr, 0) > 0);
+		return true;
+#endif
+	}
+
+	/**
+	* Returns the number of submissions, which have been executed.
+	*
+	* @return	Number of submissions.
+	*/
+	unsigned long long getSubmissions() {
+		return nSubmissions;
+	}
+
+
+
+public:
+	/**
+	* This function submits the passed request to the daemon, which listens on the passed socket, and waits for the result.
+	*
+	* @param psSocket		Path of the socket of the daemon.
+	* @param pnType			Type of the request (see DaemonRequest).
+	* @param psSourcecode	Sourcecode, which is executed.
+	* @param pnStatus		Error message of the submission (Error::Interpreter::PROCESS_CRASHED, if the daemon or
+	*						it's child closed the connection without a result).
+	* @param pnMicroseconds	Time in microseconds, which the execution needed within the daemon.
+	* @param psOutput		Output of the submission.
+	* @return				Whether the daemon could be reached.
+	*/
+	static bool submit(string psSocket, unsigned int pnType, const string& psSourcecode, short int& pnStatus, long long& pnMicroseconds, string& psOutput) {
+#if defined(_WIN32)
+		return false;
+#else
+		sockaddr_un address;
+		if (!createAddress(psSocket, address)) {
+			return false;
+		}
+		int nSocket = socket(AF_UNIX, SOCK_STREAM, 0); //Stores the socket of the connection.
+		if (nSocket < 0) {
+			return false;
+		}
+		if (connect(nSocket, (sockaddr*)&address, sizeof(address)) != 0) {
+			close(nSocket);
+			return false;
+		}
+		SRequest request;
+		request.nType = pnType;
+		request.nLength = psSourcecode.size();
+		SResponse response;
+		if (CSocket::transmit(nSocket, &request, sizeof(request)) && CSocket::transmit(nSocket, psSourcecode.data(), psSourcecode.size()) && CSocket::receive(nSocket, &response, sizeof(response)) && CSocket::receiveString(nSocket, response.nLength, psOutput)) {
+			pnStatus = (short int)response.nStatus;
+			pnMicroseconds = response.nMicroseconds;
+		}
+		else {
+			//The connection has been closed without a result:
+			pnStatus = Error::Interpreter::PROCESS_CRASHED;
+			pnMicroseconds = 0;
+			psOutput = "The daemon closed the connection without a result.\n";
+		}
+		close(nSocket);
+		return true;
+#endif
+	}
+
+
+
+#if !defined(_WIN32)
+private:
+	/**
+	* This function executes the passed sourcecode and sends the result to the client.
+	*
+	* @param pnClient		Socket of the client.
+	* @param psSourcecode	Sourcecode, which is executed.
+	*/
+	void run(int pnClient, const string& psSourcecode) {
+		string sOutput = "";
+		chrono::steady_clock::time_point begin = chrono::steady_clock::now();
+		short int nStatus = execute(psSourcecode, sOutput);
+		respond(pnClient, nStatus, chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - begin).count(), sOutput);
+	}
+
+	/**
+	* This function sends the result of a submission to the client.
+	*
+	* @param pnClient		Socket of the client.
+	* @param pnStatus		Error message of the submission.
+	* @param pnMicroseconds	Time, which the execution needed.
+	* @param psOutput		Output of the submission.
+	*/
+	static void respond(int pnClient, short int pnStatus, long long pnMicroseconds, const string& psOutput) {
+		SResponse response;
+		response.nMicroseconds = pnMicroseconds;
+		response.nStatus = pnStatus;
+		response.nLength = psOutput.size();
+		if (CSocket::transmit(pnClient, &response, sizeof(response))) {
+			CSocket::transmit(pnClient, psOutput.data(), psOutput.size());
+		}
+	}
+
+	/**
+	* This function converts the passed path into the address of a Unix domain socket.
+	*
+	* @param psSocket	Path of the socket.
+	* @param pAddress	Address, into which the path is written.
+	* @return			Whether the path is short enough.
+	*/
+	static bool createAddress(const string& psSocket, sockaddr_un& pAddress) {
+		memset(&pAddress, 0, sizeof(pAddress));
+		pAddress.sun_family = AF_UNIX;
+		if (psSocket.empty() || psSocket.size() >= sizeof(pAddress.sun_path)) {
+			return false;
+		}
+		memcpy(pAddress.sun_path, psSocket.data(), psSocket.size());
+		return true;
+	}
+#endif
+};
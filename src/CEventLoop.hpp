@@ -0,0 +1,267 @@
+/*
+FILE:		CEventLoop.hpp
+
+REMARKS:	This file contains the class "CEventLoop", with which a single thread executes many functions of a Lisp-program
+			simultaneously, while they wait for functions, which are executed by the host.
+*/
+#pragma once
+
+#include <iostream>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+
+#include "CContext.hpp"
+#include "CContinuationEvaluator.hpp"
+#include "CLinkedList.hpp"
+#include "CProgram.hpp"
+#include "CRV.hpp"
+#include "CToken.hpp"
+#include "Variables/ErrorMessages.hpp"
+#include "Variables/TokenTypes.hpp"
+
+using namespace std;
+
+
+
+/**
+* A host result passes the return value of a host function (or the token, which caused an error) together with it's error
+* message to the event loop, which resumes the waiting execution. It can be called from any thread, but only once.
+*/
+typedef function<void(CToken, short int)> HostResult;
+
+/**
+* A host function is executed, when a Lisp-function calls a function, which is not defined by the program. It receives the
+* arguments of the call and passes it's result through the host result, either immediately or once it is available.
+*/
+typedef function<void(CLinkedList<CToken>, HostResult)> HostFunction;
+
+/**
+* A completion receives the result of an execution (the return value of the called function, an empty token for
+* void-functions, or the error message) and it's output, once the execution has finished.
+*/
+typedef function<void(CRV<CToken>, const string&)> Completion;
+
+
+
+/**
+* The class "CEventLoop" executes functions of a program, which spend most of their time waiting for the host (e.g. for
+* I/O), without a thread for every execution. Every execution is evaluated by a continuation evaluator, which stores the
+* state of the execution on the heap. When a Lisp-function calls a function, which the program does not define, the
+* execution is suspended and the host function with the same name is called. Once the host passes the result, the
+* execution is resumed by the next call of "poll()" or "run()".
+* Every execution only stores it's continuations, variables and output, while the flattened program is shared by every
+* execution. Executions are submitted and resumed by a single thread, only the host results can be passed from other
+* threads.
+*
+* @author	Christian-2003
+* @version	19.10.2026
+*/
+class CEventLoop {
+private:
+	/**
+	* The struct "SExecution" stores an execution, which has not finished yet.
+	*/
+	struct SExecution {
+		CContinuationEvaluator evaluator; //Stores the continuations and the variables of the execution.
+		ostringstream output; //Stores the output of the execution.
+		Completion completion; //Stores the function, which receives the result of the execution.
+	};
+
+	/**
+	* The struct "SHostResult" stores the result of a host function, until the waiting execution is resumed.
+	*/
+	struct SHostResult {
+		unsigned int nExecution; //Stores the identifier of the waiting execution.
+		CToken result; //Stores the return value of the host function.
+		short int nErrorMessage; //Stores the error message of the host function.
+	};
+
+
+
+private:
+	/**
+	* Stores the flattened functions of the program, which are shared by every execution.
+	*/
+	shared_ptr<CContinuationProgram> pProgram;
+
+	/**
+	* Stores every host function by it's name.
+	*/
+	unordered_map<string, HostFunction> mHostFunctions;
+
+	/**
+	* Stores every execution, which has not finished yet, by it's identifier.
+	*/
+	unordered_map<unsigned int, unique_ptr<SExecution>> mExecutions;
+
+	/**
+	* Stores the results of the host functions, whose executions have not been resumed yet.
+	*/
+	deque<SHostResult> lHostResults;
+
+	/**
+	* Locks the results of the host functions.
+	*/
+	mutex lock;
+
+	/**
+	* Notifies the event loop, that a host function has passed it's result.
+	*/
+	condition_variable resumable;
+
+	/**
+	* Stores the identifier of the next execution.
+	*/
+	unsigned int nNextExecution;
+
+	/**
+	* Stores the number of Lisp-functions, which can be executed within each other by every execution.
+	*/
+	unsigned int nMaximumDepth;
+
+	/**
+	* Stores whether "&" and "|" skip their remaining operands once the result is decided.
+	*/
+	bool bShortCircuit;
+
+
+
+public:
+	/**
+	* This constructor instantiates a new event loop, which executes the functions of the passed program.
+	*
+	* @param ppProgram	Program, whose functions are executed.
+	* @param pContext	Context, which provides the configuration.
+	*/
+	CEventLoop(shared_ptr<const CProgram> ppProgram, CContext pContext) {
+		pProgram = make_shared<CContinuationProgram>();
+		pProgram->build(ppProgram->getFunctions());
+		nNextExecution = 1;
+		nMaximumDepth = pContext.getMaximumDepth();
+		bShortCircuit = pContext.isShortCircuit();
+	}
+
+
+
+public:
+	/**
+	* This function adds a host function, which is called, when a Lisp-function calls a function with the passed name,
+	* that is not defined by the program.
+	*
+	* @param psName		Name of the function.
+	* @param pFunction	Host function.
+	*/
+	void setHostFunction(string psName, HostFunction pFunction) {
+		mHostFunctions[psName] = pFunction;
+	}
+
+	/**
+	* This function starts to execute the function of the program with the passed name. The execution runs until it
+	* finishes or calls a host function.
+	*
+	* @param psFunction		Name of the function.
+	* @param plArguments	Arguments of the call.
+	* @param pCompletion	Function, which receives the result and the output of the execution.
+	* @return				Identifier of the execution.
+	*/
+	unsigned int submit(string psFunction, CLinkedList<CToken> plArguments, Completion pCompletion) {
+		unsigned int nExecution = nNextExecution++; //Stores the identifier of the execution.
+		unique_ptr<SExecution> execution = make_unique<SExecution>();
+		execution->evaluator.setProgram(pProgram);
+		execution->evaluator.setHostCalls(true);
+		execution->evaluator.setMaximumDepth(nMaximumDepth);
+		execution->evaluator.setShortCircuit(bShortCircuit);
+		execution->evaluator.setOutput(execution->output);
+		execution->completion = pCompletion;
+		CContinuationEvaluator& evaluator = execution->evaluator;
+		mExecutions[nExecution] = move(execution);
+		proceed(nExecution, evaluator.call(psFunction, plArguments));
+		return nExecution;
+	}
+
+	/**
+	* This function resumes every execution, whose host function has passed it's result, without waiting for further
+	* results.
+	*
+	* @return	Number of resumed executions.
+	*/
+	unsigned int poll() {
+		deque<SHostResult> lResults; //Stores the results, with which the executions are resumed.
+		{
+			lock_guard<mutex> guard(lock);
+			lResults.swap(lHostResults);
+		}
+		for (unsigned int i = 0; i < lResults.size(); i++) {
+			unordered_map<unsigned int, unique_ptr<SExecution>>::iterator execution = mExecutions.find(lResults[i].nExecution);
+			if (execution != mExecutions.end() && execution->second->evaluator.isSuspended()) {
+				proceed(lResults[i].nExecution, execution->second->evaluator.resume(lResults[i].result, lResults[i].nErrorMessage));
+			}
+		}
+		return lResults.size();
+	}
+
+	/**
+	* This function resumes the executions, until every execution has finished. While every execution waits for a host
+	* function, the event loop waits for a host result, which is passed by another thread.
+	*/
+	void run() {
+		while (!mExecutions.empty()) {
+			if (poll() == 0) {
+				unique_lock<mutex> guard(lock);
+				resumable.wait(guard, [this]() { return !lHostResults.empty(); });
+			}
+		}
+	}
+
+	/**
+	* Returns the number of executions, which have not finished yet.
+	*
+	* @return	Number of executions.
+	*/
+	unsigned int getExecutions() {
+		return mExecutions.size();
+	}
+
+
+
+private:
+	/**
+	* This function continues the passed execution with the passed result of the evaluator: If the execution calls a host
+	* function, it is called, otherwise the execution has finished and it's completion is called.
+	*
+	* @param pnExecution	Identifier of the execution.
+	* @param prvResult		Result of the evaluator.
+	*/
+	void proceed(unsigned int pnExecution, CRV<CToken> prvResult) {
+		SExecution& execution = *mExecutions[pnExecution];
+		while (prvResult.getErrorMessage() == Error::Interpreter::INFO_HOST_CALL) {
+			unordered_map<string, HostFunction>::iterator host = mHostFunctions.find(prvResult.getContent().getLexeme());
+			if (host == mHostFunctions.end()) {
+				//Neither the program nor the host defines the function:
+				prvResult = execution.evaluator.resume(prvResult.getContent(), Error::Interpreter::FUNCTION_DOES_NOT_EXIST);
+				continue;
+			}
+			//The execution is resumed, once the host passes the result:
+			host->second(execution.evaluator.getHostArguments(), [this, pnExecution](CToken pResult, short int pnErrorMessage) {
+				lock_guard<mutex> guard(lock);
+				lHostResults.push_back(SHostResult{ pnExecution, pResult, pnErrorMessage });
+				resumable.notify_one();
+			});
+			return;
+		}
+		if (prvResult.getErrorMessage() == Error::SUCCESS && prvResult.getContent().getType() == Token::IDENTIFIER) {
+			//A void-function returns it's name:
+			prvResult = CRV<CToken>(CToken(), Error::SUCCESS);
+		}
+		Completion completion = execution.completion;
+		string sOutput = execution.output.str();
+		mExecutions.erase(pnExecution);
+		completion(prvResult, sOutput);
+	}
+};
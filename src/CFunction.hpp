@@ -211,7 +211,7 @@ public:
 	* 
 	* @return	Name of the Lisp function.
 	*/
-	string getName() {
+	const string& getName() const {
 		return sName;
 	}
 
@@ -220,7 +220,7 @@ public:
 	* 
 	* @return	Return type of the Lisp function.
 	*/
-	short int getReturnType() {
+	short int getReturnType() const {
 		return nReturnValue;
 	}
 
@@ -229,7 +229,7 @@ public:
 	* 
 	* @return	Parameters of the Lisp function.
 	*/
-	CLinkedList<CVariable> getParameters() {
+	const CLinkedList<CVariable>& getParameters() const {
 		return lParameters;
 	}
 
@@ -238,7 +238,7 @@ public:
 	* 
 	* @return	Expressions of the Lisp function.
 	*/
-	CLinkedList<CAbstractSyntaxTree<CToken>> getExpressions() {
+	const CLinkedList<CAbstractSyntaxTree<CToken>>& getExpressions() const {
 		return lExpressions;
 	}
 
@@ -247,7 +247,60 @@ public:
 	* 
 	* @return	Number of parameters.
 	*/
-	unsigned int getParameterAmount() {
+	unsigned int getParameterAmount() const {
 		return lParameters.size();
 	}
+
+	/**
+	* This function returns whether the Lisp-function is terminated through a return statement (or an error) on every
+	* path. If the condition of an if-statement is no operation, the statement might be skipped without error.
+	* 
+	* @return	Whether the function always returns.
+	*/
+	bool alwaysReturns() {
+		for (unsigned int i = 0; i < lExpressions.size(); i++) {
+			if (expressionAlwaysReturns(lExpressions[i])) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+
+
+private:
+	/**
+	* This function returns whether the passed expression is terminated through a return statement on every path.
+	* 
+	* @param pAST	Abstract syntax tree of the expression.
+	* @return		Whether the expression always returns.
+	*/
+	bool expressionAlwaysReturns(CAbstractSyntaxTree<CToken> pAST) {
+		CToken content = pAST.getContent();
+		if (content.getType() == Token::BRANCH) {
+			//Body of a control structure:
+			for (unsigned int i = 0; i < pAST.getSubTreeNumber(); i++) {
+				if (expressionAlwaysReturns(pAST.getSubTreeAtIndex(i))) {
+					return true;
+				}
+			}
+			return false;
+		}
+		else if (content.getType() != Token::KEYWORD || !pAST.hasSubTrees()) {
+			return false;
+		}
+		else if (content.getLexeme() == Keyword::RETURN) {
+			return true;
+		}
+		else if (content.getLexeme() == Keyword::IF && pAST.getSubTreeNumber() >= 3) {
+			//Both bodies must return, if the condition is evaluated:
+			short int nConditionType = pAST.getSubTreeAtIndex(0).getContent().getType();
+			bool bOperation = pAST.getSubTreeAtIndex(0).hasSubTrees() && (nConditionType == Token::OPERATOR_ARITHMETIC || nConditionType == Token::OPERATOR_RELATIONAL || nConditionType == Token::OPERATOR_BOOL);
+			if (!bOperation && nConditionType != Token::U_BOOL) {
+				return false;
+			}
+			return expressionAlwaysReturns(pAST.getSubTreeAtIndex(1)) && expressionAlwaysReturns(pAST.getSubTreeAtIndex(2));
+		}
+		return false;
+	}
 };
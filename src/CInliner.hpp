@@ -0,0 +1,873 @@
+/*
+FILE:		CInliner.hpp
+
+REMARKS:	This file contains the class "CInliner", which replaces calls of small Lisp-functions with the functions' bodies.
+*/
+#pragma once
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "CAbstractSyntaxTree.hpp"
+#include "CLinkedList.hpp"
+#include "COpcodeResolver.hpp"
+#include "CRV.hpp"
+#include "CSourceAnalyzer.hpp"
+#include "CToken.hpp"
+#include "CVariable.hpp"
+#include "Variables/ErrorMessages.hpp"
+#include "Variables/OpcodeTypes.hpp"
+#include "Variables/TokenTypes.hpp"
+
+using namespace std;
+
+#define INLINER_NODE_BUDGET 16
+
+
+
+/**
+* The class "CInliner" replaces the calls of small Lisp-functions with the expression, that is returned by the function.
+* A function can be inlined, if:
+*	- It's body consists of a single return-statement, whose value is made up of values, parameters, operations and
+*	  calls of other functions.
+*	- It does not call itself (directly or through other functions).
+*	- The returned expression has at most INLINER_NODE_BUDGET nodes and certainly is of the function's return type.
+* The parameters are replaced with the arguments of the call, so that no name of the function can capture a variable of
+* the caller. Values and variables are substituted directly. Every other argument must be evaluated before anything else
+* of the expression (in the order of the arguments) and is wrapped into an operation, which does not change it's value
+* (e.g. "(+ 0 x)"), so that the value is located at the parameter, as if it was read from the parameter. A call is only
+* inlined, if every argument certainly has the type of it's parameter.
+* Every inlined call produces exactly the same output and the same errors as the call of the function.
+*
+* @author	Christian-2003
+* @version	19.10.2026
+*/
+class CInliner {
+private:
+	/**
+	* Stores the abstract syntax tree of every Lisp-function.
+	*/
+	vector<CAbstractSyntaxTree<CToken>> vtFunctions;
+
+	/**
+	* Stores the name and the return type of every Lisp-function.
+	*/
+	vector<CVariable> vFunctions;
+
+	/**
+	* Stores the parameters of every Lisp-function.
+	*/
+	vector<CLinkedList<CVariable>> vlParameters;
+
+	/**
+	* Stores the expression, that is returned by every Lisp-function, which can be inlined.
+	*/
+	vector<CAbstractSyntaxTree<CToken>> vtExpressions;
+
+	/**
+	* Stores whether every Lisp-function can be inlined.
+	*/
+	vector<bool> vbInlinable;
+
+	/**
+	* Stores the name and the type of every variable, that is declared at the currently inlined node.
+	*/
+	CLinkedList<CVariable> lScope;
+
+	/**
+	* Stores whether the declared variables of the currently inlined function are known exactly.
+	*/
+	bool bTrackVariables;
+
+	/**
+	* Stores whether every integer of the sourcecode is written in it's default form, so that "(+ 0 x)" has the same
+	* lexeme as x.
+	*/
+	bool bCanonicalIntegers;
+
+	/**
+	* Stores the number of calls, that have been inlined.
+	*/
+	unsigned int nInlinedCalls;
+
+	/**
+	* Resolves the opcodes of the nodes.
+	*/
+	COpcodeResolver resolver;
+
+	/**
+	* Analyzes the functions.
+	*/
+	CSourceAnalyzer analyzer;
+
+
+
+public:
+	/**
+	* The default constructor instantiates a new inliner.
+	*/
+	CInliner() {
+		bTrackVariables = false;
+		bCanonicalIntegers = false;
+		nInlinedCalls = 0;
+	}
+
+
+
+public:
+	/**
+	* This function inlines the calls of small functions within the passed abstract syntax trees, each of which resembles a
+	* Lisp-function. If any function cannot be evaluated by the interpreter, the abstract syntax trees are returned
+	* unchanged, so that the interpreter reports the error.
+	* The functions are inlined in such an order, that every function's calls have been inlined, before the function
+	* itself is inlined.
+	*
+	* @param pltASTs	List of abstract syntax trees, which resemble Lisp-functions.
+	* @return			Abstract syntax trees with inlined calls.
+	*/
+	CLinkedList<CAbstractSyntaxTree<CToken>> inlineCalls(CLinkedList<CAbstractSyntaxTree<CToken>> pltASTs) {
+		nInlinedCalls = 0;
+		vtFunctions.clear();
+		vFunctions.clear();
+		vlParameters.clear();
+		bCanonicalIntegers = true;
+		for (unsigned int i = 0; i < pltASTs.size(); i++) {
+			CAbstractSyntaxTree<CToken> tFunction = pltASTs[i];
+			short int nReturnType = analyzer.typeOf(tFunction.getContent());
+			CRV<CLinkedList<CVariable>> rvParameters = analyzer.readParameters(tFunction);
+			if (nReturnType == Token::UNKNOWN || tFunction.getSubTreeNumber() < 2 || rvParameters.getErrorMessage() != Error::SUCCESS) {
+				//The function is invalid:
+				return pltASTs;
+			}
+			CAbstractSyntaxTree<CToken> tName = tFunction.getSubTreeAtIndex(0);
+			if (tName.getContent().getType() != Token::IDENTIFIER || tName.hasSubTrees()) {
+				//The function's name is invalid:
+				return pltASTs;
+			}
+			vtFunctions.push_back(tFunction);
+			vFunctions.push_back(CVariable(tName.getContent().getLexeme(), "", nReturnType));
+			vlParameters.push_back(rvParameters.getContent());
+			bCanonicalIntegers = bCanonicalIntegers && analyzer.hasCanonicalIntegers(tFunction);
+		}
+		vtExpressions.assign(vtFunctions.size(), CAbstractSyntaxTree<CToken>());
+		vbInlinable.assign(vtFunctions.size(), false);
+
+		//Inline the calls of every function after the functions, which it calls:
+		vector<bool> vbVisited(vtFunctions.size(), false);
+		vector<unsigned int> vnOrder; //Stores the indices of the functions in the order, in which they are inlined.
+		for (unsigned int i = 0; i < vtFunctions.size(); i++) {
+			orderFunctions(i, vbVisited, vnOrder);
+		}
+		for (unsigned int i = 0; i < vnOrder.size(); i++) {
+			unsigned int nFunction = vnOrder[i];
+			vtFunctions[nFunction] = inlineFunction(nFunction);
+			vbInlinable[nFunction] = isInlinable(nFunction);
+		}
+
+		CLinkedList<CAbstractSyntaxTree<CToken>> ltInlined; //Stores the functions with inlined calls.
+		for (unsigned int i = 0; i < vtFunctions.size(); i++) {
+			ltInlined.add(vtFunctions[i]);
+		}
+		return ltInlined;
+	}
+
+	/**
+	* This function returns the number of calls, that have been inlined.
+	*
+	* @return	Number of inlined calls.
+	*/
+	unsigned int getChangedNodes() {
+		return nInlinedCalls;
+	}
+
+
+
+private:
+	/**
+	* This function adds the passed function to the order of the functions, after every function, that it calls.
+	*
+	* @param pnFunction	Index of the function.
+	* @param pvbVisited	Stores whether every function has been visited.
+	* @param pvnOrder	Order of the functions.
+	*/
+	void orderFunctions(unsigned int pnFunction, vector<bool>& pvbVisited, vector<unsigned int>& pvnOrder) {
+		if (pvbVisited[pnFunction]) {
+			return;
+		}
+		pvbVisited[pnFunction] = true;
+		vector<unsigned int> vnCalled; //Stores the functions, that are called by the function.
+		findCalls(getBody(pnFunction), vnCalled);
+		for (unsigned int i = 0; i < vnCalled.size(); i++) {
+			orderFunctions(vnCalled[i], pvbVisited, pvnOrder);
+		}
+		pvnOrder.push_back(pnFunction);
+	}
+
+	/**
+	* This function adds every function, whose name occurs within the passed abstract syntax tree, to the passed list.
+	*
+	* @param pAST		Abstract syntax tree.
+	* @param pvnCalled	Indices of the called functions.
+	*/
+	void findCalls(CAbstractSyntaxTree<CToken> pAST, vector<unsigned int>& pvnCalled) {
+		if (pAST.getContent().getType() == Token::IDENTIFIER) {
+			int nFunction = findFunction(pAST.getContent().getLexeme());
+			if (nFunction >= 0) {
+				pvnCalled.push_back(nFunction);
+			}
+		}
+		for (unsigned int i = 0; i < pAST.getSubTreeNumber(); i++) {
+			findCalls(pAST.getSubTreeAtIndex(i), pvnCalled);
+		}
+	}
+
+	/**
+	* This function returns whether the passed function calls the target function, either directly or through other
+	* functions.
+	*
+	* @param pnFunction	Index of the calling function.
+	* @param pnTarget	Index of the target function.
+	* @param pvbVisited	Stores whether every function has been visited.
+	* @return			Whether the target function is called.
+	*/
+	bool calls(unsigned int pnFunction, unsigned int pnTarget, vector<bool>& pvbVisited) {
+		vector<unsigned int> vnCalled; //Stores the functions, that are called by the function.
+		findCalls(getBody(pnFunction), vnCalled);
+		for (unsigned int i = 0; i < vnCalled.size(); i++) {
+			if (vnCalled[i] == pnTarget) {
+				return true;
+			}
+			else if (!pvbVisited[vnCalled[i]]) {
+				pvbVisited[vnCalled[i]] = true;
+				if (calls(vnCalled[i], pnTarget, pvbVisited)) {
+					return true;
+				}
+			}
+		}
+		return false;
+	}
+
+	/**
+	* This function returns the body of the passed function, which is it's last subtree.
+	*
+	* @param pnFunction	Index of the function.
+	* @return			Body of the function.
+	*/
+	CAbstractSyntaxTree<CToken> getBody(unsigned int pnFunction) {
+		return vtFunctions[pnFunction].getSubTreeAtIndex(vtFunctions[pnFunction].getSubTreeNumber() - 1);
+	}
+
+	/**
+	* This function returns whether the passed function can be inlined. If so, the returned expression is stored.
+	*
+	* @param pnFunction	Index of the function.
+	* @return			Whether the function can be inlined.
+	*/
+	bool isInlinable(unsigned int pnFunction) {
+		CLinkedList<CVariable> lParameters = vlParameters[pnFunction];
+		vector<bool> vbVisited(vtFunctions.size(), false);
+		if (vFunctions[pnFunction].getType() == Token::U_VOID || !analyzer.hasUniqueNames(lParameters) || calls(pnFunction, pnFunction, vbVisited)) {
+			return false;
+		}
+		for (unsigned int i = 0; i < lParameters.size(); i++) {
+			if (lParameters[i].getType() == Token::U_VOID) {
+				//The parameter's type is invalid:
+				return false;
+			}
+		}
+
+		CAbstractSyntaxTree<CToken> tBody = getBody(pnFunction);
+		if (tBody.getContent().getType() == Token::BRANCH) {
+			if (tBody.getSubTreeNumber() != 1) {
+				return false;
+			}
+			tBody = tBody.getSubTreeAtIndex(0);
+		}
+		if (resolver.resolveOpcode(tBody.getContent()) != Opcode::OPCODE_RETURN || tBody.getSubTreeNumber() != 1) {
+			//The body is no single return-statement:
+			return false;
+		}
+		CAbstractSyntaxTree<CToken> tExpression = tBody.getSubTreeAtIndex(0);
+		if (!isInlinableExpression(tExpression, lParameters) || countNodes(tExpression) > INLINER_NODE_BUDGET || inferType(tExpression, lParameters) != vFunctions[pnFunction].getType()) {
+			return false;
+		}
+		vtExpressions[pnFunction] = tExpression;
+		return true;
+	}
+
+	/**
+	* This function returns whether the passed expression consists only of values, parameters, operations and calls.
+	*
+	* @param pAST			Abstract syntax tree of the expression.
+	* @param plParameters	Parameters of the function.
+	* @return				Whether the expression can be inlined.
+	*/
+	bool isInlinableExpression(CAbstractSyntaxTree<CToken> pAST, CLinkedList<CVariable> plParameters) {
+		CToken content = pAST.getContent();
+		if (!pAST.hasSubTrees()) {
+			//Value or parameter (every other identifier would be read from the caller's variables):
+			return analyzer.isValue(content.getType()) || (content.getType() == Token::IDENTIFIER && findParameter(content.getLexeme(), plParameters) >= 0);
+		}
+		short int nOpcode = resolver.resolveOpcode(content);
+		if (nOpcode == Opcode::OPCODE_NONE || nOpcode >= Opcode::OPCODE_DECLARE_INT) {
+			return false;
+		}
+		for (unsigned int i = 0; i < pAST.getSubTreeNumber(); i++) {
+			if (!isInlinableExpression(pAST.getSubTreeAtIndex(i), plParameters)) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+
+
+private:
+	/**
+	* This function inlines the calls within the body of the passed Lisp-function.
+	*
+	* @param pnFunction	Index of the function.
+	* @return			Abstract syntax tree of the function with inlined calls.
+	*/
+	CAbstractSyntaxTree<CToken> inlineFunction(unsigned int pnFunction) {
+		CAbstractSyntaxTree<CToken> tFunction = vtFunctions[pnFunction];
+		CLinkedList<CAbstractSyntaxTree<CToken>> ltSubTrees; //Stores the subtrees of the function.
+		ltSubTrees.addAll(tFunction.getSubTrees());
+		CAbstractSyntaxTree<CToken> tBody = ltSubTrees[ltSubTrees.size() - 1]; //The last subtree resembles the function's body.
+
+		lScope.clear();
+		lScope.addAll(vlParameters[pnFunction]);
+		bTrackVariables = !analyzer.declaresInExpression(tBody) && analyzer.hasUniqueNames(vlParameters[pnFunction]);
+
+		CLinkedList<CAbstractSyntaxTree<CToken>> ltInlined; //Stores the subtrees of the function with inlined calls.
+		for (unsigned int i = 0; i < ltSubTrees.size() - 1; i++) {
+			ltInlined.add(ltSubTrees[i]);
+		}
+		ltInlined.add(inlineBody(tBody));
+		return CAbstractSyntaxTree<CToken>(tFunction.getContent(), ltInlined);
+	}
+
+	/**
+	* This function inlines the calls within the body of a function, an if-statement or a while-loop.
+	*
+	* @param pAST	Abstract syntax tree of the body.
+	* @return		Body with inlined calls.
+	*/
+	CAbstractSyntaxTree<CToken> inlineBody(CAbstractSyntaxTree<CToken> pAST) {
+		unsigned int nScope = lScope.size(); //Stores the number of variables, that are declared outside of the body.
+		CAbstractSyntaxTree<CToken> tInlined;
+		if (pAST.getContent().getType() != Token::BRANCH) {
+			tInlined = inlineStatement(pAST);
+		}
+		else {
+			CLinkedList<CAbstractSyntaxTree<CToken>> ltStatements; //Stores the statements of the body.
+			ltStatements.addAll(pAST.getSubTrees());
+			CLinkedList<CAbstractSyntaxTree<CToken>> ltInlined; //Stores the statements with inlined calls.
+			for (unsigned int i = 0; i < ltStatements.size(); i++) {
+				ltInlined.add(inlineStatement(ltStatements[i]));
+			}
+			tInlined = CAbstractSyntaxTree<CToken>(pAST.getContent(), ltInlined);
+		}
+		while (lScope.size() > nScope) {
+			lScope.remove(lScope.size() - 1);
+		}
+		return tInlined;
+	}
+
+	/**
+	* This function inlines the calls within a statement. The statement itself is never replaced, since the returned
+	* expression might not be executable as a statement.
+	*
+	* @param pAST	Abstract syntax tree of the statement.
+	* @return		Statement with inlined calls.
+	*/
+	CAbstractSyntaxTree<CToken> inlineStatement(CAbstractSyntaxTree<CToken> pAST) {
+		CToken content = pAST.getContent();
+		CLinkedList<CAbstractSyntaxTree<CToken>> ltSubTrees; //Stores the subtrees of the statement.
+		ltSubTrees.addAll(pAST.getSubTrees());
+		CLinkedList<CAbstractSyntaxTree<CToken>> ltInlined; //Stores the subtrees with inlined calls.
+
+		switch (resolver.resolveOpcode(content)) {
+		case Opcode::OPCODE_ADD:
+		case Opcode::OPCODE_SUBTRACT:
+		case Opcode::OPCODE_MULTIPLY:
+		case Opcode::OPCODE_DIVIDE:
+		case Opcode::OPCODE_EQUAL:
+		case Opcode::OPCODE_NOT_EQUAL:
+		case Opcode::OPCODE_GREATER:
+		case Opcode::OPCODE_LESS:
+		case Opcode::OPCODE_GREATER_EQUAL:
+		case Opcode::OPCODE_LESS_EQUAL:
+		case Opcode::OPCODE_AND:
+		case Opcode::OPCODE_OR:
+			//Operation, whose result is discarded:
+			for (unsigned int i = 0; i < ltSubTrees.size(); i++) {
+				ltInlined.add(inlineOperand(ltSubTrees[i]));
+			}
+			break;
+
+		case Opcode::OPCODE_IDENTIFIER:
+		case Opcode::OPCODE_PRINT:
+		case Opcode::OPCODE_PRINTLN:
+		case Opcode::OPCODE_RETURN:
+			//Every subtree is evaluated:
+			for (unsigned int i = 0; i < ltSubTrees.size(); i++) {
+				ltInlined.add(inlineExpression(ltSubTrees[i], false));
+			}
+			break;
+
+		case Opcode::OPCODE_DECLARE_INT:
+		case Opcode::OPCODE_DECLARE_DOUBLE:
+		case Opcode::OPCODE_DECLARE_BOOL:
+		case Opcode::OPCODE_DECLARE_CHAR:
+		case Opcode::OPCODE_DECLARE_STRING:
+		case Opcode::OPCODE_SET:
+			//The first subtree resembles the variable's name:
+			for (unsigned int i = 0; i < ltSubTrees.size(); i++) {
+				ltInlined.add(i == 0 ? ltSubTrees[i] : inlineExpression(ltSubTrees[i], false));
+			}
+			if (resolver.resolveOpcode(content) != Opcode::OPCODE_SET && ltSubTrees.size() >= 1 && ltSubTrees[0].getContent().getType() == Token::IDENTIFIER && findVariable(ltSubTrees[0].getContent().getLexeme()).getErrorMessage() != Error::SUCCESS) {
+				//The variable is declared after the initializer was evaluated:
+				lScope.add(CVariable(ltSubTrees[0].getContent().getLexeme(), "", analyzer.typeOf(content)));
+			}
+			break;
+
+		case Opcode::OPCODE_IF:
+			//Condition, body and else-body:
+			for (unsigned int i = 0; i < ltSubTrees.size(); i++) {
+				if (i == 0) {
+					ltInlined.add(inlineExpression(ltSubTrees[i], true));
+				}
+				else if (i <= 2) {
+					ltInlined.add(inlineBody(ltSubTrees[i]));
+				}
+				else {
+					ltInlined.add(ltSubTrees[i]);
+				}
+			}
+			break;
+
+		case Opcode::OPCODE_WHILE:
+			//Condition and body:
+			for (unsigned int i = 0; i < ltSubTrees.size(); i++) {
+				if (i == 0) {
+					ltInlined.add(inlineExpression(ltSubTrees[i], true));
+				}
+				else if (i == 1) {
+					ltInlined.add(inlineBody(ltSubTrees[i]));
+				}
+				else {
+					ltInlined.add(ltSubTrees[i]);
+				}
+			}
+			break;
+
+		case Opcode::OPCODE_FOR:
+		case Opcode::OPCODE_PFOR: {
+			//Counter, range, clauses and body, within which the counter is an integer:
+			unsigned int nScope = lScope.size(); //Stores the number of variables, that are declared outside of the loop.
+			for (unsigned int i = 0; i < ltSubTrees.size(); i++) {
+				if (i == 1 || i == 2) {
+					ltInlined.add(inlineExpression(ltSubTrees[i], false));
+				}
+				else if (i >= 3 && i + 1 == ltSubTrees.size()) {
+					if (ltSubTrees[0].getContent().getType() == Token::IDENTIFIER) {
+						lScope.add(CVariable(ltSubTrees[0].getContent().getLexeme(), "", Token::U_INT));
+					}
+					ltInlined.add(inlineBody(ltSubTrees[i]));
+				}
+				else {
+					ltInlined.add(ltSubTrees[i]);
+				}
+			}
+			while (lScope.size() > nScope) {
+				lScope.remove(lScope.size() - 1);
+			}
+			break;
+		}
+
+		default:
+			//The statement does not contain any calls, that can be inlined:
+			return pAST;
+		}
+		return CAbstractSyntaxTree<CToken>(content, ltInlined);
+	}
+
+	/**
+	* This function inlines the calls within an expression, whose value is used by a statement.
+	*
+	* @param pAST			Abstract syntax tree of the expression.
+	* @param pbCondition	Whether the expression resembles the condition of an if-statement or a while-loop.
+	* @return				Expression with inlined calls.
+	*/
+	CAbstractSyntaxTree<CToken> inlineExpression(CAbstractSyntaxTree<CToken> pAST, bool pbCondition) {
+		switch (resolver.resolveOpcode(pAST.getContent())) {
+		case Opcode::OPCODE_ADD:
+		case Opcode::OPCODE_SUBTRACT:
+		case Opcode::OPCODE_MULTIPLY:
+		case Opcode::OPCODE_DIVIDE:
+		case Opcode::OPCODE_EQUAL:
+		case Opcode::OPCODE_NOT_EQUAL:
+		case Opcode::OPCODE_GREATER:
+		case Opcode::OPCODE_LESS:
+		case Opcode::OPCODE_GREATER_EQUAL:
+		case Opcode::OPCODE_LESS_EQUAL:
+		case Opcode::OPCODE_AND:
+		case Opcode::OPCODE_OR: {
+			CLinkedList<CAbstractSyntaxTree<CToken>> ltOperands; //Stores the operands with inlined calls.
+			for (unsigned int i = 0; i < pAST.getSubTreeNumber(); i++) {
+				ltOperands.add(inlineOperand(pAST.getSubTreeAtIndex(i)));
+			}
+			return CAbstractSyntaxTree<CToken>(pAST.getContent(), ltOperands);
+		}
+
+		case Opcode::OPCODE_IDENTIFIER: {
+			if (!pAST.hasSubTrees()) {
+				//Variable or function call without arguments:
+				return pAST;
+			}
+			CLinkedList<CAbstractSyntaxTree<CToken>> ltArguments; //Stores the arguments with inlined calls.
+			for (unsigned int i = 0; i < pAST.getSubTreeNumber(); i++) {
+				ltArguments.add(inlineExpression(pAST.getSubTreeAtIndex(i), false));
+			}
+			return inlineCall(CAbstractSyntaxTree<CToken>(pAST.getContent(), ltArguments), pbCondition);
+		}
+
+		case Opcode::OPCODE_NONE:
+			//Value:
+			return pAST;
+
+		default:
+			//Keyword, that is executed like a statement:
+			return inlineStatement(pAST);
+		}
+	}
+
+	/**
+	* This function inlines the calls within the operand of an operation. Operands, that are neither operations, nor
+	* identifiers, are evaluated as operations by the interpreter and are therefore not changed.
+	*
+	* @param pAST	Abstract syntax tree of the operand.
+	* @return		Operand with inlined calls.
+	*/
+	CAbstractSyntaxTree<CToken> inlineOperand(CAbstractSyntaxTree<CToken> pAST) {
+		short int nOpcode = resolver.resolveOpcode(pAST.getContent());
+		if (!pAST.hasSubTrees() || nOpcode == Opcode::OPCODE_NONE || nOpcode >= Opcode::OPCODE_DECLARE_INT) {
+			return pAST;
+		}
+		return inlineExpression(pAST, false);
+	}
+
+
+
+private:
+	/**
+	* This function replaces the passed call with the expression, that is returned by the called function, if the
+	* function can be inlined and every argument certainly has the type of it's parameter.
+	*
+	* @param pAST			Abstract syntax tree of the call, whose arguments have already been inlined.
+	* @param pbCondition	Whether the call resembles a condition. Conditions cannot be replaced with variables, since
+	*						they must be a value or an operation.
+	* @return				Inlined expression or the unchanged call.
+	*/
+	CAbstractSyntaxTree<CToken> inlineCall(CAbstractSyntaxTree<CToken> pAST, bool pbCondition) {
+		int nFunction = findFunction(pAST.getContent().getLexeme());
+		if (nFunction < 0 || !vbInlinable[nFunction] || vlParameters[nFunction].size() != pAST.getSubTreeNumber()) {
+			return pAST;
+		}
+		CLinkedList<CVariable> lParameters = vlParameters[nFunction];
+		CAbstractSyntaxTree<CToken> tExpression = vtExpressions[nFunction];
+
+		//Check the arguments:
+		vector<CAbstractSyntaxTree<CToken>> vtArguments; //Stores the arguments.
+		vector<bool> vbEvaluated; //Stores whether every argument needs to be evaluated (it is neither a value, nor a variable).
+		unsigned int nEvaluated = 0; //Stores the number of arguments, that need to be evaluated.
+		for (unsigned int i = 0; i < pAST.getSubTreeNumber(); i++) {
+			CAbstractSyntaxTree<CToken> tArgument = pAST.getSubTreeAtIndex(i);
+			CToken argument = tArgument.getContent();
+			short int nType = Token::UNKNOWN; //Stores the type of the argument.
+			bool bEvaluated = false;
+			if (!tArgument.hasSubTrees() && analyzer.isValue(argument.getType())) {
+				//Value:
+				nType = argument.getType();
+			}
+			else if (!tArgument.hasSubTrees() && argument.getType() == Token::IDENTIFIER) {
+				//Variable:
+				CRV<CVariable> rvVariable = findVariable(argument.getLexeme());
+				if (bTrackVariables && rvVariable.getErrorMessage() == Error::SUCCESS) {
+					nType = rvVariable.getContent().getType();
+				}
+			}
+			else if (isPureExpression(tArgument)) {
+				//Operation or call, whose value can be relocated to the parameter:
+				nType = inferType(tArgument, bTrackVariables ? lScope : CLinkedList<CVariable>());
+				bEvaluated = true;
+				nEvaluated++;
+				if (!(nType == Token::U_BOOL || nType == Token::U_STRING || (nType == Token::U_INT && bCanonicalIntegers))) {
+					return pAST;
+				}
+			}
+			if (nType == Token::UNKNOWN || nType != lParameters[i].getType()) {
+				//The argument might cause an error, when it is passed:
+				return pAST;
+			}
+			vtArguments.push_back(tArgument);
+			vbEvaluated.push_back(bEvaluated);
+		}
+
+		//Evaluated arguments must be evaluated first and in their original order:
+		vector<unsigned int> vnOrder; //Stores the evaluated parameters in the order, in which they are read.
+		bool bApplied = false; //Stores whether an operation or a call has been applied.
+		if (!checkOrder(tExpression, lParameters, vbEvaluated, vnOrder, bApplied) || vnOrder.size() != nEvaluated) {
+			return pAST;
+		}
+		for (unsigned int i = 1; i < vnOrder.size(); i++) {
+			if (vnOrder[i] <= vnOrder[i - 1]) {
+				return pAST;
+			}
+		}
+		if (pbCondition && !tExpression.hasSubTrees() && tExpression.getContent().getType() == Token::IDENTIFIER && !vbEvaluated[findParameter(tExpression.getContent().getLexeme(), lParameters)] && !analyzer.isValue(vtArguments[findParameter(tExpression.getContent().getLexeme(), lParameters)].getContent().getType())) {
+			//The condition would be replaced with a variable:
+			return pAST;
+		}
+
+		nInlinedCalls++;
+		return substitute(tExpression, lParameters, vtArguments, vbEvaluated);
+	}
+
+	/**
+	* This function checks, whether the parameters of evaluated arguments are read before any operation or call of the
+	* passed expression is applied, and whether each of them is read exactly once. Parameters must not be read within an
+	* operand of "&" or "|", which may be skipped.
+	*
+	* @param pAST			Abstract syntax tree of the expression.
+	* @param plParameters	Parameters of the function.
+	* @param pvbEvaluated	Whether the argument of every parameter is evaluated.
+	* @param pvnOrder		Evaluated parameters in the order, in which they are read.
+	* @param pbApplied		Whether an operation or a call has been applied.
+	* @return				Whether the expression reads the evaluated parameters in time.
+	*/
+	bool checkOrder(CAbstractSyntaxTree<CToken> pAST, CLinkedList<CVariable> plParameters, vector<bool>& pvbEvaluated, vector<unsigned int>& pvnOrder, bool& pbApplied) {
+		if (!pAST.hasSubTrees()) {
+			int nParameter = pAST.getContent().getType() == Token::IDENTIFIER ? findParameter(pAST.getContent().getLexeme(), plParameters) : -1;
+			if (nParameter >= 0 && pvbEvaluated[nParameter]) {
+				pvnOrder.push_back(nParameter);
+				return !pbApplied;
+			}
+			return true;
+		}
+		bool bLazy = pAST.getContent().getType() == Token::OPERATOR_BOOL; //Stores whether later operands may be skipped.
+		for (unsigned int i = 0; i < pAST.getSubTreeNumber(); i++) {
+			size_t nRead = pvnOrder.size(); //Stores the number of parameters, that have been read before the subtree.
+			if (!checkOrder(pAST.getSubTreeAtIndex(i), plParameters, pvbEvaluated, pvnOrder, pbApplied)) {
+				return false;
+			}
+			if (bLazy && i > 0 && pvnOrder.size() != nRead) {
+				//The argument would not be evaluated, if "&" or "|" is decided by an earlier operand:
+				return false;
+			}
+		}
+		pbApplied = true;
+		return true;
+	}
+
+	/**
+	* This function replaces the parameters within the passed expression with the passed arguments. Values and variables are
+	* located at the parameter, evaluated arguments are wrapped into an operation, whose result is located at the parameter.
+	*
+	* @param pAST			Abstract syntax tree of the expression.
+	* @param plParameters	Parameters of the function.
+	* @param pvtArguments	Arguments of the call.
+	* @param pvbEvaluated	Whether every argument is evaluated.
+	* @return				Expression with substituted parameters.
+	*/
+	CAbstractSyntaxTree<CToken> substitute(CAbstractSyntaxTree<CToken> pAST, CLinkedList<CVariable> plParameters, vector<CAbstractSyntaxTree<CToken>>& pvtArguments, vector<bool>& pvbEvaluated) {
+		CToken content = pAST.getContent();
+		if (!pAST.hasSubTrees()) {
+			int nParameter = content.getType() == Token::IDENTIFIER ? findParameter(content.getLexeme(), plParameters) : -1;
+			if (nParameter < 0) {
+				return pAST;
+			}
+			CAbstractSyntaxTree<CToken> tArgument = pvtArguments[nParameter];
+			if (!pvbEvaluated[nParameter]) {
+				//Value or variable:
+				return CAbstractSyntaxTree<CToken>(CToken(tArgument.getContent().getLexeme(), tArgument.getContent().getType(), content.getFilename(), content.getLine()));
+			}
+			//Wrap the argument into an operation, that returns the argument's value at the parameter:
+			CLinkedList<CAbstractSyntaxTree<CToken>> ltOperands; //Stores the operands of the wrapping operation.
+			short int nType = plParameters[nParameter].getType();
+			if (nType == Token::U_BOOL) {
+				ltOperands.add(CAbstractSyntaxTree<CToken>(CToken("t", Token::U_BOOL, content.getFilename(), content.getLine())));
+				ltOperands.add(tArgument);
+				return CAbstractSyntaxTree<CToken>(CToken("&", Token::OPERATOR_BOOL, content.getFilename(), content.getLine()), ltOperands);
+			}
+			ltOperands.add(CAbstractSyntaxTree<CToken>(CToken(nType == Token::U_INT ? "0" : "", nType, content.getFilename(), content.getLine())));
+			ltOperands.add(tArgument);
+			return CAbstractSyntaxTree<CToken>(CToken("+", Token::OPERATOR_ARITHMETIC, content.getFilename(), content.getLine()), ltOperands);
+		}
+		CLinkedList<CAbstractSyntaxTree<CToken>> ltSubstituted; //Stores the subtrees with substituted parameters.
+		for (unsigned int i = 0; i < pAST.getSubTreeNumber(); i++) {
+			ltSubstituted.add(substitute(pAST.getSubTreeAtIndex(i), plParameters, pvtArguments, pvbEvaluated));
+		}
+		return CAbstractSyntaxTree<CToken>(content, ltSubstituted);
+	}
+
+
+
+private:
+	/**
+	* This function returns the type, that the passed expression certainly has, if it is evaluated without errors.
+	*
+	* @param pAST		Abstract syntax tree of the expression.
+	* @param plScope	Variables, whose types are known.
+	* @return			Type of the expression or Token::UNKNOWN.
+	*/
+	short int inferType(CAbstractSyntaxTree<CToken> pAST, CLinkedList<CVariable> plScope) {
+		CToken content = pAST.getContent();
+		short int nOpcode = resolver.resolveOpcode(content);
+		if (!pAST.hasSubTrees()) {
+			if (analyzer.isValue(content.getType())) {
+				return content.getType();
+			}
+			else if (content.getType() == Token::IDENTIFIER) {
+				int nVariable = findParameter(content.getLexeme(), plScope);
+				return nVariable >= 0 ? plScope[nVariable].getType() : (short int)Token::UNKNOWN;
+			}
+			return Token::UNKNOWN;
+		}
+
+		switch (nOpcode) {
+		case Opcode::OPCODE_IDENTIFIER: {
+			//Call, which returns the function's return type:
+			int nFunction = findFunction(content.getLexeme());
+			if (nFunction < 0 || vFunctions[nFunction].getType() == Token::U_VOID) {
+				return Token::UNKNOWN;
+			}
+			return vFunctions[nFunction].getType();
+		}
+
+		case Opcode::OPCODE_ADD:
+		case Opcode::OPCODE_SUBTRACT:
+		case Opcode::OPCODE_MULTIPLY: {
+			short int nFirst = inferType(pAST.getSubTreeAtIndex(0), plScope);
+			if (nOpcode == Opcode::OPCODE_ADD && (nFirst == Token::U_STRING || nFirst == Token::U_CHAR)) {
+				//Characters and strings are concatenated:
+				return Token::U_STRING;
+			}
+			short int nType = Token::U_INT;
+			for (unsigned int i = 0; i < pAST.getSubTreeNumber(); i++) {
+				short int nOperand = inferType(pAST.getSubTreeAtIndex(i), plScope);
+				if (nOperand == Token::U_DOUBLE) {
+					nType = Token::U_DOUBLE;
+				}
+				else if (nOperand != Token::U_INT) {
+					return Token::UNKNOWN;
+				}
+			}
+			return nType;
+		}
+
+		case Opcode::OPCODE_DIVIDE:
+			return Token::U_DOUBLE;
+
+		case Opcode::OPCODE_EQUAL:
+		case Opcode::OPCODE_NOT_EQUAL:
+		case Opcode::OPCODE_GREATER:
+		case Opcode::OPCODE_LESS:
+		case Opcode::OPCODE_GREATER_EQUAL:
+		case Opcode::OPCODE_LESS_EQUAL:
+		case Opcode::OPCODE_AND:
+		case Opcode::OPCODE_OR:
+			return Token::U_BOOL;
+
+		default:
+			return Token::UNKNOWN;
+		}
+	}
+
+	/**
+	* This function returns whether the passed argument is an operation or a call, that neither declares nor changes any
+	* variable, so that the variables of the other arguments can be read later on.
+	*
+	* @param pAST	Abstract syntax tree of the argument.
+	* @return		Whether the argument is pure.
+	*/
+	bool isPureExpression(CAbstractSyntaxTree<CToken> pAST) {
+		short int nOpcode = resolver.resolveOpcode(pAST.getContent());
+		if (!pAST.hasSubTrees() || nOpcode == Opcode::OPCODE_NONE || nOpcode >= Opcode::OPCODE_DECLARE_INT) {
+			return false;
+		}
+		for (unsigned int i = 0; i < pAST.getSubTreeNumber(); i++) {
+			CAbstractSyntaxTree<CToken> tOperand = pAST.getSubTreeAtIndex(i);
+			if (tOperand.hasSubTrees() ? !isPureExpression(tOperand) : !(analyzer.isValue(tOperand.getContent().getType()) || tOperand.getContent().getType() == Token::IDENTIFIER)) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/**
+	* This function returns the number of nodes of the passed abstract syntax tree.
+	*
+	* @param pAST	Abstract syntax tree.
+	* @return		Number of nodes.
+	*/
+	unsigned int countNodes(CAbstractSyntaxTree<CToken> pAST) {
+		unsigned int nNodes = 1;
+		for (unsigned int i = 0; i < pAST.getSubTreeNumber(); i++) {
+			nNodes += countNodes(pAST.getSubTreeAtIndex(i));
+		}
+		return nNodes;
+	}
+
+
+
+private:
+	/**
+	* This function returns the index of the first Lisp-function with the passed name, since the interpreter calls this
+	* function.
+	*
+	* @param psName	Name of the function.
+	* @return		Index of the function or -1.
+	*/
+	int findFunction(string psName) {
+		for (unsigned int i = 0; i < vFunctions.size(); i++) {
+			if (vFunctions[i].getName() == psName) {
+				return i;
+			}
+		}
+		return -1;
+	}
+
+	/**
+	* This function returns the index of the parameter with the passed name.
+	*
+	* @param psName			Name of the parameter.
+	* @param plParameters	Parameters of the function.
+	* @return				Index of the parameter or -1.
+	*/
+	int findParameter(string psName, CLinkedList<CVariable> plParameters) {
+		for (unsigned int i = 0; i < plParameters.size(); i++) {
+			if (plParameters[i].getName() == psName) {
+				return i;
+			}
+		}
+		return -1;
+	}
+
+	/**
+	* This function returns the variable of the current scope, which has the passed name.
+	*
+	* @param psName	Name of the variable.
+	* @return		Variable.
+	*/
+	CRV<CVariable> findVariable(string psName) {
+		for (unsigned int i = 0; i < lScope.size(); i++) {
+			if (lScope[i].getName() == psName) {
+				return CRV<CVariable>(lScope[i], Error::SUCCESS);
+			}
+		}
+		return CRV<CVariable>(CVariable(), Error::Interpreter::VARIABLE_DOES_NOT_EXIST);
+	}
+};
@@ -8,19 +8,42 @@ REMARKS:	This file contains the class "CInterpreter" with which an abstract synt
 #include <iostream>
 #include <string>
 #include <stdio.h>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 #include "CAbstractSyntaxTree.hpp"
+#include "CArgumentScheduler.hpp"
+#include "CClosureCompiler.hpp"
+#include "CContinuationEvaluator.hpp"
+#include "CCountedLoop.hpp"
+#include "CSpecializingEvaluator.hpp"
+#include "CJitCompiler.hpp"
 #include "CFileScanner.hpp"
 #include "CInterpreter.hpp"
 #include "CLinkedList.hpp"
+#include "CLoopChecker.hpp"
+#include "CMemoCache.hpp"
+#include "COpcodeResolver.hpp"
+#include "COperationEvaluator.hpp"
 #include "CParser.hpp"
+#include "CProgram.hpp"
 #include "CRV.hpp"
+#include "CSourceAnalyzer.hpp"
+#include "CTaskTable.hpp"
+#include "CChannelTable.hpp"
+#include "CContext.hpp"
+#include "CThreadPool.hpp"
 #include "CToken.hpp"
 #include "CTokenizer.hpp"
+#include "CTypeChecker.hpp"
 #include "CVariable.hpp"
 #include "CFunction.hpp"
 #include "Variables/ErrorMessages.hpp"
+#include "Variables/ExecutionModes.hpp"
 #include "Variables/KeywordTypes.hpp"
+#include "Variables/OpcodeTypes.hpp"
 #include "Variables/TokenTypes.hpp"
 
 using namespace std;
@@ -41,9 +64,255 @@ private:
 	CLinkedList<CVariable> lVariables;
 
 	/**
-	* Stores a list of every function which is implemented by the user.
+	* Stores the program, whose functions are executed. The program is shared with the interpreters of the thread pool and
+	* with every other interpreter, which executes the same program.
 	*/
-	CLinkedList<CFunction> lFunctions;
+	shared_ptr<const CProgram> pProgram;
+
+	/**
+	* Stores the execution engine, with which the main-function is executed.
+	*/
+	short int nExecutionMode;
+
+	/**
+	* Stores the native code of the functions, if the execution mode is ExecutionMode::NATIVE_COMPILATION.
+	*/
+	CJitCompiler jit;
+
+	/**
+	* Stores the number of Lisp-functions, which can be executed within each other, if the execution mode is
+	* ExecutionMode::EXPLICIT_CONTINUATION.
+	*/
+	unsigned int nMaximumDepth;
+
+	/**
+	* Stores whether "&" and "|" stop evaluating their operands, as soon as an operand decides the result.
+	*/
+	bool bShortCircuit;
+
+	/**
+	* Applies the operators of operations to their evaluated operands.
+	*/
+	COperationEvaluator operations;
+
+	/**
+	* Stores the number of Lisp-functions, which are currently executed through "callFunction()". Calls in tail position can
+	* only reuse a frame, if they are made within a function.
+	*/
+	unsigned int nCallDepth;
+
+	/**
+	* Stores the name of the function, which is called in tail position, until the frame of the calling function is reused.
+	*/
+	CToken tailCallName;
+
+	/**
+	* Stores the evaluated arguments of the function, which is called in tail position.
+	*/
+	CLinkedList<CToken> lTailCallArguments;
+
+	/**
+	* Stores the return values of pure functions, if memoization is enabled (nullptr otherwise).
+	*/
+	CMemoCache* pMemoCache;
+
+	/**
+	* Stores the number of threads, which evaluate arguments, if the execution mode is ExecutionMode::PARALLEL_EVALUATION.
+	*/
+	unsigned int nThreads;
+
+	/**
+	* Stores the tasks, which are spawned by the program (only used by the interpreter, which executes the main-function).
+	*/
+	CTaskTable tasks;
+
+	/**
+	* Stores the tasks, which are spawned by the program. The interpreters of the pool share the tasks of the interpreter,
+	* which executes the main-function.
+	*/
+	CTaskTable* pTasks;
+
+	/**
+	* Stores the channels, which are created by the program (only used by the interpreter, which executes the
+	* main-function).
+	*/
+	CChannelTable channels;
+
+	/**
+	* Stores the channels, which are created by the program. The interpreters of the pool share the channels of the
+	* interpreter, which executes the main-function.
+	*/
+	CChannelTable* pChannels;
+
+	/**
+	* Stores the printed text of the current task, which has not been written yet, since the line has not been finished.
+	* Text is only buffered, if the program is executed by multiple threads.
+	*/
+	string sOutput;
+
+	/**
+	* Stores the context, into whose log the events are written and into whose output the program prints. The interpreters
+	* of the pool get a copy of the context of the interpreter, which executes the main-function, so that they share the
+	* lock of the output.
+	*/
+	CContext context;
+
+	/**
+	* Stores the interpreters, which are used by the threads of the pool (only the interpreter, which executes the
+	* main-function, owns them). The vector contains an entry for every thread, which the pool could start, but the
+	* interpreter of a thread is only created by the thread itself (see "CInterpreter::createWorker()").
+	*/
+	vector<unique_ptr<CInterpreter>> lWorkers;
+
+	/**
+	* Stores the thread pool, which is owned by the interpreter, that executes the main-function. It is destroyed before
+	* the interpreters of it's threads.
+	*/
+	unique_ptr<CThreadPool> threadPool;
+
+	/**
+	* Stores the thread pool, which evaluates the forked arguments of parallel calls and operations (nullptr, if arguments
+	* are evaluated sequentially).
+	*/
+	CThreadPool* pThreadPool;
+
+	/**
+	* Stores the interpreter, which executes the main-function and owns the interpreters of the threads of the pool.
+	*/
+	CInterpreter* pMainInterpreter;
+
+	/**
+	* Stores whether the program spawns or awaits tasks or contains parallel loops.
+	*/
+	bool bUsesTasks;
+
+	/**
+	* Stores whether the program contains counted loops or channels.
+	*/
+	bool bUsesLoops;
+
+	/**
+	* Stores whether the thread pool and the native code have been prepared for "call()".
+	*/
+	bool bCallable;
+
+
+
+public:
+	/**
+	* The default constructor instantiates a new interpreter, which evaluates the abstract syntax trees directly.
+	*/
+	CInterpreter() {
+		nExecutionMode = ExecutionMode::TREE_WALKING;
+		nMaximumDepth = CONTINUATION_DEFAULT_MAXIMUM_DEPTH;
+		bShortCircuit = true;
+		nCallDepth = 0;
+		pMemoCache = nullptr;
+		nThreads = 1;
+		pThreadPool = nullptr;
+		pMainInterpreter = this;
+		pTasks = &tasks;
+		pChannels = &channels;
+		pProgram = make_shared<CProgram>();
+		bUsesTasks = false;
+		bUsesLoops = false;
+		bCallable = false;
+	}
+
+
+
+public:
+	/**
+	* This function changes the execution engine, with which the main-function is executed.
+	*
+	* @param pnExecutionMode	New execution mode.
+	*/
+	void setExecutionMode(short int pnExecutionMode) {
+		nExecutionMode = pnExecutionMode;
+	}
+
+	/**
+	* This function changes the number of Lisp-functions, which can be executed within each other by the continuation
+	* evaluator, before a stack overflow is reported.
+	*
+	* @param pnMaximumDepth	New maximum depth.
+	*/
+	void setMaximumDepth(unsigned int pnMaximumDepth) {
+		nMaximumDepth = pnMaximumDepth;
+	}
+
+	/**
+	* This function changes whether "&" and "|" are short-circuited by every execution engine. If they are not, every
+	* operand is evaluated before the operator is applied (the behaviour of earlier versions).
+	*
+	* @param pbShortCircuit	Whether boolean operations are short-circuited.
+	*/
+	void setShortCircuit(bool pbShortCircuit) {
+		bShortCircuit = pbShortCircuit;
+		operations.setShortCircuit(pbShortCircuit);
+	}
+
+	/**
+	* This function passes the cache, in which the interpreter memoizes the return values of pure functions. The cache is
+	* reset before the sourcecode is executed, and is only used, if it is enabled.
+	*
+	* @param ppMemoCache	Cache or nullptr.
+	*/
+	void setMemoCache(CMemoCache* ppMemoCache) {
+		pMemoCache = ppMemoCache;
+	}
+
+	/**
+	* This function changes the number of threads, which evaluate the arguments of calls, if the execution mode is
+	* ExecutionMode::PARALLEL_EVALUATION, and which execute spawned tasks. The thread, which executes the main-function, is
+	* included.
+	*
+	* @param pnThreads	Number of threads.
+	*/
+	void setThreads(unsigned int pnThreads) {
+		nThreads = pnThreads;
+	}
+
+	/**
+	* This function changes the context, in which the sourcecode is executed. The configuration of the context replaces
+	* the execution mode, the maximum depth, the number of threads, the short-circuiting and the cache of the interpreter.
+	*
+	* @param pContext	Context of the execution.
+	*/
+	void setContext(CContext pContext) {
+		context = pContext;
+		setExecutionMode(context.getExecutionMode());
+		setMaximumDepth(context.getMaximumDepth());
+		setThreads(context.getThreads());
+		setShortCircuit(context.isShortCircuit());
+		setMemoCache(context.getMemoCache());
+	}
+
+	/**
+	* This function passes the prepared program, whose functions are executed by the interpreter. The cache is reset and
+	* told, which functions are pure.
+	*
+	* @param ppProgram	Prepared program, which is shared by reference.
+	*/
+	void setProgram(shared_ptr<const CProgram> ppProgram) {
+		pProgram = ppProgram;
+		bUsesTasks = pProgram->usesTasks();
+		bUsesLoops = pProgram->usesLoops();
+		bCallable = false;
+		if (pMemoCache != nullptr) {
+			//Find the functions, whose return values can be memoized:
+			pMemoCache->reset();
+			if (pMemoCache->isEnabled()) {
+				const vector<bool>& vbPureFunctions = pProgram->getPureFunctions(); //Stores whether each function is pure.
+				unsigned int nPureFunctions = 0; //Stores the number of pure functions.
+				for (unsigned int j = 0; j < vbPureFunctions.size(); j++) {
+					nPureFunctions += vbPureFunctions[j] ? 1 : 0;
+				}
+				pMemoCache->setPureFunctions(nPureFunctions, pProgram->getFunctionCount());
+				context.getLog().addEntry(to_string(nPureFunctions) + " of " + to_string(pProgram->getFunctionCount()) + " functions are pure and will be memoized.", LogEntryComponent::INTERPRETER, LogEntryType::INF);
+			}
+		}
+	}
 
 
 
@@ -65,6 +334,16 @@ private:
 		return CRV<CVariable>(CVariable(), Error::Interpreter::VARIABLE_DOES_NOT_EXIST);
 	}
 
+	/**
+	* This function returns the index of the first function, which has the passed argument as name.
+	*
+	* @param psName	Name of the function.
+	* @return		Index of the function.
+	*/
+	CRV<unsigned int> getFunctionIndex(const string& psName) {
+		return pProgram->findFunction(psName);
+	}
+
 	/**
 	* This function adds the passed variable to the list of variables.
 	* 
@@ -114,55 +393,170 @@ public:
 	* @return			Error message.
 	*/
 	CRV<CToken> interpret(CLinkedList<CAbstractSyntaxTree<CToken>> pltASTs) {
-		logger.addEntry("Begin code execution (Interpreter).", LogEntryComponent::INTERPRETER, LogEntryType::INF);
-		//Each passed abstract syntax tree resembles a function:
-		for (unsigned int i = 0; i < pltASTs.size(); i++) {
-			//Add every function to the list of functions:
-			CFunction newFunc;
-			CRV<CToken> funcReturn = newFunc.evaluateFunctionSourceCode(pltASTs[i]);
-			if (funcReturn.getErrorMessage() != Error::SUCCESS) {
-				//An error occured:
-				return funcReturn;
-			}
-			lFunctions.add(newFunc);
+		context.getLog().addEntry("Begin code execution (Interpreter).", LogEntryComponent::INTERPRETER, LogEntryType::INF);
+		shared_ptr<CProgram> program = make_shared<CProgram>();
+		CRV<CToken> rvProgram = program->prepare(pltASTs, context);
+		if (rvProgram.getErrorMessage() != Error::SUCCESS) {
+			//An error occured:
+			return rvProgram;
 		}
+		setProgram(program);
 
 		//Find the main function:
-		for (unsigned int i = 0; i < lFunctions.size(); i++) {
-			if (lFunctions[i].getName() == Keyword::MAIN_FUNCTION) {
+		for (unsigned int i = 0; i < pProgram->getFunctionCount(); i++) {
+			if (pProgram->getFunction(i).getName() == Keyword::MAIN_FUNCTION) {
 				//Found main function:
-				if (lFunctions[i].getParameterAmount() != 0) {
+				if (pProgram->getFunction(i).getParameterAmount() != 0) {
 					//The function has too many parameters:
-					logger.addEntry(Error::generateErrorMessage(Error::Interpreter::MAIN_FUNCTION_HAS_PARAMETERS), LogEntryComponent::INTERPRETER, LogEntryType::FATAL);
+					context.getLog().addEntry(Error::generateErrorMessage(Error::Interpreter::MAIN_FUNCTION_HAS_PARAMETERS), LogEntryComponent::INTERPRETER, LogEntryType::FATAL);
 					return CRV<CToken>(CToken(), Error::Interpreter::MAIN_FUNCTION_HAS_PARAMETERS);
 				}
-				else if (lFunctions[i].getReturnType() != Token::U_VOID) {
+				else if (pProgram->getFunction(i).getReturnType() != Token::U_VOID) {
 					//The function does not have "void" as return type:
-					logger.addEntry(Error::generateErrorMessage(Error::Interpreter::MAIN_FUNCTION_HAS_INCORRECT_RETURN_TYPE), LogEntryComponent::INTERPRETER, LogEntryType::FATAL);
+					context.getLog().addEntry(Error::generateErrorMessage(Error::Interpreter::MAIN_FUNCTION_HAS_INCORRECT_RETURN_TYPE), LogEntryComponent::INTERPRETER, LogEntryType::FATAL);
 					return CRV<CToken>(CToken(), Error::Interpreter::MAIN_FUNCTION_HAS_INCORRECT_RETURN_TYPE);
 				}
+				if (bUsesTasks || bUsesLoops) {
+					//Tasks and loops are scheduled by the interpreter, which executes them on the threads of the pool:
+					if (nExecutionMode != ExecutionMode::TREE_WALKING && nExecutionMode != ExecutionMode::PARALLEL_EVALUATION) {
+						context.getLog().addEntry(bUsesTasks ? "The sourcecode spawns tasks or contains parallel loops, which can only be executed by the interpreter." : "The sourcecode contains counted loops or channels, which can only be executed by the interpreter.", LogEntryComponent::INTERPRETER, LogEntryType::WARN);
+					}
+					if (bUsesTasks || nExecutionMode == ExecutionMode::PARALLEL_EVALUATION) {
+						startThreads();
+					}
+				}
+				else if (nExecutionMode == ExecutionMode::CLOSURE_COMPILATION) {
+					//Compile every function into closures:
+					CClosureCompiler compiler;
+					compiler.setShortCircuit(bShortCircuit);
+					compiler.setOutput(context.getOutput());
+					short int nCompileError = compiler.compile(pProgram->getFunctions());
+					if (nCompileError == Error::SUCCESS) {
+						context.getLog().addEntry("Begin code execution (Closure compiler).", LogEntryComponent::INTERPRETER, LogEntryType::INF);
+						CRV<CToken> rvExecution = compiler.execute(i);
+						if (rvExecution.getErrorMessage() != Error::SUCCESS) {
+							//An error occured:
+							context.getLog().addEntry_tokenException(rvExecution.getContent(), LogEntryComponent::INTERPRETER, LogEntryType::FATAL, rvExecution.getErrorMessage(), Error::generateErrorMessage(rvExecution.getErrorMessage()));
+							return rvExecution;
+						}
+						context.getLog().addEntry("End code execution (Closure compiler) successfully.", LogEntryComponent::INTERPRETER, LogEntryType::INF);
+						return CRV<CToken>(CToken(), Error::SUCCESS);
+					}
+					//The sourcecode cannot be compiled -> Continue with the interpreter:
+					context.getLog().addEntry("The sourcecode cannot be compiled into closures, the interpreter is used instead.", LogEntryComponent::INTERPRETER, LogEntryType::WARN);
+				}
+				else if (nExecutionMode == ExecutionMode::SELF_SPECIALIZATION) {
+					//Convert every function into self-specializing nodes:
+					CSpecializingEvaluator evaluator;
+					evaluator.setShortCircuit(bShortCircuit);
+					evaluator.setOutput(context.getOutput());
+					short int nBuildError = evaluator.build(pProgram->getFunctions());
+					if (nBuildError == Error::SUCCESS) {
+						context.getLog().addEntry("Begin code execution (Specializing evaluator).", LogEntryComponent::INTERPRETER, LogEntryType::INF);
+						CRV<CToken> rvExecution = evaluator.execute(i);
+						context.getLog().addEntry("Nodes specialized: " + to_string(evaluator.getSpecializations()) + ", nodes deoptimized: " + to_string(evaluator.getDeoptimizations()) + ".", LogEntryComponent::INTERPRETER, LogEntryType::INF);
+						if (rvExecution.getErrorMessage() != Error::SUCCESS) {
+							//An error occured:
+							context.getLog().addEntry_tokenException(rvExecution.getContent(), LogEntryComponent::INTERPRETER, LogEntryType::FATAL, rvExecution.getErrorMessage(), Error::generateErrorMessage(rvExecution.getErrorMessage()));
+							return rvExecution;
+						}
+						context.getLog().addEntry("End code execution (Specializing evaluator) successfully.", LogEntryComponent::INTERPRETER, LogEntryType::INF);
+						return CRV<CToken>(CToken(), Error::SUCCESS);
+					}
+					//The sourcecode cannot be converted -> Continue with the interpreter:
+					context.getLog().addEntry("The sourcecode cannot be converted into specializing nodes, the interpreter is used instead.", LogEntryComponent::INTERPRETER, LogEntryType::WARN);
+				}
+				else if (nExecutionMode == ExecutionMode::EXPLICIT_CONTINUATION) {
+					//Execute every function through a stack of continuations, which does not grow the C++ stack:
+					CContinuationEvaluator evaluator;
+					evaluator.setMaximumDepth(nMaximumDepth);
+					evaluator.setShortCircuit(bShortCircuit);
+					evaluator.setOutput(context.getOutput());
+					evaluator.build(pProgram->getFunctions());
+					context.getLog().addEntry("Begin code execution (Continuation evaluator).", LogEntryComponent::INTERPRETER, LogEntryType::INF);
+					CRV<CToken> rvExecution = evaluator.execute(i);
+					if (rvExecution.getErrorMessage() != Error::SUCCESS) {
+						//An error occured:
+						context.getLog().addEntry_tokenException(rvExecution.getContent(), LogEntryComponent::INTERPRETER, LogEntryType::FATAL, rvExecution.getErrorMessage(), Error::generateErrorMessage(rvExecution.getErrorMessage()));
+						return rvExecution;
+					}
+					context.getLog().addEntry("End code execution (Continuation evaluator) successfully.", LogEntryComponent::INTERPRETER, LogEntryType::INF);
+					return CRV<CToken>(CToken(), Error::SUCCESS);
+				}
+				else if (nExecutionMode == ExecutionMode::NATIVE_COMPILATION) {
+					//Compile every numeric function into machine code, the remaining functions are interpreted:
+					jit.setShortCircuit(bShortCircuit);
+					if (jit.compile(pProgram->getFunctions()) == Error::SUCCESS) {
+						context.getLog().addEntry(to_string(jit.getCompiledFunctions()) + " of " + to_string(pProgram->getFunctionCount()) + " functions have been compiled into native code.", LogEntryComponent::INTERPRETER, LogEntryType::INF);
+					}
+					else {
+						context.getLog().addEntry("Native code is not supported on this platform, the interpreter is used instead.", LogEntryComponent::INTERPRETER, LogEntryType::WARN);
+					}
+				}
+				else if (nExecutionMode == ExecutionMode::PARALLEL_EVALUATION) {
+					//Start the threads, which evaluate the marked arguments together with the interpreter:
+					startThreads();
+				}
+
 				//Interpret each expression from the Lisp main-function:
-				CLinkedList<CAbstractSyntaxTree<CToken>> ltMainExpressions; //Stores every expression of the main-function.
-				ltMainExpressions.addAll(lFunctions[i].getExpressions());
+				const CLinkedList<CAbstractSyntaxTree<CToken>>& ltMainExpressions = pProgram->getFunction(i).getExpressions(); //Stores every expression of the main-function.
 				for (unsigned int j = 0; j < ltMainExpressions.size(); j++) {
 					CRV<CToken> rvEval = interpretExpression(ltMainExpressions[j]); //Interprets the current expression.
 					if (rvEval.getErrorMessage() != Error::SUCCESS) {
 						//An error occured:
-						logger.addEntry_tokenException(rvEval.getContent(), LogEntryComponent::INTERPRETER, LogEntryType::FATAL, rvEval.getErrorMessage(), Error::generateErrorMessage(rvEval.getErrorMessage()));
+						context.getLog().addEntry_tokenException(rvEval.getContent(), LogEntryComponent::INTERPRETER, LogEntryType::FATAL, rvEval.getErrorMessage(), Error::generateErrorMessage(rvEval.getErrorMessage()));
+						awaitTasks();
+						logMemoization();
+						logThreads();
 						return rvEval;
 					}
 				}
 
 				//Every expression was successfully interpreted:
-				logger.addEntry("End code execution (Interpreter) successfully.", LogEntryComponent::INTERPRETER, LogEntryType::INF);
+				awaitTasks();
+				logMemoization();
+				logThreads();
+				context.getLog().addEntry("End code execution (Interpreter) successfully.", LogEntryComponent::INTERPRETER, LogEntryType::INF);
 				return CRV<CToken>(CToken(), Error::SUCCESS);
 			}
 		}
 		//Main function does not exist:
-		logger.addEntry(Error::generateErrorMessage(Error::Interpreter::MISSING_MAIN_FUNCTION), LogEntryComponent::INTERPRETER, LogEntryType::FATAL);
+		context.getLog().addEntry(Error::generateErrorMessage(Error::Interpreter::MISSING_MAIN_FUNCTION), LogEntryComponent::INTERPRETER, LogEntryType::FATAL);
 		return CRV<CToken>(CToken(), Error::Interpreter::MISSING_MAIN_FUNCTION);
 	}
 
+	/**
+	* This function calls a function of the program, which has been passed through "setProgram()", with the passed
+	* arguments, whose types have to match the parameters of the function. Every call starts without variables. The first
+	* call compiles the native code and starts the thread pool, if the execution mode or the program needs them. The
+	* closure compiler, the specializing and the continuation evaluator are not used, their functions are interpreted.
+	*
+	* @param psFunction		Name of the function.
+	* @param plArguments	Arguments of the call.
+	* @return				Return value of the function (an empty token for void-functions) or error message.
+	*/
+	CRV<CToken> call(string psFunction, CLinkedList<CToken> plArguments) {
+		if (!bCallable) {
+			if (nExecutionMode == ExecutionMode::NATIVE_COMPILATION) {
+				jit.setShortCircuit(bShortCircuit);
+				jit.compile(pProgram->getFunctions());
+			}
+			if (bUsesTasks || nExecutionMode == ExecutionMode::PARALLEL_EVALUATION) {
+				startThreads();
+			}
+			bCallable = true;
+		}
+		lVariables.clear();
+		nCallDepth = 0;
+		CRV<CToken> rvCall = callFunction(CToken(psFunction, Token::IDENTIFIER), plArguments);
+		awaitTasks();
+		if (rvCall.getErrorMessage() == Error::SUCCESS && rvCall.getContent().getType() == Token::IDENTIFIER) {
+			//A void-function returns it's name:
+			return CRV<CToken>(CToken(), Error::SUCCESS);
+		}
+		return rvCall;
+	}
+
 
 
 private:
@@ -175,19 +569,54 @@ private:
 	CRV<CToken> interpretExpression(CAbstractSyntaxTree<CToken> pAST) {
 		CRV<CToken> rvEval;
 		//Evaluate AST:
-		if (pAST.getContent().getType() == Token::OPERATOR_ARITHMETIC || pAST.getContent().getType() == Token::OPERATOR_RELATIONAL || pAST.getContent().getType() == Token::OPERATOR_BOOL) {
+		switch (pAST.getContent().getOpcode()) {
+		case Opcode::OPCODE_ADD:
+		case Opcode::OPCODE_SUBTRACT:
+		case Opcode::OPCODE_MULTIPLY:
+		case Opcode::OPCODE_DIVIDE:
+		case Opcode::OPCODE_EQUAL:
+		case Opcode::OPCODE_NOT_EQUAL:
+		case Opcode::OPCODE_GREATER:
+		case Opcode::OPCODE_LESS:
+		case Opcode::OPCODE_GREATER_EQUAL:
+		case Opcode::OPCODE_LESS_EQUAL:
+		case Opcode::OPCODE_AND:
+		case Opcode::OPCODE_OR:
 			//Operation found:
 			rvEval = evaluateOperation(pAST);
-		}
-		else if (pAST.getContent().getType() == Token::KEYWORD) {
+			break;
+
+		case Opcode::OPCODE_DECLARE_INT:
+		case Opcode::OPCODE_DECLARE_DOUBLE:
+		case Opcode::OPCODE_DECLARE_BOOL:
+		case Opcode::OPCODE_DECLARE_CHAR:
+		case Opcode::OPCODE_DECLARE_STRING:
+		case Opcode::OPCODE_SET:
+		case Opcode::OPCODE_PRINT:
+		case Opcode::OPCODE_PRINTLN:
+		case Opcode::OPCODE_IF:
+		case Opcode::OPCODE_WHILE:
+		case Opcode::OPCODE_RETURN:
+		case Opcode::OPCODE_KEYWORD:
+		case Opcode::OPCODE_SPAWN:
+		case Opcode::OPCODE_AWAIT:
+		case Opcode::OPCODE_FOR:
+		case Opcode::OPCODE_PFOR:
+		case Opcode::OPCODE_MAKE_CHANNEL:
+		case Opcode::OPCODE_SEND:
+		case Opcode::OPCODE_RECV:
+		case Opcode::OPCODE_TRY_SEND:
+		case Opcode::OPCODE_TRY_RECV:
 			//Keyword found:
 			rvEval = evaluateKeyword(pAST);
-		}
-		else if (pAST.getContent().getType() == Token::IDENTIFIER) {
+			break;
+
+		case Opcode::OPCODE_IDENTIFIER:
 			//Identifier found:
 			rvEval = evaluateIdentifier(pAST);
-		}
-		else {
+			break;
+
+		default:
 			//Incorrect token found:
 			return CRV<CToken>(rvEval.getContent(), Error::Interpreter::SYNTAX_I);
 		}
@@ -215,328 +644,52 @@ private:
 		CToken headNode = pAST.getContent(); //Represents the headNode.
 
 		CLinkedList<CToken> lOperands; //Stores the operands of the arithmetic operation.
+		if (pThreadPool != nullptr && headNode.isParallel()) {
+			//The expensive operands are evaluated by the thread pool:
+			CRV<CToken> rvOperands = evaluateInParallel(pAST, lOperands);
+			if (rvOperands.getErrorMessage() != Error::SUCCESS) {
+				//An error occured:
+				return rvOperands;
+			}
+			return operations.evaluate(headNode, lOperands);
+		}
 		CLinkedList<CAbstractSyntaxTree<CToken>> lNodeSubtrees; //Stores the subtrees.
 		lNodeSubtrees.addAll(pAST.getSubTrees());
 		for (unsigned int i = 0; i < lNodeSubtrees.size(); i++) {
-			CAbstractSyntaxTree<CToken> currentAST;
-			currentAST = lNodeSubtrees[i];
-			if (currentAST.getContent().getType() == Token::U_INT || currentAST.getContent().getType() == Token::U_DOUBLE || currentAST.getContent().getType() == Token::U_BOOL || currentAST.getContent().getType() == Token::U_CHAR || currentAST.getContent().getType() == Token::U_STRING) {
-				//Found integer, double or string (string only if operator is "+"):
-				lOperands.add(currentAST.getContent());
-			}
-			else if (currentAST.getContent().getType() == Token::IDENTIFIER) {
-				//Found variablename or function call:
-				CRV<CToken> rvEval = interpretExpression(currentAST); //Stores the result of the evaluation of the identifier.
-				if (rvEval.getErrorMessage() != Error::SUCCESS) {
-					//An error occured:
-					return rvEval;
-				}
-				lOperands.add(rvEval.getContent());
-			}
-			else {
-				//Another abstraxt syntax tree needs to be evaluated:
-				CRV<CToken> rv_eval = evaluateOperation(currentAST);
-				if (rv_eval.getErrorMessage() != Error::SUCCESS) {
-					//An error occured:
-					return rv_eval;
-				}
-				lOperands.add(rv_eval.getContent());
-			}
-		}
-
-		if (headNode.getType() == Token::OPERATOR_ARITHMETIC) {
-			//Arithmetic operation:
-			if (headNode.getLexeme() == "+") {
-				//Additon -> Check wether the operands can be added:
-				short int nReturnType = lOperands[0].getType();
-				if (nReturnType == Token::U_STRING || nReturnType == Token::U_CHAR) {
-					//Every other operand must be string or character:
-					for (unsigned int i = 1; i < lOperands.size(); i++) {
-						if (lOperands[i].getType() != Token::U_STRING && lOperands[i].getType() != Token::U_CHAR) {
-							//Error: Operands are not of the same type:
-							return CRV<CToken>(lOperands[i], Error::Interpreter::OPERANDS_ARE_OF_DIFFERENT_TYPE);
-						}
-					}
-					nReturnType = Token::U_STRING; //Needs to be string, since either added characters or strings, make up a string in the end! \(^_^)/
-				}
-				else if (nReturnType == Token::U_INT || nReturnType == Token::U_DOUBLE) {
-					//Every other operand must be integer or double:
-					for (unsigned int i = 1; i < lOperands.size(); i++) {
-						if (lOperands[i].getType() != Token::U_INT && lOperands[i].getType() != Token::U_DOUBLE) {
-							//Error: Operands are not of the same type:
-							return CRV<CToken>(lOperands[i], Error::Interpreter::OPERANDS_ARE_OF_DIFFERENT_TYPE);
-						}
-						if (lOperands[i].getType() == Token::U_DOUBLE) {
-							nReturnType = Token::U_DOUBLE; //When integer and double, or multiple doubles are added, a double-type value must be returned.
-														 //If only integers are present, this value will simply stay as integer!
-						}
-					}
-				}
-				else if (nReturnType == Token::U_BOOL) {
-					//Error: Cannot add multiple booleans:
-					return CRV<CToken>(lOperands[0], Error::Interpreter::CANNOT_ADD_BOOLEANS);
-				}
-				else {
-					//Error: Incorrect token encountered -> Syntax error:
-					return CRV<CToken>(lOperands[0], Error::Interpreter::SYNTAX_I);
-				}
-
-				//Add the operands:
-				string sReturnValue = ""; //Represents the value, which should be returned as token.
-				if (nReturnType == Token::U_STRING) {
-					//A string needs to be created:
-					for (unsigned int i = 0; i < lOperands.size(); i++) {
-						sReturnValue += lOperands[i].getLexeme();
-					}
-				}
-				else {
-					//A number (either integer or double) needs to be created:
-					sReturnValue = lOperands[0].getLexeme(); //First number makes string.
-					for (unsigned int i = 1; i < lOperands.size(); i++) {
-						if (nReturnType == Token::U_INT) {
-							sReturnValue = to_string(stoi(sReturnValue) + stoi(lOperands[i].getLexeme()));
-						}
-						else {
-							sReturnValue = to_string(stod(sReturnValue) + stod(lOperands[i].getLexeme()));
-						}
-					}
-				}
-				return CRV<CToken>(CToken(sReturnValue, nReturnType, lOperands[0].getFilename(), lOperands[0].getLine()), Error::SUCCESS);
-			}
-			
-			else if (headNode.getLexeme() == "-") {
-				//Subtraction -> check wether all operators are numeric values:
-				short int nReturnType = Token::U_INT; //Stores, wether return value is integer or double.
-				for (unsigned int i = 0; i < lOperands.size(); i++) {
-					if (lOperands[i].getType() == Token::U_DOUBLE) {
-						nReturnType = Token::U_DOUBLE;
-					}
-					else if (lOperands[i].getType() != Token::U_DOUBLE && lOperands[i].getType() != Token::U_INT) {
-						//Found token, which resembles a non-numeric value:
-						return CRV<CToken>(lOperands[i], Error::Interpreter::CANNOT_SUBTRACT_NON_NUMERIC_VALUES);
-					}
-				}
-
-				//Subtract the numbers:
-				string sReturnValue = lOperands[0].getLexeme(); //Resembles the return value of the subtraction.
-				for (unsigned int i = 1; i < lOperands.size(); i++) {
-					if (nReturnType == Token::U_INT) {
-						sReturnValue = to_string(stoi(sReturnValue) - stoi(lOperands[i].getLexeme()));
-					}
-					else {
-						sReturnValue = to_string(stod(sReturnValue) - stod(lOperands[i].getLexeme()));
-					}
-				}
-				return CRV<CToken>(CToken(sReturnValue, nReturnType, lOperands[0].getFilename(), lOperands[0].getLine()), Error::SUCCESS);
-			}
-
-			else if (headNode.getLexeme() == "*") {
-				//Multiplication -> check wether all operators are numeric values:
-				short int nReturnType = lOperands[0].getType(); //Stores, wether an integer or double should be returned.
-				for (unsigned int i = 0; i < lOperands.size(); i++) {
-					if (lOperands[i].getType() != Token::U_INT && lOperands[i].getType() != Token::U_DOUBLE) {
-						//Error: Cannot multiply with non-numeric-values:
-						return CRV<CToken>(lOperands[i], Error::Interpreter::CANNOT_MULTIPLY_NON_NUMERIC_VALUES);
-					}
-					else if (lOperands[i].getType() == Token::U_DOUBLE) {
-						nReturnType = Token::U_DOUBLE;
-					}
-				}
-
-				//Multiply:
-				string sReturnValue = ""; //Stores the result of the multiplication as string.
-				sReturnValue = lOperands[0].getLexeme();
-				for (unsigned int i = 1; i < lOperands.size(); i++) {
-					if (nReturnType == Token::U_INT) {
-						sReturnValue = to_string(stoi(sReturnValue) * stoi(lOperands[i].getLexeme()));
-					}
-					else if (nReturnType == Token::U_DOUBLE) {
-						sReturnValue = to_string(stod(sReturnValue) * stod(lOperands[i].getLexeme()));
-					}
-				}
-				return CRV<CToken>(CToken(sReturnValue, nReturnType, lOperands[0].getFilename(), lOperands[0].getLine()), Error::SUCCESS);
+			CRV<CToken> rvEval = evaluateOperand(lNodeSubtrees[i]); //Stores the evaluated operand.
+			if (rvEval.getErrorMessage() != Error::SUCCESS) {
+				//An error occured:
+				return rvEval;
 			}
-
-			else if (headNode.getLexeme() == "/") {
-				//Division -> check wether all operators are numeric values:
-				for (unsigned int i = 0; i < lOperands.size(); i++) {
-					if (lOperands[i].getType() != Token::U_INT && lOperands[i].getType() != Token::U_DOUBLE) {
-						//Error: Cannot divide non-numeric values:
-						return CRV<CToken>(lOperands[i], Error::Interpreter::CANNOT_DIVIDE_NON_NUMERIC_VALUES);
-					}
-					else if (i >= 1 && stod(lOperands[i].getLexeme()) == 0) {
-						//Error: Cannot divide by zero:
-						return CRV<CToken>(lOperands[i], Error::Interpreter::CANNOT_DIVIDE_BY_ZERO);
-					}
-				}
-
-				//Divide:
-				string sReturnValue = ""; //Stores the result of the division as string.
-				sReturnValue = lOperands[0].getLexeme();
-				for (unsigned int i = 1; i < lOperands.size(); i++) {
-					sReturnValue = to_string(stod(sReturnValue) / stod(lOperands[i].getLexeme()));
-				}
-				return CRV<CToken>(CToken(sReturnValue, Token::U_DOUBLE, lOperands[0].getFilename(), lOperands[0].getLine()), Error::SUCCESS);
+			lOperands.add(rvEval.getContent());
+			if (i + 1 < lNodeSubtrees.size() && operations.isDecided(headNode, lOperands.back())) {
+				//The remaining operands of "&" or "|" cannot change the result:
+				break;
 			}
 		}
-		
-		else if (headNode.getType() == Token::OPERATOR_RELATIONAL) {
-			//Relational operation:
-			if (lOperands.size() != 2) {
-				//Error: Relational operations do only work with exactly 2 operators:
-				if (lOperands.size() < 2) {
-					return CRV<CToken>(headNode, Error::Interpreter::NOT_ENOUGH_ARGUMENTS);
-				}
-				else {
-					return CRV<CToken>(headNode, Error::Interpreter::TOO_MANY_ARGUMENTS);
-				}
-			}
-
-			CToken firstOperand = lOperands[0]; //Stores the first operand.
-			CToken secondOperand = lOperands[1]; //Stores the second operand.
-			bool bResult = false; //Stores the result of the relational operation.
 
-			if (headNode.getLexeme() == "=") {
-				//Equal to:
-				if (firstOperand.getType() != secondOperand.getType() && !((firstOperand.getType() == Token::U_INT && secondOperand.getType() == Token::U_DOUBLE) || (firstOperand.getType() == Token::U_DOUBLE && secondOperand.getType() == Token::U_INT))) {
-					//Error operands are of different type:
-					return CRV<CToken>(headNode, Error::produceConvertError(firstOperand.getType(), secondOperand.getType()));
-				}
-				if (firstOperand.getLexeme() == secondOperand.getLexeme()) {
-					//Lexemes of operands are identical:
-					return CRV<CToken>(CToken("t", Token::U_BOOL, headNode.getFilename(), headNode.getLine()), Error::SUCCESS);
-				}
-				else if (firstOperand.getType() == Token::U_INT || secondOperand.getType() == Token::U_INT || firstOperand.getType() == Token::U_DOUBLE || secondOperand.getType() == Token::U_DOUBLE) {
-					//Operands are of numerical type (This can be done this way, since the aforeimplemented if-clause makes sure that all the operands are comparable with
-					//each other, so if this condition is true, each operand is of numerical type. Therefore, they can be compared):
-					double val1 = stod(firstOperand.getLexeme());
-					double val2 = stod(secondOperand.getLexeme());
-					//Compare the two values:
-					if (val1 == val2) {
-						//The two operands are identical:
-						return CRV<CToken>(CToken("t", Token::U_BOOL, headNode.getFilename(), headNode.getLine()), Error::SUCCESS);
-					}
-					else {
-						return CRV<CToken>(CToken("nil", Token::U_BOOL, headNode.getFilename(), headNode.getLine()), Error::SUCCESS);
-					}
-				}
-				else {
-					//Operands are not identical:
-					return CRV<CToken>(CToken("nil", Token::U_BOOL, headNode.getFilename(), headNode.getLine()), Error::SUCCESS);
-				}
-			}
-			else if (headNode.getLexeme() == "!") {
-				//Not equal to:
-				if (firstOperand.getType() != secondOperand.getType() && !((firstOperand.getType() == Token::U_INT && secondOperand.getType() == Token::U_DOUBLE) || (firstOperand.getType() == Token::U_DOUBLE && secondOperand.getType() == Token::U_INT))) {
-					//Error operands are of different type:
-					return CRV<CToken>(headNode, Error::produceConvertError(firstOperand.getType(), secondOperand.getType()));
-				}
-				if (firstOperand.getLexeme() != secondOperand.getLexeme()) {
-					//Operands are not identical:
-					return CRV<CToken>(CToken("t", Token::U_BOOL, headNode.getFilename(), headNode.getLine()), Error::SUCCESS);
-				}
-				else {
-					//Operands are identical:
-					return CRV<CToken>(CToken("nil", Token::U_BOOL, headNode.getFilename(), headNode.getLine()), Error::SUCCESS);
-				}
-			}
-			else {
-				//For every other relational operation, the operands must either be an integer or a double:
-				if (firstOperand.getType() != Token::U_INT && firstOperand.getType() != Token::U_DOUBLE) {
-					//Error: The first operand is no number:
-					return CRV<CToken>(firstOperand, Error::produceConvertError(firstOperand.getType(), Token::U_DOUBLE));
-				}
-				else if (secondOperand.getType() != Token::U_INT && secondOperand.getType() != Token::U_DOUBLE) {
-					//Error: The second operand is no number:
-					return CRV<CToken>(secondOperand, Error::produceConvertError(secondOperand.getType(), Token::U_DOUBLE));
-				}
-				double nVal1 = stod(firstOperand.getLexeme()); //Stores the first operand as double-value.
-				double nVal2 = stod(secondOperand.getLexeme()); //Stores the second operand as double-value.
-
-				if (headNode.getLexeme() == ">") {
-					//Greater than:
-					if (nVal1 > nVal2) {
-						//The first value is greater than the second value:
-						return CRV<CToken>(CToken("t", Token::U_BOOL, headNode.getFilename(), headNode.getLine()), Error::SUCCESS);
-					}
-					else {
-						//The first value is not greater than the second value:
-						return CRV<CToken>(CToken("nil", Token::U_BOOL, headNode.getFilename(), headNode.getLine()), Error::SUCCESS);
-					}
-				}
-				else if (headNode.getLexeme() == "<") {
-					//Less than:
-					if (nVal1 < nVal2) {
-						//The first value is less than the second value:
-						return CRV<CToken>(CToken("t", Token::U_BOOL, headNode.getFilename(), headNode.getLine()), Error::SUCCESS);
-					}
-					else {
-						//The first value is not less than the second value:
-						return CRV<CToken>(CToken("nil", Token::U_BOOL, headNode.getFilename(), headNode.getLine()), Error::SUCCESS);
-					}
-				}
-				else if (headNode.getLexeme() == ">=") {
-					//Greater or equal than:
-					if (nVal1 >= nVal2) {
-						//The first value is greater or equal than the second value:
-						return CRV<CToken>(CToken("t", Token::U_BOOL, headNode.getFilename(), headNode.getLine()), Error::SUCCESS);
-					}
-					else {
-						//The first value is not greater or equal than the second value:
-						return CRV<CToken>(CToken("nil", Token::U_BOOL, headNode.getFilename(), headNode.getLine()), Error::SUCCESS);
-					}
-				}
-				else if (headNode.getLexeme() == "<=") {
-					//Less or equal than:
-					if (nVal1 <= nVal2) {
-						//The first value is less or equal than the second value:
-						return CRV<CToken>(CToken("t", Token::U_BOOL, headNode.getFilename(), headNode.getLine()), Error::SUCCESS);
-					}
-					else {
-						//The first value is not less or equal than the second value:
-						return CRV<CToken>(CToken("nil", Token::U_BOOL, headNode.getFilename(), headNode.getLine()), Error::SUCCESS);
-					}
-				}
-			}
-		}
+		//Apply the operator to the operands:
+		return operations.evaluate(headNode, lOperands);
+	}
 
-		else if (headNode.getType() == Token::OPERATOR_BOOL) {
-			//Boolean operation:
-			if (lOperands.size() < 2) {
-				//Error: Boolean operation must contain at least two arguments:
-				return CRV<CToken>(headNode, Error::Interpreter::NOT_ENOUGH_ARGUMENTS);
-			}
-			if (headNode.getLexeme() == "&") {
-				//All operands must be "t":
-				for (unsigned int i = 0; i < lOperands.size(); i++) {
-					if (lOperands[i].getLexeme() == "nil") {
-						//nil was found, return nil:
-						return CRV<CToken>(CToken("nil", Token::U_BOOL, headNode.getFilename(), headNode.getLine()), Error::SUCCESS);
-					}
-				}
-				//nil was not found, return t:
-				return CRV<CToken>(CToken("t", Token::U_BOOL, headNode.getFilename(), headNode.getLine()), Error::SUCCESS);
-			}
-			else {
-				//At least one operand must be "t":
-				for (unsigned int i = 0; i < lOperands.size(); i++) {
-					if (lOperands[i].getLexeme() == "t") {
-						//t was found, return t:
-						return CRV<CToken>(CToken("t", Token::U_BOOL, headNode.getFilename(), headNode.getLine()), Error::SUCCESS);
-					}
-				}
-				//t was not found, return nil:
-				return CRV<CToken>(CToken("nil", Token::U_BOOL, headNode.getFilename(), headNode.getLine()), Error::SUCCESS);
-			}
+	/**
+	* This function evaluates a single operand of an operation.
+	*
+	* @param pOperand	Abstract syntax tree, which represents the operand.
+	* @return			Evaluated operand or error message including the token which caused the error.
+	*/
+	CRV<CToken> evaluateOperand(CAbstractSyntaxTree<CToken> pOperand) {
+		short int nType = pOperand.getContent().getType(); //Stores the type of the operand's head node.
+		if (nType == Token::U_INT || nType == Token::U_DOUBLE || nType == Token::U_BOOL || nType == Token::U_CHAR || nType == Token::U_STRING) {
+			//Found integer, double or string (string only if operator is "+"):
+			return CRV<CToken>(pOperand.getContent(), Error::SUCCESS);
 		}
-
-		else {
-			//Found invalid token:
-			return CRV<CToken>(headNode, Error::Interpreter::INCORRECT_TOKEN);
+		else if (nType == Token::IDENTIFIER || returnsValue(pOperand.getContent().getOpcode())) {
+			//Found variablename, function call, task or channel:
+			return interpretExpression(pOperand);
 		}
-
-		//Return SUCCESS -> Only needed to eliminate compiler warning. \(^_^)/
-		return CRV<CToken>(headNode, Error::SUCCESS);
+		//Another abstraxt syntax tree needs to be evaluated:
+		return evaluateOperation(pOperand);
 	}
 	
 
@@ -562,25 +715,32 @@ private:
 			return CRV<CToken>(headNode, Error::Interpreter::SYNTAX_I);
 		}
 
-		if (headNode.getLexeme() == Keyword::INT || headNode.getLexeme() == Keyword::DOUBLE || headNode.getLexeme() == Keyword::BOOL || headNode.getLexeme() == Keyword::CHAR || headNode.getLexeme() == Keyword::STRING) {
+		switch (headNode.getOpcode()) {
+		case Opcode::OPCODE_DECLARE_INT:
+		case Opcode::OPCODE_DECLARE_DOUBLE:
+		case Opcode::OPCODE_DECLARE_BOOL:
+		case Opcode::OPCODE_DECLARE_CHAR:
+		case Opcode::OPCODE_DECLARE_STRING: {
 			//The keyword indicates a declaration of a new variable:
 			CToken variableName; //Stores the name of the variable.
 			CToken variableValue; //Stores the value of the new variable.
 			//Initialize variable with standard value:
-			if (headNode.getLexeme() == Keyword::INT) {
+			switch (headNode.getOpcode()) {
+			case Opcode::OPCODE_DECLARE_INT:
 				variableValue = CToken{ "0", Token::U_INT, variableName.getFilename(), variableName.getLine() };
-			}
-			else if (headNode.getLexeme() == Keyword::DOUBLE) {
+				break;
+			case Opcode::OPCODE_DECLARE_DOUBLE:
 				variableValue = CToken{ "0.0", Token::U_DOUBLE, variableName.getFilename(), variableName.getLine() };
-			}
-			else if (headNode.getLexeme() == Keyword::BOOL) {
+				break;
+			case Opcode::OPCODE_DECLARE_BOOL:
 				variableValue = CToken{ "nil", Token::U_BOOL, variableName.getFilename(), variableName.getLine() };
-			}
-			else if (headNode.getLexeme() == Keyword::CHAR) {
+				break;
+			case Opcode::OPCODE_DECLARE_CHAR:
 				variableValue = CToken{ " ", Token::U_CHAR, variableName.getFilename(), variableName.getLine() };
-			}
-			else if (headNode.getLexeme() == Keyword::STRING) {
+				break;
+			default:
 				variableValue = CToken{ "", Token::U_STRING, variableName.getFilename(), variableName.getLine() };
+				break;
 			}
 			
 			if (lASTs.size() < 1) {
@@ -611,15 +771,15 @@ private:
 						//An error occured:
 						return rvEval;
 					}
-					else if (rvEval.getContent().getType() != variableValue.getType()) {
+					else if (!headNode.isVerified() && rvEval.getContent().getType() != variableValue.getType()) {
 						return CRV<CToken>(rvEval.getContent(), Error::produceConvertError(rvEval.getContent().getType(), variableValue.getType()));
 					}
 					variableValue = rvEval.getContent();
 				}
 			}
-			else if (lASTs.size() > 1) {
+			else if (headNode.getArityError() != Error::SUCCESS) {
 				//There are too many arguments wit this declaration:
-				return CRV<CToken>(headNode, Error::Interpreter::TOO_MANY_ARGUMENTS);
+				return CRV<CToken>(headNode, headNode.getArityError());
 			}
 			//Create a new variable:
 			short int nErrorMessage = addVariable(CVariable(variableName.getLexeme(), variableValue.getLexeme(), variableValue.getType()));
@@ -627,16 +787,12 @@ private:
 			return CRV<CToken>(variableName, nErrorMessage);
 		}
 
-		else if (headNode.getLexeme() == Keyword::SET) {
+		case Opcode::OPCODE_SET: {
 			CToken variableName; //Stores the name of the variable.
 			CToken variableValue; //Stores the value of the new variable.
-			if (lASTs.size() < 2) {
-				//Error: Not enough arguments:
-				return CRV<CToken>(headNode, Error::Interpreter::NOT_ENOUGH_ARGUMENTS);
-			}
-			else if (lASTs.size() > 2) {
-				//Error: Too many arguments:
-				return CRV<CToken>(headNode, Error::Interpreter::TOO_MANY_ARGUMENTS);
+			if (headNode.getArityError() != Error::SUCCESS) {
+				//Error: Not enough or too many arguments:
+				return CRV<CToken>(headNode, headNode.getArityError());
 			}
 			else if (lASTs[0].getContent().getType() != Token::IDENTIFIER) {
 				//Error: Incorrect token found:
@@ -665,8 +821,9 @@ private:
 			//Return result of changed value:
 			return CRV<CToken>(variableName, nErrorMessage);
 		}
-	
-		else if (headNode.getLexeme() == Keyword::PRINT || headNode.getLexeme() == Keyword::PRINTLN) {
+
+		case Opcode::OPCODE_PRINT:
+		case Opcode::OPCODE_PRINTLN: {
 			//Print every other element in the list:
 			for (unsigned int i = 0; i < lASTs.size(); i++) {
 				//Print every other element in the list:
@@ -678,7 +835,7 @@ private:
 						//An error occured:
 						return rvEval;
 					}
-					cout << rvEval.getContent().getLexeme();
+					writeOutput(rvEval.getContent().getLexeme());
 				}
 				else if (current.getContent().getType() == Token::IDENTIFIER) {
 					//Need to get the value of variable:
@@ -687,58 +844,85 @@ private:
 						//An error occured:
 						return rvEval;
 					}
-					cout << rvEval.getContent().getLexeme();
+					writeOutput(rvEval.getContent().getLexeme());
 				}
 				else if (current.getContent().getType() == Token::U_INT || current.getContent().getType() == Token::U_DOUBLE || current.getContent().getType() == Token::U_BOOL || current.getContent().getType() == Token::U_CHAR || current.getContent().getType() == Token::U_STRING) {
 					//Element resembles value which can be printed:
-					cout << current.getContent().getLexeme();
+					writeOutput(current.getContent().getLexeme());
 				}
 				else {
 					//Encountered invalid token:
 					return CRV<CToken>(current.getContent(), Error::Interpreter::INCORRECT_TOKEN);
 				}
 			}
-			if (headNode.getLexeme() == Keyword::PRINTLN) {
-				cout << "\n";
+			if (headNode.getOpcode() == Opcode::OPCODE_PRINTLN) {
+				writeOutput("\n");
 			}
 			return CRV<CToken>(headNode, Error::SUCCESS);
 		}
 
-		else if (headNode.getLexeme() == Keyword::IF) {
-		//Evaluate if-statement:
-		return ifStatement(pAST);
-		}
+		case Opcode::OPCODE_IF:
+			//Evaluate if-statement:
+			return ifStatement(pAST);
 
-		else if (headNode.getLexeme() == Keyword::WHILE) {
+		case Opcode::OPCODE_WHILE:
 			//Evaluate while-loop:
 			return whileLoop(pAST);
-		}
 
-		else if (headNode.getLexeme() == Keyword::RETURN) {
+		case Opcode::OPCODE_FOR:
+		case Opcode::OPCODE_PFOR:
+			//Evaluate counted loop:
+			return countedLoop(pAST);
+
+		case Opcode::OPCODE_SPAWN:
+			//Call a function in another task:
+			return spawnTask(pAST);
+
+		case Opcode::OPCODE_AWAIT:
+			//Wait for a spawned task:
+			return awaitTask(pAST);
+
+		case Opcode::OPCODE_MAKE_CHANNEL:
+		case Opcode::OPCODE_SEND:
+		case Opcode::OPCODE_RECV:
+		case Opcode::OPCODE_TRY_SEND:
+		case Opcode::OPCODE_TRY_RECV:
+			//Create a channel or send or receive a value:
+			return channelOperation(pAST);
+
+		case Opcode::OPCODE_RETURN: {
 			//Evaluate return-statement:
-			if (pAST.hasSubTrees()) {
-				if (pAST.getSubTreeNumber() == 1) {
-					//Return the ONLY subtree of the return statement:
-					CAbstractSyntaxTree<CToken> tReturnValue = pAST.getSubTreeAtIndex(0);
-					if (tReturnValue.hasSubTrees() || !(tReturnValue.getContent().getType() == Token::U_INT || tReturnValue.getContent().getType() == Token::U_DOUBLE || tReturnValue.getContent().getType() == Token::U_CHAR || tReturnValue.getContent().getType() == Token::U_BOOL || tReturnValue.getContent().getType() == Token::U_STRING)) {
-						//Further evaluation needed for return value:
-						CRV<CToken> rvEval = interpretExpression(tReturnValue);
-						if (rvEval.getErrorMessage() != Error::SUCCESS) {
-							//An error occured:
-							return rvEval;
-						}
-						return CRV<CToken>(rvEval.getContent(), Error::Interpreter::INFO_RETURN_STATEMENT_ENCOUNTERED);
-					}
-					return CRV<CToken>(pAST.getSubTreeAtIndex(0).getContent(), Error::Interpreter::INFO_RETURN_STATEMENT_ENCOUNTERED);
+			if (headNode.getArityError() != Error::SUCCESS) {
+				//Too many values encountered which could be returned:
+				return CRV<CToken>(headNode, headNode.getArityError());
+			}
+			//Return the ONLY subtree of the return statement:
+			CAbstractSyntaxTree<CToken> tReturnValue = pAST.getSubTreeAtIndex(0);
+			if (nCallDepth > 0 && tReturnValue.getContent().getOpcode() == Opcode::OPCODE_IDENTIFIER && (tReturnValue.hasSubTrees() || getVariable(tReturnValue.getContent().getLexeme()).getErrorMessage() != Error::SUCCESS)) {
+				//The returned value is computed by a call in tail position, which is executed by the calling function:
+				CLinkedList<CToken> lArguments;
+				CRV<CToken> rvArguments = evaluateArguments(tReturnValue, lArguments);
+				if (rvArguments.getErrorMessage() != Error::SUCCESS) {
+					//An error occured:
+					return rvArguments;
 				}
-				else {
-					//Too many values encountered which could be returned:
-					return CRV<CToken>(headNode, Error::Interpreter::TOO_MANY_VALUES_TO_RETURN);
+				tailCallName = tReturnValue.getContent();
+				lTailCallArguments = lArguments;
+				return CRV<CToken>(tailCallName, Error::Interpreter::INFO_TAIL_CALL);
+			}
+			if (tReturnValue.hasSubTrees() || !(tReturnValue.getContent().getType() == Token::U_INT || tReturnValue.getContent().getType() == Token::U_DOUBLE || tReturnValue.getContent().getType() == Token::U_CHAR || tReturnValue.getContent().getType() == Token::U_BOOL || tReturnValue.getContent().getType() == Token::U_STRING)) {
+				//Further evaluation needed for return value:
+				CRV<CToken> rvEval = interpretExpression(tReturnValue);
+				if (rvEval.getErrorMessage() != Error::SUCCESS) {
+					//An error occured:
+					return rvEval;
 				}
+				return CRV<CToken>(rvEval.getContent(), Error::Interpreter::INFO_RETURN_STATEMENT_ENCOUNTERED);
 			}
+			return CRV<CToken>(tReturnValue.getContent(), Error::Interpreter::INFO_RETURN_STATEMENT_ENCOUNTERED);
 		}
 
-		else {
+		default:
 			//Found invalid keyword:
 			return CRV<CToken>(headNode, Error::Interpreter::INCORRECT_TOKEN);
 		}
@@ -783,34 +967,129 @@ private:
 		else {
 			//Identifier resembles a function name:
 			CLinkedList<CToken> plPassedArguments;
-			if (pAST.hasSubTrees()) {
-				//The function call has arguments which are passed:
-				for (unsigned int i = 0; i < pAST.getSubTrees().size(); i++) {
-					CToken currentArg;
-					//Find out if each argument has subtrees and needs further evaluation:
-					if (pAST.getSubTreeAtIndex(i).hasSubTrees() || !(pAST.getSubTreeAtIndex(i).getContent().getType() == Token::U_INT || pAST.getSubTreeAtIndex(i).getContent().getType() == Token::U_DOUBLE || pAST.getSubTreeAtIndex(i).getContent().getType() == Token::U_CHAR || pAST.getSubTreeAtIndex(i).getContent().getType() == Token::U_BOOL || pAST.getSubTreeAtIndex(i).getContent().getType() == Token::U_STRING)) {
-						//Further evaluation neccessary:
-						CRV<CToken> rvEval;
-						rvEval = interpretExpression(pAST.getSubTreeAtIndex(i));
-						if (rvEval.getErrorMessage() != Error::SUCCESS) {
-							//An error occured:
-							return rvEval;
-						}
-						currentArg = rvEval.getContent();
-					}
-					else {
-						//No further evaluation neccessary:
-						currentArg = pAST.getSubTreeAtIndex(i).getContent();
-					}
+			CRV<CToken> rvArguments = evaluateArguments(pAST, plPassedArguments);
+			if (rvArguments.getErrorMessage() != Error::SUCCESS) {
+				//An error occured:
+				return rvArguments;
+			}
+			
+			//Call the function:
+			return callFunction(pAST.getContent(), plPassedArguments);
+		}
+	}
 
-					//Add the current argument to the list of passed arguments:
-					plPassedArguments.add(currentArg);
+	/**
+	* This function evaluates a single argument of a function call. Values are returned without being evaluated.
+	*
+	* @param pArgument	Abstract syntax tree, which represents the argument.
+	* @return			Evaluated argument or error message including the token which caused the error.
+	*/
+	CRV<CToken> evaluateArgument(CAbstractSyntaxTree<CToken> pArgument) {
+		short int nType = pArgument.getContent().getType(); //Stores the type of the argument's head node.
+		if (pArgument.hasSubTrees() || !(nType == Token::U_INT || nType == Token::U_DOUBLE || nType == Token::U_CHAR || nType == Token::U_BOOL || nType == Token::U_STRING)) {
+			//Further evaluation neccessary:
+			return interpretExpression(pArgument);
+		}
+		//No further evaluation neccessary:
+		return CRV<CToken>(pArgument.getContent(), Error::SUCCESS);
+	}
+
+	/**
+	* This function evaluates the arguments of a function call from left to right. The arguments of parallel calls (see
+	* CArgumentScheduler) are evaluated simultaneously.
+	*
+	* @param pAST			Abstract syntax tree, which represents the function call.
+	* @param plArguments	List, to which the evaluated arguments are added.
+	* @return				Error message including the token which caused the error.
+	*/
+	CRV<CToken> evaluateArguments(CAbstractSyntaxTree<CToken> pAST, CLinkedList<CToken>& plArguments) {
+		if (pThreadPool != nullptr && pAST.getContent().isParallel()) {
+			return evaluateInParallel(pAST, plArguments);
+		}
+		for (unsigned int i = 0; i < pAST.getSubTreeNumber(); i++) {
+			CRV<CToken> rvEval = evaluateArgument(pAST.getSubTreeAtIndex(i));
+			if (rvEval.getErrorMessage() != Error::SUCCESS) {
+				//An error occured:
+				return rvEval;
+			}
+
+			//Add the current argument to the list of passed arguments:
+			plArguments.add(rvEval.getContent());
+		}
+		return CRV<CToken>(pAST.getContent(), Error::SUCCESS);
+	}
+
+	/**
+	* This function evaluates the arguments of a parallel call or the operands of a parallel operation simultaneously:
+	* The forked arguments are submitted to the thread pool, every other argument is evaluated by the current thread,
+	* which helps the pool afterwards, until every argument is evaluated. Since the arguments are pure, only errors could
+	* reveal the order of their evaluation. Therefore, the error of the first argument (in the order of the sourcecode) is
+	* returned, like it would have been returned, if the arguments had been evaluated from left to right.
+	*
+	* @param pAST			Abstract syntax tree, which represents the call or operation.
+	* @param plArguments	List, to which the evaluated arguments are added.
+	* @return				Error message including the token which caused the error.
+	*/
+	CRV<CToken> evaluateInParallel(CAbstractSyntaxTree<CToken> pAST, CLinkedList<CToken>& plArguments) {
+		bool bOperation = pAST.getContent().getOpcode() != Opcode::OPCODE_IDENTIFIER; //Stores whether the subtrees are operands.
+		CLinkedList<CAbstractSyntaxTree<CToken>> ltSubTrees = pAST.getSubTrees();
+		vector<CAbstractSyntaxTree<CToken>> vtArguments; //Stores the arguments of the call.
+		for (unsigned int i = 0; i < ltSubTrees.size(); i++) {
+			vtArguments.push_back(ltSubTrees[i]);
+		}
+		vector<CRV<CToken>> vrvResults(vtArguments.size()); //Stores the result of each argument.
+		CLinkedList<CVariable> lCallerVariables = lVariables; //Stores the variables, which can be read by the arguments.
+		atomic<unsigned int> nRemaining(0); //Stores the number of arguments, which are still evaluated by the pool.
+
+		for (unsigned int i = 0; i < vtArguments.size(); i++) {
+			if (vtArguments[i].getContent().isForked()) {
+				pThreadPool->submit([this, i, bOperation, &vtArguments, &vrvResults, &lCallerVariables]() {
+					//Every thread evaluates the argument with it's own interpreter:
+					CInterpreter* pInterpreter = getThreadInterpreter();
+					vrvResults[i] = pInterpreter->evaluateTask(vtArguments[i], bOperation, lCallerVariables);
+				}, nRemaining);
+			}
+		}
+		for (unsigned int i = 0; i < vtArguments.size(); i++) {
+			if (!vtArguments[i].getContent().isForked()) {
+				vrvResults[i] = bOperation ? evaluateOperand(vtArguments[i]) : evaluateArgument(vtArguments[i]);
+				if (vrvResults[i].getErrorMessage() != Error::SUCCESS) {
+					//The remaining arguments cannot change the result:
+					break;
 				}
 			}
-			
-			//Call the function:
-			return callFunction(pAST.getContent(), plPassedArguments);
 		}
+		pThreadPool->wait(nRemaining);
+
+		for (unsigned int i = 0; i < vtArguments.size(); i++) {
+			if (vrvResults[i].getErrorMessage() != Error::SUCCESS) {
+				//The first error in the order of the sourcecode is reported:
+				return vrvResults[i];
+			}
+			plArguments.add(vrvResults[i].getContent());
+		}
+		return CRV<CToken>(pAST.getContent(), Error::SUCCESS);
+	}
+
+	/**
+	* This function evaluates an argument, which has been submitted to the thread pool, with the passed variables of the
+	* calling function. Since the current thread can execute tasks while it waits for the arguments of another call, the
+	* state of the interpreter is restored afterwards.
+	*
+	* @param pArgument			Abstract syntax tree, which represents the argument.
+	* @param pbOperand			Whether the argument is the operand of an operation.
+	* @param plCallerVariables	Variables of the calling function.
+	* @return					Evaluated argument or error message including the token which caused the error.
+	*/
+	CRV<CToken> evaluateTask(CAbstractSyntaxTree<CToken> pArgument, bool pbOperand, CLinkedList<CVariable>& plCallerVariables) {
+		CLinkedList<CVariable> lOldVariables = lVariables; //Stores the variables, which are restored afterwards.
+		unsigned int nOldCallDepth = nCallDepth; //Stores the call depth, which is restored afterwards.
+		lVariables = plCallerVariables;
+		nCallDepth = 0;
+		CRV<CToken> rvEval = pbOperand ? evaluateOperand(pArgument) : evaluateArgument(pArgument);
+		lVariables = lOldVariables;
+		nCallDepth = nOldCallDepth;
+		return rvEval;
 	}
 	
 
@@ -824,7 +1103,7 @@ private:
 	* @return		Error message and token, which caused the error.
 	*/
 	CRV<CToken> ifStatement(CAbstractSyntaxTree<CToken> pAST) {
-		if (pAST.getContent().getLexeme() != Keyword::IF) {
+		if (pAST.getContent().getOpcode() != Opcode::OPCODE_IF) {
 			//Error: Incorrect token found:
 			return CRV<CToken>(pAST.getContent(), Error::Interpreter::INCORRECT_TOKEN);
 		}
@@ -841,6 +1120,7 @@ private:
 		}
 		CAbstractSyntaxTree<CToken> tCondition = lSubTrees[0]; //Stores the condition of the AST.
 		bool bCondition = false; //Stores wether the statement's condition is true or false.
+		bool bVerified = pAST.getContent().isVerified(); //Stores wether the condition always results in a boolean.
 		if (tCondition.hasSubTrees()) {
 			//Further evaluation of the condition needed:
 			CRV<CToken> rvEval = interpretExpression(tCondition);
@@ -849,7 +1129,7 @@ private:
 				return rvEval;
 			}
 			CToken condToken = rvEval.getContent(); //Stores the returned token, which stores the boolean for the condition.
-			if (condToken.getType() != Token::U_BOOL || (condToken.getType() == Token::U_INT && (stoi(condToken.getLexeme()) != 1 || stoi(condToken.getLexeme()) != 0)) || (condToken.getType() == Token::U_DOUBLE && (stod(condToken.getLexeme()) != 1 || stod(condToken.getLexeme()) != 0))) {
+			if (!bVerified && (condToken.getType() != Token::U_BOOL || (condToken.getType() == Token::U_INT && (stoi(condToken.getLexeme()) != 1 || stoi(condToken.getLexeme()) != 0)) || (condToken.getType() == Token::U_DOUBLE && (stod(condToken.getLexeme()) != 1 || stod(condToken.getLexeme()) != 0)))) {
 				//Error: Incorrect datatype encountered:
 				return CRV<CToken>(rvEval.getContent(), Error::produceConvertError(rvEval.getContent().getType(), Token::U_BOOL));
 			}
@@ -861,7 +1141,7 @@ private:
 		else {
 			//No further evaluation needed:
 			CToken condToken = tCondition.getContent(); //Stores the returned token, which stores the boolean for the condition.
-			if (condToken.getType() != Token::U_BOOL || (condToken.getType() == Token::U_INT && (stoi(condToken.getLexeme()) != 1 || stoi(condToken.getLexeme()) != 0)) || (condToken.getType() == Token::U_DOUBLE && (stod(condToken.getLexeme()) != 1 || stod(condToken.getLexeme()) != 0))) {
+			if (!bVerified && (condToken.getType() != Token::U_BOOL || (condToken.getType() == Token::U_INT && (stoi(condToken.getLexeme()) != 1 || stoi(condToken.getLexeme()) != 0)) || (condToken.getType() == Token::U_DOUBLE && (stod(condToken.getLexeme()) != 1 || stod(condToken.getLexeme()) != 0)))) {
 				//Error: Incorrect datatype encountered:
 				return CRV<CToken>(tCondition.getContent(), Error::produceConvertError(tCondition.getContent().getType(), Token::U_BOOL));
 			}
@@ -939,7 +1219,7 @@ private:
 	* @return		Error message and token, which caused the error.
 	*/
 	CRV<CToken> whileLoop(CAbstractSyntaxTree<CToken> pAST) {
-		if (pAST.getContent().getLexeme() != Keyword::WHILE) {
+		if (pAST.getContent().getOpcode() != Opcode::OPCODE_WHILE) {
 			//Error: Incorrect token found:
 			return CRV<CToken>(pAST.getContent(), Error::Interpreter::INCORRECT_TOKEN);
 		}
@@ -956,6 +1236,7 @@ private:
 		}
 		CAbstractSyntaxTree<CToken> tCondition = lSubTrees[0]; //Stores the condition of the AST.
 		bool bCondition = false; //Stores wether the loop's condition is true or false.
+		bool bVerified = pAST.getContent().isVerified(); //Stores wether the condition always results in a boolean and the loop has exactly one body.
 		if (tCondition.hasSubTrees()) {
 			//Further evaluation of the condition needed:
 			CRV<CToken> rvEval = interpretExpression(tCondition);
@@ -964,7 +1245,7 @@ private:
 				return rvEval;
 			}
 			CToken condToken = rvEval.getContent(); //Stores the returned token, which stores the boolean for the condition.
-			if (condToken.getType() != Token::U_BOOL || (condToken.getType() == Token::U_INT && (stoi(condToken.getLexeme()) != 1 || stoi(condToken.getLexeme()) != 0)) || (condToken.getType() == Token::U_DOUBLE && (stod(condToken.getLexeme()) != 1 || stod(condToken.getLexeme()) != 0))) {
+			if (!bVerified && (condToken.getType() != Token::U_BOOL || (condToken.getType() == Token::U_INT && (stoi(condToken.getLexeme()) != 1 || stoi(condToken.getLexeme()) != 0)) || (condToken.getType() == Token::U_DOUBLE && (stod(condToken.getLexeme()) != 1 || stod(condToken.getLexeme()) != 0)))) {
 				//Error: Incorrect datatype encountered:
 				return CRV<CToken>(rvEval.getContent(), Error::produceConvertError(rvEval.getContent().getType(), Token::U_BOOL));
 			}
@@ -976,7 +1257,7 @@ private:
 		else {
 			//No further evaluation needed:
 			CToken condToken = tCondition.getContent(); //Stores the returned token, which stores the boolean for the condition.
-			if (condToken.getType() != Token::U_BOOL || (condToken.getType() == Token::U_INT && (stoi(condToken.getLexeme()) != 1 || stoi(condToken.getLexeme()) != 0)) || (condToken.getType() == Token::U_DOUBLE && (stod(condToken.getLexeme()) != 1 || stod(condToken.getLexeme()) != 0))) {
+			if (!bVerified && (condToken.getType() != Token::U_BOOL || (condToken.getType() == Token::U_INT && (stoi(condToken.getLexeme()) != 1 || stoi(condToken.getLexeme()) != 0)) || (condToken.getType() == Token::U_DOUBLE && (stod(condToken.getLexeme()) != 1 || stod(condToken.getLexeme()) != 0)))) {
 				//Error: Incorrect datatype encountered:
 				return CRV<CToken>(tCondition.getContent(), Error::produceConvertError(tCondition.getContent().getType(), Token::U_BOOL));
 			}
@@ -1000,7 +1281,7 @@ private:
 					return rvEval;
 				}
 				CToken condToken = rvEval.getContent(); //Stores the returned token, which stores the boolean for the condition.
-				if (condToken.getType() != Token::U_BOOL || (condToken.getType() == Token::U_INT && (stoi(condToken.getLexeme()) != 1 || stoi(condToken.getLexeme()) != 0)) || (condToken.getType() == Token::U_DOUBLE && (stod(condToken.getLexeme()) != 1 || stod(condToken.getLexeme()) != 0))) {
+				if (!bVerified && (condToken.getType() != Token::U_BOOL || (condToken.getType() == Token::U_INT && (stoi(condToken.getLexeme()) != 1 || stoi(condToken.getLexeme()) != 0)) || (condToken.getType() == Token::U_DOUBLE && (stod(condToken.getLexeme()) != 1 || stod(condToken.getLexeme()) != 0)))) {
 					//Error: Incorrect datatype encountered:
 					return CRV<CToken>(rvEval.getContent(), Error::produceConvertError(rvEval.getContent().getType(), Token::U_BOOL));
 				}
@@ -1012,7 +1293,7 @@ private:
 			else {
 				//No further evaluation needed:
 				CToken condToken = tCondition.getContent(); //Stores the returned token, which stores the boolean for the condition.
-				if (condToken.getType() != Token::U_BOOL || (condToken.getType() == Token::U_INT && (stoi(condToken.getLexeme()) != 1 || stoi(condToken.getLexeme()) != 0)) || (condToken.getType() == Token::U_DOUBLE && (stod(condToken.getLexeme()) != 1 || stod(condToken.getLexeme()) != 0))) {
+				if (!bVerified && (condToken.getType() != Token::U_BOOL || (condToken.getType() == Token::U_INT && (stoi(condToken.getLexeme()) != 1 || stoi(condToken.getLexeme()) != 0)) || (condToken.getType() == Token::U_DOUBLE && (stod(condToken.getLexeme()) != 1 || stod(condToken.getLexeme()) != 0)))) {
 					//Error: Incorrect datatype encountered:
 					return CRV<CToken>(tCondition.getContent(), Error::produceConvertError(tCondition.getContent().getType(), Token::U_BOOL));
 				}
@@ -1027,7 +1308,10 @@ private:
 			}
 
 			//Get the body's statements:
-			if (lSubTrees.size() < 2) {
+			if (bVerified) {
+				//The number of bodies has been verified by the type checker...
+			}
+			else if (lSubTrees.size() < 2) {
 				//Error: The body is missing:
 				return CRV<CToken>(pAST.getContent(), Error::Interpreter::MISSING_BODY);
 			}
@@ -1076,6 +1360,465 @@ private:
 		return CRV<CToken>(pAST.getContent(), Error::SUCCESS);
 	}
 
+	/**
+	* This function is used to evaluate a counted loop (see CCountedLoop).
+	* The headnode of the passed AST must resemble the for- or pfor-keyword. The range is evaluated once and the counter is
+	* incremented natively, so that no condition is evaluated between the iterations. The counter can only be accessed
+	* within the loop.
+	*
+	* @param pAST	Abstract syntax tree, which resembles the loop.
+	* @return		Error message and token, which caused the error.
+	*/
+	CRV<CToken> countedLoop(CAbstractSyntaxTree<CToken> pAST) {
+		CToken headNode = pAST.getContent();
+		CCountedLoop loop;
+		CRV<CToken> rvLoop = loop.read(pAST);
+		if (rvLoop.getErrorMessage() != Error::SUCCESS) {
+			//An error occured:
+			return rvLoop;
+		}
+		int vnRange[2]; //Stores the first value of the counter and the value after the last iteration.
+		for (unsigned int i = 0; i < 2; i++) {
+			CRV<CToken> rvBound = evaluateArgument(pAST.getSubTreeAtIndex(i + 1));
+			if (rvBound.getErrorMessage() != Error::SUCCESS) {
+				//An error occured:
+				return rvBound;
+			}
+			else if (!headNode.isVerified() && rvBound.getContent().getType() != Token::U_INT) {
+				//Error: The range consists of integers:
+				return CRV<CToken>(rvBound.getContent(), Error::produceConvertError(rvBound.getContent().getType(), Token::U_INT));
+			}
+			vnRange[i] = stoi(rvBound.getContent().getLexeme());
+		}
+		CAbstractSyntaxTree<CToken> tBody = pAST.getSubTreeAtIndex(pAST.getSubTreeNumber() - 1); //Stores the body of the loop.
+		if (loop.isParallel()) {
+			return parallelLoop(headNode, loop, tBody, vnRange[0], vnRange[1]);
+		}
+
+		CLinkedList<CVariable> lOldVariables = lVariables; //Stores the variables before the execution of the loop.
+		short int nErrorMessage = addVariable(CVariable(loop.getCounter(), to_string(vnRange[0]), Token::U_INT));
+		if (nErrorMessage != Error::SUCCESS) {
+			//Error: The name of the counter is already in use:
+			return CRV<CToken>(pAST.getSubTreeAtIndex(0).getContent(), nErrorMessage);
+		}
+		CLinkedList<CVariable> lLoopVariables = lVariables; //Stores the variables before each iteration.
+		for (int n = vnRange[0]; n < vnRange[1]; n++) {
+			changeVariableValue(CVariable(loop.getCounter(), to_string(n), Token::U_INT));
+			CRV<CToken> rvBody = executeBody(tBody);
+			if (rvBody.getErrorMessage() != Error::SUCCESS) {
+				//An error occured:
+				return rvBody;
+			}
+			leaveScope(lLoopVariables);
+		}
+		leaveScope(lOldVariables);
+		return CRV<CToken>(headNode, Error::SUCCESS);
+	}
+
+	/**
+	* This function is used to evaluate a parallel loop, whose range has been evaluated. The range is split into chunks,
+	* which are executed by the thread pool (or one after another, if the program is executed by a single thread). A static
+	* loop submits one task per thread, which executes a block of consecutive chunks, the tasks of a dynamic loop execute
+	* the next chunk, which has not been started yet, until every chunk has been started. Every chunk starts with a copy of
+	* the current variables, in which the reduction variables are replaced with their neutral values. Afterwards, the
+	* results of the chunks are combined in their order.
+	*
+	* @param pHeadNode	Head node of the loop.
+	* @param pLoop		Parallel loop.
+	* @param ptBody		Body of the loop.
+	* @param pnFirst	First value of the counter.
+	* @param pnLast		Value of the counter after the last iteration.
+	* @return			Error message and token, which caused the error.
+	*/
+	CRV<CToken> parallelLoop(CToken pHeadNode, CCountedLoop& pLoop, CAbstractSyntaxTree<CToken>& ptBody, int pnFirst, int pnLast) {
+		CLinkedList<CVariable> lChunkVariables = lVariables; //Stores the variables, with which every chunk starts.
+		vector<CToken> vValues; //Stores the value of each reduction variable before the loop.
+		for (unsigned int i = 0; i < pLoop.getReductions(); i++) {
+			CRV<CVariable> rvVariable = getVariable(pLoop.getReductionVariable(i));
+			if (rvVariable.getErrorMessage() != Error::SUCCESS) {
+				//Error: The reduced variable does not exist:
+				return CRV<CToken>(CToken(pLoop.getReductionVariable(i), Token::IDENTIFIER, pHeadNode.getFilename(), pHeadNode.getLine()), rvVariable.getErrorMessage());
+			}
+			CVariable variable = rvVariable.getContent();
+			if (variable.getType() != Token::U_INT && variable.getType() != Token::U_DOUBLE) {
+				//Error: Only numbers can be reduced:
+				return CRV<CToken>(CToken(variable.getName(), Token::IDENTIFIER, pHeadNode.getFilename(), pHeadNode.getLine()), Error::Interpreter::INVALID_LOOP_CLAUSE);
+			}
+			vValues.push_back(CToken(variable.getValue(), variable.getType(), pHeadNode.getFilename(), pHeadNode.getLine()));
+			for (unsigned int j = 0; j < lChunkVariables.size(); j++) {
+				if (lChunkVariables[j].getName() == variable.getName()) {
+					lChunkVariables.remove(j);
+					lChunkVariables.add(CVariable(variable.getName(), pLoop.identity(i, variable.getType()).getLexeme(), variable.getType()), j);
+					break;
+				}
+			}
+		}
+		if (pnLast <= pnFirst) {
+			//The loop does not have any iterations:
+			return CRV<CToken>(pHeadNode, Error::SUCCESS);
+		}
+
+		unsigned int nWorkers = pThreadPool != nullptr ? nThreads : 1; //Stores the number of threads, which execute the chunks.
+		long long nIterations = (long long)pnLast - pnFirst; //Stores the number of iterations.
+		long long nChunkSize = pLoop.getChunkSize(nIterations); //Stores the number of iterations of a chunk.
+		unsigned int nChunks = (nIterations + nChunkSize - 1) / nChunkSize; //Stores the number of chunks.
+		unsigned int nTasks = min(nWorkers, nChunks); //Stores the number of tasks, which execute the chunks.
+		vector<vector<CToken>> vvResults(nChunks); //Stores the values of the reduction variables after each chunk.
+		vector<CRV<CToken>> vrvChunks(nChunks, CRV<CToken>(pHeadNode, Error::SUCCESS)); //Stores the result of each chunk.
+		atomic<bool> bFailed(false); //Stores whether an iteration has failed.
+		atomic<unsigned int> nNextChunk(0); //Stores the index of the next chunk of a dynamic loop, which is executed.
+		atomic<unsigned int> nNextTask(0); //Stores the index of the next task, which is started.
+		function<void()> executeChunks = [&]() {
+			//Every thread executes the chunks with it's own interpreter:
+			CInterpreter* pInterpreter = pThreadPool != nullptr ? getThreadInterpreter() : this;
+			unsigned int nTask = nNextTask++; //Stores the index of the task.
+			unsigned int nChunk = pLoop.isDynamic() ? nNextChunk++ : nTask * nChunks / nTasks; //Stores the index of the current chunk.
+			unsigned int nEnd = pLoop.isDynamic() ? nChunks : (nTask + 1) * nChunks / nTasks; //Stores the index after the task's last chunk.
+			while (nChunk < nEnd) {
+				int nFirst = pnFirst + nChunk * nChunkSize; //Stores the first value of the chunk's counter.
+				int nLast = (int)min<long long>((long long)nFirst + nChunkSize, pnLast); //Stores the value after the chunk's last iteration.
+				vrvChunks[nChunk] = pInterpreter->executeChunk(pLoop, ptBody, lChunkVariables, nFirst, nLast, vvResults[nChunk], bFailed);
+				nChunk = pLoop.isDynamic() ? nNextChunk++ : nChunk + 1;
+			}
+		};
+		if (pThreadPool != nullptr) {
+			atomic<unsigned int> nPending(0); //Stores the number of unfinished tasks.
+			for (unsigned int i = 0; i < nTasks; i++) {
+				pThreadPool->submit(executeChunks, nPending);
+			}
+			pThreadPool->wait(nPending);
+		}
+		else {
+			executeChunks();
+		}
+
+		for (unsigned int i = 0; i < nChunks; i++) {
+			if (vrvChunks[i].getErrorMessage() != Error::SUCCESS) {
+				//The first error of the iterations is reported:
+				return vrvChunks[i];
+			}
+		}
+		for (unsigned int i = 0; i < pLoop.getReductions(); i++) {
+			CToken value = vValues[i]; //Stores the combined value of the reduction.
+			for (unsigned int j = 0; j < nChunks; j++) {
+				value = pLoop.combine(i, value, vvResults[j][i]);
+			}
+			changeVariableValue(CVariable(pLoop.getReductionVariable(i), value.getLexeme(), value.getType()));
+		}
+		return CRV<CToken>(pHeadNode, Error::SUCCESS);
+	}
+
+	/**
+	* This function executes the iterations of a single chunk of a parallel loop. Since the current thread can execute a
+	* chunk while it waits for another chunk, the variables of the interpreter are restored afterwards. The iterations stop,
+	* once an iteration of another chunk has failed.
+	*
+	* @param pLoop			Parallel loop.
+	* @param ptBody			Body of the loop.
+	* @param plVariables	Variables, with which the chunk starts.
+	* @param pnFirst		First value of the counter.
+	* @param pnLast			Value of the counter after the last iteration.
+	* @param pvResults		Vector, to which the value of each reduction variable is added.
+	* @param pbFailed		Whether an iteration has failed.
+	* @return				Error message and token, which caused the error.
+	*/
+	CRV<CToken> executeChunk(CCountedLoop& pLoop, CAbstractSyntaxTree<CToken>& ptBody, CLinkedList<CVariable>& plVariables, int pnFirst, int pnLast, vector<CToken>& pvResults, atomic<bool>& pbFailed) {
+		CLinkedList<CVariable> lOldVariables = lVariables; //Stores the variables, which are restored afterwards.
+		unsigned int nOldCallDepth = nCallDepth; //Stores the call depth, which is restored afterwards.
+		lVariables = plVariables;
+		nCallDepth = 0;
+		CToken counter(pLoop.getCounter(), Token::IDENTIFIER, ptBody.getContent().getFilename(), ptBody.getContent().getLine()); //Stores the name of the counter.
+		CRV<CToken> rvChunk(counter, addVariable(CVariable(pLoop.getCounter(), to_string(pnFirst), Token::U_INT))); //Stores the result of the chunk.
+		CLinkedList<CVariable> lLoopVariables = lVariables; //Stores the variables before each iteration.
+		for (int n = pnFirst; n < pnLast && rvChunk.getErrorMessage() == Error::SUCCESS && !pbFailed; n++) {
+			changeVariableValue(CVariable(pLoop.getCounter(), to_string(n), Token::U_INT));
+			rvChunk = executeBody(ptBody);
+			leaveScope(lLoopVariables);
+		}
+		if (rvChunk.getErrorMessage() != Error::SUCCESS) {
+			pbFailed = true;
+		}
+		for (unsigned int i = 0; i < pLoop.getReductions(); i++) {
+			CVariable variable = getVariable(pLoop.getReductionVariable(i)).getContent();
+			pvResults.push_back(CToken(variable.getValue(), variable.getType()));
+		}
+		lVariables = lOldVariables;
+		nCallDepth = nOldCallDepth;
+		return rvChunk;
+	}
+
+	/**
+	* This function executes the statements of the passed body.
+	*
+	* @param ptBody	Abstract syntax tree of the body (a single statement or a branch of statements).
+	* @return		Error message and token, which caused the error.
+	*/
+	CRV<CToken> executeBody(CAbstractSyntaxTree<CToken>& ptBody) {
+		if (ptBody.getContent().getType() != Token::BRANCH) {
+			//Only one expression needs to be evaluated:
+			return interpretExpression(ptBody);
+		}
+		for (unsigned int i = 0; i < ptBody.getSubTreeNumber(); i++) {
+			CRV<CToken> rvEval = interpretExpression(ptBody.getSubTreeAtIndex(i)); //Execute current expression.
+			if (rvEval.getErrorMessage() != Error::SUCCESS) {
+				//An error occured:
+				return rvEval;
+			}
+		}
+		return CRV<CToken>(ptBody.getContent(), Error::SUCCESS);
+	}
+
+	/**
+	* This function removes the variables, which have been declared after the passed variables, once a body has been
+	* executed. The values of the passed variables are updated.
+	*
+	* @param plOldVariables	Variables, which existed before the body.
+	*/
+	void leaveScope(CLinkedList<CVariable> plOldVariables) {
+		CLinkedList<CVariable> lScope; //Stores the remaining variables.
+		for (CVariable oldVariable : plOldVariables) {
+			for (CVariable variable : lVariables) {
+				if (variable.getName() == oldVariable.getName()) {
+					oldVariable = variable;
+					break;
+				}
+			}
+			lScope.add(oldVariable);
+		}
+		lVariables = lScope;
+	}
+
+
+
+	/**
+	* This function is used to spawn a task, which calls a function.
+	* The headnode of the passed AST must resemble the spawn-keyword, it's only subtree the call. The arguments are
+	* evaluated by the current thread, the function itself is executed by the thread pool (or immediately, if the
+	* program is executed by a single thread).
+	*
+	* @param pAST	Abstract syntax tree, which resembles the spawned call.
+	* @return		Handle of the task or error message and token, which caused the error.
+	*/
+	CRV<CToken> spawnTask(CAbstractSyntaxTree<CToken> pAST) {
+		CToken headNode = pAST.getContent();
+		if (headNode.getArityError() != Error::SUCCESS) {
+			//Error: Only one call can be spawned:
+			return CRV<CToken>(headNode, headNode.getArityError());
+		}
+		CAbstractSyntaxTree<CToken> tCall = pAST.getSubTreeAtIndex(0); //Stores the spawned call.
+		CToken calledName = tCall.getContent(); //Stores the name of the called function.
+		if (calledName.getOpcode() != Opcode::OPCODE_IDENTIFIER || (!tCall.hasSubTrees() && getVariable(calledName.getLexeme()).getErrorMessage() == Error::SUCCESS)) {
+			//Error: Only function calls can be spawned:
+			return CRV<CToken>(calledName, Error::Interpreter::INCORRECT_TOKEN);
+		}
+		CLinkedList<CToken> lArguments; //Stores the evaluated arguments.
+		CRV<CToken> rvArguments = evaluateArguments(tCall, lArguments);
+		if (rvArguments.getErrorMessage() != Error::SUCCESS) {
+			//An error occured:
+			return rvArguments;
+		}
+
+		unique_ptr<CTaskTable::CSpawnedTask> task = make_unique<CTaskTable::CSpawnedTask>();
+		CTaskTable::CSpawnedTask* pTask = task.get(); //Stores the task, after it has been moved into the table.
+		if (pThreadPool != nullptr) {
+			pThreadPool->submit([this, pTask, calledName, lArguments]() {
+				//Every thread executes the task with it's own interpreter:
+				CInterpreter* pInterpreter = getThreadInterpreter();
+				pTask->result = pInterpreter->executeTask(calledName, lArguments);
+			}, pTask->nPending);
+		}
+		else {
+			pTask->result = executeTask(calledName, lArguments);
+		}
+		unsigned int nHandle = pTasks->add(move(task)); //Stores the handle of the task.
+		return CRV<CToken>(CToken(to_string(nHandle), Token::U_INT, headNode.getFilename(), headNode.getLine()), Error::SUCCESS);
+	}
+
+	/**
+	* This function is used to wait for a spawned task.
+	* The headnode of the passed AST must resemble the await-keyword, it's only subtree the handle of the task. While
+	* the task is pending, the current thread executes it itself, otherwise it blocks until the task has finished.
+	*
+	* @param pAST	Abstract syntax tree, which resembles the awaited task.
+	* @return		Return value of the task's function or the error, which occured within the task.
+	*/
+	CRV<CToken> awaitTask(CAbstractSyntaxTree<CToken> pAST) {
+		CToken headNode = pAST.getContent();
+		if (headNode.getArityError() != Error::SUCCESS) {
+			//Error: Only one task can be awaited:
+			return CRV<CToken>(headNode, headNode.getArityError());
+		}
+		CRV<CToken> rvHandle = evaluateArgument(pAST.getSubTreeAtIndex(0)); //Stores the handle of the task.
+		if (rvHandle.getErrorMessage() != Error::SUCCESS) {
+			//An error occured:
+			return rvHandle;
+		}
+		else if (rvHandle.getContent().getType() != Token::U_INT) {
+			//Error: Handles are integers:
+			return CRV<CToken>(rvHandle.getContent(), Error::produceConvertError(rvHandle.getContent().getType(), Token::U_INT));
+		}
+		CTaskTable::CSpawnedTask* pTask = pTasks->find(rvHandle.getContent().getLexeme());
+		if (pTask == nullptr) {
+			//Error: No task has been spawned with the handle:
+			return CRV<CToken>(rvHandle.getContent(), Error::Interpreter::TASK_DOES_NOT_EXIST);
+		}
+		if (pThreadPool != nullptr) {
+			pThreadPool->wait(pTask->nPending);
+		}
+		return pTask->result;
+	}
+
+	/**
+	* This function is used to create a channel, or to send a value through a channel or receive a value from it.
+	* The first subtree of the passed AST resembles the capacity of the created channel or the handle of the channel, the
+	* second subtree the sent value or the variable, into which "try-recv" receives the value. If "send" or "recv" would
+	* block, while no other thread could receive or send a value (see "CInterpreter::canBlock()"), an error is returned
+	* instead.
+	*
+	* @param pAST	Abstract syntax tree, which resembles the keyword.
+	* @return		Handle of the channel, received value, whether "try-send" or "try-recv" succeeded ("t" for "send")
+	*				or error message and token, which caused the error.
+	*/
+	CRV<CToken> channelOperation(CAbstractSyntaxTree<CToken> pAST) {
+		CToken headNode = pAST.getContent();
+		if (headNode.getArityError() != Error::SUCCESS) {
+			//Error: Incorrect number of arguments:
+			return CRV<CToken>(headNode, headNode.getArityError());
+		}
+		CRV<CToken> rvFirst = evaluateArgument(pAST.getSubTreeAtIndex(0)); //Stores the capacity or the handle.
+		if (rvFirst.getErrorMessage() != Error::SUCCESS) {
+			//An error occured:
+			return rvFirst;
+		}
+		else if (rvFirst.getContent().getType() != Token::U_INT) {
+			//Error: Capacities and handles are integers:
+			return CRV<CToken>(rvFirst.getContent(), Error::produceConvertError(rvFirst.getContent().getType(), Token::U_INT));
+		}
+		if (headNode.getOpcode() == Opcode::OPCODE_MAKE_CHANNEL) {
+			long long nCapacity = stoll(rvFirst.getContent().getLexeme()); //Stores the capacity of the channel.
+			if (nCapacity <= 0) {
+				//Error: The channel could not store any value:
+				return CRV<CToken>(rvFirst.getContent(), Error::Interpreter::INVALID_CHANNEL_CAPACITY);
+			}
+			unsigned int nHandle = pChannels->add(nCapacity); //Stores the handle of the channel.
+			return CRV<CToken>(CToken(to_string(nHandle), Token::U_INT, headNode.getFilename(), headNode.getLine()), Error::SUCCESS);
+		}
+		CChannel* pChannel = pChannels->find(rvFirst.getContent().getLexeme());
+		if (pChannel == nullptr) {
+			//Error: No channel has been created with the handle:
+			return CRV<CToken>(rvFirst.getContent(), Error::Interpreter::CHANNEL_DOES_NOT_EXIST);
+		}
+
+		switch (headNode.getOpcode()) {
+		case Opcode::OPCODE_SEND:
+		case Opcode::OPCODE_TRY_SEND: {
+			CRV<CToken> rvValue = evaluateArgument(pAST.getSubTreeAtIndex(1)); //Stores the sent value.
+			if (rvValue.getErrorMessage() != Error::SUCCESS) {
+				//An error occured:
+				return rvValue;
+			}
+			bool bSent = pChannel->trySend(rvValue.getContent()); //Stores whether the value has been sent.
+			if (!bSent && headNode.getOpcode() == Opcode::OPCODE_SEND) {
+				if (canBlock()) {
+					pChannel->send(rvValue.getContent(), pThreadPool);
+				}
+				else if (!pChannel->trySend(rvValue.getContent())) {
+					//Error: No other thread could receive a value:
+					return CRV<CToken>(headNode, Error::Interpreter::CHANNEL_BLOCKS_FOREVER);
+				}
+				bSent = true;
+			}
+			return CRV<CToken>(CToken(bSent ? "t" : "nil", Token::U_BOOL, headNode.getFilename(), headNode.getLine()), Error::SUCCESS);
+		}
+
+		case Opcode::OPCODE_RECV: {
+			CToken value; //Stores the received value.
+			if (!pChannel->tryReceive(value)) {
+				if (canBlock()) {
+					value = pChannel->receive(pThreadPool);
+				}
+				else if (!pChannel->tryReceive(value)) {
+					//Error: No other thread could send a value:
+					return CRV<CToken>(headNode, Error::Interpreter::CHANNEL_BLOCKS_FOREVER);
+				}
+			}
+			return CRV<CToken>(CToken(value.getLexeme(), value.getType(), headNode.getFilename(), headNode.getLine()), Error::SUCCESS);
+		}
+
+		default: {
+			CToken variableName = pAST.getSubTreeAtIndex(1).getContent(); //Stores the name of the variable.
+			if (variableName.getType() != Token::IDENTIFIER || pAST.getSubTreeAtIndex(1).hasSubTrees()) {
+				//Error: Values can only be received into variables:
+				return CRV<CToken>(variableName, Error::Interpreter::INCORRECT_TOKEN);
+			}
+			CRV<CVariable> rvVariable = getVariable(variableName.getLexeme());
+			if (rvVariable.getErrorMessage() != Error::SUCCESS) {
+				//Error: The variable must exist, before a value is received:
+				return CRV<CToken>(variableName, rvVariable.getErrorMessage());
+			}
+			CToken value; //Stores the received value.
+			if (!pChannel->tryReceive(value)) {
+				return CRV<CToken>(CToken("nil", Token::U_BOOL, headNode.getFilename(), headNode.getLine()), Error::SUCCESS);
+			}
+			short int nErrorMessage = changeVariableValue(CVariable(variableName.getLexeme(), value.getLexeme(), value.getType()));
+			if (nErrorMessage != Error::SUCCESS) {
+				//Error: The value cannot be converted into the type of the variable:
+				return CRV<CToken>(CToken(value.getLexeme(), value.getType(), headNode.getFilename(), headNode.getLine()), nErrorMessage);
+			}
+			return CRV<CToken>(CToken("t", Token::U_BOOL, headNode.getFilename(), headNode.getLine()), Error::SUCCESS);
+		}
+		}
+	}
+
+	/**
+	* This function returns whether another thread could still receive or send a value, while the current thread waits
+	* for a channel. If the program does not spawn tasks, or if the thread, which executes the main-function, waits while
+	* every task has finished, no other thread could use the channel, so that the current thread would wait forever. A
+	* task, which finished just before, might have used the channel, therefore the operation has to be retried once, if
+	* this function returns false.
+	*
+	* @return	Whether the current thread can wait for the channel.
+	*/
+	bool canBlock() {
+		return pThreadPool != nullptr && (pThreadPool->getWorkerIndex() >= 0 || pTasks->hasPendingTasks());
+	}
+
+	/**
+	* This function returns whether the passed opcode resembles a keyword, whose value can be used as the operand of an
+	* operation.
+	*
+	* @param pnOpcode	Opcode of the keyword.
+	* @return			Whether the keyword returns a value.
+	*/
+	bool returnsValue(short int pnOpcode) {
+		return pnOpcode == Opcode::OPCODE_SPAWN || pnOpcode == Opcode::OPCODE_AWAIT || pnOpcode == Opcode::OPCODE_MAKE_CHANNEL || pnOpcode == Opcode::OPCODE_SEND || pnOpcode == Opcode::OPCODE_RECV || pnOpcode == Opcode::OPCODE_TRY_SEND || pnOpcode == Opcode::OPCODE_TRY_RECV;
+	}
+
+	/**
+	* This function executes a spawned call with an empty environment, so that the function can only access it's
+	* arguments. Since the current thread can execute a task while it waits for another task, the state of the
+	* interpreter is restored afterwards. A line, which has not been finished by the task, is written, once the task has
+	* finished.
+	*
+	* @param pFunctionName	Name of the called function.
+	* @param plArguments	Evaluated arguments.
+	* @return				Return value of the function or error message.
+	*/
+	CRV<CToken> executeTask(CToken pFunctionName, CLinkedList<CToken> plArguments) {
+		CLinkedList<CVariable> lOldVariables = lVariables; //Stores the variables, which are restored afterwards.
+		unsigned int nOldCallDepth = nCallDepth; //Stores the call depth, which is restored afterwards.
+		string sOldOutput = sOutput; //Stores the unfinished line, which is restored afterwards.
+		lVariables.clear();
+		nCallDepth = 0;
+		sOutput.clear();
+		CRV<CToken> rvCall = callFunction(pFunctionName, plArguments);
+		flushOutput(sOutput.size());
+		lVariables = lOldVariables;
+		nCallDepth = nOldCallDepth;
+		sOutput = sOldOutput;
+		return rvCall;
+	}
+
 
 
 private:
@@ -1086,67 +1829,137 @@ private:
 	* If the LISP-function is executed without occuring errors, this function returns the LISP-
 	* function's return value. If any errors are caused, the causing token is returned with
 	* an appropriate erorr message.
+	* If the LISP-function returns the result of another call ("(return (f ...))"), the called
+	* function is executed within the same frame, as long as it has the same return type. The
+	* conversion of it's return value can then not fail in the calling function, so that
+	* tail-recursive functions run in constant stack and memory. Every pure function, which is
+	* executed within the frame, returns the same value. Only the keys of the latest calls are
+	* kept for the memoization, since the cache cannot remember more values than it's capacity.
 	* 
 	* @param pFunctionName	Name of the LISP-function.
 	* @param plArguments	List of arguments, that are passed onto the LISP-function.
 	* @return				The return value of the function or error message.
 	*/
 	CRV<CToken> callFunction(CToken pFunctionName, CLinkedList<CToken> plArguments) {
-		//Find the function:
-		CFunction function;
-		bool bFunctionExists = false;
-		for (unsigned int i = 0; i < lFunctions.size(); i++) {
-			if (lFunctions[i].getName() == pFunctionName.getLexeme()) {
-				//Found function at index i:
-				function = lFunctions[i];
-				bFunctionExists = true;
-				break;
+		CToken calledName = pFunctionName; //Stores the name of the function, which is executed within the frame.
+		CLinkedList<CToken> lArguments = plArguments; //Stores the arguments of the function, which is executed within the frame.
+		const CFunction* pFunction = nullptr; //Stores the function, which is executed within the frame.
+		CToken returnValue;
+		CLinkedList<CVariable> lOldVariables; //Stores the variables of the calling function.
+		bool bFrameCreated = false; //Stores wether the variables of the calling function have been saved.
+		vector<string> vsMemoKeys; //Stores the keys of the latest pure functions, which are executed within the frame (at most the capacity of the cache).
+		unsigned int nOldestKey = 0; //Stores the index of the oldest key, once the capacity of the cache is reached.
+		bool bInterpreted = false; //Stores whether the native code of a function has returned to the interpreter within the frame.
+
+		while (true) {
+			//Find the function:
+			CRV<unsigned int> rvFunctionIndex = getFunctionIndex(calledName.getLexeme());
+			if (rvFunctionIndex.getErrorMessage() != Error::SUCCESS) {
+				//The called function does not exist:
+				return CRV<CToken>(calledName, rvFunctionIndex.getErrorMessage());
+			}
+			unsigned int nFunctionIndex = rvFunctionIndex.getContent(); //Stores the index of the function.
+			pFunction = &pProgram->getFunction(nFunctionIndex);
+
+			if (isMemoized(nFunctionIndex)) {
+				//A pure function, which has already been called with the same arguments, returns the same value:
+				string sKey = pMemoCache->generateKey(nFunctionIndex, lArguments);
+				if (pMemoCache->find(sKey, returnValue)) {
+					if (!bFrameCreated) {
+						return CRV<CToken>(returnValue, Error::SUCCESS);
+					}
+					break;
+				}
+				if (vsMemoKeys.size() < pMemoCache->getCapacity()) {
+					vsMemoKeys.push_back(sKey);
+				}
+				else {
+					//The oldest key would be evicted by the latest keys anyway:
+					vsMemoKeys[nOldestKey] = sKey;
+					nOldestKey = (nOldestKey + 1) % vsMemoKeys.size();
+				}
 			}
-		}
-		if (!bFunctionExists) {
-			//The called function does not exist:
-			return CRV<CToken>(pFunctionName, Error::Interpreter::FUNCTION_DOES_NOT_EXIST);
-		}
-		
-		//Check wether the function's parameter are identical with the passed arguments:
-		CLinkedList<CVariable> lFunctionParameters; //Stores the parameters of the function.
-		if (function.getParameterAmount() != plArguments.size()) {
-			//Incorrect number of arguments are passed:
-			return CRV<CToken>(pFunctionName, Error::Interpreter::INCORRECT_NUMBER_OF_ARGUMENTS_PASSED);
-		}
-		
-		for (unsigned int i = 0; i < plArguments.size(); i++) {
-			if (function.getParameters()[i].getType() != plArguments[i].getType()) {
-				//Error: The passed type is not identical with the parameter type:
-				return CRV<CToken>(plArguments[i], Error::produceConvertError(plArguments[i].getType(), function.getParameters()[i].getType()));
+
+			//Check wether the function's parameter are identical with the passed arguments (Verified calls cannot fail):
+			CLinkedList<CVariable> lFunctionParameters; //Stores the parameters of the function.
+			const CLinkedList<CVariable>& lParameters = pFunction->getParameters(); //Stores the declared parameters of the function.
+			if (!calledName.isVerified() && pFunction->getParameterAmount() != lArguments.size()) {
+				//Incorrect number of arguments are passed:
+				return CRV<CToken>(calledName, Error::Interpreter::INCORRECT_NUMBER_OF_ARGUMENTS_PASSED);
 			}
-			lFunctionParameters.add(CVariable(function.getParameters()[i].getName(), plArguments[i].getLexeme(), plArguments[i].getType()));
-		}
-		
-		//Save the variables of the currently executed function:
-		CLinkedList<CVariable> lOldVariables; //Stores the variables of the current function.
-		lOldVariables.addAll(lVariables);
-		lVariables.clear();
-		lVariables.addAll(lFunctionParameters);
-		
-		//Execute the function's expressions:
-		CLinkedList<CAbstractSyntaxTree<CToken>> lExpressions;
-		CToken returnValue;
-		lExpressions.addAll(function.getExpressions());
-		for (unsigned int i = 0; i < lExpressions.size(); i++) {
-			CRV<CToken> rvEval = interpretExpression(lExpressions[i]);
-			if (rvEval.getErrorMessage() != Error::SUCCESS && rvEval.getErrorMessage() != Error::Interpreter::INFO_RETURN_STATEMENT_ENCOUNTERED) {
-				//An error occured:
-				return rvEval;
+
+			for (unsigned int i = 0; i < lArguments.size(); i++) {
+				if (!calledName.isVerified() && lParameters[i].getType() != lArguments[i].getType()) {
+					//Error: The passed type is not identical with the parameter type:
+					return CRV<CToken>(lArguments[i], Error::produceConvertError(lArguments[i].getType(), lParameters[i].getType()));
+				}
+				lFunctionParameters.add(CVariable(lParameters[i].getName(), lArguments[i].getLexeme(), lArguments[i].getType()));
+			}
+
+			if (nExecutionMode == ExecutionMode::NATIVE_COMPILATION && !bInterpreted && jit.isCompiled(nFunctionIndex)) {
+				//Execute the native code of the function:
+				CRV<CToken> rvNative = jit.call(nFunctionIndex, lArguments, calledName);
+				if (rvNative.getErrorMessage() == Error::SUCCESS) {
+					if (!bFrameCreated) {
+						return rvNative;
+					}
+					returnValue = rvNative.getContent();
+					break;
+				}
+				//The function is executed by the interpreter, which reports the error or reuses the frame for a deep recursion:
+				bInterpreted = true;
+			}
+
+			//Save the variables of the currently executed function:
+			if (!bFrameCreated) {
+				lOldVariables.addAll(lVariables);
+				bFrameCreated = true;
+			}
+			lVariables.clear();
+			lVariables.addAll(lFunctionParameters);
+
+			//Execute the function's expressions:
+			returnValue = CToken();
+			CRV<CToken> rvEval(CToken(), Error::SUCCESS); //Stores the result of the last executed expression.
+			nCallDepth++;
+			for (const CAbstractSyntaxTree<CToken>& expression : pFunction->getExpressions()) {
+				rvEval = interpretExpression(expression);
+				if (rvEval.getErrorMessage() != Error::SUCCESS) {
+					break;
+				}
 			}
-			else if (rvEval.getErrorMessage() == Error::Interpreter::INFO_RETURN_STATEMENT_ENCOUNTERED) {
+			nCallDepth--;
+			if (rvEval.getErrorMessage() == Error::Interpreter::INFO_RETURN_STATEMENT_ENCOUNTERED) {
 				//The function's execution was terminated through a return statement:
 				returnValue = rvEval.getContent();
-				break;
 			}
+			else if (rvEval.getErrorMessage() == Error::Interpreter::INFO_TAIL_CALL) {
+				//The function's execution was terminated through a return statement with a call:
+				CToken tailName = tailCallName;
+				CLinkedList<CToken> lTailArguments = lTailCallArguments;
+				CRV<unsigned int> rvTailIndex = getFunctionIndex(tailName.getLexeme());
+				if (rvTailIndex.getErrorMessage() == Error::SUCCESS && pProgram->getFunction(rvTailIndex.getContent()).getReturnType() == pFunction->getReturnType()) {
+					//Reuse the frame for the called function:
+					calledName = tailName;
+					lArguments = lTailArguments;
+					continue;
+				}
+				//The return value of the called function needs to be converted:
+				CRV<CToken> rvCall = callFunction(tailName, lTailArguments);
+				if (rvCall.getErrorMessage() != Error::SUCCESS) {
+					//An error occured:
+					return rvCall;
+				}
+				returnValue = rvCall.getContent();
+			}
+			else if (rvEval.getErrorMessage() != Error::SUCCESS) {
+				//An error occured:
+				return rvEval;
+			}
+			break;
 		}
 		
-		if (function.getReturnType() == Token::U_VOID) {
+		if (pFunction->getReturnType() == Token::U_VOID) {
 			//No return value expected -> eventually returned values are ignored (ONLY TEMPORARY):
 			//Restore variables of old function call:
 			lVariables.clear();
@@ -1155,17 +1968,154 @@ private:
 		}
 		
 		//Process the return value:
-		if (returnValue.getType() != function.getReturnType()) {
+		if (returnValue.getType() != pFunction->getReturnType()) {
 			//The returned value's type is not identical with the function's return type:
-			return CRV<CToken>(returnValue, Error::produceConvertError(returnValue.getType(), function.getReturnType()));
+			return CRV<CToken>(returnValue, Error::produceConvertError(returnValue.getType(), pFunction->getReturnType()));
 		}
 		
 		//Restore variables of old function call:
 		lVariables.clear();
 		lVariables.addAll(lOldVariables);
+
+		//Every pure function, which has been executed within the frame, returns the same value (oldest key first):
+		for (unsigned int i = 0; i < vsMemoKeys.size(); i++) {
+			pMemoCache->store(vsMemoKeys[(nOldestKey + i) % vsMemoKeys.size()], returnValue);
+		}
 		
 		//Return the return value:
 		return CRV<CToken>(returnValue, Error::SUCCESS);
 	}
 
+	/**
+	* This function returns whether the return values of the passed function are memoized.
+	*
+	* @param pnFunction	Index of the function.
+	* @return			Whether the function is memoized.
+	*/
+	bool isMemoized(unsigned int pnFunction) {
+		return pMemoCache != nullptr && pMemoCache->isEnabled() && pnFunction < pProgram->getPureFunctions().size() && pProgram->getPureFunctions()[pnFunction];
+	}
+
+	/**
+	* This function starts the thread pool, if more than one thread should evaluate arguments or if the program spawns
+	* tasks. Spawned tasks are executed by at least one thread of the pool, so that they can exchange values through
+	* channels with the main-function, even if only one thread is available. Every thread of the pool gets an interpreter
+	* of it's own, which knows the same functions as this interpreter.
+	*/
+	void startThreads() {
+		if (nThreads <= 1 && !bUsesTasks) {
+			//The arguments are evaluated sequentially:
+			context.getLog().addEntry("Only one thread is available, the arguments are evaluated sequentially.", LogEntryComponent::INTERPRETER, LogEntryType::WARN);
+			return;
+		}
+		unsigned int nSlots = nThreads > 1 ? nThreads - 1 : 1; //Stores the number of threads, which execute tasks simultaneously.
+		threadPool.reset();
+		lWorkers.clear();
+		lWorkers.resize(nSlots + POOL_SPARE_THREADS);
+		pMainInterpreter = this;
+		threadPool = make_unique<CThreadPool>(nSlots, POOL_SPARE_THREADS, [this](unsigned int pnIndex) { createWorker(pnIndex); });
+		pThreadPool = threadPool.get();
+		context.getLog().addEntry("Started " + to_string(pThreadPool->getThreads()) + " threads, which execute tasks simultaneously (up to " + to_string(POOL_SPARE_THREADS) + " spare threads replace blocked threads).", LogEntryComponent::INTERPRETER, LogEntryType::INF);
+	}
+
+	/**
+	* This function creates the interpreter of the passed thread of the pool. It is executed by the thread itself, before
+	* it executes it's first task, so that the interpreters of spare threads are only created, once they are needed.
+	*
+	* @param pnIndex	Index of the thread within the pool.
+	*/
+	void createWorker(unsigned int pnIndex) {
+		unique_ptr<CInterpreter> worker = make_unique<CInterpreter>();
+		//The interpreters of the pool do not memoize, since the cache is not synchronized:
+		worker->pProgram = pProgram;
+		worker->nExecutionMode = ExecutionMode::PARALLEL_EVALUATION;
+		worker->setShortCircuit(bShortCircuit);
+		worker->pThreadPool = pThreadPool;
+		worker->pMainInterpreter = this;
+		worker->pTasks = pTasks;
+		worker->pChannels = pChannels;
+		worker->nThreads = nThreads;
+		worker->context = context;
+		lWorkers[pnIndex] = move(worker);
+	}
+
+	/**
+	* This function returns the interpreter of the current thread: A thread of the pool uses the interpreter, which it
+	* has created, every other thread (e.g. the thread, which executes the main-function and executes pending tasks while
+	* it waits for them) uses the interpreter, which executes the main-function.
+	*
+	* @return	Interpreter of the current thread.
+	*/
+	CInterpreter* getThreadInterpreter() {
+		int nIndex = pThreadPool->getWorkerIndex(); //Stores the index of the current thread within the pool.
+		return nIndex >= 0 ? pMainInterpreter->lWorkers[nIndex].get() : pMainInterpreter;
+	}
+
+	/**
+	* This function waits for every spawned task, which has not finished yet, since the program ends with it's last
+	* task. The remaining text of the main-function is written afterwards.
+	*/
+	void awaitTasks() {
+		if (pThreadPool != nullptr) {
+			//Tasks, which are spawned while waiting, are added to the end of the table:
+			for (unsigned int i = 1; i <= pTasks->size(); i++) {
+				pThreadPool->wait(pTasks->find(i)->nPending);
+			}
+		}
+		flushOutput(sOutput.size());
+	}
+
+	/**
+	* This function prints the passed text. If the program is executed by multiple threads, the text is buffered until
+	* the line is finished, so that the lines of different tasks are not mixed up.
+	*
+	* @param psText	Text, which is printed.
+	*/
+	void writeOutput(string psText) {
+		if (pThreadPool == nullptr) {
+			context.getOutput() << psText;
+			return;
+		}
+		sOutput += psText;
+		size_t nEnd = sOutput.rfind('\n'); //Stores the end of the last finished line.
+		if (nEnd != string::npos) {
+			flushOutput(nEnd + 1);
+		}
+	}
+
+	/**
+	* This function writes the passed number of buffered characters into the output of the context.
+	*
+	* @param pnLength	Number of characters.
+	*/
+	void flushOutput(size_t pnLength) {
+		if (pnLength == 0) {
+			return;
+		}
+		lock_guard<mutex> lock(context.getOutputLock());
+		context.getOutput() << sOutput.substr(0, pnLength);
+		sOutput.erase(0, pnLength);
+	}
+
+	/**
+	* This function writes the statistics of the thread pool into the log.
+	*/
+	void logThreads() {
+		if (pThreadPool != nullptr) {
+			context.getLog().addEntry("Thread pool: " + to_string(pThreadPool->getExecutedTasks()) + " tasks executed, " + to_string(pThreadPool->getStolenTasks()) + " stolen.", LogEntryComponent::INTERPRETER, LogEntryType::INF);
+		}
+		if (pTasks->size() > 0) {
+			context.getLog().addEntry(to_string(pTasks->size()) + " tasks have been spawned.", LogEntryComponent::INTERPRETER, LogEntryType::INF);
+		}
+	}
+
+	/**
+	* This function writes the statistics of the memoization into the log.
+	*/
+	void logMemoization() {
+		if (pMemoCache != nullptr && pMemoCache->isEnabled()) {
+			context.getLog().addEntry("Memoization: " + to_string(pMemoCache->getHits()) + " hits, " + to_string(pMemoCache->getMisses()) + " misses, " + to_string(pMemoCache->getEvictions()) + " evictions.", LogEntryComponent::INTERPRETER, LogEntryType::INF);
+		}
+	}
+
 };
@@ -0,0 +1,2089 @@
+/*
+FILE:		CJitCompiler.hpp
+
+REMARKS:	This file contains the class "CJitCompiler", which compiles numeric Lisp-functions into x86-64 machine code at
+			runtime. Functions, which cannot be compiled, are executed by the interpreter.
+*/
+#pragma once
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <set>
+#include <cstring>
+#include <cstdint>
+#include <initializer_list>
+
+#if defined(_WIN32)
+#include <Windows.h>
+#elif defined(__x86_64__)
+#include <sys/mman.h>
+#endif
+
+#include "CAbstractSyntaxTree.hpp"
+#include "CFunction.hpp"
+#include "CLinkedList.hpp"
+#include "CRV.hpp"
+#include "CToken.hpp"
+#include "CValue.hpp"
+#include "CVariable.hpp"
+#include "Variables/ErrorMessages.hpp"
+#include "Variables/KeywordTypes.hpp"
+#include "Variables/TokenTypes.hpp"
+
+using namespace std;
+#define JIT_STACK_SIZE 262144 //Number of bytes of the stack, which compiled functions use before the interpreter takes over.
+
+
+
+/**
+* This enumeration contains the x86-64 condition codes, which are used by the JIT compiler.
+*/
+enum JitCondition : const unsigned char {
+	CONDITION_PARITY = 0x0A, //PF = 1 (unordered comparison of doubles).
+	CONDITION_NO_PARITY = 0x0B, //PF = 0.
+	CONDITION_BELOW = 0x02, //CF = 1.
+	CONDITION_EQUAL = 0x04, //ZF = 1.
+	CONDITION_NOT_EQUAL = 0x05, //ZF = 0.
+	CONDITION_ABOVE = 0x07, //CF = 0 and ZF = 0.
+	CONDITION_ABOVE_EQUAL = 0x03, //CF = 0.
+	CONDITION_LESS = 0x0C, //Signed less.
+	CONDITION_GREATER = 0x0F, //Signed greater.
+	CONDITION_LESS_EQUAL = 0x0E, //Signed less or equal.
+	CONDITION_GREATER_EQUAL = 0x0D //Signed greater or equal.
+};
+
+
+
+/**
+* Every compiled function has this signature. The arguments and the returned value are stored as 64 bit words (integers
+* are sign-extended, doubles are stored bitwise, booleans are 0 or 1). The function returns 0 on success and 1, if the
+* execution must be repeated by the interpreter (e.g. because of a division by zero).
+*/
+typedef int (*JitEntry)(const int64_t* plArguments, int64_t* pnResult, unsigned int* pnLine);
+
+
+
+/**
+* Instances of this class store machine code in executable memory.
+*
+* @author	Christian-2003
+* @version	19.10.2026
+*/
+class CJitMemory {
+private:
+	/**
+	* Stores the address of the executable memory.
+	*/
+	unsigned char* pMemory;
+
+	/**
+	* Stores the size of the executable memory.
+	*/
+	size_t nSize;
+
+
+
+public:
+	/**
+	* The default constructor instantiates a new instance without memory.
+	*/
+	CJitMemory() {
+		pMemory = NULL;
+		nSize = 0;
+	}
+
+	/**
+	* The memory can only be released once, which is why the instance must never be copied.
+	*/
+	CJitMemory(const CJitMemory&) = delete;
+
+	/**
+	* The destructor releases the executable memory.
+	*/
+	~CJitMemory() {
+		release();
+	}
+
+
+
+public:
+	/**
+	* Copies the passed machine code into new executable memory. The memory is writable while the code is copied, and
+	* executable afterwards (it is never writable and executable at the same time).
+	*
+	* @param plCode	Machine code.
+	* @return		Whether the memory could be allocated.
+	*/
+	bool allocate(vector<unsigned char>& plCode) {
+		release();
+		if (plCode.empty()) {
+			return false;
+		}
+#if defined(_WIN32)
+		void* pAddress = VirtualAlloc(NULL, plCode.size(), MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+		if (pAddress == NULL) {
+			return false;
+		}
+		memcpy(pAddress, plCode.data(), plCode.size());
+		DWORD nOldProtection;
+		if (!VirtualProtect(pAddress, plCode.size(), PAGE_EXECUTE_READ, &nOldProtection)) {
+			VirtualFree(pAddress, 0, MEM_RELEASE);
+			return false;
+		}
+#elif defined(__x86_64__)
+		void* pAddress = mmap(NULL, plCode.size(), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		if (pAddress == MAP_FAILED) {
+			return false;
+		}
+		memcpy(pAddress, plCode.data(), plCode.size());
+		if (mprotect(pAddress, plCode.size(), PROT_READ | PROT_EXEC) != 0) {
+			munmap(pAddress, plCode.size());
+			return false;
+		}
+#else
+		//Executable memory is not supported on this platform:
+		return false;
+#endif
+		pMemory = (unsigned char*)pAddress;
+		nSize = plCode.size();
+		return true;
+	}
+
+	/**
+	* Releases the executable memory.
+	*/
+	void release() {
+		if (pMemory == NULL) {
+			return;
+		}
+#if defined(_WIN32)
+		VirtualFree(pMemory, 0, MEM_RELEASE);
+#elif defined(__x86_64__)
+		munmap(pMemory, nSize);
+#endif
+		pMemory = NULL;
+		nSize = 0;
+	}
+
+	/**
+	* Returns the address of the executable memory.
+	*
+	* @return	Address of the memory.
+	*/
+	unsigned char* getAddress() {
+		return pMemory;
+	}
+};
+
+
+
+/**
+* This class writes x86-64 instructions into a buffer. Only the few registers and instructions, that are needed by the
+* JIT compiler, are supported. Jumps are written with 32 bit displacements, which are inserted once the target is
+* known.
+*
+* @author	Christian-2003
+* @version	19.10.2026
+*/
+class CJitAssembler {
+private:
+	/**
+	* Stores the machine code.
+	*/
+	vector<unsigned char> lCode;
+
+	/**
+	* Stores the position of every label (or -1, if the label is not bound yet).
+	*/
+	vector<int> lLabels;
+
+	/**
+	* Stores the position of every displacement, which must be replaced by the distance to a label.
+	*/
+	vector<pair<unsigned int, unsigned int>> lPatches;
+
+
+
+public:
+	/**
+	* Returns the machine code. Every displacement is resolved.
+	*
+	* @return	Machine code.
+	*/
+	vector<unsigned char>& getCode() {
+		for (unsigned int i = 0; i < lPatches.size(); i++) {
+			int32_t nDisplacement = lLabels[lPatches[i].second] - (int)(lPatches[i].first + 4);
+			memcpy(&lCode[lPatches[i].first], &nDisplacement, 4);
+		}
+		lPatches.clear();
+		return lCode;
+	}
+
+	/**
+	* Creates a new label.
+	*
+	* @return	Label.
+	*/
+	unsigned int createLabel() {
+		lLabels.push_back(-1);
+		return lLabels.size() - 1;
+	}
+
+	/**
+	* Binds the passed label to the current position.
+	*
+	* @param pnLabel	Label.
+	*/
+	void bind(unsigned int pnLabel) {
+		lLabels[pnLabel] = lCode.size();
+	}
+
+
+
+public:
+	/**
+	* Writes the passed bytes.
+	*
+	* @param plBytes	Bytes.
+	*/
+	void emit(initializer_list<unsigned char> plBytes) {
+		lCode.insert(lCode.end(), plBytes);
+	}
+
+	/**
+	* Writes a 32 bit value.
+	*
+	* @param pnValue	Value.
+	*/
+	void emit32(int32_t pnValue) {
+		unsigned char lBytes[4];
+		memcpy(lBytes, &pnValue, 4);
+		lCode.insert(lCode.end(), lBytes, lBytes + 4);
+	}
+
+	/**
+	* Writes a 64 bit value.
+	*
+	* @param pnValue	Value.
+	*/
+	void emit64(int64_t pnValue) {
+		unsigned char lBytes[8];
+		memcpy(lBytes, &pnValue, 8);
+		lCode.insert(lCode.end(), lBytes, lBytes + 8);
+	}
+
+
+
+public:
+	/**
+	* mov rax, imm64
+	*/
+	void moveRaxImmediate(int64_t pnValue) {
+		emit({ 0x48, 0xB8 });
+		emit64(pnValue);
+	}
+
+	/**
+	* mov rax, [rbp + disp32]
+	*/
+	void loadRaxFromFrame(int32_t pnDisplacement) {
+		emit({ 0x48, 0x8B, 0x85 });
+		emit32(pnDisplacement);
+	}
+
+	/**
+	* mov [rbp + disp32], rax
+	*/
+	void storeRaxToFrame(int32_t pnDisplacement) {
+		emit({ 0x48, 0x89, 0x85 });
+		emit32(pnDisplacement);
+	}
+
+	/**
+	* mov qword [rbp + disp32], imm32
+	*/
+	void storeImmediateToFrame(int32_t pnDisplacement, int32_t pnValue) {
+		emit({ 0x48, 0xC7, 0x85 });
+		emit32(pnDisplacement);
+		emit32(pnValue);
+	}
+
+	/**
+	* mov rcx, [rbp + disp32] followed by mov [rbp + disp32], rcx
+	*/
+	void copyFrameSlot(int32_t pnSource, int32_t pnDestination) {
+		emit({ 0x48, 0x8B, 0x8D });
+		emit32(pnSource);
+		emit({ 0x48, 0x89, 0x8D });
+		emit32(pnDestination);
+	}
+
+	/**
+	* cmp qword [rbp + disp32], 0
+	*/
+	void compareFrameWithZero(int32_t pnDisplacement) {
+		emit({ 0x48, 0x83, 0xBD });
+		emit32(pnDisplacement);
+		emit({ 0x00 });
+	}
+
+	/**
+	* mov rax, [rbx + disp32]
+	*/
+	void loadRaxFromArguments(int32_t pnDisplacement) {
+		emit({ 0x48, 0x8B, 0x83 });
+		emit32(pnDisplacement);
+	}
+
+	/**
+	* mov rax, [rsp + disp32]
+	*/
+	void loadRaxFromStack(int32_t pnDisplacement) {
+		emit({ 0x48, 0x8B, 0x84, 0x24 });
+		emit32(pnDisplacement);
+	}
+
+	/**
+	* mov edx, [rsp + disp32]
+	*/
+	void loadEdxFromStack(int32_t pnDisplacement) {
+		emit({ 0x8B, 0x94, 0x24 });
+		emit32(pnDisplacement);
+	}
+
+	/**
+	* mov [rsp + disp32], rax
+	*/
+	void storeRaxToStack(int32_t pnDisplacement) {
+		emit({ 0x48, 0x89, 0x84, 0x24 });
+		emit32(pnDisplacement);
+	}
+
+	/**
+	* Loads the addresses of the arguments, the result and the line into the registers, with which the first three
+	* arguments of a function are passed.
+	*/
+	void loadCallArguments(int32_t pnArguments, int32_t pnResult, int32_t pnLine) {
+#if defined(_WIN32)
+		emit({ 0x48, 0x8D, 0x8C, 0x24 }); //lea rcx, [rsp + disp32]
+		emit32(pnArguments);
+		emit({ 0x48, 0x8D, 0x94, 0x24 }); //lea rdx, [rsp + disp32]
+		emit32(pnResult);
+		emit({ 0x4C, 0x8D, 0x84, 0x24 }); //lea r8, [rsp + disp32]
+		emit32(pnLine);
+#else
+		emit({ 0x48, 0x8D, 0xBC, 0x24 }); //lea rdi, [rsp + disp32]
+		emit32(pnArguments);
+		emit({ 0x48, 0x8D, 0xB4, 0x24 }); //lea rsi, [rsp + disp32]
+		emit32(pnResult);
+		emit({ 0x48, 0x8D, 0x94, 0x24 }); //lea rdx, [rsp + disp32]
+		emit32(pnLine);
+#endif
+	}
+
+	/**
+	* Saves the callee-saved registers and stores the pointers to the arguments (rbx), the result (r12) and the line
+	* (r13). Afterwards, the passed number of bytes is reserved for the variables.
+	*/
+	void prologue(int32_t pnFrameSize) {
+		emit({ 0x55 }); //push rbp
+		emit({ 0x48, 0x89, 0xE5 }); //mov rbp, rsp
+		emit({ 0x53 }); //push rbx
+		emit({ 0x41, 0x54 }); //push r12
+		emit({ 0x41, 0x55 }); //push r13
+		emit({ 0x41, 0x56 }); //push r14
+#if defined(_WIN32)
+		emit({ 0x48, 0x89, 0xCB }); //mov rbx, rcx
+		emit({ 0x49, 0x89, 0xD4 }); //mov r12, rdx
+		emit({ 0x4D, 0x89, 0xC5 }); //mov r13, r8
+#else
+		emit({ 0x48, 0x89, 0xFB }); //mov rbx, rdi
+		emit({ 0x49, 0x89, 0xF4 }); //mov r12, rsi
+		emit({ 0x49, 0x89, 0xD5 }); //mov r13, rdx
+#endif
+		subtractFromRsp(pnFrameSize);
+	}
+
+	/**
+	* Restores the callee-saved registers and returns.
+	*/
+	void epilogue() {
+		emit({ 0x48, 0x8D, 0x65, 0xE0 }); //lea rsp, [rbp - 32]
+		emit({ 0x41, 0x5E }); //pop r14
+		emit({ 0x41, 0x5D }); //pop r13
+		emit({ 0x41, 0x5C }); //pop r12
+		emit({ 0x5B }); //pop rbx
+		emit({ 0x5D }); //pop rbp
+		emit({ 0xC3 }); //ret
+	}
+
+	/**
+	* mov [r12], rax
+	*/
+	void storeResult() {
+		emit({ 0x49, 0x89, 0x04, 0x24 });
+	}
+
+	/**
+	* mov dword [r13], imm32
+	*/
+	void storeLineImmediate(unsigned int pnLine) {
+		emit({ 0x41, 0xC7, 0x45, 0x00 });
+		emit32((int32_t)pnLine);
+	}
+
+	/**
+	* mov [r13], edx
+	*/
+	void storeLineFromEdx() {
+		emit({ 0x41, 0x89, 0x55, 0x00 });
+	}
+
+	/**
+	* sub rsp, imm32
+	*/
+	void subtractFromRsp(int32_t pnBytes) {
+		emit({ 0x48, 0x81, 0xEC });
+		emit32(pnBytes);
+	}
+
+	/**
+	* cmp rsp, [rax]
+	*/
+	void compareRspWithRaxAddress() {
+		emit({ 0x48, 0x3B, 0x20 });
+	}
+
+	/**
+	* add rsp, imm32
+	*/
+	void addToRsp(int32_t pnBytes) {
+		emit({ 0x48, 0x81, 0xC4 });
+		emit32(pnBytes);
+	}
+
+	/**
+	* push rax
+	*/
+	void pushRax() {
+		emit({ 0x50 });
+	}
+
+	/**
+	* pop rax
+	*/
+	void popRax() {
+		emit({ 0x58 });
+	}
+
+	/**
+	* push rdx
+	*/
+	void pushRdx() {
+		emit({ 0x52 });
+	}
+
+	/**
+	* pop rdx
+	*/
+	void popRdx() {
+		emit({ 0x5A });
+	}
+
+	/**
+	* mov rcx, rax
+	*/
+	void moveRaxToRcx() {
+		emit({ 0x48, 0x89, 0xC1 });
+	}
+
+	/**
+	* movsxd rax, eax
+	*/
+	void signExtendEax() {
+		emit({ 0x48, 0x63, 0xC0 });
+	}
+
+	/**
+	* movzx eax, al
+	*/
+	void zeroExtendAl() {
+		emit({ 0x0F, 0xB6, 0xC0 });
+	}
+
+	/**
+	* add eax, ecx / sub eax, ecx / imul eax, ecx
+	*/
+	void integerOperation(char pchOperator) {
+		if (pchOperator == '+') {
+			emit({ 0x01, 0xC8 });
+		}
+		else if (pchOperator == '-') {
+			emit({ 0x29, 0xC8 });
+		}
+		else {
+			emit({ 0x0F, 0xAF, 0xC1 });
+		}
+	}
+
+	/**
+	* and eax, ecx / or eax, ecx
+	*/
+	void booleanOperation(bool pbAnd) {
+		emit({ (unsigned char)(pbAnd ? 0x21 : 0x09), 0xC8 });
+	}
+
+	/**
+	* movq xmm0, rax
+	*/
+	void moveRaxToXmm0() {
+		emit({ 0x66, 0x48, 0x0F, 0x6E, 0xC0 });
+	}
+
+	/**
+	* movq xmm1, rcx
+	*/
+	void moveRcxToXmm1() {
+		emit({ 0x66, 0x48, 0x0F, 0x6E, 0xC9 });
+	}
+
+	/**
+	* movq rax, xmm0
+	*/
+	void moveXmm0ToRax() {
+		emit({ 0x66, 0x48, 0x0F, 0x7E, 0xC0 });
+	}
+
+	/**
+	* cvtsi2sd xmm0, rax
+	*/
+	void convertRaxToXmm0() {
+		emit({ 0xF2, 0x48, 0x0F, 0x2A, 0xC0 });
+	}
+
+	/**
+	* cvtsi2sd xmm1, rcx
+	*/
+	void convertRcxToXmm1() {
+		emit({ 0xF2, 0x48, 0x0F, 0x2A, 0xC9 });
+	}
+
+	/**
+	* addsd / subsd / mulsd / divsd xmm0, xmm1
+	*/
+	void doubleOperation(char pchOperator) {
+		unsigned char nOpcode = 0x5E;
+		if (pchOperator == '+') {
+			nOpcode = 0x58;
+		}
+		else if (pchOperator == '-') {
+			nOpcode = 0x5C;
+		}
+		else if (pchOperator == '*') {
+			nOpcode = 0x59;
+		}
+		emit({ 0xF2, 0x0F, nOpcode, 0xC1 });
+	}
+
+	/**
+	* xorpd xmm2, xmm2 followed by ucomisd xmm1, xmm2
+	*/
+	void compareXmm1WithZero() {
+		emit({ 0x66, 0x0F, 0x57, 0xD2 });
+		emit({ 0x66, 0x0F, 0x2E, 0xCA });
+	}
+
+	/**
+	* ucomisd xmm0, xmm1 (or ucomisd xmm1, xmm0, if the operands are swapped)
+	*/
+	void compareDoubles(bool pbSwapped) {
+		emit({ 0x66, 0x0F, 0x2E, (unsigned char)(pbSwapped ? 0xC8 : 0xC1) });
+	}
+
+	/**
+	* cmp rax, rcx
+	*/
+	void compareIntegers() {
+		emit({ 0x48, 0x39, 0xC8 });
+	}
+
+	/**
+	* setcc al
+	*/
+	void setAl(unsigned char pnCondition) {
+		emit({ 0x0F, (unsigned char)(0x90 + pnCondition), 0xC0 });
+	}
+
+	/**
+	* setcc cl
+	*/
+	void setCl(unsigned char pnCondition) {
+		emit({ 0x0F, (unsigned char)(0x90 + pnCondition), 0xC1 });
+	}
+
+	/**
+	* and al, cl / or al, cl
+	*/
+	void combineAlWithCl(bool pbAnd) {
+		emit({ (unsigned char)(pbAnd ? 0x20 : 0x08), 0xC8 });
+	}
+
+	/**
+	* test rax, rax
+	*/
+	void testRax() {
+		emit({ 0x48, 0x85, 0xC0 });
+	}
+
+	/**
+	* test eax, eax
+	*/
+	void testEax() {
+		emit({ 0x85, 0xC0 });
+	}
+
+	/**
+	* mov eax, imm32
+	*/
+	void moveEaxImmediate(int32_t pnValue) {
+		emit({ 0xB8 });
+		emit32(pnValue);
+	}
+
+	/**
+	* jmp label
+	*/
+	void jump(unsigned int pnLabel) {
+		emit({ 0xE9 });
+		lPatches.push_back(pair<unsigned int, unsigned int>(lCode.size(), pnLabel));
+		emit32(0);
+	}
+
+	/**
+	* jcc label
+	*/
+	void jumpIf(unsigned char pnCondition, unsigned int pnLabel) {
+		emit({ 0x0F, (unsigned char)(0x80 + pnCondition) });
+		lPatches.push_back(pair<unsigned int, unsigned int>(lCode.size(), pnLabel));
+		emit32(0);
+	}
+
+	/**
+	* call [rax]
+	*/
+	void callIndirectRax() {
+		emit({ 0xFF, 0x10 });
+	}
+
+	/**
+	* call rax
+	*/
+	void callRax() {
+		emit({ 0xFF, 0xD0 });
+	}
+};
+
+
+
+/**
+* Instances of this class describe a value, which has been computed into rax by the compiled code.
+*
+* @author	Christian-2003
+* @version	19.10.2026
+*/
+class CJitValue {
+private:
+	/**
+	* Stores the type of the value.
+	*/
+	short int nType;
+
+	/**
+	* Stores the line of the value, if it is known during the compilation.
+	*/
+	unsigned int nLine;
+
+	/**
+	* Stores whether the line is only known at runtime (it is stored in edx in this case).
+	*/
+	bool bDynamicLine;
+
+	/**
+	* Stores whether the interpreter would represent the value with it's default lexeme.
+	*/
+	bool bDefaultLexeme;
+
+	/**
+	* Stores the slot of the variable, which stores whether the value has it's default lexeme at runtime (or -1, if this
+	* is known during the compilation).
+	*/
+	int nLexemeSlot;
+
+
+
+public:
+	/**
+	* The default constructor instantiates a new value of unknown type.
+	*/
+	CJitValue() {
+		nType = Token::UNKNOWN;
+		nLine = 0;
+		bDynamicLine = false;
+		bDefaultLexeme = true;
+		nLexemeSlot = -1;
+	}
+
+	/**
+	* This constructor instantiates a new value.
+	*
+	* @param pnType				Type of the value.
+	* @param pnLine				Line of the value.
+	* @param pbDynamicLine		Whether the line is only known at runtime.
+	* @param pbDefaultLexeme	Whether the value has it's default lexeme.
+	*/
+	CJitValue(short int pnType, unsigned int pnLine, bool pbDynamicLine, bool pbDefaultLexeme) {
+		nType = pnType;
+		nLine = pnLine;
+		bDynamicLine = pbDynamicLine;
+		bDefaultLexeme = pbDefaultLexeme;
+		nLexemeSlot = -1;
+	}
+
+	/**
+	* This constructor instantiates a new value, whose lexeme is only known at runtime.
+	*
+	* @param pnType			Type of the value.
+	* @param pnLine			Line of the value.
+	* @param pnLexemeSlot	Slot, which stores 1 if the value does not have it's default lexeme.
+	*/
+	CJitValue(short int pnType, unsigned int pnLine, int pnLexemeSlot) {
+		nType = pnType;
+		nLine = pnLine;
+		bDynamicLine = false;
+		bDefaultLexeme = true;
+		nLexemeSlot = pnLexemeSlot;
+	}
+
+
+
+public:
+	/**
+	* Returns the type of the value.
+	*
+	* @return	Type.
+	*/
+	short int getType() {
+		return nType;
+	}
+
+	/**
+	* Returns the line of the value.
+	*
+	* @return	Line.
+	*/
+	unsigned int getLine() {
+		return nLine;
+	}
+
+	/**
+	* Returns whether the line is only known at runtime.
+	*
+	* @return	Whether the line is stored in edx.
+	*/
+	bool hasDynamicLine() {
+		return bDynamicLine;
+	}
+
+	/**
+	* Returns whether the value has it's default lexeme.
+	*
+	* @return	Whether the lexeme is the default lexeme.
+	*/
+	bool hasDefaultLexeme() {
+		return bDefaultLexeme;
+	}
+
+	/**
+	* Returns the slot, which stores whether the value has it's default lexeme at runtime.
+	*
+	* @return	Slot or -1.
+	*/
+	int getLexemeSlot() {
+		return nLexemeSlot;
+	}
+};
+
+
+
+/**
+* The class "CJitCompiler" compiles Lisp-functions into native x86-64 machine code. A function is compiled, if it's
+* parameters and return value are of the types int, double or bool and it's expressions consist only of arithmetic,
+* relational and boolean operations, declarations, "set", "if", "while", "return" and calls of other compiled
+* functions. Compiled functions never have side effects, which is why every execution that cannot be completed
+* natively (e.g. because of a division by zero) is simply repeated by the interpreter, which then reports the error.
+* Values behave exactly like in the interpreter (integers wrap around, doubles are rounded to six decimal places after
+* every step and the lines of the returned tokens are identical).
+*
+* @author	Christian-2003
+* @version	19.10.2026
+*/
+class CJitCompiler {
+private:
+	/**
+	* Stores the number of bytes, which are pushed by the prologue of a compiled function.
+	*/
+	static const int32_t SAVED_REGISTERS_SIZE = 32;
+
+	/**
+	* Stores the executable memory.
+	*/
+	CJitMemory memory;
+
+	/**
+	* Stores the entry point of every function (or NULL, if the function is not compiled). Compiled functions call each
+	* other through this table, which is why it must not be resized after the compilation has started.
+	*/
+	vector<void*> lEntries;
+
+	/**
+	* Stores the lowest address of the stack, which compiled functions may use. Every compiled function returns to the
+	* interpreter, if it is called below this address, so that deep recursions cannot overflow the stack.
+	*/
+	uintptr_t nStackLimit;
+
+	/**
+	* Stores the parameter types of every function.
+	*/
+	vector<vector<short int>> lParameterTypes;
+
+	/**
+	* Stores the return type of every function.
+	*/
+	vector<short int> lReturnTypes;
+
+	/**
+	* Stores the name of every function.
+	*/
+	vector<string> lNames;
+
+	/**
+	* Stores which functions are compiled.
+	*/
+	vector<bool> lCompiled;
+
+	/**
+	* Stores the filename of the sourcecode.
+	*/
+	string sFilename;
+
+	/**
+	* Stores the instructions of the function, which is currently compiled.
+	*/
+	CJitAssembler assembler;
+
+	/**
+	* Stores the name and type of every variable, which is visible at the current position of the compilation.
+	*/
+	vector<CVariable> lScope;
+
+	/**
+	* Stores the slot of every visible variable.
+	*/
+	vector<unsigned int> lSlots;
+
+	/**
+	* Stores the slot, which stores whether the variable has it's default lexeme, for every visible variable (or -1, if
+	* the variable always has it's default lexeme).
+	*/
+	vector<int> lLexemeSlots;
+
+	/**
+	* Stores the number of slots, which are used at the current position of the compilation.
+	*/
+	unsigned int nSlots;
+
+	/**
+	* Stores the maximum number of slots of the current function.
+	*/
+	unsigned int nMaxSlots;
+
+	/**
+	* Stores the number of bytes, which have been pushed onto the stack by the current expression.
+	*/
+	int32_t nStackDepth;
+
+	/**
+	* Stores the names of the variables, which might store a value that does not have it's default lexeme.
+	*/
+	set<string> lNonDefaultVariables;
+
+	/**
+	* Stores the return type of the current function.
+	*/
+	short int nReturnType;
+
+	/**
+	* Stores the label, at which the current function returns successfully.
+	*/
+	unsigned int nSuccessLabel;
+
+	/**
+	* Stores the label, at which the current function returns, if the execution must be repeated by the interpreter.
+	*/
+	unsigned int nBailoutLabel;
+
+	/**
+	* Stores whether "&" and "|" skip their remaining operands once the result is decided.
+	*/
+	bool bShortCircuit;
+
+
+
+public:
+	/**
+	* The default constructor instantiates a new compiler without compiled functions.
+	*/
+	CJitCompiler() {
+		sFilename = "";
+		nSlots = 0;
+		nMaxSlots = 0;
+		nStackDepth = 0;
+		nReturnType = Token::U_VOID;
+		nSuccessLabel = 0;
+		nBailoutLabel = 0;
+		bShortCircuit = true;
+		nStackLimit = 0;
+	}
+
+	/**
+	* The compiled functions reference the entry table of this instance, which is why it must never be copied.
+	*/
+	CJitCompiler(const CJitCompiler&) = delete;
+
+
+
+public:
+	/**
+	* This function changes, whether the compiled operations "&" and "|" skip their remaining operands once the result is
+	* decided. The setting is applied to functions, which are compiled afterwards.
+	*
+	* @param pbShortCircuit	Whether the operands are evaluated lazily.
+	*/
+	void setShortCircuit(bool pbShortCircuit) {
+		bShortCircuit = pbShortCircuit;
+	}
+
+
+
+public:
+	/**
+	* This function compiles every passed Lisp-function, that can be compiled.
+	*
+	* @param plFunctions	Lisp-functions.
+	* @return				Error message (Error::Interpreter::INFO_ENGINE_UNSUPPORTED if native code is not supported on
+	*						this platform).
+	*/
+	short int compile(CLinkedList<CFunction> plFunctions) {
+		memory.release();
+		lNames.clear();
+		lParameterTypes.clear();
+		lReturnTypes.clear();
+		vector<CFunction> lFunctions;
+		for (CFunction function : plFunctions) {
+			lFunctions.push_back(function);
+			lNames.push_back(function.getName());
+			lReturnTypes.push_back(function.getReturnType());
+			lParameterTypes.push_back(vector<short int>());
+			CLinkedList<CVariable> lParameters = function.getParameters();
+			for (CVariable parameter : lParameters) {
+				lParameterTypes.back().push_back(parameter.getType());
+			}
+		}
+		lEntries.assign(lFunctions.size(), NULL);
+		lCompiled.assign(lFunctions.size(), false);
+#if !defined(__x86_64__) && !defined(_M_X64)
+		//Native code can only be generated for x86-64:
+		return Error::Interpreter::INFO_ENGINE_UNSUPPORTED;
+#endif
+
+		//Every function is compiled, until no function needs to be removed because it calls an uncompiled function:
+		for (unsigned int i = 0; i < lFunctions.size(); i++) {
+			lCompiled[i] = isCandidate(lFunctions[i]) && getFunctionIndex(lNames[i]) == (int)i;
+		}
+		vector<vector<unsigned char>> lCodes(lFunctions.size());
+		bool bChanged = true;
+		while (bChanged) {
+			bChanged = false;
+			for (unsigned int i = 0; i < lFunctions.size(); i++) {
+				if (!lCompiled[i]) {
+					continue;
+				}
+				if (compileFunction(lFunctions[i]) != Error::SUCCESS) {
+					lCompiled[i] = false;
+					bChanged = true;
+					continue;
+				}
+				lCodes[i] = assembler.getCode();
+			}
+		}
+
+		//Copy the machine code into executable memory:
+		vector<unsigned char> lCode;
+		vector<size_t> lOffsets(lFunctions.size(), 0);
+		for (unsigned int i = 0; i < lFunctions.size(); i++) {
+			if (lCompiled[i]) {
+				while (lCode.size() % 16 != 0) {
+					lCode.push_back(0xCC); //int3
+				}
+				lOffsets[i] = lCode.size();
+				lCode.insert(lCode.end(), lCodes[i].begin(), lCodes[i].end());
+			}
+		}
+		if (lCode.empty()) {
+			return Error::SUCCESS;
+		}
+		if (!memory.allocate(lCode)) {
+			lCompiled.assign(lFunctions.size(), false);
+			return Error::Interpreter::INFO_ENGINE_UNSUPPORTED;
+		}
+		for (unsigned int i = 0; i < lFunctions.size(); i++) {
+			if (lCompiled[i]) {
+				lEntries[i] = memory.getAddress() + lOffsets[i];
+			}
+		}
+		return Error::SUCCESS;
+	}
+
+	/**
+	* Returns whether the function at the passed index has been compiled.
+	*
+	* @param pnFunctionIndex	Index of the function.
+	* @return					Whether the function is compiled.
+	*/
+	bool isCompiled(unsigned int pnFunctionIndex) {
+		return pnFunctionIndex < lEntries.size() && lEntries[pnFunctionIndex] != NULL;
+	}
+
+	/**
+	* Returns the number of compiled functions.
+	*
+	* @return	Number of compiled functions.
+	*/
+	unsigned int getCompiledFunctions() {
+		unsigned int nCompiled = 0;
+		for (unsigned int i = 0; i < lEntries.size(); i++) {
+			if (lEntries[i] != NULL) {
+				nCompiled++;
+			}
+		}
+		return nCompiled;
+	}
+
+	/**
+	* This function calls the compiled function at the passed index. The types of the arguments must have been checked by
+	* the interpreter.
+	*
+	* @param pnFunctionIndex	Index of the function.
+	* @param plArguments		Arguments.
+	* @param pFunctionName		Token of the function's name.
+	* @return					Returned token or Error::Interpreter::INFO_ENGINE_UNSUPPORTED, if the function must be
+	*							executed by the interpreter.
+	*/
+	CRV<CToken> call(unsigned int pnFunctionIndex, CLinkedList<CToken>& plArguments, CToken pFunctionName) {
+		vector<int64_t> lArguments(plArguments.size() + 1, 0);
+		for (unsigned int i = 0; i < plArguments.size(); i++) {
+			CValue argument;
+			try {
+				argument = CValue(plArguments[i]);
+			}
+			catch (const exception&) {
+				return CRV<CToken>(CToken(), Error::Interpreter::INFO_ENGINE_UNSUPPORTED);
+			}
+			if (!argument.hasDefaultLexeme()) {
+				//The compiled code cannot reproduce lexemes like "0.5":
+				return CRV<CToken>(CToken(), Error::Interpreter::INFO_ENGINE_UNSUPPORTED);
+			}
+			lArguments[i] = toWord(argument);
+		}
+		int64_t nResult = 0;
+		unsigned int nLine = 0;
+		nStackLimit = (uintptr_t)&nResult - JIT_STACK_SIZE;
+		if (((JitEntry)lEntries[pnFunctionIndex])(lArguments.data(), &nResult, &nLine) != 0) {
+			//The execution must be repeated by the interpreter:
+			return CRV<CToken>(CToken(), Error::Interpreter::INFO_ENGINE_UNSUPPORTED);
+		}
+		if (lReturnTypes[pnFunctionIndex] == Token::U_VOID) {
+			return CRV<CToken>(pFunctionName, Error::SUCCESS);
+		}
+		CValue result = fromWord(nResult, lReturnTypes[pnFunctionIndex]);
+		result.setLine(nLine);
+		return CRV<CToken>(result.toToken(sFilename), Error::SUCCESS);
+	}
+
+
+
+private:
+	/**
+	* Returns whether the signature of the passed function can be compiled.
+	*
+	* @param pFunction	Function.
+	* @return			Whether the function might be compiled.
+	*/
+	bool isCandidate(CFunction pFunction) {
+		if (pFunction.getName() == Keyword::MAIN_FUNCTION) {
+			return false;
+		}
+		else if (pFunction.getReturnType() != Token::U_VOID && (!isNative(pFunction.getReturnType()) || !pFunction.alwaysReturns())) {
+			return false;
+		}
+		CLinkedList<CVariable> lParameters = pFunction.getParameters();
+		for (CVariable parameter : lParameters) {
+			if (!isNative(parameter.getType())) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/**
+	* This function compiles the passed function into the assembler.
+	*
+	* @param pFunction	Function.
+	* @return			Error message.
+	*/
+	short int compileFunction(CFunction pFunction) {
+		assembler = CJitAssembler();
+		lScope.clear();
+		lSlots.clear();
+		lLexemeSlots.clear();
+		nSlots = 0;
+		nMaxSlots = 0;
+		nStackDepth = 0;
+		nReturnType = pFunction.getReturnType();
+		nSuccessLabel = assembler.createLabel();
+		nBailoutLabel = assembler.createLabel();
+		CLinkedList<CAbstractSyntaxTree<CToken>> lExpressions = pFunction.getExpressions();
+		findNonDefaultVariables(lExpressions);
+		//Deep recursions (e.g. calls in tail position) are repeated by the interpreter, which limits their depth itself:
+		assembler.moveRaxImmediate((int64_t)(intptr_t)&nStackLimit);
+		assembler.compareRspWithRaxAddress();
+		assembler.jumpIf(JitCondition::CONDITION_BELOW, nBailoutLabel);
+
+		//The size of the frame is only known afterwards, which is why the prologue is written into a separate assembler:
+		CLinkedList<CVariable> lParameters = pFunction.getParameters();
+		for (unsigned int i = 0; i < lParameters.size(); i++) {
+			declareVariable(lParameters[i].getName(), lParameters[i].getType());
+			if (lLexemeSlots[i] >= 0) {
+				//Arguments always have their default lexeme:
+				assembler.storeImmediateToFrame(getSlotDisplacement(lLexemeSlots[i]), 0);
+			}
+		}
+		for (CAbstractSyntaxTree<CToken> expression : lExpressions) {
+			if (expression.getContent().getFilename() != "") {
+				sFilename = expression.getContent().getFilename();
+			}
+			if (compileStatement(expression) != Error::SUCCESS) {
+				return Error::Interpreter::INFO_ENGINE_UNSUPPORTED;
+			}
+		}
+		//Functions with return values never reach the end of the body:
+		assembler.jump(nReturnType == Token::U_VOID ? nSuccessLabel : nBailoutLabel);
+		assembler.bind(nSuccessLabel);
+		assembler.moveEaxImmediate(0);
+		unsigned int nExitLabel = assembler.createLabel();
+		assembler.jump(nExitLabel);
+		assembler.bind(nBailoutLabel);
+		assembler.moveEaxImmediate(1);
+		assembler.bind(nExitLabel);
+		assembler.epilogue();
+		vector<unsigned char> lBody = assembler.getCode();
+
+		assembler = CJitAssembler();
+		assembler.prologue((int32_t)((nMaxSlots * 8 + 15) / 16 * 16));
+		for (unsigned int i = 0; i < lParameters.size(); i++) {
+			assembler.loadRaxFromArguments(i * 8);
+			assembler.storeRaxToFrame(getSlotDisplacement(lSlots[i]));
+		}
+		vector<unsigned char>& lCode = assembler.getCode();
+		lCode.insert(lCode.end(), lBody.begin(), lBody.end());
+		return Error::SUCCESS;
+	}
+
+	/**
+	* This function compiles an expression, whose value is not used.
+	*
+	* @param pAST	Abstract syntax tree of the expression.
+	* @return		Error message.
+	*/
+	short int compileStatement(CAbstractSyntaxTree<CToken> pAST) {
+		CToken content = pAST.getContent();
+		if (content.getType() != Token::KEYWORD) {
+			if (content.getType() != Token::IDENTIFIER && !isOperator(content.getType())) {
+				return Error::Interpreter::INFO_ENGINE_UNSUPPORTED;
+			}
+			return compileExpression(pAST, true).getErrorMessage();
+		}
+		else if (!pAST.hasSubTrees()) {
+			return Error::Interpreter::INFO_ENGINE_UNSUPPORTED;
+		}
+		CLinkedList<CAbstractSyntaxTree<CToken>> lSubTrees = pAST.getSubTrees();
+		string sKeyword = content.getLexeme();
+
+		if (sKeyword == Keyword::INT || sKeyword == Keyword::DOUBLE || sKeyword == Keyword::BOOL) {
+			//Declaration of a new variable:
+			short int nType = sKeyword == Keyword::INT ? Token::U_INT : (sKeyword == Keyword::DOUBLE ? Token::U_DOUBLE : Token::U_BOOL);
+			CAbstractSyntaxTree<CToken> name = lSubTrees[0];
+			if (name.getContent().getType() != Token::IDENTIFIER || name.hasSubTrees() || lSubTrees.size() > 2 || findVariable(name.getContent().getLexeme()) >= 0) {
+				return Error::Interpreter::INFO_ENGINE_UNSUPPORTED;
+			}
+			CJitValue value;
+			if (lSubTrees.size() == 2) {
+				CRV<CJitValue> rvValue = compileOperand(lSubTrees[1], false);
+				if (rvValue.getErrorMessage() != Error::SUCCESS || rvValue.getContent().getType() != nType) {
+					return Error::Interpreter::INFO_ENGINE_UNSUPPORTED;
+				}
+				value = rvValue.getContent();
+			}
+			else {
+				//Standard value (the bits of 0.0 are 0 as well, but the lexeme of the double is "0.0"):
+				assembler.moveRaxImmediate(0);
+				value = CJitValue(nType, 0, false, nType != Token::U_DOUBLE);
+			}
+			return storeVariable(declareVariable(name.getContent().getLexeme(), nType), value);
+		}
+
+		else if (sKeyword == Keyword::SET) {
+			if (lSubTrees.size() != 2 || lSubTrees[0].getContent().getType() != Token::IDENTIFIER || lSubTrees[0].hasSubTrees()) {
+				return Error::Interpreter::INFO_ENGINE_UNSUPPORTED;
+			}
+			int nVariable = findVariable(lSubTrees[0].getContent().getLexeme());
+			if (nVariable < 0) {
+				return Error::Interpreter::INFO_ENGINE_UNSUPPORTED;
+			}
+			CRV<CJitValue> rvValue = compileOperand(lSubTrees[1], false);
+			if (rvValue.getErrorMessage() != Error::SUCCESS || rvValue.getContent().getType() != lScope[nVariable].getType()) {
+				return Error::Interpreter::INFO_ENGINE_UNSUPPORTED;
+			}
+			return storeVariable(nVariable, rvValue.getContent());
+		}
+
+		else if (sKeyword == Keyword::IF) {
+			if (lSubTrees.size() < 2 || lSubTrees.size() > 3 || compileCondition(lSubTrees[0]) != Error::SUCCESS) {
+				return Error::Interpreter::INFO_ENGINE_UNSUPPORTED;
+			}
+			unsigned int nElseLabel = assembler.createLabel();
+			unsigned int nEndLabel = assembler.createLabel();
+			assembler.testEax();
+			assembler.jumpIf(JitCondition::CONDITION_EQUAL, nElseLabel);
+			if (compileBody(lSubTrees[1]) != Error::SUCCESS) {
+				return Error::Interpreter::INFO_ENGINE_UNSUPPORTED;
+			}
+			assembler.jump(nEndLabel);
+			assembler.bind(nElseLabel);
+			if (lSubTrees.size() == 3 && compileBody(lSubTrees[2]) != Error::SUCCESS) {
+				return Error::Interpreter::INFO_ENGINE_UNSUPPORTED;
+			}
+			assembler.bind(nEndLabel);
+			return Error::SUCCESS;
+		}
+
+		else if (sKeyword == Keyword::WHILE) {
+			//The interpreter evaluates the condition once more before the loop, which has no effect in compiled code:
+			if (lSubTrees.size() != 2) {
+				return Error::Interpreter::INFO_ENGINE_UNSUPPORTED;
+			}
+			unsigned int nConditionLabel = assembler.createLabel();
+			unsigned int nEndLabel = assembler.createLabel();
+			assembler.bind(nConditionLabel);
+			if (compileCondition(lSubTrees[0]) != Error::SUCCESS) {
+				return Error::Interpreter::INFO_ENGINE_UNSUPPORTED;
+			}
+			assembler.testEax();
+			assembler.jumpIf(JitCondition::CONDITION_EQUAL, nEndLabel);
+			if (compileBody(lSubTrees[1]) != Error::SUCCESS) {
+				return Error::Interpreter::INFO_ENGINE_UNSUPPORTED;
+			}
+			assembler.jump(nConditionLabel);
+			assembler.bind(nEndLabel);
+			return Error::SUCCESS;
+		}
+
+		else if (sKeyword == Keyword::RETURN) {
+			if (lSubTrees.size() != 1) {
+				return Error::Interpreter::INFO_ENGINE_UNSUPPORTED;
+			}
+			CAbstractSyntaxTree<CToken> tValue = lSubTrees[0];
+			CRV<CJitValue> rvValue = !tValue.hasSubTrees() && isPrimitive(tValue.getContent().getType()) ? compileLiteral(tValue.getContent()) : compileExpression(tValue, false);
+			if (rvValue.getErrorMessage() != Error::SUCCESS) {
+				return Error::Interpreter::INFO_ENGINE_UNSUPPORTED;
+			}
+			CJitValue value = rvValue.getContent();
+			if (nReturnType != Token::U_VOID) {
+				if (value.getType() != nReturnType || requireDefaultLexeme(value) != Error::SUCCESS) {
+					return Error::Interpreter::INFO_ENGINE_UNSUPPORTED;
+				}
+				assembler.storeResult();
+				if (value.hasDynamicLine()) {
+					assembler.storeLineFromEdx();
+				}
+				else {
+					assembler.storeLineImmediate(value.getLine());
+				}
+			}
+			assembler.jump(nSuccessLabel);
+			return Error::SUCCESS;
+		}
+		return Error::Interpreter::INFO_ENGINE_UNSUPPORTED;
+	}
+
+	/**
+	* This function compiles the body of an if-statement or while-loop. Variables, which are declared within the body, are
+	* not visible afterwards.
+	*
+	* @param pBody	Abstract syntax tree of the body.
+	* @return		Error message.
+	*/
+	short int compileBody(CAbstractSyntaxTree<CToken> pBody) {
+		unsigned int nScopeSize = lScope.size();
+		unsigned int nSlotsBefore = nSlots;
+		CLinkedList<CAbstractSyntaxTree<CToken>> lExpressions;
+		if (pBody.getContent().getType() != Token::BRANCH) {
+			lExpressions.add(pBody);
+		}
+		else {
+			lExpressions.addAll(pBody.getSubTrees());
+		}
+		for (CAbstractSyntaxTree<CToken> current : lExpressions) {
+			if (compileStatement(current) != Error::SUCCESS) {
+				return Error::Interpreter::INFO_ENGINE_UNSUPPORTED;
+			}
+		}
+		lScope.resize(nScopeSize);
+		lSlots.resize(nScopeSize);
+		lLexemeSlots.resize(nScopeSize);
+		nSlots = nSlotsBefore;
+		return Error::SUCCESS;
+	}
+
+	/**
+	* This function compiles the condition of an if-statement or while-loop into eax.
+	*
+	* @param pCondition	Abstract syntax tree of the condition.
+	* @return			Error message.
+	*/
+	short int compileCondition(CAbstractSyntaxTree<CToken> pCondition) {
+		CRV<CJitValue> rvCondition = pCondition.hasSubTrees() ? compileExpression(pCondition, false) : compileLiteral(pCondition.getContent());
+		if (rvCondition.getErrorMessage() != Error::SUCCESS || rvCondition.getContent().getType() != Token::U_BOOL) {
+			return Error::Interpreter::INFO_ENGINE_UNSUPPORTED;
+		}
+		return Error::SUCCESS;
+	}
+
+
+
+private:
+	/**
+	* This function compiles an argument or the value of a declaration or "set" into rax. The compiled code does not store
+	* lexemes, which is why arguments must have their default lexeme.
+	*
+	* @param pAST				Abstract syntax tree of the value.
+	* @param pbDefaultLexeme	Whether the value must have it's default lexeme.
+	* @return					Compiled value.
+	*/
+	CRV<CJitValue> compileOperand(CAbstractSyntaxTree<CToken> pAST, bool pbDefaultLexeme) {
+		CRV<CJitValue> rvValue = isPrimitive(pAST.getContent().getType()) ? compileLiteral(pAST) : compileExpression(pAST, false);
+		if (rvValue.getErrorMessage() != Error::SUCCESS || (pbDefaultLexeme && requireDefaultLexeme(rvValue.getContent()) != Error::SUCCESS)) {
+			return CRV<CJitValue>(CJitValue(), Error::Interpreter::INFO_ENGINE_UNSUPPORTED);
+		}
+		return rvValue;
+	}
+
+	/**
+	* This function compiles an operation, a variable or a function call into rax.
+	*
+	* @param pAST			Abstract syntax tree of the expression.
+	* @param pbStatement	Whether the value is not used (only void-functions may be called in this case).
+	* @return				Compiled expression.
+	*/
+	CRV<CJitValue> compileExpression(CAbstractSyntaxTree<CToken> pAST, bool pbStatement) {
+		short int nType = pAST.getContent().getType();
+		if (isOperator(nType) && pAST.hasSubTrees()) {
+			return compileOperation(pAST);
+		}
+		else if (nType != Token::IDENTIFIER) {
+			return CRV<CJitValue>(CJitValue(), Error::Interpreter::INFO_ENGINE_UNSUPPORTED);
+		}
+		CToken name = pAST.getContent();
+		int nVariable = findVariable(name.getLexeme());
+		if (!pAST.hasSubTrees() && nVariable >= 0) {
+			//Identifier resembles variable name:
+			assembler.loadRaxFromFrame(getSlotDisplacement(lSlots[nVariable]));
+			return CRV<CJitValue>(CJitValue(lScope[nVariable].getType(), name.getLine(), lLexemeSlots[nVariable]), Error::SUCCESS);
+		}
+		return compileCall(pAST, pbStatement);
+	}
+
+	/**
+	* This function compiles a literal into rax.
+	*
+	* @param pAST	Abstract syntax tree of the literal.
+	* @return		Compiled literal.
+	*/
+	CRV<CJitValue> compileLiteral(CAbstractSyntaxTree<CToken> pAST) {
+		if (pAST.hasSubTrees()) {
+			return CRV<CJitValue>(CJitValue(), Error::Interpreter::INFO_ENGINE_UNSUPPORTED);
+		}
+		return compileLiteral(pAST.getContent());
+	}
+
+	/**
+	* This function compiles a literal into rax.
+	*
+	* @param pToken	Token of the literal.
+	* @return		Compiled literal.
+	*/
+	CRV<CJitValue> compileLiteral(CToken pToken) {
+		if (!isNative(pToken.getType())) {
+			return CRV<CJitValue>(CJitValue(), Error::Interpreter::INFO_ENGINE_UNSUPPORTED);
+		}
+		CValue value;
+		try {
+			value = CValue(pToken);
+		}
+		catch (const exception&) {
+			//The interpreter would crash while converting the number:
+			return CRV<CJitValue>(CJitValue(), Error::Interpreter::INFO_ENGINE_UNSUPPORTED);
+		}
+		assembler.moveRaxImmediate(toWord(value));
+		return CRV<CJitValue>(CJitValue(value.getType(), value.getLine(), false, value.hasDefaultLexeme()), Error::SUCCESS);
+	}
+
+	/**
+	* This function compiles an arithmetic, relational or boolean operation into rax.
+	*
+	* @param pAST	Abstract syntax tree of the operation.
+	* @return		Compiled operation.
+	*/
+	CRV<CJitValue> compileOperation(CAbstractSyntaxTree<CToken> pAST) {
+		CToken head = pAST.getContent();
+		CLinkedList<CAbstractSyntaxTree<CToken>> lOperands = pAST.getSubTrees();
+		string sOperator = head.getLexeme();
+		if (lOperands.size() < 2 || (head.getType() == Token::OPERATOR_RELATIONAL && lOperands.size() != 2)) {
+			//Single operands keep their lexeme, which cannot be reproduced:
+			return CRV<CJitValue>(CJitValue(), Error::Interpreter::INFO_ENGINE_UNSUPPORTED);
+		}
+
+		if (head.getType() == Token::OPERATOR_ARITHMETIC) {
+			//The interpreter computes every operand as double, if any operand is a double:
+			short int nResultType = sOperator == "/" ? Token::U_DOUBLE : Token::U_INT;
+			for (unsigned int i = 0; i < lOperands.size(); i++) {
+				short int nOperandType = inferType(lOperands[i]);
+				if (nOperandType == Token::U_DOUBLE) {
+					nResultType = Token::U_DOUBLE;
+				}
+				else if (nOperandType != Token::U_INT) {
+					return CRV<CJitValue>(CJitValue(), Error::Interpreter::INFO_ENGINE_UNSUPPORTED);
+				}
+			}
+			CRV<CJitValue> rvFirst = compileOperationOperand(lOperands[0]);
+			if (rvFirst.getErrorMessage() != Error::SUCCESS) {
+				return rvFirst;
+			}
+			CJitValue first = rvFirst.getContent();
+			if (nResultType == Token::U_DOUBLE && first.getType() == Token::U_INT) {
+				assembler.convertRaxToXmm0();
+				assembler.moveXmm0ToRax();
+			}
+			if (first.hasDynamicLine()) {
+				push(true);
+			}
+			push(false);
+			for (unsigned int i = 1; i < lOperands.size(); i++) {
+				CRV<CJitValue> rvOperand = compileOperationOperand(lOperands[i]);
+				if (rvOperand.getErrorMessage() != Error::SUCCESS) {
+					return rvOperand;
+				}
+				assembler.moveRaxToRcx();
+				pop(false);
+				if (nResultType == Token::U_INT) {
+					assembler.integerOperation(sOperator[0]);
+					assembler.signExtendEax();
+				}
+				else {
+					assembler.moveRaxToXmm0();
+					if (rvOperand.getContent().getType() == Token::U_INT) {
+						assembler.convertRcxToXmm1();
+					}
+					else {
+						assembler.moveRcxToXmm1();
+					}
+					if (sOperator == "/") {
+						//Division by zero is reported by the interpreter:
+						unsigned int nValidLabel = assembler.createLabel();
+						assembler.compareXmm1WithZero();
+						assembler.jumpIf(JitCondition::CONDITION_PARITY, nValidLabel);
+						assembler.jumpIf(JitCondition::CONDITION_EQUAL, nBailoutLabel);
+						assembler.bind(nValidLabel);
+					}
+					assembler.doubleOperation(sOperator[0]);
+					callNormalizeDouble();
+					assembler.moveXmm0ToRax();
+				}
+				push(false);
+			}
+			pop(false);
+			if (first.hasDynamicLine()) {
+				pop(true);
+			}
+			return CRV<CJitValue>(CJitValue(nResultType, first.getLine(), first.hasDynamicLine(), true), Error::SUCCESS);
+		}
+
+		if (head.getType() == Token::OPERATOR_BOOL && bShortCircuit) {
+			//Every operand jumps to the end, if it decides the result, which is already stored in rax:
+			unsigned int nEndLabel = assembler.createLabel();
+			for (unsigned int i = 0; i < lOperands.size(); i++) {
+				CRV<CJitValue> rvOperand = compileOperationOperand(lOperands[i]);
+				if (rvOperand.getErrorMessage() != Error::SUCCESS) {
+					return rvOperand;
+				}
+				else if (rvOperand.getContent().getType() != Token::U_BOOL) {
+					return CRV<CJitValue>(CJitValue(), Error::Interpreter::INFO_ENGINE_UNSUPPORTED);
+				}
+				if (i + 1 < lOperands.size()) {
+					assembler.testRax();
+					assembler.jumpIf(sOperator == "&" ? JitCondition::CONDITION_EQUAL : JitCondition::CONDITION_NOT_EQUAL, nEndLabel);
+				}
+			}
+			assembler.bind(nEndLabel);
+			return CRV<CJitValue>(CJitValue(Token::U_BOOL, head.getLine(), false, true), Error::SUCCESS);
+		}
+
+		//Relational and boolean operations return a boolean with the line of the operator:
+		vector<short int> lTypes;
+		for (unsigned int i = 0; i < lOperands.size(); i++) {
+			CRV<CJitValue> rvOperand = compileOperationOperand(lOperands[i]);
+			if (rvOperand.getErrorMessage() != Error::SUCCESS) {
+				return rvOperand;
+			}
+			lTypes.push_back(rvOperand.getContent().getType());
+			if (head.getType() == Token::OPERATOR_BOOL) {
+				if (lTypes.back() != Token::U_BOOL) {
+					return CRV<CJitValue>(CJitValue(), Error::Interpreter::INFO_ENGINE_UNSUPPORTED);
+				}
+				else if (i > 0) {
+					assembler.moveRaxToRcx();
+					pop(false);
+					assembler.booleanOperation(sOperator == "&");
+				}
+			}
+			else if (sOperator == "!" && requireDefaultLexeme(rvOperand.getContent()) != Error::SUCCESS) {
+				//"!" compares the lexemes:
+				return CRV<CJitValue>(CJitValue(), Error::Interpreter::INFO_ENGINE_UNSUPPORTED);
+			}
+			else if (i > 0) {
+				assembler.moveRaxToRcx();
+				pop(false);
+			}
+			if (i + 1 < lOperands.size()) {
+				push(false);
+			}
+		}
+		if (head.getType() == Token::OPERATOR_RELATIONAL && compileComparison(sOperator, lTypes[0], lTypes[1]) != Error::SUCCESS) {
+			return CRV<CJitValue>(CJitValue(), Error::Interpreter::INFO_ENGINE_UNSUPPORTED);
+		}
+		return CRV<CJitValue>(CJitValue(Token::U_BOOL, head.getLine(), false, true), Error::SUCCESS);
+	}
+
+	/**
+	* This function compiles an operand of an operation into rax.
+	*
+	* @param pAST	Abstract syntax tree of the operand.
+	* @return		Compiled operand.
+	*/
+	CRV<CJitValue> compileOperationOperand(CAbstractSyntaxTree<CToken> pAST) {
+		if (isPrimitive(pAST.getContent().getType())) {
+			return compileLiteral(pAST);
+		}
+		return compileExpression(pAST, false);
+	}
+
+	/**
+	* This function compares rax with rcx and stores the boolean result in rax.
+	*
+	* @param psOperator		Relational operator.
+	* @param pnFirstType	Type of the first operand (rax).
+	* @param pnSecondType	Type of the second operand (rcx).
+	* @return				Error message.
+	*/
+	short int compileComparison(string psOperator, short int pnFirstType, short int pnSecondType) {
+		bool bFirstNumeric = pnFirstType == Token::U_INT || pnFirstType == Token::U_DOUBLE;
+		bool bSecondNumeric = pnSecondType == Token::U_INT || pnSecondType == Token::U_DOUBLE;
+		bool bIntegers = pnFirstType == Token::U_INT && pnSecondType == Token::U_INT;
+		if (psOperator == "=" || psOperator == "!") {
+			if (pnFirstType == Token::U_BOOL && pnSecondType == Token::U_BOOL) {
+				bIntegers = true;
+			}
+			else if (!bFirstNumeric || !bSecondNumeric) {
+				return Error::Interpreter::INFO_ENGINE_UNSUPPORTED;
+			}
+			else if (psOperator == "!" && pnFirstType != pnSecondType) {
+				//Default lexemes of integers and doubles are never identical:
+				assembler.moveEaxImmediate(1);
+				return Error::SUCCESS;
+			}
+			if (bIntegers) {
+				assembler.compareIntegers();
+				assembler.setAl(psOperator == "=" ? JitCondition::CONDITION_EQUAL : JitCondition::CONDITION_NOT_EQUAL);
+			}
+			else {
+				convertOperandsToDouble(pnFirstType, pnSecondType);
+				assembler.compareDoubles(false);
+				if (psOperator == "=") {
+					assembler.setAl(JitCondition::CONDITION_EQUAL);
+					assembler.setCl(JitCondition::CONDITION_NO_PARITY);
+					assembler.combineAlWithCl(true);
+				}
+				else {
+					assembler.setAl(JitCondition::CONDITION_NOT_EQUAL);
+					assembler.setCl(JitCondition::CONDITION_PARITY);
+					assembler.combineAlWithCl(false);
+				}
+			}
+			assembler.zeroExtendAl();
+			return Error::SUCCESS;
+		}
+		else if (!bFirstNumeric || !bSecondNumeric) {
+			return Error::Interpreter::INFO_ENGINE_UNSUPPORTED;
+		}
+
+		if (bIntegers) {
+			assembler.compareIntegers();
+			if (psOperator == ">") {
+				assembler.setAl(JitCondition::CONDITION_GREATER);
+			}
+			else if (psOperator == "<") {
+				assembler.setAl(JitCondition::CONDITION_LESS);
+			}
+			else if (psOperator == ">=") {
+				assembler.setAl(JitCondition::CONDITION_GREATER_EQUAL);
+			}
+			else {
+				assembler.setAl(JitCondition::CONDITION_LESS_EQUAL);
+			}
+		}
+		else {
+			//Unordered comparisons (NaN) must be false, which is why "<" and "<=" swap their operands:
+			convertOperandsToDouble(pnFirstType, pnSecondType);
+			assembler.compareDoubles(psOperator == "<" || psOperator == "<=");
+			assembler.setAl(psOperator == ">" || psOperator == "<" ? JitCondition::CONDITION_ABOVE : JitCondition::CONDITION_ABOVE_EQUAL);
+		}
+		assembler.zeroExtendAl();
+		return Error::SUCCESS;
+	}
+
+	/**
+	* Moves both operands of a comparison into xmm0 and xmm1.
+	*
+	* @param pnFirstType	Type of the first operand (rax).
+	* @param pnSecondType	Type of the second operand (rcx).
+	*/
+	void convertOperandsToDouble(short int pnFirstType, short int pnSecondType) {
+		if (pnFirstType == Token::U_INT) {
+			assembler.convertRaxToXmm0();
+		}
+		else {
+			assembler.moveRaxToXmm0();
+		}
+		if (pnSecondType == Token::U_INT) {
+			assembler.convertRcxToXmm1();
+		}
+		else {
+			assembler.moveRcxToXmm1();
+		}
+	}
+
+	/**
+	* This function compiles a function call into rax. The line of the returned value is stored in edx.
+	*
+	* @param pAST			Abstract syntax tree of the function call.
+	* @param pbStatement	Whether the returned value is not used.
+	* @return				Compiled function call.
+	*/
+	CRV<CJitValue> compileCall(CAbstractSyntaxTree<CToken> pAST, bool pbStatement) {
+		CToken name = pAST.getContent();
+		int nIndex = getFunctionIndex(name.getLexeme());
+		if (nIndex < 0 || !lCompiled[nIndex] || (!pbStatement && lReturnTypes[nIndex] == Token::U_VOID)) {
+			return CRV<CJitValue>(CJitValue(), Error::Interpreter::INFO_ENGINE_UNSUPPORTED);
+		}
+		CLinkedList<CAbstractSyntaxTree<CToken>> lArguments;
+		if (pAST.hasSubTrees()) {
+			lArguments.addAll(pAST.getSubTrees());
+		}
+		vector<short int>& lTypes = lParameterTypes[nIndex];
+		if (lArguments.size() != lTypes.size()) {
+			return CRV<CJitValue>(CJitValue(), Error::Interpreter::INFO_ENGINE_UNSUPPORTED);
+		}
+
+		//Reserve the arguments, the result and the line on the stack:
+		int32_t nResultOffset = lArguments.size() * 8;
+		int32_t nAreaSize = nResultOffset + 16;
+		if ((nStackDepth + nAreaSize) % 16 != 0) {
+			nAreaSize += 8;
+		}
+		assembler.subtractFromRsp(nAreaSize);
+		nStackDepth += nAreaSize;
+		for (unsigned int i = 0; i < lArguments.size(); i++) {
+			CRV<CJitValue> rvArgument = compileOperand(lArguments[i], true);
+			if (rvArgument.getErrorMessage() != Error::SUCCESS || rvArgument.getContent().getType() != lTypes[i]) {
+				return CRV<CJitValue>(CJitValue(), Error::Interpreter::INFO_ENGINE_UNSUPPORTED);
+			}
+			assembler.storeRaxToStack(i * 8);
+		}
+		assembler.loadCallArguments(0, nResultOffset, nResultOffset + 8);
+		assembler.moveRaxImmediate((int64_t)(intptr_t)&lEntries[nIndex]);
+		assembler.callIndirectRax();
+		assembler.testEax();
+		assembler.jumpIf(JitCondition::CONDITION_NOT_EQUAL, nBailoutLabel);
+		assembler.loadRaxFromStack(nResultOffset);
+		assembler.loadEdxFromStack(nResultOffset + 8);
+		assembler.addToRsp(nAreaSize);
+		nStackDepth -= nAreaSize;
+		return CRV<CJitValue>(CJitValue(lReturnTypes[nIndex], 0, true, true), Error::SUCCESS);
+	}
+
+	/**
+	* Calls CValue::normalizeDouble() for xmm0 (which never throws for the results of arithmetic operations).
+	*/
+	void callNormalizeDouble() {
+		int32_t nPadding = nStackDepth % 16 != 0 ? 8 : 0;
+#if defined(_WIN32)
+		nPadding += 32; //Shadow space of the Windows calling convention.
+#endif
+		if (nPadding != 0) {
+			assembler.subtractFromRsp(nPadding);
+		}
+		double (*pNormalize)(double) = &CValue::normalizeDouble;
+		assembler.moveRaxImmediate((int64_t)(intptr_t)pNormalize);
+		assembler.callRax();
+		if (nPadding != 0) {
+			assembler.addToRsp(nPadding);
+		}
+	}
+
+
+
+private:
+	/**
+	* Returns the type of the passed operand, without compiling it.
+	*
+	* @param pAST	Abstract syntax tree of the operand.
+	* @return		Type of the operand or Token::UNKNOWN.
+	*/
+	short int inferType(CAbstractSyntaxTree<CToken> pAST) {
+		CToken content = pAST.getContent();
+		if (isPrimitive(content.getType())) {
+			return content.getType();
+		}
+		else if (content.getType() == Token::OPERATOR_RELATIONAL || content.getType() == Token::OPERATOR_BOOL) {
+			return Token::U_BOOL;
+		}
+		else if (content.getType() == Token::OPERATOR_ARITHMETIC && pAST.hasSubTrees()) {
+			if (content.getLexeme() == "/") {
+				return Token::U_DOUBLE;
+			}
+			short int nType = Token::U_INT;
+			for (unsigned int i = 0; i < pAST.getSubTreeNumber(); i++) {
+				short int nOperandType = inferType(pAST.getSubTreeAtIndex(i));
+				if (nOperandType == Token::U_DOUBLE) {
+					nType = Token::U_DOUBLE;
+				}
+				else if (nOperandType != Token::U_INT) {
+					return Token::UNKNOWN;
+				}
+			}
+			return nType;
+		}
+		else if (content.getType() == Token::IDENTIFIER) {
+			int nVariable = findVariable(content.getLexeme());
+			if (!pAST.hasSubTrees() && nVariable >= 0) {
+				return lScope[nVariable].getType();
+			}
+			int nIndex = getFunctionIndex(content.getLexeme());
+			return nIndex >= 0 ? lReturnTypes[nIndex] : (short int)Token::UNKNOWN;
+		}
+		return Token::UNKNOWN;
+	}
+
+	/**
+	* Finds every variable, which might store a value without it's default lexeme (e.g. "(double d 0.5)"). These variables
+	* get an additional slot, which stores whether their current value has it's default lexeme.
+	*
+	* @param plExpressions	Expressions of the function.
+	*/
+	void findNonDefaultVariables(CLinkedList<CAbstractSyntaxTree<CToken>> plExpressions) {
+		lNonDefaultVariables.clear();
+		vector<pair<string, CAbstractSyntaxTree<CToken>>> lAssignments;
+		vector<string> lDefaultDoubles;
+		for (CAbstractSyntaxTree<CToken> expression : plExpressions) {
+			findAssignments(expression, lAssignments, lDefaultDoubles);
+		}
+		for (unsigned int i = 0; i < lDefaultDoubles.size(); i++) {
+			//The standard value of doubles has the lexeme "0.0":
+			lNonDefaultVariables.insert(lDefaultDoubles[i]);
+		}
+		bool bChanged = true;
+		while (bChanged) {
+			bChanged = false;
+			for (unsigned int i = 0; i < lAssignments.size(); i++) {
+				if (lNonDefaultVariables.count(lAssignments[i].first) != 0) {
+					continue;
+				}
+				CAbstractSyntaxTree<CToken> value = lAssignments[i].second;
+				bool bNonDefault = false;
+				if (value.hasSubTrees()) {
+					bNonDefault = false;
+				}
+				else if (isPrimitive(value.getContent().getType())) {
+					try {
+						bNonDefault = !CValue(value.getContent()).hasDefaultLexeme();
+					}
+					catch (const exception&) {
+						bNonDefault = true;
+					}
+				}
+				else if (value.getContent().getType() == Token::IDENTIFIER) {
+					bNonDefault = lNonDefaultVariables.count(value.getContent().getLexeme()) != 0;
+				}
+				if (bNonDefault) {
+					lNonDefaultVariables.insert(lAssignments[i].first);
+					bChanged = true;
+				}
+			}
+		}
+	}
+
+	/**
+	* Adds every declaration and "set" of the passed expression to the passed lists.
+	*
+	* @param pAST				Abstract syntax tree of the expression.
+	* @param plAssignments		Name and value of every assignment.
+	* @param plDefaultDoubles	Names of the doubles, which are declared without value.
+	*/
+	void findAssignments(CAbstractSyntaxTree<CToken> pAST, vector<pair<string, CAbstractSyntaxTree<CToken>>>& plAssignments, vector<string>& plDefaultDoubles) {
+		CToken content = pAST.getContent();
+		unsigned int nSubTrees = pAST.getSubTreeNumber();
+		if (content.getType() == Token::KEYWORD && nSubTrees >= 1) {
+			string sKeyword = content.getLexeme();
+			string sName = pAST.getSubTreeAtIndex(0).getContent().getLexeme();
+			if ((sKeyword == Keyword::INT || sKeyword == Keyword::DOUBLE || sKeyword == Keyword::BOOL || sKeyword == Keyword::SET) && nSubTrees == 2) {
+				plAssignments.push_back(pair<string, CAbstractSyntaxTree<CToken>>(sName, pAST.getSubTreeAtIndex(1)));
+			}
+			else if (sKeyword == Keyword::DOUBLE && nSubTrees == 1) {
+				plDefaultDoubles.push_back(sName);
+			}
+		}
+		for (unsigned int i = 0; i < nSubTrees; i++) {
+			findAssignments(pAST.getSubTreeAtIndex(i), plAssignments, plDefaultDoubles);
+		}
+	}
+
+
+
+private:
+	/**
+	* Pushes rax (or rdx) onto the stack.
+	*
+	* @param pbLine	Whether rdx is pushed.
+	*/
+	void push(bool pbLine) {
+		if (pbLine) {
+			assembler.pushRdx();
+		}
+		else {
+			assembler.pushRax();
+		}
+		nStackDepth += 8;
+	}
+
+	/**
+	* Pops rax (or rdx) from the stack.
+	*
+	* @param pbLine	Whether rdx is popped.
+	*/
+	void pop(bool pbLine) {
+		if (pbLine) {
+			assembler.popRdx();
+		}
+		else {
+			assembler.popRax();
+		}
+		nStackDepth -= 8;
+	}
+
+	/**
+	* Adds a new variable to the current scope.
+	*
+	* @param psName	Name of the variable.
+	* @param pnType	Type of the variable.
+	* @return		Index of the variable.
+	*/
+	unsigned int declareVariable(string psName, short int pnType) {
+		lScope.push_back(CVariable(psName, "", pnType));
+		lSlots.push_back(nSlots++);
+		lLexemeSlots.push_back(lNonDefaultVariables.count(psName) != 0 ? (int)nSlots++ : -1);
+		if (nSlots > nMaxSlots) {
+			nMaxSlots = nSlots;
+		}
+		return lScope.size() - 1;
+	}
+
+	/**
+	* Stores rax in the passed variable.
+	*
+	* @param pnVariable	Index of the variable.
+	* @param pValue		Value in rax.
+	* @return			Error message.
+	*/
+	short int storeVariable(unsigned int pnVariable, CJitValue pValue) {
+		assembler.storeRaxToFrame(getSlotDisplacement(lSlots[pnVariable]));
+		if (lLexemeSlots[pnVariable] < 0) {
+			return pValue.hasDefaultLexeme() && pValue.getLexemeSlot() < 0 ? (short int)Error::SUCCESS : (short int)Error::Interpreter::INFO_ENGINE_UNSUPPORTED;
+		}
+		int32_t nDisplacement = getSlotDisplacement(lLexemeSlots[pnVariable]);
+		if (pValue.getLexemeSlot() >= 0) {
+			assembler.copyFrameSlot(getSlotDisplacement(pValue.getLexemeSlot()), nDisplacement);
+		}
+		else {
+			assembler.storeImmediateToFrame(nDisplacement, pValue.hasDefaultLexeme() ? 0 : 1);
+		}
+		return Error::SUCCESS;
+	}
+
+	/**
+	* Checks, whether the value in rax has it's default lexeme. If this is only known at runtime, the execution is
+	* repeated by the interpreter otherwise.
+	*
+	* @param pValue	Value in rax.
+	* @return		Error message.
+	*/
+	short int requireDefaultLexeme(CJitValue pValue) {
+		if (!pValue.hasDefaultLexeme()) {
+			return Error::Interpreter::INFO_ENGINE_UNSUPPORTED;
+		}
+		else if (pValue.getLexemeSlot() >= 0) {
+			assembler.compareFrameWithZero(getSlotDisplacement(pValue.getLexemeSlot()));
+			assembler.jumpIf(JitCondition::CONDITION_NOT_EQUAL, nBailoutLabel);
+		}
+		return Error::SUCCESS;
+	}
+
+	/**
+	* Returns the index of the visible variable with the passed name.
+	*
+	* @param psName	Name of the variable.
+	* @return		Index or -1, if the variable does not exist.
+	*/
+	int findVariable(string psName) {
+		for (unsigned int i = 0; i < lScope.size(); i++) {
+			if (lScope[i].getName() == psName) {
+				return i;
+			}
+		}
+		return -1;
+	}
+
+	/**
+	* Returns the displacement of the passed slot relative to rbp.
+	*
+	* @param pnSlot	Slot.
+	* @return		Displacement.
+	*/
+	int32_t getSlotDisplacement(unsigned int pnSlot) {
+		return -SAVED_REGISTERS_SIZE - 8 - (int32_t)pnSlot * 8;
+	}
+
+	/**
+	* Returns the index of the first function with the passed name.
+	*
+	* @param psName	Name of the function.
+	* @return		Index or -1, if the function does not exist.
+	*/
+	int getFunctionIndex(string psName) {
+		for (unsigned int i = 0; i < lNames.size(); i++) {
+			if (lNames[i] == psName) {
+				return i;
+			}
+		}
+		return -1;
+	}
+
+	/**
+	* Converts the passed value into a 64 bit word.
+	*
+	* @param pValue	Value.
+	* @return		Word.
+	*/
+	int64_t toWord(CValue pValue) {
+		if (pValue.getType() == Token::U_DOUBLE) {
+			int64_t nWord;
+			double dValue = pValue.getDouble();
+			memcpy(&nWord, &dValue, 8);
+			return nWord;
+		}
+		return pValue.getInt();
+	}
+
+	/**
+	* Converts the passed 64 bit word into a value.
+	*
+	* @param pnWord	Word.
+	* @param pnType	Type of the value.
+	* @return		Value.
+	*/
+	CValue fromWord(int64_t pnWord, short int pnType) {
+		CValue value;
+		if (pnType == Token::U_DOUBLE) {
+			double dValue;
+			memcpy(&dValue, &pnWord, 8);
+			value.setDouble(dValue, to_string(dValue));
+		}
+		else if (pnType == Token::U_BOOL) {
+			value.setBool(pnWord != 0);
+		}
+		else {
+			value.setInt((int)pnWord);
+		}
+		return value;
+	}
+
+	/**
+	* Returns whether the passed type can be stored in compiled code.
+	*
+	* @param pnType	Type.
+	* @return		Whether the type is int, double or bool.
+	*/
+	bool isNative(short int pnType) {
+		return pnType == Token::U_INT || pnType == Token::U_DOUBLE || pnType == Token::U_BOOL;
+	}
+
+	/**
+	* Returns whether the passed type resembles a primitive datatype.
+	*
+	* @param pnType	Type.
+	* @return		Whether the type is primitive.
+	*/
+	bool isPrimitive(short int pnType) {
+		return pnType == Token::U_INT || pnType == Token::U_DOUBLE || pnType == Token::U_BOOL || pnType == Token::U_CHAR || pnType == Token::U_STRING;
+	}
+
+	/**
+	* Returns whether the passed type resembles an operator.
+	*
+	* @param pnType	Type.
+	* @return		Whether the type is an operator.
+	*/
+	bool isOperator(short int pnType) {
+		return pnType == Token::OPERATOR_ARITHMETIC || pnType == Token::OPERATOR_RELATIONAL || pnType == Token::OPERATOR_BOOL;
+	}
+};
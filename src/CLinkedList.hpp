@@ -48,6 +48,23 @@ public:
 		}
 	}
 
+	/**
+	* This overloaded operator allows to read any element of a constant LinkedList without copying it. If the index is out of
+	* range, an exception is thrown.
+	*
+	* @param pnIndex	Index of the element in the list.
+	* @return			Element at the specified index.
+	*/
+	const T& operator[](unsigned int pnIndex) const {
+		if (pnIndex >= this->size()) {
+			//The passed index is out of range:
+			throw invalid_argument("index out of range");
+		}
+		typename list<T>::const_iterator listIterator = this->begin();
+		advance(listIterator, pnIndex);
+		return *listIterator;
+	}
+
 
 
 public:
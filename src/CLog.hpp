@@ -10,6 +10,7 @@ REMARKS:	This file contains the class "CLog" which can be used to create a log f
 #include <fstream>
 #include <iostream>
 #include <algorithm>
+#include <mutex>
 
 #include "CToken.hpp"
 #include "Variables/TokenTypes.hpp"
@@ -71,10 +72,22 @@ private:
 	struct tm* timeTable;
 
 	/**
-	* Whether the logger should actually log or not.
+	* Stores the values of the system time, to which "timeTable" points. The structure of "localtime()" is shared by every
+	* thread, therefore every log converts the time into it's own structure.
+	*/
+	struct tm timeBuffer;
+
+	/**
+	* Whether the logger should actually log or not (only accessed while the lock is held).
 	*/
 	bool log;
 
+	/**
+	* Locks the log, since the interpreters of multiple threads write their entries into the same file. Whether the log
+	* is open is only read while the lock is held, since another thread could close it meanwhile.
+	*/
+	mutex lock;
+
 
 
 private:
@@ -156,7 +169,12 @@ private:
 	*/
 	void refreshTime() {
 		rawSystemTime = time(0);
-		timeTable = localtime(&rawSystemTime);
+#if defined(_WIN32)
+		localtime_s(&timeBuffer, &rawSystemTime);
+#else
+		localtime_r(&rawSystemTime, &timeBuffer);
+#endif
+		timeTable = &timeBuffer;
 	}
 
 
@@ -237,6 +255,7 @@ public:
 	* @return	Name of the file of the log.
 	*/
 	string getFilename() {
+		lock_guard<mutex> guard(lock);
 		return filename;
 	}
 
@@ -246,6 +265,7 @@ public:
 	* @return	Whether the logger is logging or not.
 	*/
 	bool isLogging() {
+		lock_guard<mutex> guard(lock);
 		return log;
 	}
 
@@ -259,6 +279,7 @@ public:
 	* @param _type	Type for the entry.
 	*/
 	void addEntry(string _entry, short int _component, short int _type) {
+		lock_guard<mutex> guard(lock);
 		if (!log) {
 			//Logger shall not log:
 			return;
@@ -285,6 +306,7 @@ public:
 	* @param _arguments	Arguments that were passed with the aforementioned command.
 	*/
 	void addEntry_terminalCommand(string _command, CLinkedList<string> _arguments) {
+		lock_guard<mutex> guard(lock);
 		if (!log) {
 			//Logger shall not log:
 			return;
@@ -323,6 +345,7 @@ public:
 	* @param _errorMessage	Error message to output in the log.
 	*/
 	void addEntry_terminalCommandArgException(string _command, CLinkedList<string> _arguments, string _errorArgument, string _errorMessage) {
+		lock_guard<mutex> guard(lock);
 		if (!log) {
 			//Logger shall not log:
 			return;
@@ -358,6 +381,7 @@ public:
 	* @param _errorMessage	Error message to output in the log.
 	*/
 	void addEntry_terminalCommandException(string _command, CLinkedList<string> _arguments, string _errorMessage) {
+		lock_guard<mutex> guard(lock);
 		if (!log) {
 			//Logger shall not log:
 			return;
@@ -392,6 +416,7 @@ public:
 	* @param _token	Token which was extracted.
 	*/
 	void addEntry_tokenizerAddToken(CToken _token) {
+		lock_guard<mutex> guard(lock);
 		if (!log) {
 			//Logger shall not log:
 			return;
@@ -419,6 +444,7 @@ public:
 	* @param _errorMessage	Error message that belongs to the error code.
 	*/
 	void addEntry_tokenException(CToken _token, short int _component, short int _type, short int _errorCode, string _errorMessage) {
+		lock_guard<mutex> guard(lock);
 		if (!log) {
 			//Logger shall not log:
 			return;
@@ -453,6 +479,7 @@ public:
 	* This method closes the log. After this method is called, the log will not be continued.
 	*/
 	void close() {
+		lock_guard<mutex> guard(lock);
 		logFile.close(); //Close the file.
 		log = false;
 	}
@@ -462,6 +489,7 @@ public:
 	* this method is called. Please make sure to "close()" the log afterwards.
 	*/
 	void open() {
+		lock_guard<mutex> guard(lock);
 		//Generate name for the log-file:
 		refreshTime();
 		string timeForFilename = convertTimeToString();
@@ -474,9 +502,3 @@ public:
 
 };
 
-
-
-/**
-* Global object can log the events of the interpreter.
-*/
-CLog logger;
@@ -0,0 +1,433 @@
+/*
+FILE:		CLoopChecker.hpp
+
+REMARKS:	This file contains the class "CLoopChecker", which rejects counted loops, whose iterations cannot be executed in
+			the way, in which the loop demands it.
+*/
+#pragma once
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "CAbstractSyntaxTree.hpp"
+#include "CCountedLoop.hpp"
+#include "CFunction.hpp"
+#include "CLinkedList.hpp"
+#include "CRV.hpp"
+#include "CSourceAnalyzer.hpp"
+#include "CToken.hpp"
+#include "Variables/ErrorMessages.hpp"
+#include "Variables/OpcodeTypes.hpp"
+#include "Variables/TokenTypes.hpp"
+
+using namespace std;
+
+
+
+/**
+* The class "CLoopChecker" checks every counted loop before the sourcecode is executed. The counter of a loop must not be
+* changed by it's body, since the next value of the counter does not depend on the body. The iterations of a parallel
+* loop are executed by multiple threads in any order, therefore they must not depend on each other. Within the body of a
+* parallel loop:
+*	- Only variables, which are declared within the body, are changed.
+*	- A reduction variable is only changed through "(set x (+ x ...))" (or "*" respectively) and is not read otherwise.
+*	  The variable of "min" and "max" is only changed through "(if (< y x) (set x y))" (or ">" respectively).
+*	- Nothing is printed, no task is spawned or awaited, no channel is used and no value is returned.
+*	- Only pure functions (see "CSourceAnalyzer::findPureFunctions()") are called.
+* The opcodes of the abstract syntax trees have to be resolved before (see COpcodeResolver).
+*
+* @author	Christian-2003
+* @version	19.10.2026
+*/
+class CLoopChecker {
+private:
+	/**
+	* Stores the name of every function.
+	*/
+	vector<string> vsNames;
+
+	/**
+	* Stores whether each function is pure (same index as vsNames).
+	*/
+	vector<bool> vbPure;
+
+	/**
+	* Stores the number of parallel loops, which have been checked.
+	*/
+	unsigned int nParallelLoops;
+
+	/**
+	* Analyzes the functions.
+	*/
+	CSourceAnalyzer analyzer;
+
+
+
+public:
+	/**
+	* The default constructor instantiates a new loop checker.
+	*/
+	CLoopChecker() {
+		nParallelLoops = 0;
+	}
+
+
+
+public:
+	/**
+	* This function checks every counted loop of the passed abstract syntax trees. If the functions cannot be read, no
+	* error is returned, so that the error is reported by the CInterpreter.
+	*
+	* @param pltASTs	Abstract syntax trees, which resemble Lisp-functions.
+	* @return			Error message including the token, which caused the first error.
+	*/
+	CRV<CToken> check(CLinkedList<CAbstractSyntaxTree<CToken>> pltASTs) {
+		CLinkedList<CFunction> lFunctions; //Stores every function.
+		for (unsigned int i = 0; i < pltASTs.size(); i++) {
+			CFunction function;
+			if (function.evaluateFunctionSourceCode(pltASTs[i]).getErrorMessage() != Error::SUCCESS) {
+				return CRV<CToken>(CToken(), Error::SUCCESS);
+			}
+			lFunctions.add(function);
+			vsNames.push_back(function.getName());
+		}
+		vbPure = analyzer.findPureFunctions(lFunctions);
+
+		vector<string> vsCounters; //Stores the counters of the loops, which contain the checked node.
+		for (unsigned int i = 0; i < pltASTs.size(); i++) {
+			CRV<CToken> rvCheck = checkNode(pltASTs[i], vsCounters);
+			if (rvCheck.getErrorMessage() != Error::SUCCESS) {
+				return rvCheck;
+			}
+		}
+		return CRV<CToken>(CToken(), Error::SUCCESS);
+	}
+
+	/**
+	* Returns the number of parallel loops, which have been checked.
+	*
+	* @return	Number of parallel loops.
+	*/
+	unsigned int getParallelLoops() {
+		return nParallelLoops;
+	}
+
+
+
+private:
+	/**
+	* This function checks the passed node and every loop within it.
+	*
+	* @param pAST			Abstract syntax tree of the node.
+	* @param pvsCounters	Counters of the loops, which contain the node.
+	* @return				Error message including the token, which caused the error.
+	*/
+	CRV<CToken> checkNode(CAbstractSyntaxTree<CToken> pAST, vector<string>& pvsCounters) {
+		CToken content = pAST.getContent();
+		size_t nCounters = pvsCounters.size(); //Stores the number of counters of the enclosing loops.
+		if ((content.getOpcode() == Opcode::OPCODE_SET && pAST.hasSubTrees()) || (content.getOpcode() == Opcode::OPCODE_TRY_RECV && pAST.getSubTreeNumber() == 2)) {
+			unsigned int nVariable = content.getOpcode() == Opcode::OPCODE_SET ? 0 : 1; //Stores the index of the changed variable.
+			string sVariable = pAST.getSubTreeAtIndex(nVariable).getContent().getLexeme(); //Stores the name of the changed variable.
+			for (unsigned int i = 0; i < pvsCounters.size(); i++) {
+				if (pvsCounters[i] == sVariable) {
+					return CRV<CToken>(pAST.getSubTreeAtIndex(nVariable).getContent(), Error::Interpreter::LOOP_COUNTER_CHANGED);
+				}
+			}
+		}
+		else if (content.getOpcode() == Opcode::OPCODE_FOR || content.getOpcode() == Opcode::OPCODE_PFOR) {
+			CCountedLoop loop;
+			CRV<CToken> rvLoop = loop.read(pAST);
+			if (rvLoop.getErrorMessage() != Error::SUCCESS) {
+				return rvLoop;
+			}
+			if (loop.isParallel()) {
+				nParallelLoops++;
+				vector<string> vsLocals; //Stores the variables, which are declared within the body.
+				CAbstractSyntaxTree<CToken> tBody = pAST.getSubTreeAtIndex(pAST.getSubTreeNumber() - 1);
+				findLocals(tBody, vsLocals);
+				CRV<CToken> rvBody = checkIteration(tBody, loop, vsLocals);
+				if (rvBody.getErrorMessage() != Error::SUCCESS) {
+					return rvBody;
+				}
+			}
+			pvsCounters.push_back(loop.getCounter());
+		}
+		for (unsigned int i = 0; i < pAST.getSubTreeNumber(); i++) {
+			CRV<CToken> rvCheck = checkNode(pAST.getSubTreeAtIndex(i), pvsCounters);
+			if (rvCheck.getErrorMessage() != Error::SUCCESS) {
+				return rvCheck;
+			}
+		}
+		pvsCounters.resize(nCounters);
+		return CRV<CToken>(content, Error::SUCCESS);
+	}
+
+	/**
+	* This function checks, whether the passed part of a parallel loop's body depends on other iterations.
+	*
+	* @param pAST		Abstract syntax tree of the part.
+	* @param pLoop		Parallel loop.
+	* @param pvsLocals	Variables, which are declared within the body.
+	* @return			Error message including the token, which caused the error.
+	*/
+	CRV<CToken> checkIteration(CAbstractSyntaxTree<CToken> pAST, CCountedLoop& pLoop, vector<string>& pvsLocals) {
+		CToken content = pAST.getContent();
+		switch (content.getOpcode()) {
+		case Opcode::OPCODE_PRINT:
+		case Opcode::OPCODE_PRINTLN:
+		case Opcode::OPCODE_SPAWN:
+		case Opcode::OPCODE_AWAIT:
+		case Opcode::OPCODE_RETURN:
+		case Opcode::OPCODE_MAKE_CHANNEL:
+		case Opcode::OPCODE_SEND:
+		case Opcode::OPCODE_RECV:
+		case Opcode::OPCODE_TRY_SEND:
+		case Opcode::OPCODE_TRY_RECV:
+			//The order of the iterations could be observed:
+			return CRV<CToken>(content, Error::Interpreter::LOOP_DEPENDENCY);
+
+		case Opcode::OPCODE_SET: {
+			if (pAST.getSubTreeNumber() != 2) {
+				//The interpreter reports the missing value:
+				break;
+			}
+			CToken variable = pAST.getSubTreeAtIndex(0).getContent(); //Stores the changed variable.
+			int nReduction = pLoop.findReduction(variable.getLexeme()); //Stores the index of the variable's reduction.
+			if (nReduction >= 0 && (pLoop.getReduction(nReduction) == Opcode::OPCODE_ADD || pLoop.getReduction(nReduction) == Opcode::OPCODE_MULTIPLY)) {
+				//Only the operands, which are combined with the variable, are checked:
+				vector<CAbstractSyntaxTree<CToken>> vtOperands; //Stores the operands.
+				if (!isUpdate(pAST.getSubTreeAtIndex(1), variable.getLexeme(), pLoop.getReduction(nReduction), vtOperands)) {
+					return CRV<CToken>(variable, Error::Interpreter::LOOP_DEPENDENCY);
+				}
+				for (unsigned int i = 0; i < vtOperands.size(); i++) {
+					CRV<CToken> rvCheck = checkIteration(vtOperands[i], pLoop, pvsLocals);
+					if (rvCheck.getErrorMessage() != Error::SUCCESS) {
+						return rvCheck;
+					}
+				}
+				return CRV<CToken>(content, Error::SUCCESS);
+			}
+			else if (variable.getLexeme() == pLoop.getCounter()) {
+				return CRV<CToken>(variable, Error::Interpreter::LOOP_COUNTER_CHANGED);
+			}
+			else if (nReduction >= 0 || !contains(pvsLocals, variable.getLexeme())) {
+				//The variable is shared by every iteration:
+				return CRV<CToken>(variable, Error::Interpreter::LOOP_DEPENDENCY);
+			}
+			return checkIteration(pAST.getSubTreeAtIndex(1), pLoop, pvsLocals);
+		}
+
+		case Opcode::OPCODE_IF: {
+			CAbstractSyntaxTree<CToken> tValue; //Stores the value, which replaces the variable of "min" or "max".
+			if (isConditionalUpdate(pAST, pLoop, tValue)) {
+				//Only the value and the else-body are checked:
+				CRV<CToken> rvCheck = checkIteration(tValue, pLoop, pvsLocals);
+				for (unsigned int i = 2; i < pAST.getSubTreeNumber() && rvCheck.getErrorMessage() == Error::SUCCESS; i++) {
+					rvCheck = checkIteration(pAST.getSubTreeAtIndex(i), pLoop, pvsLocals);
+				}
+				return rvCheck;
+			}
+			break;
+		}
+
+		case Opcode::OPCODE_PFOR: {
+			//The reductions of a nested loop change their variables:
+			CCountedLoop loop;
+			if (loop.read(pAST).getErrorMessage() == Error::SUCCESS) {
+				for (unsigned int i = 0; i < loop.getReductions(); i++) {
+					if (!contains(pvsLocals, loop.getReductionVariable(i))) {
+						return CRV<CToken>(content, Error::Interpreter::LOOP_DEPENDENCY);
+					}
+				}
+			}
+			break;
+		}
+
+		case Opcode::OPCODE_IDENTIFIER:
+			if (!pAST.hasSubTrees() && pLoop.findReduction(content.getLexeme()) >= 0) {
+				//The value of a reduction variable depends on the previous iterations of the chunk:
+				return CRV<CToken>(content, Error::Interpreter::LOOP_DEPENDENCY);
+			}
+			for (unsigned int i = 0; i < vsNames.size(); i++) {
+				if (vsNames[i] == content.getLexeme()) {
+					if (!vbPure[i]) {
+						return CRV<CToken>(content, Error::Interpreter::LOOP_DEPENDENCY);
+					}
+					break;
+				}
+			}
+			break;
+
+		default:
+			break;
+		}
+		for (unsigned int i = 0; i < pAST.getSubTreeNumber(); i++) {
+			CRV<CToken> rvCheck = checkIteration(pAST.getSubTreeAtIndex(i), pLoop, pvsLocals);
+			if (rvCheck.getErrorMessage() != Error::SUCCESS) {
+				return rvCheck;
+			}
+		}
+		return CRV<CToken>(content, Error::SUCCESS);
+	}
+
+	/**
+	* This function returns whether the passed value combines the variable of a "+" or "*" reduction with other operands
+	* (e.g. "(+ x y z)"), which do not contain the variable.
+	*
+	* @param pAST			Abstract syntax tree of the value.
+	* @param psVariable		Name of the variable.
+	* @param pnReduction	Kind of the reduction.
+	* @param pvtOperands	Vector, to which the other operands are added.
+	* @return				Whether the value is an update of the variable.
+	*/
+	bool isUpdate(CAbstractSyntaxTree<CToken> pAST, string psVariable, short int pnReduction, vector<CAbstractSyntaxTree<CToken>>& pvtOperands) {
+		if (isVariable(pAST, psVariable)) {
+			//The variable keeps it's value:
+			return true;
+		}
+		else if (pAST.getContent().getOpcode() != pnReduction) {
+			return false;
+		}
+		unsigned int nOccurences = 0; //Stores how often the variable is an operand.
+		for (unsigned int i = 0; i < pAST.getSubTreeNumber(); i++) {
+			CAbstractSyntaxTree<CToken> tOperand = pAST.getSubTreeAtIndex(i);
+			if (isVariable(tOperand, psVariable)) {
+				nOccurences++;
+			}
+			else if (mentions(tOperand, psVariable)) {
+				return false;
+			}
+			else {
+				pvtOperands.push_back(tOperand);
+			}
+		}
+		return nOccurences == 1;
+	}
+
+	/**
+	* This function returns whether the passed if-statement replaces the variable of a "min" or "max" reduction with a
+	* smaller or larger value (e.g. "(if (< y x) (set x y))").
+	*
+	* @param pAST		Abstract syntax tree of the if-statement.
+	* @param pLoop		Parallel loop.
+	* @param ptValue	Abstract syntax tree, to which the compared value is assigned.
+	* @return			Whether the if-statement is an update of the variable.
+	*/
+	bool isConditionalUpdate(CAbstractSyntaxTree<CToken> pAST, CCountedLoop& pLoop, CAbstractSyntaxTree<CToken>& ptValue) {
+		if (pAST.getSubTreeNumber() < 2 || pAST.getSubTreeAtIndex(0).getSubTreeNumber() != 2) {
+			return false;
+		}
+		CAbstractSyntaxTree<CToken> tCondition = pAST.getSubTreeAtIndex(0);
+		short int nComparison = tCondition.getContent().getOpcode(); //Stores the opcode of the comparison.
+		bool bLess = nComparison == Opcode::OPCODE_LESS || nComparison == Opcode::OPCODE_LESS_EQUAL; //Stores whether the left operand has to be smaller.
+		if (!bLess && nComparison != Opcode::OPCODE_GREATER && nComparison != Opcode::OPCODE_GREATER_EQUAL) {
+			return false;
+		}
+		int nReduction = -1; //Stores the index of the compared reduction.
+		for (unsigned int i = 0; i < 2 && nReduction < 0; i++) {
+			CAbstractSyntaxTree<CToken> tVariable = tCondition.getSubTreeAtIndex(i);
+			nReduction = tVariable.hasSubTrees() || tVariable.getContent().getType() != Token::IDENTIFIER ? -1 : pLoop.findReduction(tVariable.getContent().getLexeme());
+			if (nReduction >= 0) {
+				//The value is the other operand:
+				ptValue = tCondition.getSubTreeAtIndex(1 - i);
+				bLess = i == 0 ? !bLess : bLess;
+			}
+		}
+		if (nReduction < 0 || pLoop.getReduction(nReduction) != (bLess ? Opcode::OPCODE_LESS : Opcode::OPCODE_GREATER)) {
+			//The value does not replace the variable of a matching reduction:
+			return false;
+		}
+		string sVariable = pLoop.getReductionVariable(nReduction); //Stores the name of the variable.
+		CAbstractSyntaxTree<CToken> tBody = pAST.getSubTreeAtIndex(1);
+		if (tBody.getContent().getType() == Token::BRANCH && tBody.getSubTreeNumber() == 1) {
+			tBody = tBody.getSubTreeAtIndex(0);
+		}
+		return !mentions(ptValue, sVariable) && tBody.getContent().getOpcode() == Opcode::OPCODE_SET && tBody.getSubTreeNumber() == 2 && isVariable(tBody.getSubTreeAtIndex(0), sVariable) && isEqual(tBody.getSubTreeAtIndex(1), ptValue);
+	}
+
+
+
+private:
+	/**
+	* This function adds every variable, which is declared within the passed abstract syntax tree, to the passed vector.
+	* The counters of nested loops are declared as well.
+	*
+	* @param pAST		Abstract syntax tree.
+	* @param pvsLocals	Vector, to which the names are added.
+	*/
+	void findLocals(CAbstractSyntaxTree<CToken> pAST, vector<string>& pvsLocals) {
+		short int nOpcode = pAST.getContent().getOpcode();
+		if (((nOpcode >= Opcode::OPCODE_DECLARE_INT && nOpcode <= Opcode::OPCODE_DECLARE_STRING) || nOpcode == Opcode::OPCODE_FOR || nOpcode == Opcode::OPCODE_PFOR) && pAST.hasSubTrees()) {
+			pvsLocals.push_back(pAST.getSubTreeAtIndex(0).getContent().getLexeme());
+		}
+		for (unsigned int i = 0; i < pAST.getSubTreeNumber(); i++) {
+			findLocals(pAST.getSubTreeAtIndex(i), pvsLocals);
+		}
+	}
+
+	/**
+	* This function returns whether the passed abstract syntax tree contains an identifier with the passed name.
+	*
+	* @param pAST		Abstract syntax tree.
+	* @param psName		Name of the identifier.
+	* @return			Whether the identifier is contained.
+	*/
+	bool mentions(CAbstractSyntaxTree<CToken> pAST, string psName) {
+		if (pAST.getContent().getType() == Token::IDENTIFIER && pAST.getContent().getLexeme() == psName) {
+			return true;
+		}
+		for (unsigned int i = 0; i < pAST.getSubTreeNumber(); i++) {
+			if (mentions(pAST.getSubTreeAtIndex(i), psName)) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	/**
+	* This function returns whether the passed abstract syntax tree resembles the variable with the passed name.
+	*
+	* @param pAST		Abstract syntax tree.
+	* @param psName		Name of the variable.
+	* @return			Whether the abstract syntax tree is the variable.
+	*/
+	bool isVariable(CAbstractSyntaxTree<CToken> pAST, string psName) {
+		return !pAST.hasSubTrees() && pAST.getContent().getType() == Token::IDENTIFIER && pAST.getContent().getLexeme() == psName;
+	}
+
+	/**
+	* This function returns whether the passed abstract syntax trees consist of the same tokens.
+	*
+	* @param pFirst		First abstract syntax tree.
+	* @param pSecond	Second abstract syntax tree.
+	* @return			Whether the abstract syntax trees are equal.
+	*/
+	bool isEqual(CAbstractSyntaxTree<CToken> pFirst, CAbstractSyntaxTree<CToken> pSecond) {
+		if (pFirst.getContent().getLexeme() != pSecond.getContent().getLexeme() || pFirst.getContent().getType() != pSecond.getContent().getType() || pFirst.getSubTreeNumber() != pSecond.getSubTreeNumber()) {
+			return false;
+		}
+		for (unsigned int i = 0; i < pFirst.getSubTreeNumber(); i++) {
+			if (!isEqual(pFirst.getSubTreeAtIndex(i), pSecond.getSubTreeAtIndex(i))) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/**
+	* This function returns whether the passed vector contains the passed name.
+	*
+	* @param pvsNames	Names.
+	* @param psName		Name.
+	* @return			Whether the name is contained.
+	*/
+	bool contains(vector<string>& pvsNames, string psName) {
+		for (unsigned int i = 0; i < pvsNames.size(); i++) {
+			if (pvsNames[i] == psName) {
+				return true;
+			}
+		}
+		return false;
+	}
+};
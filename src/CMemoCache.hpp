@@ -0,0 +1,294 @@
+/*
+FILE:		CMemoCache.hpp
+
+REMARKS:	This file contains the class "CMemoCache", which stores the return values of pure Lisp-functions, so that calls
+			with the same arguments are not executed again.
+*/
+#pragma once
+
+#include <iostream>
+#include <string>
+#include <list>
+#include <unordered_map>
+#include <utility>
+
+#include "CLinkedList.hpp"
+#include "CToken.hpp"
+
+using namespace std;
+#define MEMO_DEFAULT_CAPACITY 4096
+
+
+
+/**
+* The class "CMemoCache" maps a call of a pure Lisp-function (the index of the function together with the types and lexemes
+* of it's arguments) to the value, which the function returned. The number of stored values is limited, if the cache is
+* full, the value, which has not been used for the longest time, is removed (least recently used).
+* The cache is enabled through the terminal and reset by the CInterpreter before every execution, the statistics remain
+* available until the next execution.
+*
+* @author	Christian-2003
+* @version	19.10.2026
+*/
+class CMemoCache {
+private:
+	/**
+	* Stores every key together with it's value, the most recently used entry is at the front.
+	*/
+	list<pair<string, CToken>> lEntries;
+
+	/**
+	* Stores the position of every key within lEntries.
+	*/
+	unordered_map<string, list<pair<string, CToken>>::iterator> lPositions;
+
+	/**
+	* Stores whether return values are memoized.
+	*/
+	bool bEnabled;
+
+	/**
+	* Stores the maximum number of entries.
+	*/
+	unsigned int nCapacity;
+
+	/**
+	* Stores the number of calls, whose value has been found.
+	*/
+	unsigned long long nHits;
+
+	/**
+	* Stores the number of calls of pure functions, whose value has not been found.
+	*/
+	unsigned long long nMisses;
+
+	/**
+	* Stores the number of entries, which have been removed because the cache was full.
+	*/
+	unsigned long long nEvictions;
+
+	/**
+	* Stores the number of pure functions of the latest execution.
+	*/
+	unsigned int nPureFunctions;
+
+	/**
+	* Stores the number of functions of the latest execution.
+	*/
+	unsigned int nFunctions;
+
+
+
+public:
+	/**
+	* The default constructor instantiates a new, disabled cache.
+	*/
+	CMemoCache() {
+		bEnabled = false;
+		nCapacity = MEMO_DEFAULT_CAPACITY;
+		reset();
+	}
+
+
+
+public:
+	/**
+	* This function enables or disables the cache.
+	*
+	* @param pbEnabled	Whether return values are memoized.
+	*/
+	void setEnabled(bool pbEnabled) {
+		bEnabled = pbEnabled;
+	}
+
+	/**
+	* This function returns whether return values are memoized.
+	*
+	* @return	Whether the cache is enabled.
+	*/
+	bool isEnabled() {
+		return bEnabled;
+	}
+
+	/**
+	* This function changes the maximum number of entries. Entries, which exceed the new capacity, are removed.
+	*
+	* @param pnCapacity	Maximum number of entries (at least 1).
+	*/
+	void setCapacity(unsigned int pnCapacity) {
+		nCapacity = pnCapacity > 0 ? pnCapacity : 1;
+		while (lEntries.size() > nCapacity) {
+			evict();
+		}
+	}
+
+	/**
+	* This function returns the maximum number of entries.
+	*
+	* @return	Capacity.
+	*/
+	unsigned int getCapacity() {
+		return nCapacity;
+	}
+
+	/**
+	* This function removes every entry and every statistic, before a new program is executed.
+	*/
+	void reset() {
+		lEntries.clear();
+		lPositions.clear();
+		nHits = 0;
+		nMisses = 0;
+		nEvictions = 0;
+		nPureFunctions = 0;
+		nFunctions = 0;
+	}
+
+	/**
+	* This function stores how many functions of the executed program are pure.
+	*
+	* @param pnPureFunctions	Number of pure functions.
+	* @param pnFunctions		Number of functions.
+	*/
+	void setPureFunctions(unsigned int pnPureFunctions, unsigned int pnFunctions) {
+		nPureFunctions = pnPureFunctions;
+		nFunctions = pnFunctions;
+	}
+
+
+
+public:
+	/**
+	* This function generates the key of a call.
+	*
+	* @param pnFunction		Index of the called function.
+	* @param plArguments	Evaluated arguments.
+	* @return				Key of the call.
+	*/
+	string generateKey(unsigned int pnFunction, CLinkedList<CToken>& plArguments) {
+		string sKey = to_string(pnFunction); //Stores the key.
+		for (CLinkedList<CToken>::iterator argument = plArguments.begin(); argument != plArguments.end(); argument++) {
+			//The length of the lexeme separates it from the next argument:
+			sKey += ":" + to_string(argument->getType()) + ":" + to_string(argument->getLexeme().size()) + ":" + argument->getLexeme();
+		}
+		return sKey;
+	}
+
+	/**
+	* This function searches the value of the passed key. If it is found, the entry becomes the most recently used entry.
+	*
+	* @param psKey	Key of the call.
+	* @param pValue	Token, into which the value is written.
+	* @return		Whether the value has been found.
+	*/
+	bool find(const string& psKey, CToken& pValue) {
+		unordered_map<string, list<pair<string, CToken>>::iterator>::iterator position = lPositions.find(psKey);
+		if (position == lPositions.end()) {
+			nMisses++;
+			return false;
+		}
+		lEntries.splice(lEntries.begin(), lEntries, position->second);
+		pValue = position->second->second;
+		nHits++;
+		return true;
+	}
+
+	/**
+	* This function stores the value of the passed key.
+	*
+	* @param psKey	Key of the call.
+	* @param pValue	Value, which has been returned by the call.
+	*/
+	void store(const string& psKey, CToken& pValue) {
+		unordered_map<string, list<pair<string, CToken>>::iterator>::iterator position = lPositions.find(psKey);
+		if (position != lPositions.end()) {
+			//The value has been stored by a nested call with the same arguments:
+			position->second->second = pValue;
+			lEntries.splice(lEntries.begin(), lEntries, position->second);
+			return;
+		}
+		if (lEntries.size() >= nCapacity) {
+			evict();
+		}
+		lEntries.push_front(make_pair(psKey, pValue));
+		lPositions[psKey] = lEntries.begin();
+	}
+
+
+
+public:
+	/**
+	* Returns the number of calls, whose value has been found.
+	*
+	* @return	Number of hits.
+	*/
+	unsigned long long getHits() {
+		return nHits;
+	}
+
+	/**
+	* Returns the number of calls of pure functions, whose value has not been found.
+	*
+	* @return	Number of misses.
+	*/
+	unsigned long long getMisses() {
+		return nMisses;
+	}
+
+	/**
+	* Returns the number of entries, which have been removed because the cache was full.
+	*
+	* @return	Number of evictions.
+	*/
+	unsigned long long getEvictions() {
+		return nEvictions;
+	}
+
+	/**
+	* Returns the percentage of calls of pure functions, whose value has been found.
+	*
+	* @return	Hit rate (0 to 100).
+	*/
+	double getHitRate() {
+		return nHits + nMisses == 0 ? 0.0 : 100.0 * nHits / (nHits + nMisses);
+	}
+
+	/**
+	* Returns the number of stored entries.
+	*
+	* @return	Number of entries.
+	*/
+	unsigned int getEntries() {
+		return lEntries.size();
+	}
+
+	/**
+	* Returns the number of pure functions of the latest execution.
+	*
+	* @return	Number of pure functions.
+	*/
+	unsigned int getPureFunctions() {
+		return nPureFunctions;
+	}
+
+	/**
+	* Returns the number of functions of the latest execution.
+	*
+	* @return	Number of functions.
+	*/
+	unsigned int getFunctions() {
+		return nFunctions;
+	}
+
+
+
+private:
+	/**
+	* This function removes the least recently used entry.
+	*/
+	void evict() {
+		lPositions.erase(lEntries.back().first);
+		lEntries.pop_back();
+		nEvictions++;
+	}
+};
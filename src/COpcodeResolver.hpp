@@ -0,0 +1,341 @@
+/*
+FILE:		COpcodeResolver.hpp
+
+REMARKS:	This file contains the class "COpcodeResolver", which stamps every node of an abstract syntax tree with its opcode.
+*/
+#pragma once
+
+#include <iostream>
+
+#include "CAbstractSyntaxTree.hpp"
+#include "CLinkedList.hpp"
+#include "CToken.hpp"
+#include "Variables/ErrorMessages.hpp"
+#include "Variables/KeywordTypes.hpp"
+#include "Variables/OpcodeTypes.hpp"
+#include "Variables/TokenTypes.hpp"
+
+using namespace std;
+
+
+
+/**
+* The class "COpcodeResolver" resolves the lexeme of every node of the abstract syntax trees into an opcode and validates the
+* number of the node's arguments once, after the sourcecode has been parsed. Afterwards, the interpreter can dispatch every
+* node with a single switch-statement.
+* The errors of invalid arities are not returned by the resolver, since the interpreter reports them only when the node is
+* executed (and after its operands have been evaluated).
+*
+* @author	Christian-2003
+* @version	19.10.2026
+*/
+class COpcodeResolver {
+private:
+	/**
+	* Stores the number of nodes, that have been resolved.
+	*/
+	unsigned int nResolvedNodes;
+
+
+
+public:
+	/**
+	* The default constructor instantiates a new resolver.
+	*/
+	COpcodeResolver() {
+		nResolvedNodes = 0;
+	}
+
+
+
+public:
+	/**
+	* This function stamps every node of the passed abstract syntax trees with its opcode and the error of its arity.
+	*
+	* @param pltASTs	List of abstract syntax trees, which should be resolved.
+	* @return			Resolved abstract syntax trees.
+	*/
+	CLinkedList<CAbstractSyntaxTree<CToken>> resolve(CLinkedList<CAbstractSyntaxTree<CToken>> pltASTs) {
+		CLinkedList<CAbstractSyntaxTree<CToken>> ltResolved; //Stores the resolved abstract syntax trees.
+		for (unsigned int i = 0; i < pltASTs.size(); i++) {
+			ltResolved.add(resolveTree(pltASTs[i]));
+		}
+		return ltResolved;
+	}
+
+	/**
+	* This function returns the number of nodes, that have been resolved.
+	*
+	* @return	Number of resolved nodes.
+	*/
+	unsigned int getResolvedNodes() {
+		return nResolvedNodes;
+	}
+
+	/**
+	* This function stamps the passed token with its opcode and the error of the arity of its node.
+	*
+	* @param pToken		Token, which should be stamped.
+	* @param pnArity	Number of subtrees of the token's node.
+	* @return			Stamped token.
+	*/
+	CToken resolveToken(CToken pToken, unsigned int pnArity) {
+		short int nOpcode = resolveOpcode(pToken);
+		pToken.setOpcode(nOpcode, validateArity(nOpcode, pnArity));
+		return pToken;
+	}
+
+
+
+private:
+	/**
+	* This function stamps the passed node and all of it's subtrees.
+	*
+	* @param pAST	Abstract syntax tree, which should be resolved.
+	* @return		Resolved abstract syntax tree.
+	*/
+	CAbstractSyntaxTree<CToken> resolveTree(CAbstractSyntaxTree<CToken> pAST) {
+		CLinkedList<CAbstractSyntaxTree<CToken>> ltSubTrees; //Stores the subtrees of the passed AST.
+		ltSubTrees.addAll(pAST.getSubTrees());
+		CLinkedList<CAbstractSyntaxTree<CToken>> ltResolved; //Stores the resolved subtrees.
+		for (unsigned int i = 0; i < ltSubTrees.size(); i++) {
+			ltResolved.add(resolveTree(ltSubTrees[i]));
+		}
+
+		nResolvedNodes++;
+		return CAbstractSyntaxTree<CToken>(resolveToken(pAST.getContent(), ltSubTrees.size()), ltResolved);
+	}
+
+
+
+public:
+	/**
+	* This function returns the opcode of the passed token.
+	*
+	* @param pToken	Token, whose opcode should be returned.
+	* @return		Opcode of the token.
+	*/
+	short int resolveOpcode(CToken pToken) {
+		string sLexeme = pToken.getLexeme();
+		switch (pToken.getType()) {
+		case Token::IDENTIFIER:
+			return Opcode::OPCODE_IDENTIFIER;
+
+		case Token::OPERATOR_ARITHMETIC:
+			if (sLexeme == "+") {
+				return Opcode::OPCODE_ADD;
+			}
+			else if (sLexeme == "-") {
+				return Opcode::OPCODE_SUBTRACT;
+			}
+			else if (sLexeme == "*") {
+				return Opcode::OPCODE_MULTIPLY;
+			}
+			return Opcode::OPCODE_DIVIDE;
+
+		case Token::OPERATOR_RELATIONAL:
+			if (sLexeme == "=") {
+				return Opcode::OPCODE_EQUAL;
+			}
+			else if (sLexeme == "!") {
+				return Opcode::OPCODE_NOT_EQUAL;
+			}
+			else if (sLexeme == ">") {
+				return Opcode::OPCODE_GREATER;
+			}
+			else if (sLexeme == "<") {
+				return Opcode::OPCODE_LESS;
+			}
+			else if (sLexeme == ">=") {
+				return Opcode::OPCODE_GREATER_EQUAL;
+			}
+			return Opcode::OPCODE_LESS_EQUAL;
+
+		case Token::OPERATOR_BOOL:
+			if (sLexeme == "&") {
+				return Opcode::OPCODE_AND;
+			}
+			return Opcode::OPCODE_OR; //Every other boolean operator is evaluated as "|".
+
+		case Token::KEYWORD:
+			if (sLexeme == Keyword::INT) {
+				return Opcode::OPCODE_DECLARE_INT;
+			}
+			else if (sLexeme == Keyword::DOUBLE) {
+				return Opcode::OPCODE_DECLARE_DOUBLE;
+			}
+			else if (sLexeme == Keyword::BOOL) {
+				return Opcode::OPCODE_DECLARE_BOOL;
+			}
+			else if (sLexeme == Keyword::CHAR) {
+				return Opcode::OPCODE_DECLARE_CHAR;
+			}
+			else if (sLexeme == Keyword::STRING) {
+				return Opcode::OPCODE_DECLARE_STRING;
+			}
+			else if (sLexeme == Keyword::SET) {
+				return Opcode::OPCODE_SET;
+			}
+			else if (sLexeme == Keyword::PRINT) {
+				return Opcode::OPCODE_PRINT;
+			}
+			else if (sLexeme == Keyword::PRINTLN) {
+				return Opcode::OPCODE_PRINTLN;
+			}
+			else if (sLexeme == Keyword::IF) {
+				return Opcode::OPCODE_IF;
+			}
+			else if (sLexeme == Keyword::WHILE) {
+				return Opcode::OPCODE_WHILE;
+			}
+			else if (sLexeme == Keyword::RETURN) {
+				return Opcode::OPCODE_RETURN;
+			}
+			else if (sLexeme == Keyword::SPAWN) {
+				return Opcode::OPCODE_SPAWN;
+			}
+			else if (sLexeme == Keyword::AWAIT) {
+				return Opcode::OPCODE_AWAIT;
+			}
+			else if (sLexeme == Keyword::FOR) {
+				return Opcode::OPCODE_FOR;
+			}
+			else if (sLexeme == Keyword::PFOR) {
+				return Opcode::OPCODE_PFOR;
+			}
+			else if (sLexeme == Keyword::MAKE_CHANNEL) {
+				return Opcode::OPCODE_MAKE_CHANNEL;
+			}
+			else if (sLexeme == Keyword::SEND) {
+				return Opcode::OPCODE_SEND;
+			}
+			else if (sLexeme == Keyword::RECV) {
+				return Opcode::OPCODE_RECV;
+			}
+			else if (sLexeme == Keyword::TRY_SEND) {
+				return Opcode::OPCODE_TRY_SEND;
+			}
+			else if (sLexeme == Keyword::TRY_RECV) {
+				return Opcode::OPCODE_TRY_RECV;
+			}
+			return Opcode::OPCODE_KEYWORD;
+
+		default:
+			return Opcode::OPCODE_NONE;
+		}
+	}
+
+
+
+private:
+	/**
+	* This function validates the number of arguments of a node with the passed opcode. Arities, that are checked by the
+	* statements themselves in a specific order (e.g. if-statements and while-loops), are not validated.
+	*
+	* @param pnOpcode	Opcode of the node.
+	* @param pnArity	Number of subtrees of the node.
+	* @return			Error, which is caused by the arity.
+	*/
+	short int validateArity(short int pnOpcode, unsigned int pnArity) {
+		switch (pnOpcode) {
+		case Opcode::OPCODE_EQUAL:
+		case Opcode::OPCODE_NOT_EQUAL:
+		case Opcode::OPCODE_GREATER:
+		case Opcode::OPCODE_LESS:
+		case Opcode::OPCODE_GREATER_EQUAL:
+		case Opcode::OPCODE_LESS_EQUAL:
+			//Relational operations do only work with exactly 2 operands:
+			if (pnArity < 2) {
+				return Error::Interpreter::NOT_ENOUGH_ARGUMENTS;
+			}
+			else if (pnArity > 2) {
+				return Error::Interpreter::TOO_MANY_ARGUMENTS;
+			}
+			return Error::SUCCESS;
+
+		case Opcode::OPCODE_AND:
+		case Opcode::OPCODE_OR:
+			//Boolean operations need at least 2 operands:
+			if (pnArity < 2) {
+				return Error::Interpreter::NOT_ENOUGH_ARGUMENTS;
+			}
+			return Error::SUCCESS;
+
+		case Opcode::OPCODE_DECLARE_INT:
+		case Opcode::OPCODE_DECLARE_DOUBLE:
+		case Opcode::OPCODE_DECLARE_BOOL:
+		case Opcode::OPCODE_DECLARE_CHAR:
+		case Opcode::OPCODE_DECLARE_STRING:
+			//Name of the variable and optional initializer:
+			if (pnArity < 1) {
+				return Error::Interpreter::MISSING_TOKEN;
+			}
+			else if (pnArity > 2) {
+				return Error::Interpreter::TOO_MANY_ARGUMENTS;
+			}
+			return Error::SUCCESS;
+
+		case Opcode::OPCODE_SET:
+			//Name of the variable and new value:
+			if (pnArity < 2) {
+				return Error::Interpreter::NOT_ENOUGH_ARGUMENTS;
+			}
+			else if (pnArity > 2) {
+				return Error::Interpreter::TOO_MANY_ARGUMENTS;
+			}
+			return Error::SUCCESS;
+
+		case Opcode::OPCODE_SPAWN:
+		case Opcode::OPCODE_AWAIT:
+			//Exactly one call or task:
+			if (pnArity > 1) {
+				return Error::Interpreter::TOO_MANY_ARGUMENTS;
+			}
+			return Error::SUCCESS;
+
+		case Opcode::OPCODE_FOR:
+		case Opcode::OPCODE_PFOR:
+			//Counter, range, clauses (only "pfor") and body:
+			if (pnArity < 4) {
+				return Error::Interpreter::MISSING_BODY;
+			}
+			else if (pnOpcode == Opcode::OPCODE_FOR && pnArity > 4) {
+				return Error::Interpreter::TOO_MANY_ARGUMENTS;
+			}
+			return Error::SUCCESS;
+
+		case Opcode::OPCODE_MAKE_CHANNEL:
+		case Opcode::OPCODE_RECV:
+			//Exactly one capacity or channel:
+			if (pnArity < 1) {
+				return Error::Interpreter::NOT_ENOUGH_ARGUMENTS;
+			}
+			else if (pnArity > 1) {
+				return Error::Interpreter::TOO_MANY_ARGUMENTS;
+			}
+			return Error::SUCCESS;
+
+		case Opcode::OPCODE_SEND:
+		case Opcode::OPCODE_TRY_SEND:
+		case Opcode::OPCODE_TRY_RECV:
+			//Channel and value or variable:
+			if (pnArity < 2) {
+				return Error::Interpreter::NOT_ENOUGH_ARGUMENTS;
+			}
+			else if (pnArity > 2) {
+				return Error::Interpreter::TOO_MANY_ARGUMENTS;
+			}
+			return Error::SUCCESS;
+
+		case Opcode::OPCODE_RETURN:
+			//Exactly one value can be returned:
+			if (pnArity > 1) {
+				return Error::Interpreter::TOO_MANY_VALUES_TO_RETURN;
+			}
+			return Error::SUCCESS;
+
+		default:
+			return Error::SUCCESS;
+		}
+	}
+};
@@ -0,0 +1,392 @@
+/*
+FILE:		COperationEvaluator.hpp
+
+REMARKS:	This file contains the class "COperationEvaluator", which applies an operator to already evaluated operands.
+*/
+#pragma once
+
+#include <iostream>
+#include <string>
+
+#include "CLinkedList.hpp"
+#include "COperationKernels.hpp"
+#include "CRV.hpp"
+#include "CToken.hpp"
+#include "CVectorReduction.hpp"
+#include "Variables/ErrorMessages.hpp"
+#include "Variables/OpcodeTypes.hpp"
+#include "Variables/TokenTypes.hpp"
+
+using namespace std;
+
+
+
+/**
+* The class "COperationEvaluator" applies an arithmetic, relational or boolean operator to a list of operands. It is used by
+* the interpreter to evaluate operations and by the CConstantFolder to evaluate operations with constant operands in
+* advance, so that both produce exactly the same tokens and errors. Operations, for which the CTypeChecker has selected a
+* kernel, are passed on to the COperationKernels. Long additions, subtractions and multiplications are reduced by the
+* CVectorReduction, whenever this does not change the result.
+* The engines, which evaluate the operands, ask "isDecided()" after every operand of "&" and "|", whether the remaining
+* operands can be skipped.
+*
+* @author	Christian-2003
+* @version	19.10.2026
+*/
+class COperationEvaluator {
+public:
+	/**
+	* The default constructor instantiates a new operation evaluator, with which "&" and "|" are short-circuited.
+	*/
+	COperationEvaluator() {
+		bShortCircuit = true;
+	}
+
+
+
+public:
+	/**
+	* This function changes whether "&" and "|" are short-circuited. Otherwise, every operand is evaluated, as it has been
+	* done before short-circuiting was introduced.
+	*
+	* @param pbShortCircuit	Whether boolean operations are short-circuited.
+	*/
+	void setShortCircuit(bool pbShortCircuit) {
+		bShortCircuit = pbShortCircuit;
+	}
+
+	/**
+	* This function returns whether the passed operand decides the result of a boolean operation ("nil" for "&", "t" for
+	* "|"), so that the remaining operands do not have to be evaluated.
+	*
+	* @param pHeadNode	Token, which resembles the operator.
+	* @param pOperand	Latest evaluated operand.
+	* @return			Whether the remaining operands are skipped.
+	*/
+	bool isDecided(CToken& pHeadNode, CToken& pOperand) {
+		if (!bShortCircuit) {
+			return false;
+		}
+		short int nOpcode = pHeadNode.getOpcode();
+		return (nOpcode == Opcode::OPCODE_AND && pOperand.getLexeme() == "nil") || (nOpcode == Opcode::OPCODE_OR && pOperand.getLexeme() == "t");
+	}
+
+	/**
+	* This function applies the operator of the passed head node to the passed operands. The head node must have been
+	* stamped with it's opcode by the COpcodeResolver.
+	*
+	* @param pHeadNode	Token, which resembles the operator.
+	* @param plOperands	Evaluated operands of the operation.
+	* @return			Return value of the operation as token.
+	*/
+	CRV<CToken> evaluate(CToken pHeadNode, CLinkedList<CToken>& plOperands) {
+		if (pHeadNode.getKernel() != OperationKernel::KERNEL_NONE) {
+			//The types of the operands have already been verified:
+			return kernels.evaluate(pHeadNode, plOperands);
+		}
+		switch (pHeadNode.getOpcode()) {
+		case Opcode::OPCODE_ADD: {
+			//Additon -> Check wether the operands can be added:
+			short int nReturnType = plOperands[0].getType();
+			if (nReturnType == Token::U_STRING || nReturnType == Token::U_CHAR) {
+				//Every other operand must be string or character:
+				for (unsigned int i = 1; i < plOperands.size(); i++) {
+					if (plOperands[i].getType() != Token::U_STRING && plOperands[i].getType() != Token::U_CHAR) {
+						//Error: Operands are not of the same type:
+						return CRV<CToken>(plOperands[i], Error::Interpreter::OPERANDS_ARE_OF_DIFFERENT_TYPE);
+					}
+				}
+				nReturnType = Token::U_STRING; //Needs to be string, since either added characters or strings, make up a string in the end! \(^_^)/
+			}
+			else if (nReturnType == Token::U_INT || nReturnType == Token::U_DOUBLE) {
+				//Every other operand must be integer or double:
+				for (unsigned int i = 1; i < plOperands.size(); i++) {
+					if (plOperands[i].getType() != Token::U_INT && plOperands[i].getType() != Token::U_DOUBLE) {
+						//Error: Operands are not of the same type:
+						return CRV<CToken>(plOperands[i], Error::Interpreter::OPERANDS_ARE_OF_DIFFERENT_TYPE);
+					}
+					if (plOperands[i].getType() == Token::U_DOUBLE) {
+						nReturnType = Token::U_DOUBLE; //When integer and double, or multiple doubles are added, a double-type value must be returned.
+													 //If only integers are present, this value will simply stay as integer!
+					}
+				}
+			}
+			else if (nReturnType == Token::U_BOOL) {
+				//Error: Cannot add multiple booleans:
+				return CRV<CToken>(plOperands[0], Error::Interpreter::CANNOT_ADD_BOOLEANS);
+			}
+			else {
+				//Error: Incorrect token encountered -> Syntax error:
+				return CRV<CToken>(plOperands[0], Error::Interpreter::SYNTAX_I);
+			}
+
+			//Add the operands:
+			string sReturnValue = ""; //Represents the value, which should be returned as token.
+			CRV<string> rvReduction = reduction.reduce(Opcode::OPCODE_ADD, nReturnType, plOperands);
+			if (rvReduction.getErrorMessage() == Error::SUCCESS) {
+				return CRV<CToken>(CToken(rvReduction.getContent(), nReturnType, plOperands[0].getFilename(), plOperands[0].getLine()), Error::SUCCESS);
+			}
+			if (nReturnType == Token::U_STRING) {
+				//A string needs to be created:
+				for (unsigned int i = 0; i < plOperands.size(); i++) {
+					sReturnValue += plOperands[i].getLexeme();
+				}
+			}
+			else {
+				//A number (either integer or double) needs to be created:
+				sReturnValue = plOperands[0].getLexeme(); //First number makes string.
+				for (unsigned int i = 1; i < plOperands.size(); i++) {
+					if (nReturnType == Token::U_INT) {
+						sReturnValue = to_string(stoi(sReturnValue) + stoi(plOperands[i].getLexeme()));
+					}
+					else {
+						sReturnValue = to_string(stod(sReturnValue) + stod(plOperands[i].getLexeme()));
+					}
+				}
+			}
+			return CRV<CToken>(CToken(sReturnValue, nReturnType, plOperands[0].getFilename(), plOperands[0].getLine()), Error::SUCCESS);
+		}
+
+		case Opcode::OPCODE_SUBTRACT: {
+			//Subtraction -> check wether all operators are numeric values:
+			short int nReturnType = Token::U_INT; //Stores, wether return value is integer or double.
+			for (unsigned int i = 0; i < plOperands.size(); i++) {
+				if (plOperands[i].getType() == Token::U_DOUBLE) {
+					nReturnType = Token::U_DOUBLE;
+				}
+				else if (plOperands[i].getType() != Token::U_DOUBLE && plOperands[i].getType() != Token::U_INT) {
+					//Found token, which resembles a non-numeric value:
+					return CRV<CToken>(plOperands[i], Error::Interpreter::CANNOT_SUBTRACT_NON_NUMERIC_VALUES);
+				}
+			}
+
+			//Subtract the numbers:
+			CRV<string> rvReduction = reduction.reduce(Opcode::OPCODE_SUBTRACT, nReturnType, plOperands);
+			if (rvReduction.getErrorMessage() == Error::SUCCESS) {
+				return CRV<CToken>(CToken(rvReduction.getContent(), nReturnType, plOperands[0].getFilename(), plOperands[0].getLine()), Error::SUCCESS);
+			}
+			string sReturnValue = plOperands[0].getLexeme(); //Resembles the return value of the subtraction.
+			for (unsigned int i = 1; i < plOperands.size(); i++) {
+				if (nReturnType == Token::U_INT) {
+					sReturnValue = to_string(stoi(sReturnValue) - stoi(plOperands[i].getLexeme()));
+				}
+				else {
+					sReturnValue = to_string(stod(sReturnValue) - stod(plOperands[i].getLexeme()));
+				}
+			}
+			return CRV<CToken>(CToken(sReturnValue, nReturnType, plOperands[0].getFilename(), plOperands[0].getLine()), Error::SUCCESS);
+		}
+
+		case Opcode::OPCODE_MULTIPLY: {
+			//Multiplication -> check wether all operators are numeric values:
+			short int nReturnType = plOperands[0].getType(); //Stores, wether an integer or double should be returned.
+			for (unsigned int i = 0; i < plOperands.size(); i++) {
+				if (plOperands[i].getType() != Token::U_INT && plOperands[i].getType() != Token::U_DOUBLE) {
+					//Error: Cannot multiply with non-numeric-values:
+					return CRV<CToken>(plOperands[i], Error::Interpreter::CANNOT_MULTIPLY_NON_NUMERIC_VALUES);
+				}
+				else if (plOperands[i].getType() == Token::U_DOUBLE) {
+					nReturnType = Token::U_DOUBLE;
+				}
+			}
+
+			//Multiply:
+			CRV<string> rvReduction = reduction.reduce(Opcode::OPCODE_MULTIPLY, nReturnType, plOperands);
+			if (rvReduction.getErrorMessage() == Error::SUCCESS) {
+				return CRV<CToken>(CToken(rvReduction.getContent(), nReturnType, plOperands[0].getFilename(), plOperands[0].getLine()), Error::SUCCESS);
+			}
+			string sReturnValue = ""; //Stores the result of the multiplication as string.
+			sReturnValue = plOperands[0].getLexeme();
+			for (unsigned int i = 1; i < plOperands.size(); i++) {
+				if (nReturnType == Token::U_INT) {
+					sReturnValue = to_string(stoi(sReturnValue) * stoi(plOperands[i].getLexeme()));
+				}
+				else if (nReturnType == Token::U_DOUBLE) {
+					sReturnValue = to_string(stod(sReturnValue) * stod(plOperands[i].getLexeme()));
+				}
+			}
+			return CRV<CToken>(CToken(sReturnValue, nReturnType, plOperands[0].getFilename(), plOperands[0].getLine()), Error::SUCCESS);
+		}
+
+		case Opcode::OPCODE_DIVIDE: {
+			//Division -> check wether all operators are numeric values:
+			for (unsigned int i = 0; i < plOperands.size(); i++) {
+				if (plOperands[i].getType() != Token::U_INT && plOperands[i].getType() != Token::U_DOUBLE) {
+					//Error: Cannot divide non-numeric values:
+					return CRV<CToken>(plOperands[i], Error::Interpreter::CANNOT_DIVIDE_NON_NUMERIC_VALUES);
+				}
+				else if (i >= 1 && stod(plOperands[i].getLexeme()) == 0) {
+					//Error: Cannot divide by zero:
+					return CRV<CToken>(plOperands[i], Error::Interpreter::CANNOT_DIVIDE_BY_ZERO);
+				}
+			}
+
+			//Divide:
+			string sReturnValue = ""; //Stores the result of the division as string.
+			sReturnValue = plOperands[0].getLexeme();
+			for (unsigned int i = 1; i < plOperands.size(); i++) {
+				sReturnValue = to_string(stod(sReturnValue) / stod(plOperands[i].getLexeme()));
+			}
+			return CRV<CToken>(CToken(sReturnValue, Token::U_DOUBLE, plOperands[0].getFilename(), plOperands[0].getLine()), Error::SUCCESS);
+		}
+
+		case Opcode::OPCODE_EQUAL: {
+			//Equal to:
+			if (pHeadNode.getArityError() != Error::SUCCESS) {
+				//Error: Relational operations do only work with exactly 2 operators:
+				return CRV<CToken>(pHeadNode, pHeadNode.getArityError());
+			}
+			CToken firstOperand = plOperands[0]; //Stores the first operand.
+			CToken secondOperand = plOperands[1]; //Stores the second operand.
+			if (firstOperand.getType() != secondOperand.getType() && !((firstOperand.getType() == Token::U_INT && secondOperand.getType() == Token::U_DOUBLE) || (firstOperand.getType() == Token::U_DOUBLE && secondOperand.getType() == Token::U_INT))) {
+				//Error operands are of different type:
+				return CRV<CToken>(pHeadNode, Error::produceConvertError(firstOperand.getType(), secondOperand.getType()));
+			}
+			if (firstOperand.getLexeme() == secondOperand.getLexeme()) {
+				//Lexemes of operands are identical:
+				return CRV<CToken>(CToken("t", Token::U_BOOL, pHeadNode.getFilename(), pHeadNode.getLine()), Error::SUCCESS);
+			}
+			else if (firstOperand.getType() == Token::U_INT || secondOperand.getType() == Token::U_INT || firstOperand.getType() == Token::U_DOUBLE || secondOperand.getType() == Token::U_DOUBLE) {
+				//Operands are of numerical type (This can be done this way, since the aforeimplemented if-clause makes sure that all the operands are comparable with
+				//each other, so if this condition is true, each operand is of numerical type. Therefore, they can be compared):
+				double val1 = stod(firstOperand.getLexeme());
+				double val2 = stod(secondOperand.getLexeme());
+				//Compare the two values:
+				if (val1 == val2) {
+					//The two operands are identical:
+					return CRV<CToken>(CToken("t", Token::U_BOOL, pHeadNode.getFilename(), pHeadNode.getLine()), Error::SUCCESS);
+				}
+				else {
+					return CRV<CToken>(CToken("nil", Token::U_BOOL, pHeadNode.getFilename(), pHeadNode.getLine()), Error::SUCCESS);
+				}
+			}
+			else {
+				//Operands are not identical:
+				return CRV<CToken>(CToken("nil", Token::U_BOOL, pHeadNode.getFilename(), pHeadNode.getLine()), Error::SUCCESS);
+			}
+		}
+
+		case Opcode::OPCODE_NOT_EQUAL: {
+			//Not equal to:
+			if (pHeadNode.getArityError() != Error::SUCCESS) {
+				//Error: Relational operations do only work with exactly 2 operators:
+				return CRV<CToken>(pHeadNode, pHeadNode.getArityError());
+			}
+			CToken firstOperand = plOperands[0]; //Stores the first operand.
+			CToken secondOperand = plOperands[1]; //Stores the second operand.
+			if (firstOperand.getType() != secondOperand.getType() && !((firstOperand.getType() == Token::U_INT && secondOperand.getType() == Token::U_DOUBLE) || (firstOperand.getType() == Token::U_DOUBLE && secondOperand.getType() == Token::U_INT))) {
+				//Error operands are of different type:
+				return CRV<CToken>(pHeadNode, Error::produceConvertError(firstOperand.getType(), secondOperand.getType()));
+			}
+			if (firstOperand.getLexeme() != secondOperand.getLexeme()) {
+				//Operands are not identical:
+				return CRV<CToken>(CToken("t", Token::U_BOOL, pHeadNode.getFilename(), pHeadNode.getLine()), Error::SUCCESS);
+			}
+			else {
+				//Operands are identical:
+				return CRV<CToken>(CToken("nil", Token::U_BOOL, pHeadNode.getFilename(), pHeadNode.getLine()), Error::SUCCESS);
+			}
+		}
+		case Opcode::OPCODE_GREATER:
+		case Opcode::OPCODE_LESS:
+		case Opcode::OPCODE_GREATER_EQUAL:
+		case Opcode::OPCODE_LESS_EQUAL: {
+			if (pHeadNode.getArityError() != Error::SUCCESS) {
+				//Error: Relational operations do only work with exactly 2 operators:
+				return CRV<CToken>(pHeadNode, pHeadNode.getArityError());
+			}
+			CToken firstOperand = plOperands[0]; //Stores the first operand.
+			CToken secondOperand = plOperands[1]; //Stores the second operand.
+			//For every other relational operation, the operands must either be an integer or a double:
+			if (firstOperand.getType() != Token::U_INT && firstOperand.getType() != Token::U_DOUBLE) {
+				//Error: The first operand is no number:
+				return CRV<CToken>(firstOperand, Error::produceConvertError(firstOperand.getType(), Token::U_DOUBLE));
+			}
+			else if (secondOperand.getType() != Token::U_INT && secondOperand.getType() != Token::U_DOUBLE) {
+				//Error: The second operand is no number:
+				return CRV<CToken>(secondOperand, Error::produceConvertError(secondOperand.getType(), Token::U_DOUBLE));
+			}
+			double nVal1 = stod(firstOperand.getLexeme()); //Stores the first operand as double-value.
+			double nVal2 = stod(secondOperand.getLexeme()); //Stores the second operand as double-value.
+
+			bool bResult = false; //Stores the result of the relational operation.
+			switch (pHeadNode.getOpcode()) {
+			case Opcode::OPCODE_GREATER:
+				//Greater than:
+				bResult = nVal1 > nVal2;
+				break;
+			case Opcode::OPCODE_LESS:
+				//Less than:
+				bResult = nVal1 < nVal2;
+				break;
+			case Opcode::OPCODE_GREATER_EQUAL:
+				//Greater or equal than:
+				bResult = nVal1 >= nVal2;
+				break;
+			default:
+				//Less or equal than:
+				bResult = nVal1 <= nVal2;
+				break;
+			}
+			return CRV<CToken>(CToken(bResult ? "t" : "nil", Token::U_BOOL, pHeadNode.getFilename(), pHeadNode.getLine()), Error::SUCCESS);
+		}
+
+		case Opcode::OPCODE_AND:
+			//Boolean operation:
+			if (pHeadNode.getArityError() != Error::SUCCESS) {
+				//Error: Boolean operation must contain at least two arguments:
+				return CRV<CToken>(pHeadNode, pHeadNode.getArityError());
+			}
+			//All operands must be "t":
+			for (unsigned int i = 0; i < plOperands.size(); i++) {
+				if (plOperands[i].getLexeme() == "nil") {
+					//nil was found, return nil:
+					return CRV<CToken>(CToken("nil", Token::U_BOOL, pHeadNode.getFilename(), pHeadNode.getLine()), Error::SUCCESS);
+				}
+			}
+			//nil was not found, return t:
+			return CRV<CToken>(CToken("t", Token::U_BOOL, pHeadNode.getFilename(), pHeadNode.getLine()), Error::SUCCESS);
+
+		case Opcode::OPCODE_OR:
+			//Boolean operation:
+			if (pHeadNode.getArityError() != Error::SUCCESS) {
+				//Error: Boolean operation must contain at least two arguments:
+				return CRV<CToken>(pHeadNode, pHeadNode.getArityError());
+			}
+			//At least one operand must be "t":
+			for (unsigned int i = 0; i < plOperands.size(); i++) {
+				if (plOperands[i].getLexeme() == "t") {
+					//t was found, return t:
+					return CRV<CToken>(CToken("t", Token::U_BOOL, pHeadNode.getFilename(), pHeadNode.getLine()), Error::SUCCESS);
+				}
+			}
+			//t was not found, return nil:
+			return CRV<CToken>(CToken("nil", Token::U_BOOL, pHeadNode.getFilename(), pHeadNode.getLine()), Error::SUCCESS);
+
+		default:
+			//Found invalid token:
+			return CRV<CToken>(pHeadNode, Error::Interpreter::INCORRECT_TOKEN);
+		}
+
+		//Return SUCCESS -> Only needed to eliminate compiler warning. \(^_^)/
+		return CRV<CToken>(pHeadNode, Error::SUCCESS);
+	}
+
+
+
+private:
+	/**
+	* Evaluates operations, whose operands have been verified by the CTypeChecker.
+	*/
+	COperationKernels kernels;
+
+	/**
+	* Reduces long lists of numeric operands.
+	*/
+	CVectorReduction reduction;
+
+	/**
+	* Stores whether "&" and "|" stop evaluating their operands, as soon as an operand decides the result.
+	*/
+	bool bShortCircuit;
+};
@@ -0,0 +1,223 @@
+/*
+FILE:		COperationKernels.hpp
+
+REMARKS:	This file contains the class "COperationKernels", which evaluates operations, whose operand types have been
+			verified by the CTypeChecker, without checking the types of the operands again.
+*/
+#pragma once
+
+#include <iostream>
+#include <string>
+#include <type_traits>
+
+#include "CLinkedList.hpp"
+#include "CRV.hpp"
+#include "CToken.hpp"
+#include "CVectorReduction.hpp"
+#include "Variables/ErrorMessages.hpp"
+#include "Variables/OpcodeTypes.hpp"
+#include "Variables/OperationKernels.hpp"
+#include "Variables/TokenTypes.hpp"
+
+using namespace std;
+
+
+
+/**
+* The class "COperationKernels" contains one specialized kernel for every combination of operand type and operand count,
+* which is listed in "Variables/OperationKernels.hpp". The kernel of an operation is selected by the CTypeChecker and
+* stored in the head node of the operation. Since the types of the operands are already known, a kernel does not check
+* them again and walks through the operands only once. Kernels for any number of operands pass long additions, subtractions
+* and multiplications on to the CVectorReduction.
+* Every kernel produces exactly the same tokens as COperationEvaluator: Intermediate results of double-operations are
+* rounded in the same way, in which they would be rounded, if they were converted to a string between every step.
+*
+* @author	Christian-2003
+* @version	19.10.2026
+*/
+class COperationKernels {
+public:
+	/**
+	* This function applies the operator of the passed head node to the passed operands with the kernel, which is stored
+	* in the head node.
+	*
+	* @param pHeadNode	Token, which resembles the operator.
+	* @param plOperands	Evaluated operands of the operation.
+	* @return			Return value of the operation as token.
+	*/
+	CRV<CToken> evaluate(CToken& pHeadNode, CLinkedList<CToken>& plOperands) {
+		switch (pHeadNode.getKernel()) {
+		case OperationKernel::KERNEL_INT_BINARY:
+			return arithmetic<int, 2>(pHeadNode, plOperands);
+		case OperationKernel::KERNEL_INT_TERNARY:
+			return arithmetic<int, 3>(pHeadNode, plOperands);
+		case OperationKernel::KERNEL_INT_VARIADIC:
+			return arithmetic<int, 0>(pHeadNode, plOperands);
+		case OperationKernel::KERNEL_DOUBLE_BINARY:
+			return arithmetic<double, 2>(pHeadNode, plOperands);
+		case OperationKernel::KERNEL_DOUBLE_TERNARY:
+			return arithmetic<double, 3>(pHeadNode, plOperands);
+		case OperationKernel::KERNEL_DOUBLE_VARIADIC:
+			return arithmetic<double, 0>(pHeadNode, plOperands);
+		case OperationKernel::KERNEL_STRING_VARIADIC:
+			return concatenate(plOperands);
+		case OperationKernel::KERNEL_COMPARISON:
+			return compare(pHeadNode, plOperands);
+		default:
+			//Found invalid kernel:
+			return CRV<CToken>(pHeadNode, Error::Interpreter::INCORRECT_TOKEN);
+		}
+	}
+
+
+
+private:
+	/**
+	* This function selects the reduction for the operator of the passed head node.
+	*
+	* @param pHeadNode	Token, which resembles the operator.
+	* @param plOperands	Evaluated operands of the operation.
+	* @return			Return value of the operation as token.
+	*/
+	template<typename T, unsigned int ARITY>
+	CRV<CToken> arithmetic(CToken& pHeadNode, CLinkedList<CToken>& plOperands) {
+		switch (pHeadNode.getOpcode()) {
+		case Opcode::OPCODE_ADD:
+			return reduce<T, ARITY, Opcode::OPCODE_ADD>(plOperands);
+		case Opcode::OPCODE_SUBTRACT:
+			return reduce<T, ARITY, Opcode::OPCODE_SUBTRACT>(plOperands);
+		case Opcode::OPCODE_MULTIPLY:
+			return reduce<T, ARITY, Opcode::OPCODE_MULTIPLY>(plOperands);
+		case Opcode::OPCODE_DIVIDE:
+			return reduce<double, ARITY, Opcode::OPCODE_DIVIDE>(plOperands);
+		default:
+			//Found invalid token:
+			return CRV<CToken>(pHeadNode, Error::Interpreter::INCORRECT_TOKEN);
+		}
+	}
+
+	/**
+	* This function applies an arithmetic operator to the operands from left to right. The number of operands is fixed
+	* through ARITY, or any number of operands is reduced, if ARITY is 0.
+	*
+	* @param plOperands	Evaluated operands of the operation.
+	* @return			Return value of the operation as token.
+	*/
+	template<typename T, unsigned int ARITY, short int OPCODE>
+	CRV<CToken> reduce(CLinkedList<CToken>& plOperands) {
+		const short int nReturnType = is_same<T, int>::value ? Token::U_INT : Token::U_DOUBLE; //Stores the type of the result.
+		CLinkedList<CToken>::iterator operand = plOperands.begin(); //Points to the current operand.
+		CToken& firstOperand = *operand;
+		if (ARITY == 0 && plOperands.size() == 1) {
+			//A single operand is returned without being converted:
+			return CRV<CToken>(CToken(firstOperand.getLexeme(), nReturnType, firstOperand.getFilename(), firstOperand.getLine()), Error::SUCCESS);
+		}
+
+		if (ARITY == 0 && OPCODE != Opcode::OPCODE_DIVIDE) {
+			CRV<string> rvReduction = reduction.reduce(OPCODE, nReturnType, plOperands);
+			if (rvReduction.getErrorMessage() == Error::SUCCESS) {
+				return CRV<CToken>(CToken(rvReduction.getContent(), nReturnType, firstOperand.getFilename(), firstOperand.getLine()), Error::SUCCESS);
+			}
+		}
+
+		T value = parse<T>(firstOperand.getLexeme()); //Stores the intermediate result.
+		for (unsigned int i = 1; ARITY == 0 ? i < plOperands.size() : i < ARITY; i++) {
+			operand++;
+			T operandValue = parse<T>(operand->getLexeme()); //Stores the value of the current operand.
+			if (is_same<T, double>::value && i >= 2) {
+				//The interpreter rounds every intermediate result, when it is converted to a string:
+				value = parse<T>(to_string(value));
+			}
+			switch (OPCODE) {
+			case Opcode::OPCODE_ADD:
+				value = value + operandValue;
+				break;
+			case Opcode::OPCODE_SUBTRACT:
+				value = value - operandValue;
+				break;
+			case Opcode::OPCODE_MULTIPLY:
+				value = value * operandValue;
+				break;
+			default:
+				if (operandValue == 0) {
+					//Error: Cannot divide by zero:
+					return CRV<CToken>(*operand, Error::Interpreter::CANNOT_DIVIDE_BY_ZERO);
+				}
+				value = value / operandValue;
+				break;
+			}
+		}
+		return CRV<CToken>(CToken(to_string(value), nReturnType, firstOperand.getFilename(), firstOperand.getLine()), Error::SUCCESS);
+	}
+
+	/**
+	* This function converts the passed lexeme into a number of the type of the kernel.
+	*
+	* @param psLexeme	Lexeme of the number.
+	* @return			Number.
+	*/
+	template<typename T>
+	T parse(const string& psLexeme) {
+		if constexpr (is_same<T, int>::value) {
+			return stoi(psLexeme);
+		}
+		else {
+			return stod(psLexeme);
+		}
+	}
+
+	/**
+	* This function concatenates strings and characters.
+	*
+	* @param plOperands	Evaluated operands of the operation.
+	* @return			Return value of the operation as token.
+	*/
+	CRV<CToken> concatenate(CLinkedList<CToken>& plOperands) {
+		string sReturnValue = ""; //Stores the concatenated string.
+		for (CLinkedList<CToken>::iterator operand = plOperands.begin(); operand != plOperands.end(); operand++) {
+			sReturnValue += operand->getLexeme();
+		}
+		return CRV<CToken>(CToken(sReturnValue, Token::U_STRING, plOperands.front().getFilename(), plOperands.front().getLine()), Error::SUCCESS);
+	}
+
+	/**
+	* This function compares two operands, whose types can be compared without error.
+	*
+	* @param pHeadNode	Token, which resembles the operator.
+	* @param plOperands	Evaluated operands of the operation.
+	* @return			Return value of the operation as token.
+	*/
+	CRV<CToken> compare(CToken& pHeadNode, CLinkedList<CToken>& plOperands) {
+		CToken& firstOperand = plOperands.front(); //Stores the first operand.
+		CToken& secondOperand = plOperands.back(); //Stores the second operand.
+		bool bResult = false; //Stores the result of the comparison.
+		switch (pHeadNode.getOpcode()) {
+		case Opcode::OPCODE_EQUAL:
+			bResult = firstOperand.getLexeme() == secondOperand.getLexeme() || ((firstOperand.getType() == Token::U_INT || firstOperand.getType() == Token::U_DOUBLE) && stod(firstOperand.getLexeme()) == stod(secondOperand.getLexeme()));
+			break;
+		case Opcode::OPCODE_NOT_EQUAL:
+			bResult = firstOperand.getLexeme() != secondOperand.getLexeme();
+			break;
+		case Opcode::OPCODE_GREATER:
+			bResult = stod(firstOperand.getLexeme()) > stod(secondOperand.getLexeme());
+			break;
+		case Opcode::OPCODE_LESS:
+			bResult = stod(firstOperand.getLexeme()) < stod(secondOperand.getLexeme());
+			break;
+		case Opcode::OPCODE_GREATER_EQUAL:
+			bResult = stod(firstOperand.getLexeme()) >= stod(secondOperand.getLexeme());
+			break;
+		default:
+			bResult = stod(firstOperand.getLexeme()) <= stod(secondOperand.getLexeme());
+			break;
+		}
+		return CRV<CToken>(CToken(bResult ? "t" : "nil", Token::U_BOOL, pHeadNode.getFilename(), pHeadNode.getLine()), Error::SUCCESS);
+	}
+
+
+
+	/**
+	* Reduces long lists of numeric operands.
+	*/
+	CVectorReduction reduction;
+};
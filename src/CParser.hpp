@@ -9,6 +9,7 @@ REMARKS:	This file contains the class "CParser", with which an abstract syntax t
 #include <string>
 
 #include "CAbstractSyntaxTree.hpp"
+#include "CContext.hpp"
 #include "CLinkedList.hpp"
 #include "CRV.hpp"
 #include "CToken.hpp"
@@ -35,6 +36,11 @@ private:
 	*/
 	CLinkedList<CToken> lTokensObj;
 
+	/**
+	* Stores the context, into whose log the events are written.
+	*/
+	CContext context;
+
 
 
 public:
@@ -165,6 +171,15 @@ private:
 
 
 public:
+	/**
+	* This function changes the context, into whose log the events are written.
+	*
+	* @param pContext	Context of the execution.
+	*/
+	void setContext(CContext pContext) {
+		context = pContext;
+	}
+
 	/**
 	* This function starts a recursive algorithm which creates an abstract syntax tree, and returns said tree through a CRV.
 	* 
@@ -172,7 +187,7 @@ public:
 	* @return				AST that was created with the passed list of tokens.
 	*/
 	CRV<CLinkedList<CAbstractSyntaxTree<CToken>>> parse(CLinkedList<CToken> plTokensObj) {
-		logger.addEntry("Begin syntactical analysis (Parser).", LogEntryComponent::PARSER, LogEntryType::INF);
+		context.getLog().addEntry("Begin syntactical analysis (Parser).", LogEntryComponent::PARSER, LogEntryType::INF);
 		lTokensObj.clear();
 		lTokensObj.addAll(plTokensObj);
 
@@ -181,19 +196,19 @@ public:
 			CToken firstToken = lTokensObj.retrieve(0); //Removes first token (Should be opened parenthesis).
 			if (firstToken.getType() != Token::PARENTHESES_OPENED) {
 				//First token is no opened parenthesis -> Syntax error:
-				logger.addEntry_tokenException(firstToken, LogEntryComponent::PARSER, LogEntryType::FATAL, Error::Parser::SYNTAX_P, Error::generateErrorMessage(Error::Parser::SYNTAX_P));
+				context.getLog().addEntry_tokenException(firstToken, LogEntryComponent::PARSER, LogEntryType::FATAL, Error::Parser::SYNTAX_P, Error::generateErrorMessage(Error::Parser::SYNTAX_P));
 				return CRV<CLinkedList<CAbstractSyntaxTree<CToken>>>(CLinkedList<CAbstractSyntaxTree<CToken>>(), Error::Parser::SYNTAX_P); //Return empty list.
 			}
 			CRV<CAbstractSyntaxTree<CToken>> rv_parseList = parseList(); //Parses the list.
 			if (rv_parseList.getErrorMessage() != Error::SUCCESS) {
 				//An error occured:
-				logger.addEntry_tokenException(rv_parseList.getContent().getContent(), LogEntryComponent::PARSER, LogEntryType::FATAL, rv_parseList.getErrorMessage(), Error::generateErrorMessage(rv_parseList.getErrorMessage()));
+				context.getLog().addEntry_tokenException(rv_parseList.getContent().getContent(), LogEntryComponent::PARSER, LogEntryType::FATAL, rv_parseList.getErrorMessage(), Error::generateErrorMessage(rv_parseList.getErrorMessage()));
 				return CRV<CLinkedList<CAbstractSyntaxTree<CToken>>>(CLinkedList<CAbstractSyntaxTree<CToken>>(), rv_parseList.getErrorMessage());
 			}
 			lASTs.add(rv_parseList.getContent());
 		}
 
-		logger.addEntry("End syntactical analysis (Parser) successfully.", LogEntryComponent::PARSER, LogEntryType::INF);
+		context.getLog().addEntry("End syntactical analysis (Parser) successfully.", LogEntryComponent::PARSER, LogEntryType::INF);
 		return CRV<CLinkedList<CAbstractSyntaxTree<CToken>>>(lASTs, Error::SUCCESS); //Return every ast.
 	}
 };
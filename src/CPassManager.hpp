@@ -0,0 +1,432 @@
+/*
+FILE:		CPassManager.hpp
+
+REMARKS:	This file contains the class "CPassManager", which runs the optimization passes between the parser and the
+			interpreter.
+*/
+#pragma once
+
+#include <chrono>
+#include <iostream>
+#include <string>
+
+#include "CAbstractSyntaxTree.hpp"
+#include "CConstantFolder.hpp"
+#include "CContext.hpp"
+#include "CInliner.hpp"
+#include "CLinkedList.hpp"
+#include "CToken.hpp"
+#include "Variables/OptimizationLevels.hpp"
+
+using namespace std;
+
+
+
+/**
+* The class "CPassStatistics" stores the results of a single optimization pass, after it has been run by the pass manager.
+*
+* @author	Christian-2003
+* @version	19.10.2026
+*/
+class CPassStatistics {
+private:
+	/**
+	* Stores the name of the pass.
+	*/
+	string sName;
+
+	/**
+	* Stores the time (in microseconds), that the pass needed.
+	*/
+	long long nMicroseconds;
+
+	/**
+	* Stores the number of nodes, that have been changed by the pass.
+	*/
+	unsigned int nChangedNodes;
+
+	/**
+	* Stores the abstract syntax trees after the pass, if they should be dumped.
+	*/
+	CLinkedList<CAbstractSyntaxTree<CToken>> ltASTs;
+
+	/**
+	* Stores whether the abstract syntax trees after the pass should be dumped.
+	*/
+	bool bDumped;
+
+
+
+public:
+	/**
+	* The default constructor instantiates empty statistics.
+	*/
+	CPassStatistics() {
+		sName = "";
+		nMicroseconds = 0;
+		nChangedNodes = 0;
+		bDumped = false;
+	}
+
+	/**
+	* This constructor instantiates the statistics of a pass.
+	*
+	* @param psName			Name of the pass.
+	* @param pnMicroseconds	Time (in microseconds), that the pass needed.
+	* @param pnChangedNodes	Number of nodes, that have been changed by the pass.
+	*/
+	CPassStatistics(string psName, long long pnMicroseconds, unsigned int pnChangedNodes) {
+		sName = psName;
+		nMicroseconds = pnMicroseconds;
+		nChangedNodes = pnChangedNodes;
+		bDumped = false;
+	}
+
+
+
+public:
+	/**
+	* This function returns the name of the pass.
+	*
+	* @return	Name of the pass.
+	*/
+	string getName() {
+		return sName;
+	}
+
+	/**
+	* This function returns the time (in microseconds), that the pass needed.
+	*
+	* @return	Time of the pass.
+	*/
+	long long getMicroseconds() {
+		return nMicroseconds;
+	}
+
+	/**
+	* This function returns the number of nodes, that have been changed by the pass.
+	*
+	* @return	Number of changed nodes.
+	*/
+	unsigned int getChangedNodes() {
+		return nChangedNodes;
+	}
+
+	/**
+	* This function returns whether the abstract syntax trees after the pass should be dumped.
+	*
+	* @return	Whether the abstract syntax trees are dumped.
+	*/
+	bool isDumped() {
+		return bDumped;
+	}
+
+	/**
+	* This function returns the abstract syntax trees after the pass. The list is empty, if they are not dumped.
+	*
+	* @return	Abstract syntax trees after the pass.
+	*/
+	CLinkedList<CAbstractSyntaxTree<CToken>> getASTs() {
+		return ltASTs;
+	}
+
+	/**
+	* This function stores the abstract syntax trees after the pass, so that they can be dumped.
+	*
+	* @param pltASTs	Abstract syntax trees after the pass.
+	*/
+	void setASTs(CLinkedList<CAbstractSyntaxTree<CToken>> pltASTs) {
+		ltASTs = pltASTs;
+		bDumped = true;
+	}
+};
+
+
+
+/**
+* The class "CPassManager" runs an ordered list of optimization passes on the abstract syntax trees, after they have been
+* parsed and before they are executed. Every pass transforms the abstract syntax trees into equivalent abstract syntax trees,
+* which produce the same output and the same errors.
+* The passes, that are run, are selected through an optimization level ("-O0", "-O1" or "-O2"). Every pass can be disabled
+* separately, in case it misbehaves. The time and the number of changed nodes of every pass is measured, and the abstract
+* syntax trees can be dumped after any pass.
+*
+* The passes are (in the order in which they are run):
+*	- "fold" (-O1):		Operations, whose operands are values, are replaced with their result.
+*	- "inline" (-O2):	Calls of small functions, which only return an expression, are replaced with the expression.
+*	- "simplify" (-O2):	Neutral operands, if-statements and while-loops with constant conditions and unreachable statements
+*						are removed. Operations, whose operands become values through this, are folded as well.
+*
+* @author	Christian-2003
+* @version	19.10.2026
+*/
+class CPassManager {
+private:
+	/**
+	* Stores the names of every pass in the order, in which they are run.
+	*/
+	CLinkedList<string> lsPasses;
+
+	/**
+	* Stores the lowest optimization level, at which the pass at the same index of "lsPasses" is run.
+	*/
+	CLinkedList<short int> lnLevels;
+
+	/**
+	* Stores the current optimization level.
+	*/
+	short int nOptimizationLevel;
+
+	/**
+	* Stores the names of the passes, which are disabled.
+	*/
+	CLinkedList<string> lsDisabled;
+
+	/**
+	* Stores the names of the passes, after which the abstract syntax trees are dumped.
+	*/
+	CLinkedList<string> lsDumped;
+
+	/**
+	* Stores the statistics of every pass, that has been run by the latest call of "run()".
+	*/
+	CLinkedList<CPassStatistics> lStatistics;
+
+	/**
+	* Stores the context, into whose log the statistics of the passes are written.
+	*/
+	CContext context;
+
+
+
+public:
+	/**
+	* The default constructor instantiates a new pass manager with the highest optimization level.
+	*/
+	CPassManager() {
+		lsPasses.add("fold");
+		lnLevels.add(OptimizationLevel::OPTIMIZATION_BASIC);
+		lsPasses.add("inline");
+		lnLevels.add(OptimizationLevel::OPTIMIZATION_FULL);
+		lsPasses.add("simplify");
+		lnLevels.add(OptimizationLevel::OPTIMIZATION_FULL);
+		nOptimizationLevel = OptimizationLevel::OPTIMIZATION_FULL;
+	}
+
+
+
+public:
+	/**
+	* This function runs every enabled pass on the passed abstract syntax trees.
+	*
+	* @param pltASTs	List of abstract syntax trees, which resemble Lisp-functions.
+	* @return			Optimized abstract syntax trees.
+	*/
+	CLinkedList<CAbstractSyntaxTree<CToken>> run(CLinkedList<CAbstractSyntaxTree<CToken>> pltASTs) {
+		lStatistics.clear();
+		for (unsigned int i = 0; i < lsPasses.size(); i++) {
+			string sPass = lsPasses[i];
+			if (!isEnabled(sPass)) {
+				continue;
+			}
+			chrono::steady_clock::time_point begin = chrono::steady_clock::now();
+			unsigned int nChangedNodes = 0;
+			pltASTs = runPass(sPass, pltASTs, nChangedNodes);
+			long long nMicroseconds = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - begin).count();
+
+			CPassStatistics statistics(sPass, nMicroseconds, nChangedNodes);
+			if (contains(lsDumped, sPass)) {
+				statistics.setASTs(pltASTs);
+			}
+			lStatistics.add(statistics);
+			context.getLog().addEntry("Pass \"" + sPass + "\" changed " + to_string(nChangedNodes) + " nodes in " + to_string(nMicroseconds) + " microseconds.", LogEntryComponent::INTERPRETER, LogEntryType::INF);
+		}
+		return pltASTs;
+	}
+
+	/**
+	* This function returns the statistics of every pass, that has been run by the latest call of "run()".
+	*
+	* @return	Statistics of the passes.
+	*/
+	CLinkedList<CPassStatistics> getStatistics() {
+		return lStatistics;
+	}
+
+
+
+public:
+	/**
+	* This function changes the context, into whose log the statistics of the passes are written.
+	*
+	* @param pContext	Context of the execution.
+	*/
+	void setContext(CContext pContext) {
+		context = pContext;
+	}
+
+	/**
+	* This function returns the names of every pass in the order, in which they are run.
+	*
+	* @return	Names of the passes.
+	*/
+	CLinkedList<string> getPasses() {
+		return lsPasses;
+	}
+
+	/**
+	* This function returns whether a pass with the passed name exists.
+	*
+	* @param psPass	Name of the pass.
+	* @return		Whether the pass exists.
+	*/
+	bool hasPass(string psPass) {
+		return contains(lsPasses, psPass);
+	}
+
+	/**
+	* This function returns the lowest optimization level, at which the passed pass is run.
+	*
+	* @param psPass	Name of the pass.
+	* @return		Optimization level of the pass.
+	*/
+	short int getLevel(string psPass) {
+		for (unsigned int i = 0; i < lsPasses.size(); i++) {
+			if (lsPasses[i] == psPass) {
+				return lnLevels[i];
+			}
+		}
+		return OptimizationLevel::OPTIMIZATION_NONE;
+	}
+
+	/**
+	* This function returns the current optimization level.
+	*
+	* @return	Optimization level.
+	*/
+	short int getOptimizationLevel() {
+		return nOptimizationLevel;
+	}
+
+	/**
+	* This function changes the optimization level.
+	*
+	* @param pnOptimizationLevel	New optimization level.
+	*/
+	void setOptimizationLevel(short int pnOptimizationLevel) {
+		nOptimizationLevel = pnOptimizationLevel;
+	}
+
+	/**
+	* This function returns whether the passed pass is run at the current optimization level and is not disabled.
+	*
+	* @param psPass	Name of the pass.
+	* @return		Whether the pass is run.
+	*/
+	bool isEnabled(string psPass) {
+		return hasPass(psPass) && getLevel(psPass) <= nOptimizationLevel && !contains(lsDisabled, psPass);
+	}
+
+	/**
+	* This function returns whether the passed pass has been disabled.
+	*
+	* @param psPass	Name of the pass.
+	* @return		Whether the pass is disabled.
+	*/
+	bool isDisabled(string psPass) {
+		return contains(lsDisabled, psPass);
+	}
+
+	/**
+	* This function disables or enables the passed pass. An enabled pass is only run, if the optimization level is high enough.
+	*
+	* @param psPass		Name of the pass.
+	* @param pbDisabled	Whether the pass should be disabled.
+	*/
+	void setDisabled(string psPass, bool pbDisabled) {
+		lsDisabled = update(lsDisabled, psPass, pbDisabled);
+	}
+
+	/**
+	* This function returns whether the abstract syntax trees are dumped after the passed pass.
+	*
+	* @param psPass	Name of the pass.
+	* @return		Whether the abstract syntax trees are dumped.
+	*/
+	bool isDumped(string psPass) {
+		return contains(lsDumped, psPass);
+	}
+
+	/**
+	* This function changes whether the abstract syntax trees are dumped after the passed pass.
+	*
+	* @param psPass		Name of the pass.
+	* @param pbDumped	Whether the abstract syntax trees should be dumped.
+	*/
+	void setDumped(string psPass, bool pbDumped) {
+		lsDumped = update(lsDumped, psPass, pbDumped);
+	}
+
+
+
+private:
+	/**
+	* This function runs a single pass.
+	*
+	* @param psPass			Name of the pass.
+	* @param pltASTs		Abstract syntax trees, on which the pass is run.
+	* @param pnChangedNodes	Number of nodes, that have been changed by the pass.
+	* @return				Transformed abstract syntax trees.
+	*/
+	CLinkedList<CAbstractSyntaxTree<CToken>> runPass(string psPass, CLinkedList<CAbstractSyntaxTree<CToken>> pltASTs, unsigned int& pnChangedNodes) {
+		if (psPass == "fold" || psPass == "simplify") {
+			CConstantFolder folder;
+			folder.setSimplification(psPass == "simplify");
+			pltASTs = folder.fold(pltASTs);
+			pnChangedNodes = folder.getChangedNodes();
+		}
+		else if (psPass == "inline") {
+			CInliner inliner;
+			pltASTs = inliner.inlineCalls(pltASTs);
+			pnChangedNodes = inliner.getChangedNodes();
+		}
+		return pltASTs;
+	}
+
+	/**
+	* This function returns whether the passed list contains the passed name.
+	*
+	* @param plsNames	List of names.
+	* @param psName		Name, which should be found.
+	* @return			Whether the name is contained.
+	*/
+	bool contains(CLinkedList<string> plsNames, string psName) {
+		for (unsigned int i = 0; i < plsNames.size(); i++) {
+			if (plsNames[i] == psName) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	/**
+	* This function adds the passed name to the list or removes it from the list.
+	*
+	* @param plsNames	List of names.
+	* @param psName		Name, which should be added or removed.
+	* @param pbContained	Whether the list should contain the name.
+	* @return			Changed list.
+	*/
+	CLinkedList<string> update(CLinkedList<string> plsNames, string psName, bool pbContained) {
+		for (unsigned int i = 0; i < plsNames.size(); i++) {
+			if (plsNames[i] == psName) {
+				plsNames.remove(i);
+				break;
+			}
+		}
+		if (pbContained) {
+			plsNames.add(psName);
+		}
+		return plsNames;
+	}
+};
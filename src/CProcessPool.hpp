@@ -0,0 +1,379 @@
+/*
+FILE:		CProcessPool.hpp
+
+REMARKS:	This file contains the class "CProcessPool", which executes files in a fixed number of worker processes, so that
+			a file, which crashes it's process, cannot take down the other files.
+*/
+#pragma once
+
+#include <iostream>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <cerrno>
+#include <csignal>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+#include "CSocket.hpp"
+#include "Variables/ErrorMessages.hpp"
+
+using namespace std;
+
+
+
+/**
+* The class "CProcessPool" forks a fixed number of worker processes, each of which is connected to the coordinating process
+* through a Unix domain socket. A worker, which has finished a file, sends the status, the time and the output of the file
+* back to the coordinator, which answers with the next file of the queue. Therefore, a worker only receives a new file
+* once it is idle, and fast workers execute more files than slow ones.
+* If a worker crashes, the coordinator notices the closed socket, marks the file, which the worker executed, with
+* Error::Interpreter::PROCESS_CRASHED and forks a new worker, which continues with the remaining files.
+* Messages consist of a header with integers of fixed width followed by the path or the output. Since the workers are
+* forked from the coordinator, they share it's configuration and need no executable of their own.
+* Processes can only be forked on POSIX-systems. On MS Windows, "isSupported()" returns false and no file is executed.
+*
+* @author	Christian-2003
+* @version	19.10.2026
+*/
+class CProcessPool {
+private:
+	/**
+	* The class "CWorker" stores a single worker process.
+	*/
+	class CWorker {
+	public:
+		/**
+		* Stores the process ID of the worker.
+		*/
+		long long nProcess;
+
+		/**
+		* Stores the socket of the coordinator, through which it communicates with the worker.
+		*/
+		int nSocket;
+
+		/**
+		* Stores the index of the file, which the worker executes (-1, if the worker is idle).
+		*/
+		long long nFile;
+
+		/**
+		* Stores the time, at which the file has been sent to the worker.
+		*/
+		chrono::steady_clock::time_point begin;
+	};
+
+	/**
+	* The struct "SRequest" stores the header of a file, which is sent to a worker.
+	*/
+	struct SRequest {
+		uint64_t nFile; //Stores the index of the file.
+		uint32_t nLength; //Stores the length of the path.
+	};
+
+	/**
+	* The struct "SResponse" stores the header of a result, which is sent to the coordinator.
+	*/
+	struct SResponse {
+		uint64_t nFile; //Stores the index of the file.
+		int64_t nMicroseconds; //Stores the time, which the file needed.
+		int32_t nStatus; //Stores the error message of the file.
+		uint32_t nLength; //Stores the length of the output.
+	};
+
+
+
+private:
+	/**
+	* Stores the function, which executes a file (passed as first argument) within a worker and writes the output into the
+	* second argument.
+	*/
+	function<short int(const string&, string&)> execute;
+
+	/**
+	* Stores every worker process.
+	*/
+	vector<CWorker> vWorkers;
+
+	/**
+	* Stores the number of workers, which have been forked again after they crashed.
+	*/
+	unsigned int nRespawns;
+
+
+
+public:
+	/**
+	* This constructor instantiates a new process pool. The workers are forked, once files are executed.
+	*
+	* @param pnProcesses	Number of worker processes (at least 1).
+	* @param pExecute		Function, which executes a file within a worker and returns it's error message.
+	*/
+	CProcessPool(unsigned int pnProcesses, function<short int(const string&, string&)> pExecute) : execute(pExecute) {
+		vWorkers.resize(pnProcesses > 0 ? pnProcesses : 1);
+		for (size_t i = 0; i < vWorkers.size(); i++) {
+			vWorkers[i].nProcess = -1;
+			vWorkers[i].nSocket = -1;
+			vWorkers[i].nFile = -1;
+		}
+		nRespawns = 0;
+	}
+
+	/**
+	* The destructor closes the sockets of the workers, which exit thereupon, and waits for them.
+	*/
+	~CProcessPool() {
+		for (size_t i = 0; i < vWorkers.size(); i++) {
+			stop(vWorkers[i]);
+		}
+	}
+
+
+
+public:
+	/**
+	* Returns whether worker processes can be forked on this platform.
+	*
+	* @return	Whether the process pool is supported.
+	*/
+	static bool isSupported() {
+#if defined(_WIN32)
+		return false;
+#else
+		return true;
+#endif
+	}
+
+	/**
+	* This function executes the passed files on the workers. The results are stored at the index of the file.
+	*
+	* @param pvsFiles		Files, which are executed.
+	* @param pvnStatus		Error message of every file.
+	* @param pvnTimes		Time in microseconds, which every file needed within it's worker.
+	* @param pvsOutputs		Output of every file.
+	* @return				Whether the files have been executed (false, if no worker could be forked).
+	*/
+	bool run(const vector<string>& pvsFiles, vector<short int>& pvnStatus, vector<long long>& pvnTimes, vector<string>& pvsOutputs) {
+		pvnStatus.assign(pvsFiles.size(), Error::SUCCESS);
+		pvnTimes.assign(pvsFiles.size(), 0);
+		pvsOutputs.assign(pvsFiles.size(), "");
+#if defined(_WIN32)
+		return false;
+#else
+		for (size_t i = 0; i < vWorkers.size(); i++) {
+			if (vWorkers[i].nSocket < 0 && !start(vWorkers[i])) {
+				return false;
+			}
+		}
+		size_t nNext = 0; //Stores the index of the next file, which is sent to a worker.
+		size_t nFinished = 0; //Stores the number of files, whose results have been received.
+		for (size_t i = 0; i < vWorkers.size() && nNext < pvsFiles.size(); i++) {
+			assign(vWorkers[i], pvsFiles, nNext, pvnStatus, pvsOutputs, nFinished);
+		}
+		vector<pollfd> vSockets(vWorkers.size()); //Stores the sockets, on which results are awaited.
+		while (nFinished < pvsFiles.size()) {
+			for (size_t i = 0; i < vWorkers.size(); i++) {
+				vSockets[i].fd = vWorkers[i].nFile >= 0 ? vWorkers[i].nSocket : -1;
+				vSockets[i].events = POLLIN;
+				vSockets[i].revents = 0;
+			}
+			if (poll(vSockets.data(), vSockets.size(), -1) < 0) {
+				if (errno == EINTR) {
+					continue;
+				}
+				return false;
+			}
+			for (size_t i = 0; i < vWorkers.size(); i++) {
+				if (vSockets[i].fd < 0 || vSockets[i].revents == 0) {
+					continue;
+				}
+				CWorker& worker = vWorkers[i];
+				SResponse response;
+				string sOutput = "";
+				if (CSocket::receive(worker.nSocket, &response, sizeof(response)) && CSocket::receiveString(worker.nSocket, response.nLength, sOutput)) {
+					pvnStatus[response.nFile] = (short int)response.nStatus;
+					pvnTimes[response.nFile] = response.nMicroseconds;
+					pvsOutputs[response.nFile] = move(sOutput);
+				}
+				else {
+					//The worker crashed while executing the file:
+					int nSignal = stop(worker);
+					pvnStatus[worker.nFile] = Error::Interpreter::PROCESS_CRASHED;
+					pvnTimes[worker.nFile] = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - worker.begin).count();
+					pvsOutputs[worker.nFile] = nSignal > 0 ? "The process has been terminated by signal " + to_string(nSignal) + ".\n" : "The process has exited unexpectedly.\n";
+					if (!start(worker)) {
+						return false;
+					}
+					nRespawns++;
+				}
+				worker.nFile = -1;
+				nFinished++;
+				if (nNext < pvsFiles.size()) {
+					assign(worker, pvsFiles, nNext, pvnStatus, pvsOutputs, nFinished);
+				}
+			}
+		}
+		return true;
+#endif
+	}
+
+	/**
+	* Returns the number of worker processes.
+	*
+	* @return	Number of workers.
+	*/
+	unsigned int getProcesses() {
+		return vWorkers.size();
+	}
+
+	/**
+	* Returns the number of workers, which have been forked again after they crashed.
+	*
+	* @return	Number of respawned workers.
+	*/
+	unsigned int getRespawns() {
+		return nRespawns;
+	}
+
+
+
+#if !defined(_WIN32)
+private:
+	/**
+	* This function forks a new worker process, which executes files until it's socket is closed.
+	*
+	* @param pWorker	Worker, which is started.
+	* @return			Whether the worker has been forked.
+	*/
+	bool start(CWorker& pWorker) {
+		int vnSockets[2]; //Stores both ends of the socket.
+		if (socketpair(AF_UNIX, SOCK_STREAM, 0, vnSockets) != 0) {
+			return false;
+		}
+		//Buffered output would be printed by the coordinator and by the worker:
+		cout.flush();
+		cerr.flush();
+		pid_t nProcess = fork();
+		if (nProcess < 0) {
+			close(vnSockets[0]);
+			close(vnSockets[1]);
+			return false;
+		}
+		if (nProcess == 0) {
+			//Within the worker:
+			close(vnSockets[0]);
+			for (size_t i = 0; i < vWorkers.size(); i++) {
+				if (vWorkers[i].nSocket >= 0) {
+					close(vWorkers[i].nSocket);
+				}
+			}
+			serve(vnSockets[1]);
+			_exit(0);
+		}
+		close(vnSockets[1]);
+		pWorker.nProcess = nProcess;
+		pWorker.nSocket = vnSockets[0];
+		pWorker.nFile = -1;
+		return true;
+	}
+
+	/**
+	* This function closes the socket of the passed worker and waits until the worker has exited.
+	*
+	* @param pWorker	Worker, which is stopped.
+	* @return			Signal, which terminated the worker (0, if the worker exited).
+	*/
+	int stop(CWorker& pWorker) {
+		if (pWorker.nSocket < 0) {
+			return 0;
+		}
+		close(pWorker.nSocket);
+		int nStatus = 0; //Stores the exit status of the worker.
+		while (waitpid((pid_t)pWorker.nProcess, &nStatus, 0) < 0 && errno == EINTR);
+		pWorker.nProcess = -1;
+		pWorker.nSocket = -1;
+		return WIFSIGNALED(nStatus) ? WTERMSIG(nStatus) : 0;
+	}
+
+	/**
+	* This function sends the next file of the queue to the passed worker. If the worker crashed before it received the
+	* file, it is forked again and the file is sent once more.
+	*
+	* @param pWorker		Idle worker.
+	* @param pvsFiles		Files, which are executed.
+	* @param pnNext			Index of the next file, which is incremented.
+	* @param pvnStatus		Error message of every file.
+	* @param pvsOutputs		Output of every file.
+	* @param pnFinished		Number of finished files, which is incremented, if the file cannot be sent.
+	*/
+	void assign(CWorker& pWorker, const vector<string>& pvsFiles, size_t& pnNext, vector<short int>& pvnStatus, vector<string>& pvsOutputs, size_t& pnFinished) {
+		size_t nFile = pnNext++;
+		SRequest request;
+		request.nFile = nFile;
+		request.nLength = pvsFiles[nFile].size();
+		for (unsigned int nAttempt = 0; nAttempt < 2; nAttempt++) {
+			if (CSocket::transmit(pWorker.nSocket, &request, sizeof(request)) && CSocket::transmit(pWorker.nSocket, pvsFiles[nFile].data(), pvsFiles[nFile].size())) {
+				pWorker.nFile = nFile;
+				pWorker.begin = chrono::steady_clock::now();
+				return;
+			}
+			//The worker is no longer running:
+			stop(pWorker);
+			if (!start(pWorker)) {
+				break;
+			}
+			nRespawns++;
+		}
+		pvnStatus[nFile] = Error::Interpreter::PROCESS_CRASHED;
+		pvsOutputs[nFile] = "The file could not be sent to a process.\n";
+		pnFinished++;
+	}
+
+	/**
+	* This function is executed by a worker. It receives files through the passed socket and sends the results back,
+	* until the coordinator closes the socket.
+	*
+	* @param pnSocket	Socket of the worker.
+	*/
+	void serve(int pnSocket) {
+		SRequest request;
+		while (CSocket::receive(pnSocket, &request, sizeof(request))) {
+			string sFile = "";
+			if (!CSocket::receiveString(pnSocket, request.nLength, sFile)) {
+				return;
+			}
+			string sOutput = "";
+			chrono::steady_clock::time_point begin = chrono::steady_clock::now();
+			short int nStatus = execute(sFile, sOutput);
+			SResponse response;
+			response.nFile = request.nFile;
+			response.nMicroseconds = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - begin).count();
+			response.nStatus = nStatus;
+			response.nLength = sOutput.size();
+			if (!CSocket::transmit(pnSocket, &response, sizeof(response)) || !CSocket::transmit(pnSocket, sOutput.data(), sOutput.size())) {
+				return;
+			}
+		}
+	}
+#else
+private:
+	/**
+	* Workers cannot be forked on MS Windows, therefore there is nothing to stop.
+	*
+	* @param pWorker	Worker, which is stopped.
+	* @return			Always 0.
+	*/
+	int stop(CWorker& pWorker) {
+		return 0;
+	}
+#endif
+};
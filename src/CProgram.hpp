@@ -0,0 +1,289 @@
+/*
+FILE:		CProgram.hpp
+
+REMARKS:	This file contains the class "CProgram", which stores the prepared functions of Lisp-sourcecode, so that they
+			can be executed multiple times without preparing the sourcecode again.
+*/
+#pragma once
+
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "CAbstractSyntaxTree.hpp"
+#include "CArgumentScheduler.hpp"
+#include "CContext.hpp"
+#include "CFunction.hpp"
+#include "CLinkedList.hpp"
+#include "CLoopChecker.hpp"
+#include "COpcodeResolver.hpp"
+#include "CParser.hpp"
+#include "CPassManager.hpp"
+#include "CRV.hpp"
+#include "CSourceAnalyzer.hpp"
+#include "CToken.hpp"
+#include "CTokenizer.hpp"
+#include "CTypeChecker.hpp"
+#include "Variables/ErrorMessages.hpp"
+#include "Variables/ExecutionModes.hpp"
+#include "Variables/OpcodeTypes.hpp"
+
+using namespace std;
+
+
+
+/**
+* The class "CProgram" stores everything, that the interpreter prepares before it executes sourcecode: The opcodes of every
+* node are resolved, the types are checked, the loops are validated, the arguments, which can be evaluated in parallel,
+* are marked and every abstract syntax tree is converted into a function. Furthermore, the program knows which functions
+* are pure and whether it uses tasks, loops or channels.
+* A program is prepared once, either from sourcecode (see "load()") or from abstract syntax trees (see "prepare()"), and
+* can afterwards be executed by any number of interpreters, which call the main-function or any other function. Once it
+* is prepared, the program is not changed anymore, therefore the interpreters of multiple threads share a single program
+* by reference and only store their variables and output themselves.
+*
+* @author	Christian-2003
+* @version	19.10.2026
+*/
+class CProgram {
+private:
+	/**
+	* Stores every function of the program.
+	*/
+	CLinkedList<CFunction> lFunctions;
+
+	/**
+	* Stores a pointer to every function of "lFunctions", so that a function is found through it's index without walking
+	* the list.
+	*/
+	vector<const CFunction*> vpFunctions;
+
+	/**
+	* Stores the index of every function by it's name. If multiple functions have the same name, the first one is stored.
+	*/
+	unordered_map<string, unsigned int> mFunctionIndices;
+
+	/**
+	* Stores whether each function is pure (see CSourceAnalyzer).
+	*/
+	vector<bool> vbPureFunctions;
+
+	/**
+	* Stores whether the program spawns or awaits tasks or contains parallel loops.
+	*/
+	bool bUsesTasks;
+
+	/**
+	* Stores whether the program contains counted loops or channels.
+	*/
+	bool bUsesLoops;
+
+
+
+public:
+	/**
+	* The default constructor instantiates a new program without functions.
+	*/
+	CProgram() {
+		bUsesTasks = false;
+		bUsesLoops = false;
+	}
+
+	/**
+	* Programs cannot be copied, since they are shared by reference and the index points into the list of functions.
+	*/
+	CProgram(const CProgram&) = delete;
+	CProgram& operator=(const CProgram&) = delete;
+
+
+
+public:
+	/**
+	* This function tokenizes, parses and optimizes the passed sourcecode and prepares the resulting abstract syntax trees.
+	*
+	* @param psSourcecode	Sourcecode of the program.
+	* @param psFilename		Name, which is shown with the errors of the sourcecode.
+	* @param pContext		Context, which provides the log and the configuration.
+	* @param pPassManager	Pass manager, which optimizes the abstract syntax trees.
+	* @return				Error message and the token, which caused it.
+	*/
+	CRV<CToken> load(string psSourcecode, string psFilename, CContext pContext, CPassManager pPassManager) {
+		CTokenizer tokenizer;
+		tokenizer.setContext(pContext);
+		CRV<CLinkedList<CToken>> rvTokens = tokenizer.tokenize(psSourcecode, psFilename);
+		if (rvTokens.getErrorMessage() != Error::SUCCESS) {
+			//An error occured:
+			return CRV<CToken>(rvTokens.getContent()[rvTokens.getContent().size() - 1], rvTokens.getErrorMessage());
+		}
+		CParser parser;
+		parser.setContext(pContext);
+		CRV<CLinkedList<CAbstractSyntaxTree<CToken>>> rvAST = parser.parse(rvTokens.getContent());
+		if (rvAST.getErrorMessage() != Error::SUCCESS) {
+			//An error occured:
+			return CRV<CToken>(rvAST.getContent()[0].getContent(), rvAST.getErrorMessage());
+		}
+		pPassManager.setContext(pContext);
+		return prepare(pPassManager.run(rvAST.getContent()), pContext);
+	}
+
+	/**
+	* This function prepares the passed abstract syntax trees, each of which resembles a function.
+	*
+	* @param pltASTs	Abstract syntax trees of the program.
+	* @param pContext	Context, which provides the log and the execution mode.
+	* @return			Error message and the token, which caused it.
+	*/
+	CRV<CToken> prepare(CLinkedList<CAbstractSyntaxTree<CToken>> pltASTs, CContext pContext) {
+		lFunctions.clear();
+		vpFunctions.clear();
+		mFunctionIndices.clear();
+		vbPureFunctions.clear();
+		//Stamp every node with it's opcode, so that the nodes are dispatched without comparing their lexemes:
+		COpcodeResolver resolver;
+		pltASTs = resolver.resolve(pltASTs);
+		pContext.getLog().addEntry("Opcodes of " + to_string(resolver.getResolvedNodes()) + " nodes resolved.", LogEntryComponent::INTERPRETER, LogEntryType::INF);
+		//Check the types of every expression, so that the runtime checks of the verified nodes can be skipped:
+		CTypeChecker checker;
+		pltASTs = checker.check(pltASTs);
+		CLinkedList<CRV<CToken>> lTypeErrors = checker.getErrors(); //Stores the errors, which are found by the type checker.
+		for (unsigned int i = 0; i < lTypeErrors.size(); i++) {
+			pContext.getLog().addEntry_tokenException(lTypeErrors[i].getContent(), LogEntryComponent::INTERPRETER, LogEntryType::WARN, lTypeErrors[i].getErrorMessage(), Error::generateErrorMessage(lTypeErrors[i].getErrorMessage()));
+		}
+		pContext.getLog().addEntry("Type checker verified " + to_string(checker.getVerifiedNodes()) + " nodes and found " + to_string(lTypeErrors.size()) + " errors.", LogEntryComponent::INTERPRETER, LogEntryType::INF);
+		//Reject the loops, whose counter is changed or whose iterations depend on each other:
+		CLoopChecker loopChecker;
+		CRV<CToken> rvLoops = loopChecker.check(pltASTs);
+		if (rvLoops.getErrorMessage() != Error::SUCCESS) {
+			pContext.getLog().addEntry_tokenException(rvLoops.getContent(), LogEntryComponent::INTERPRETER, LogEntryType::FATAL, rvLoops.getErrorMessage(), Error::generateErrorMessage(rvLoops.getErrorMessage()));
+			return rvLoops;
+		}
+		else if (loopChecker.getParallelLoops() > 0) {
+			pContext.getLog().addEntry(to_string(loopChecker.getParallelLoops()) + " parallel loops have been checked.", LogEntryComponent::INTERPRETER, LogEntryType::INF);
+		}
+		if (pContext.getExecutionMode() == ExecutionMode::PARALLEL_EVALUATION) {
+			//Mark the expensive pure arguments of calls, which are evaluated by the thread pool:
+			CArgumentScheduler scheduler;
+			pltASTs = scheduler.schedule(pltASTs);
+			pContext.getLog().addEntry(to_string(scheduler.getForkedArguments()) + " arguments of " + to_string(scheduler.getParallelNodes()) + " calls and operations are evaluated in parallel.", LogEntryComponent::INTERPRETER, LogEntryType::INF);
+		}
+		//Each passed abstract syntax tree resembles a function:
+		for (unsigned int i = 0; i < pltASTs.size(); i++) {
+			CFunction newFunc;
+			CRV<CToken> funcReturn = newFunc.evaluateFunctionSourceCode(pltASTs[i]);
+			if (funcReturn.getErrorMessage() != Error::SUCCESS) {
+				//An error occured:
+				lFunctions.clear();
+				return funcReturn;
+			}
+			lFunctions.add(newFunc);
+		}
+		for (const CFunction& function : lFunctions) {
+			mFunctionIndices.emplace(function.getName(), vpFunctions.size());
+			vpFunctions.push_back(&function);
+		}
+		CSourceAnalyzer analyzer;
+		vbPureFunctions = analyzer.findPureFunctions(lFunctions);
+		bUsesTasks = false;
+		bUsesLoops = false;
+		for (unsigned int i = 0; i < pltASTs.size(); i++) {
+			bUsesTasks = bUsesTasks || contains(pltASTs[i], Opcode::OPCODE_SPAWN) || contains(pltASTs[i], Opcode::OPCODE_AWAIT) || contains(pltASTs[i], Opcode::OPCODE_PFOR);
+			bUsesLoops = bUsesLoops || contains(pltASTs[i], Opcode::OPCODE_FOR) || contains(pltASTs[i], Opcode::OPCODE_MAKE_CHANNEL);
+		}
+		return CRV<CToken>(CToken(), Error::SUCCESS);
+	}
+
+
+
+public:
+	/**
+	* Returns every function of the program.
+	*
+	* @return	Functions.
+	*/
+	const CLinkedList<CFunction>& getFunctions() const {
+		return lFunctions;
+	}
+
+	/**
+	* Returns the function at the passed index.
+	*
+	* @param pnIndex	Index of the function (see "findFunction()").
+	* @return			Function.
+	*/
+	const CFunction& getFunction(unsigned int pnIndex) const {
+		return *vpFunctions[pnIndex];
+	}
+
+	/**
+	* Returns the number of functions of the program.
+	*
+	* @return	Number of functions.
+	*/
+	unsigned int getFunctionCount() const {
+		return vpFunctions.size();
+	}
+
+	/**
+	* This function finds the index of the function with the passed name.
+	*
+	* @param psName	Name of the function.
+	* @return		Index of the function or error message, if the function does not exist.
+	*/
+	CRV<unsigned int> findFunction(const string& psName) const {
+		unordered_map<string, unsigned int>::const_iterator function = mFunctionIndices.find(psName);
+		if (function == mFunctionIndices.end()) {
+			return CRV<unsigned int>(0, Error::Interpreter::FUNCTION_DOES_NOT_EXIST);
+		}
+		return CRV<unsigned int>(function->second, Error::SUCCESS);
+	}
+
+	/**
+	* Returns whether each function of the program is pure.
+	*
+	* @return	Pure functions.
+	*/
+	const vector<bool>& getPureFunctions() const {
+		return vbPureFunctions;
+	}
+
+	/**
+	* Returns whether the program spawns or awaits tasks or contains parallel loops.
+	*
+	* @return	Whether tasks are used.
+	*/
+	bool usesTasks() const {
+		return bUsesTasks;
+	}
+
+	/**
+	* Returns whether the program contains counted loops or channels.
+	*
+	* @return	Whether loops or channels are used.
+	*/
+	bool usesLoops() const {
+		return bUsesLoops;
+	}
+
+
+
+private:
+	/**
+	* This function returns whether the passed abstract syntax tree contains a node with the passed opcode.
+	*
+	* @param pAST		Abstract syntax tree, whose opcodes have been resolved.
+	* @param pnOpcode	Opcode (e.g. Opcode::OPCODE_SPAWN).
+	* @return			Whether the opcode is used.
+	*/
+	bool contains(CAbstractSyntaxTree<CToken> pAST, short int pnOpcode) {
+		if (pAST.getContent().getOpcode() == pnOpcode) {
+			return true;
+		}
+		for (unsigned int i = 0; i < pAST.getSubTreeNumber(); i++) {
+			if (contains(pAST.getSubTreeAtIndex(i), pnOpcode)) {
+				return true;
+			}
+		}
+		return false;
+	}
+};
@@ -0,0 +1,139 @@
+/*
+FILE:		CSession.hpp
+
+REMARKS:	This file contains the class "CSession", with which an application calls the functions of a loaded Lisp-program
+			and receives their output as string.
+*/
+#pragma once
+
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "CContext.hpp"
+#include "CInterpreter.hpp"
+#include "CLinkedList.hpp"
+#include "CMemoCache.hpp"
+#include "CProgram.hpp"
+#include "CRV.hpp"
+#include "CToken.hpp"
+#include "CValue.hpp"
+#include "Variables/ErrorMessages.hpp"
+
+using namespace std;
+
+
+
+/**
+* The class "CSession" executes the functions of a program, which has been loaded once (see CProgram), for an application,
+* that embeds the interpreter. Every session has an interpreter, a cache for the return values of pure functions and an
+* output of it's own, whereas the program is shared by every session, which is created from it. Therefore, sessions are
+* cheap to create and every thread of the application can use a session of it's own, while a single session must not be
+* used by multiple threads simultaneously.
+* Arguments and return values are passed as CValue, the type of each argument has to match the type of the respective
+* parameter. Everything, that the called function prints, is stored by the session until it is cleared.
+*
+* @author	Christian-2003
+* @version	19.10.2026
+*/
+class CSession {
+private:
+	/**
+	* Stores the program, whose functions are called.
+	*/
+	shared_ptr<const CProgram> pProgram;
+
+	/**
+	* Stores the output of the called functions.
+	*/
+	ostringstream output;
+
+	/**
+	* Stores the return values of the pure functions.
+	*/
+	CMemoCache memoCache;
+
+	/**
+	* Stores the interpreter, which executes the functions.
+	*/
+	CInterpreter interpreter;
+
+
+
+public:
+	/**
+	* This constructor instantiates a new session for the passed program.
+	*
+	* @param ppProgram	Program, whose functions are called.
+	* @param pContext	Context, which provides the log and the configuration. The output of the context is replaced by
+	*					the output of the session.
+	*/
+	CSession(shared_ptr<const CProgram> ppProgram, CContext pContext) : pProgram(ppProgram) {
+		memoCache.setEnabled(pContext.getMemoCache() != nullptr && pContext.getMemoCache()->isEnabled());
+		memoCache.setCapacity(pContext.getMemoCache() != nullptr ? pContext.getMemoCache()->getCapacity() : MEMO_DEFAULT_CAPACITY);
+		CContext context = pContext.redirect(output);
+		context.setMemoCache(&memoCache);
+		interpreter.setContext(context);
+		interpreter.setProgram(pProgram);
+	}
+
+	/**
+	* Sessions cannot be copied, since the interpreter writes into the output of the session.
+	*/
+	CSession(const CSession&) = delete;
+	CSession& operator=(const CSession&) = delete;
+
+
+
+public:
+	/**
+	* This function calls the function of the program with the passed name.
+	*
+	* @param psFunction		Name of the function.
+	* @param pvArguments	Arguments of the call.
+	* @return				Return value of the function (a value without type for void-functions) or error message.
+	*/
+	CRV<CValue> call(string psFunction, vector<CValue> pvArguments) {
+		CLinkedList<CToken> lArguments;
+		for (unsigned int i = 0; i < pvArguments.size(); i++) {
+			lArguments.add(pvArguments[i].toToken(""));
+		}
+		CRV<CToken> rvCall = interpreter.call(psFunction, lArguments);
+		if (rvCall.getErrorMessage() != Error::SUCCESS) {
+			//An error occured, the token is not converted, since it might not resemble a value:
+			CValue error;
+			error.setText(rvCall.getContent().getLexeme(), rvCall.getContent().getType());
+			error.setLine(rvCall.getContent().getLine());
+			return CRV<CValue>(error, rvCall.getErrorMessage());
+		}
+		return CRV<CValue>(CValue(rvCall.getContent()), Error::SUCCESS);
+	}
+
+	/**
+	* Returns everything, that the called functions have printed since the output has been cleared.
+	*
+	* @return	Output.
+	*/
+	string getOutput() {
+		return output.str();
+	}
+
+	/**
+	* This function clears the output.
+	*/
+	void clearOutput() {
+		output.str("");
+		output.clear();
+	}
+
+	/**
+	* Returns the program, whose functions are called.
+	*
+	* @return	Program.
+	*/
+	shared_ptr<const CProgram> getProgram() {
+		return pProgram;
+	}
+};
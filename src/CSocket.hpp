@@ -0,0 +1,100 @@
+/*
+FILE:		CSocket.hpp
+
+REMARKS:	This file contains the class "CSocket", which sends and receives messages through Unix domain sockets.
+*/
+#pragma once
+
+#include <iostream>
+#include <string>
+
+#if !defined(_WIN32)
+#include <cerrno>
+#include <sys/socket.h>
+#include <sys/types.h>
+#endif
+
+using namespace std;
+
+
+
+/**
+* The class "CSocket" contains the functions, with which the worker processes and the daemon exchange their messages. A
+* message is sent completely, even if the socket only accepts a part of it at once, and a closed socket does not raise
+* SIGPIPE, but is reported through the return value. Sockets are only used on POSIX-systems, on MS Windows every function
+* fails.
+*
+* @author	Christian-2003
+* @version	19.10.2026
+*/
+class CSocket {
+public:
+	/**
+	* This function sends the passed bytes through the passed socket.
+	*
+	* @param pnSocket	Socket, through which the bytes are sent.
+	* @param ppBytes	Bytes, which are sent.
+	* @param pnLength	Number of bytes.
+	* @return			Whether every byte has been sent.
+	*/
+	static bool transmit(int pnSocket, const void* ppBytes, size_t pnLength) {
+#if defined(_WIN32)
+		return false;
+#else
+		const char* pBytes = (const char*)ppBytes;
+		while (pnLength > 0) {
+			ssize_t nSent = send(pnSocket, pBytes, pnLength, MSG_NOSIGNAL);
+			if (nSent < 0 && errno == EINTR) {
+				continue;
+			}
+			if (nSent <= 0) {
+				return false;
+			}
+			pBytes += nSent;
+			pnLength -= nSent;
+		}
+		return true;
+#endif
+	}
+
+	/**
+	* This function receives the passed number of bytes through the passed socket.
+	*
+	* @param pnSocket	Socket, through which the bytes are received.
+	* @param ppBytes	Memory, into which the bytes are written.
+	* @param pnLength	Number of bytes.
+	* @return			Whether every byte has been received (false, if the socket has been closed).
+	*/
+	static bool receive(int pnSocket, void* ppBytes, size_t pnLength) {
+#if defined(_WIN32)
+		return false;
+#else
+		char* pBytes = (char*)ppBytes;
+		while (pnLength > 0) {
+			ssize_t nReceived = recv(pnSocket, pBytes, pnLength, 0);
+			if (nReceived < 0 && errno == EINTR) {
+				continue;
+			}
+			if (nReceived <= 0) {
+				return false;
+			}
+			pBytes += nReceived;
+			pnLength -= nReceived;
+		}
+		return true;
+#endif
+	}
+
+	/**
+	* This function receives a string of the passed length through the passed socket.
+	*
+	* @param pnSocket	Socket, through which the string is received.
+	* @param pnLength	Length of the string.
+	* @param psString	String, into which the bytes are written.
+	* @return			Whether the string has been received.
+	*/
+	static bool receiveString(int pnSocket, size_t pnLength, string& psString) {
+		psString.resize(pnLength);
+		return pnLength == 0 || receive(pnSocket, &psString[0], pnLength);
+	}
+};
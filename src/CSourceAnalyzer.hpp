@@ -0,0 +1,420 @@
+/*
+FILE:		CSourceAnalyzer.hpp
+
+REMARKS:	This file contains the class "CSourceAnalyzer", which provides the static analyses, that are shared by the optimization
+			passes.
+*/
+#pragma once
+
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "CAbstractSyntaxTree.hpp"
+#include "CFunction.hpp"
+#include "CLinkedList.hpp"
+#include "COpcodeResolver.hpp"
+#include "CRV.hpp"
+#include "CToken.hpp"
+#include "CVariable.hpp"
+#include "Variables/ErrorMessages.hpp"
+#include "Variables/KeywordTypes.hpp"
+#include "Variables/OpcodeTypes.hpp"
+#include "Variables/TokenTypes.hpp"
+
+using namespace std;
+#define COST_LOOP_ITERATIONS 16
+#define COST_RECURSION 100000
+#define COST_LIMIT 1000000000
+
+
+
+/**
+* The class "CSourceAnalyzer" analyzes the abstract syntax trees of Lisp-functions without executing them. The optimization
+* passes (e.g. CConstantFolder and CInliner) use it to find out, whether a transformation keeps the behaviour of the
+* sourcecode. The CInterpreter uses it to find the pure functions, whose return values can be memoized, and the
+* CArgumentScheduler uses it to find the arguments, which are worth being evaluated by another thread.
+*
+* @author	Christian-2003
+* @version	19.10.2026
+*/
+class CSourceAnalyzer {
+private:
+	/**
+	* Resolves the opcodes of the nodes.
+	*/
+	COpcodeResolver resolver;
+
+
+
+public:
+	/**
+	* This function returns the type, which is described by the passed keyword (e.g. Token::U_INT for "int").
+	*
+	* @param pKeyword	Keyword of the type.
+	* @return			Type or Token::UNKNOWN.
+	*/
+	short int typeOf(CToken pKeyword) {
+		if (pKeyword.getLexeme() == Keyword::INT) {
+			return Token::U_INT;
+		}
+		else if (pKeyword.getLexeme() == Keyword::DOUBLE) {
+			return Token::U_DOUBLE;
+		}
+		else if (pKeyword.getLexeme() == Keyword::BOOL) {
+			return Token::U_BOOL;
+		}
+		else if (pKeyword.getLexeme() == Keyword::CHAR) {
+			return Token::U_CHAR;
+		}
+		else if (pKeyword.getLexeme() == Keyword::STRING) {
+			return Token::U_STRING;
+		}
+		else if (pKeyword.getLexeme() == Keyword::R_VOID) {
+			return Token::U_VOID;
+		}
+		return Token::UNKNOWN;
+	}
+
+	/**
+	* This function returns whether the passed token type resembles a value.
+	*
+	* @param pnType	Type of the token.
+	* @return		Whether the token is a value.
+	*/
+	bool isValue(short int pnType) {
+		return pnType == Token::U_INT || pnType == Token::U_DOUBLE || pnType == Token::U_BOOL || pnType == Token::U_CHAR || pnType == Token::U_STRING;
+	}
+
+	/**
+	* This function reads the parameters of the passed Lisp-function in the same way as CFunction.
+	*
+	* @param pAST	Abstract syntax tree of the function.
+	* @return		Parameters of the function.
+	*/
+	CRV<CLinkedList<CVariable>> readParameters(CAbstractSyntaxTree<CToken> pAST) {
+		CLinkedList<CVariable> lParameters; //Stores the parameters.
+		if (pAST.getSubTreeNumber() % 2 == 0 || pAST.getSubTreeNumber() <= 1) {
+			//The function has no parameters:
+			return CRV<CLinkedList<CVariable>>(lParameters, Error::SUCCESS);
+		}
+		CLinkedList<CAbstractSyntaxTree<CToken>> ltParameters; //Stores the abstract syntax trees of the parameters.
+		if (pAST.getSubTreeAtIndex(1).getContent().getType() == Token::BRANCH) {
+			ltParameters.addAll(pAST.getSubTreeAtIndex(1).getSubTrees());
+		}
+		else {
+			ltParameters.add(pAST.getSubTreeAtIndex(1));
+		}
+		for (unsigned int i = 0; i < ltParameters.size(); i++) {
+			if (ltParameters[i].getSubTreeNumber() != 1) {
+				//The parameter is invalid:
+				return CRV<CLinkedList<CVariable>>(lParameters, Error::Interpreter::INCORRECT_FUNCTION_DEFINITION);
+			}
+			short int nType = typeOf(ltParameters[i].getContent());
+			lParameters.add(CVariable(ltParameters[i].getSubTreeAtIndex(0).getContent().getLexeme(), "", nType == Token::UNKNOWN ? (short int)Token::U_VOID : nType));
+		}
+		return CRV<CLinkedList<CVariable>>(lParameters, Error::SUCCESS);
+	}
+
+	/**
+	* This function returns whether every parameter of the passed list has a different name.
+	*
+	* @param plParameters	Parameters of a function.
+	* @return				Whether the names of the parameters are unique.
+	*/
+	bool hasUniqueNames(CLinkedList<CVariable> plParameters) {
+		for (unsigned int i = 0; i < plParameters.size(); i++) {
+			for (unsigned int j = i + 1; j < plParameters.size(); j++) {
+				if (plParameters[i].getName() == plParameters[j].getName()) {
+					return false;
+				}
+			}
+		}
+		return true;
+	}
+
+
+
+public:
+	/**
+	* This function returns whether every integer within the passed abstract syntax tree is written in it's default form
+	* (e.g. "7" instead of "007"). Only in this case, every integer value, that is computed at runtime, has the same lexeme as
+	* the result of an operation.
+	*
+	* @param pAST	Abstract syntax tree.
+	* @return		Whether the integers are canonical.
+	*/
+	bool hasCanonicalIntegers(CAbstractSyntaxTree<CToken> pAST) {
+		if (pAST.getContent().getType() == Token::U_INT) {
+			try {
+				if (to_string(stoi(pAST.getContent().getLexeme())) != pAST.getContent().getLexeme()) {
+					return false;
+				}
+			}
+			catch (const exception&) {
+				//The integer is out of range:
+				return false;
+			}
+		}
+		for (unsigned int i = 0; i < pAST.getSubTreeNumber(); i++) {
+			if (!hasCanonicalIntegers(pAST.getSubTreeAtIndex(i))) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/**
+	* This function returns whether the passed abstract syntax tree contains a declaration of a variable.
+	*
+	* @param pAST	Abstract syntax tree.
+	* @return		Whether a variable is declared.
+	*/
+	bool containsDeclaration(CAbstractSyntaxTree<CToken> pAST) {
+		short int nOpcode = resolver.resolveOpcode(pAST.getContent());
+		if (nOpcode >= Opcode::OPCODE_DECLARE_INT && nOpcode <= Opcode::OPCODE_DECLARE_STRING) {
+			return true;
+		}
+		for (unsigned int i = 0; i < pAST.getSubTreeNumber(); i++) {
+			if (containsDeclaration(pAST.getSubTreeAtIndex(i))) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	/**
+	* This function returns whether variables are declared anywhere else than by the statements of the passed body.
+	*
+	* @param pAST	Abstract syntax tree of the body.
+	* @return		Whether variables are declared within expressions.
+	*/
+	bool declaresInExpression(CAbstractSyntaxTree<CToken> pAST) {
+		CLinkedList<CAbstractSyntaxTree<CToken>> ltStatements; //Stores the statements of the body.
+		if (pAST.getContent().getType() == Token::BRANCH) {
+			ltStatements.addAll(pAST.getSubTrees());
+		}
+		else {
+			ltStatements.add(pAST);
+		}
+		for (unsigned int i = 0; i < ltStatements.size(); i++) {
+			short int nOpcode = resolver.resolveOpcode(ltStatements[i].getContent());
+			for (unsigned int j = 0; j < ltStatements[i].getSubTreeNumber(); j++) {
+				CAbstractSyntaxTree<CToken> tSubTree = ltStatements[i].getSubTreeAtIndex(j);
+				bool bBody = (nOpcode == Opcode::OPCODE_IF && (j == 1 || j == 2)) || (nOpcode == Opcode::OPCODE_WHILE && j == 1) || ((nOpcode == Opcode::OPCODE_FOR || nOpcode == Opcode::OPCODE_PFOR) && j >= 3 && j + 1 == ltStatements[i].getSubTreeNumber());
+				if (bBody ? declaresInExpression(tSubTree) : containsDeclaration(tSubTree)) {
+					return true;
+				}
+			}
+		}
+		return false;
+	}
+
+	/**
+	* This function finds every pure function of the passed list. A function is pure, if it returns a value, does not print
+	* anything and only calls pure functions. Since every function is executed with it's own variables, the return value
+	* of a pure function only depends on it's arguments.
+	*
+	* @param plFunctions	Lisp-functions.
+	* @return				Whether each function is pure (same index as plFunctions).
+	*/
+	vector<bool> findPureFunctions(CLinkedList<CFunction>& plFunctions) {
+		vector<string> vsNames; //Stores the name of every function.
+		vector<bool> vbPure; //Stores whether each function is pure.
+		for (unsigned int i = 0; i < plFunctions.size(); i++) {
+			vsNames.push_back(plFunctions[i].getName());
+			vbPure.push_back(plFunctions[i].getReturnType() != Token::U_VOID);
+		}
+		//A function, which calls an impure function, becomes impure until nothing changes anymore:
+		bool bChanged = true;
+		while (bChanged) {
+			bChanged = false;
+			for (unsigned int i = 0; i < plFunctions.size(); i++) {
+				if (!vbPure[i]) {
+					continue;
+				}
+				CLinkedList<CAbstractSyntaxTree<CToken>> ltExpressions = plFunctions[i].getExpressions();
+				for (unsigned int j = 0; j < ltExpressions.size(); j++) {
+					if (hasEffects(ltExpressions[j], vsNames, vbPure)) {
+						vbPure[i] = false;
+						bChanged = true;
+						break;
+					}
+				}
+			}
+		}
+		return vbPure;
+	}
+
+	/**
+	* This function returns whether the passed argument of a call can be evaluated at any time without changing the
+	* behaviour of the sourcecode. This is the case, if it does not have any effects and does not contain a keyword (e.g.
+	* "set"), which would change the variables of the calling function.
+	*
+	* @param pAST		Abstract syntax tree of the argument.
+	* @param pvsNames	Names of every function.
+	* @param pvbPure	Whether each function is pure (see "findPureFunctions()").
+	* @return			Whether the argument is pure.
+	*/
+	bool isPureArgument(CAbstractSyntaxTree<CToken> pAST, vector<string>& pvsNames, vector<bool>& pvbPure) {
+		return !containsKeyword(pAST) && !hasEffects(pAST, pvsNames, pvbPure);
+	}
+
+	/**
+	* This function estimates how expensive a call of each of the passed functions is. The cost of a function is the
+	* number of nodes, which are evaluated by a call, where the body of a loop is counted COST_LOOP_ITERATIONS times and a
+	* recursive call is counted as COST_RECURSION nodes, since the number of iterations and recursions is not known before
+	* the execution.
+	*
+	* @param plFunctions	Lisp-functions.
+	* @return				Estimated cost of each function (same index as plFunctions).
+	*/
+	vector<unsigned long long> estimateCosts(CLinkedList<CFunction>& plFunctions) {
+		vector<string> vsNames; //Stores the name of every function.
+		for (unsigned int i = 0; i < plFunctions.size(); i++) {
+			vsNames.push_back(plFunctions[i].getName());
+		}
+		vector<unsigned long long> vnCosts(plFunctions.size(), 0); //Stores the cost of each function.
+		vector<short int> vnStates(plFunctions.size(), 0); //Stores whether each cost is unknown (0), being estimated (1) or known (2).
+		for (unsigned int i = 0; i < plFunctions.size(); i++) {
+			estimateFunction(i, &plFunctions, vsNames, vnCosts, vnStates);
+		}
+		return vnCosts;
+	}
+
+	/**
+	* This function estimates how expensive the evaluation of the passed abstract syntax tree is.
+	*
+	* @param pAST		Abstract syntax tree.
+	* @param pvsNames	Names of every function.
+	* @param pvnCosts	Estimated cost of each function (see "estimateCosts()").
+	* @return			Estimated cost.
+	*/
+	unsigned long long estimateCost(CAbstractSyntaxTree<CToken> pAST, vector<string>& pvsNames, vector<unsigned long long>& pvnCosts) {
+		vector<short int> vnStates(pvnCosts.size(), 2); //Every cost is known.
+		return estimateNode(pAST, nullptr, pvsNames, pvnCosts, vnStates);
+	}
+
+
+
+private:
+	/**
+	* This function estimates the cost of the function with the passed index, if it is not known yet.
+	*
+	* @param pnFunction		Index of the function.
+	* @param plFunctions	Lisp-functions.
+	* @param pvsNames		Names of every function.
+	* @param pvnCosts		Estimated cost of each function.
+	* @param pvnStates		Whether the cost of each function is unknown, being estimated or known.
+	* @return				Estimated cost of the function.
+	*/
+	unsigned long long estimateFunction(unsigned int pnFunction, CLinkedList<CFunction>* plFunctions, vector<string>& pvsNames, vector<unsigned long long>& pvnCosts, vector<short int>& pvnStates) {
+		if (pvnStates[pnFunction] == 1) {
+			//The function is called recursively:
+			return COST_RECURSION;
+		}
+		else if (pvnStates[pnFunction] == 2 || plFunctions == nullptr) {
+			return pvnCosts[pnFunction];
+		}
+		pvnStates[pnFunction] = 1;
+		unsigned long long nCost = 1; //Stores the cost of the call.
+		CLinkedList<CAbstractSyntaxTree<CToken>> ltExpressions = (*plFunctions)[pnFunction].getExpressions();
+		for (unsigned int i = 0; i < ltExpressions.size(); i++) {
+			nCost = min<unsigned long long>(nCost + estimateNode(ltExpressions[i], plFunctions, pvsNames, pvnCosts, pvnStates), COST_LIMIT);
+		}
+		pvnCosts[pnFunction] = nCost;
+		pvnStates[pnFunction] = 2;
+		return nCost;
+	}
+
+	/**
+	* This function estimates the cost of the passed abstract syntax tree. Identifiers, which have the name of a function,
+	* are regarded as calls.
+	*
+	* @param pAST			Abstract syntax tree.
+	* @param plFunctions	Lisp-functions, whose costs are estimated if they are unknown (or nullptr).
+	* @param pvsNames		Names of every function.
+	* @param pvnCosts		Estimated cost of each function.
+	* @param pvnStates		Whether the cost of each function is unknown, being estimated or known.
+	* @return				Estimated cost.
+	*/
+	unsigned long long estimateNode(CAbstractSyntaxTree<CToken> pAST, CLinkedList<CFunction>* plFunctions, vector<string>& pvsNames, vector<unsigned long long>& pvnCosts, vector<short int>& pvnStates) {
+		CToken content = pAST.getContent();
+		unsigned long long nCost = 1; //Stores the cost of the node.
+		if (content.getType() == Token::IDENTIFIER) {
+			for (unsigned int i = 0; i < pvsNames.size(); i++) {
+				if (pvsNames[i] == content.getLexeme()) {
+					nCost += estimateFunction(i, plFunctions, pvsNames, pvnCosts, pvnStates);
+					break;
+				}
+			}
+		}
+		for (unsigned int i = 0; i < pAST.getSubTreeNumber(); i++) {
+			nCost = min<unsigned long long>(nCost + estimateNode(pAST.getSubTreeAtIndex(i), plFunctions, pvsNames, pvnCosts, pvnStates), COST_LIMIT);
+		}
+		short int nOpcode = resolver.resolveOpcode(content);
+		if (nOpcode == Opcode::OPCODE_WHILE || nOpcode == Opcode::OPCODE_FOR || nOpcode == Opcode::OPCODE_PFOR) {
+			nCost = min<unsigned long long>(nCost * COST_LOOP_ITERATIONS, COST_LIMIT);
+		}
+		return nCost;
+	}
+
+	/**
+	* This function returns whether the passed abstract syntax tree contains a keyword.
+	*
+	* @param pAST	Abstract syntax tree.
+	* @return		Whether a keyword is contained.
+	*/
+	bool containsKeyword(CAbstractSyntaxTree<CToken> pAST) {
+		if (pAST.getContent().getType() == Token::KEYWORD) {
+			return true;
+		}
+		for (unsigned int i = 0; i < pAST.getSubTreeNumber(); i++) {
+			if (containsKeyword(pAST.getSubTreeAtIndex(i))) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	/**
+	* This function returns whether the passed abstract syntax tree prints something, spawns or awaits a task, uses a
+	* channel or calls a function, which is not pure. Identifiers, which have the name of a function, are regarded as calls, even if they
+	* resemble a variable.
+	*
+	* @param pAST		Abstract syntax tree.
+	* @param pvsNames	Names of every function.
+	* @param pvbPure	Whether each function is pure.
+	* @return			Whether the abstract syntax tree has effects.
+	*/
+	bool hasEffects(CAbstractSyntaxTree<CToken> pAST, vector<string>& pvsNames, vector<bool>& pvbPure) {
+		CToken content = pAST.getContent();
+		short int nOpcode = resolver.resolveOpcode(content);
+		if (nOpcode == Opcode::OPCODE_PRINT || nOpcode == Opcode::OPCODE_PRINTLN || nOpcode == Opcode::OPCODE_SPAWN || nOpcode == Opcode::OPCODE_AWAIT || (nOpcode >= Opcode::OPCODE_MAKE_CHANNEL && nOpcode <= Opcode::OPCODE_TRY_RECV)) {
+			return true;
+		}
+		else if (content.getType() == Token::IDENTIFIER) {
+			bool bFunction = false; //Stores whether a function has the name of the identifier.
+			for (unsigned int i = 0; i < pvsNames.size(); i++) {
+				if (pvsNames[i] == content.getLexeme()) {
+					if (!pvbPure[i]) {
+						return true;
+					}
+					bFunction = true;
+					break;
+				}
+			}
+			if (!bFunction && pAST.hasSubTrees()) {
+				//The called function does not exist:
+				return true;
+			}
+		}
+		for (unsigned int i = 0; i < pAST.getSubTreeNumber(); i++) {
+			if (hasEffects(pAST.getSubTreeAtIndex(i), pvsNames, pvbPure)) {
+				return true;
+			}
+		}
+		return false;
+	}
+};
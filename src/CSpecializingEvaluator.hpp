@@ -0,0 +1,2484 @@
+/*
+FILE:		CSpecializingEvaluator.hpp
+
+REMARKS:	This file contains the class "CSpecializingEvaluator", which executes Lisp-functions through a tree of nodes, that
+			rewrite themselves into specialized nodes after observing the types of their operands.
+*/
+#pragma once
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <set>
+#include <memory>
+
+#include "CAbstractSyntaxTree.hpp"
+#include "CFunction.hpp"
+#include "CLinkedList.hpp"
+#include "CRV.hpp"
+#include "CToken.hpp"
+#include "CValue.hpp"
+#include "CValueOperations.hpp"
+#include "Variables/ErrorMessages.hpp"
+#include "Variables/KeywordTypes.hpp"
+#include "Variables/TokenTypes.hpp"
+
+using namespace std;
+
+
+
+class CNodeFunction;
+
+
+
+/**
+* Instances of this class resemble the variables of a single function call. Like the interpreter's list of variables,
+* every variable is searched by it's name. The names are interned, which is why only pointers need to be compared.
+*
+* @author	Christian-2003
+* @version	19.10.2026
+*/
+class CNodeFrame {
+private:
+	/**
+	* Stores the interned name of every variable.
+	*/
+	vector<const string*> lNames;
+
+	/**
+	* Stores the value of every variable.
+	*/
+	vector<CValue> lValues;
+
+	/**
+	* Stores the function, which is called in tail position and executed within this frame.
+	*/
+	CNodeFunction* pTailFunction;
+
+
+
+public:
+	/**
+	* The default constructor instantiates a new frame without variables.
+	*/
+	CNodeFrame() {
+		pTailFunction = NULL;
+	}
+
+
+
+public:
+	/**
+	* Returns the slot of the variable with the passed name.
+	*
+	* @param psName	Interned name of the variable.
+	* @return		Slot of the variable or -1, if the variable does not exist.
+	*/
+	int find(const string* psName) {
+		for (unsigned int i = 0; i < lNames.size(); i++) {
+			if (lNames[i] == psName) {
+				return i;
+			}
+		}
+		return -1;
+	}
+
+	/**
+	* Returns whether the passed slot stores the variable with the passed name.
+	*
+	* @param pnSlot	Slot, which should be checked.
+	* @param psName	Interned name of the variable.
+	* @return		Whether the slot stores the variable.
+	*/
+	bool isSlot(int pnSlot, const string* psName) {
+		return pnSlot >= 0 && (unsigned int)pnSlot < lNames.size() && lNames[pnSlot] == psName;
+	}
+
+	/**
+	* Returns the value of the variable in the passed slot.
+	*
+	* @param pnSlot	Slot of the variable.
+	* @return		Value of the variable.
+	*/
+	CValue& getValue(unsigned int pnSlot) {
+		return lValues[pnSlot];
+	}
+
+	/**
+	* Adds a new variable to the frame.
+	*
+	* @param psName		Interned name of the variable.
+	* @param pValue		Value of the variable.
+	*/
+	void declare(const string* psName, CValue& pValue) {
+		lNames.push_back(psName);
+		lValues.push_back(pValue);
+	}
+
+	/**
+	* Changes the name of the variable in the passed slot.
+	*
+	* @param pnSlot	Slot of the variable.
+	* @param psName	New interned name of the variable.
+	*/
+	void rename(unsigned int pnSlot, const string* psName) {
+		lNames[pnSlot] = psName;
+	}
+
+	/**
+	* Returns the number of variables.
+	*
+	* @return	Number of variables.
+	*/
+	unsigned int getSize() {
+		return lNames.size();
+	}
+
+	/**
+	* Removes every variable, which was declared after the frame had the passed size.
+	*
+	* @param pnSize	New size of the frame.
+	*/
+	void truncate(unsigned int pnSize) {
+		lNames.resize(pnSize);
+		lValues.resize(pnSize);
+	}
+
+	/**
+	* Returns the function, which has been called in tail position.
+	*
+	* @return	Function, which is executed within this frame.
+	*/
+	CNodeFunction* getTailFunction() {
+		return pTailFunction;
+	}
+
+	/**
+	* Reuses the frame for the passed function, which is called in tail position. The variables of the calling function
+	* are replaced with the parameters in the passed frame.
+	*
+	* @param pFunction		Called function.
+	* @param pParameters	Frame, which contains the parameters of the call.
+	*/
+	void reuse(CNodeFunction* pFunction, CNodeFrame& pParameters) {
+		lNames.swap(pParameters.lNames);
+		lValues.swap(pParameters.lValues);
+		pTailFunction = pFunction;
+	}
+};
+
+
+
+/**
+* Every node of the evaluator inherits from this class. A node is executed through the pointer, with which it's parent
+* references it. This allows the node to replace itself with another node by changing the pointer.
+*
+* @author	Christian-2003
+* @version	19.10.2026
+*/
+class CSpecializingNode {
+public:
+	/**
+	* Destructor of the node.
+	*/
+	virtual ~CSpecializingNode() {
+		//Does nothing...
+	}
+
+	/**
+	* Executes the node. The result (or the token which caused an error) is written into pResult.
+	*
+	* @param pSelf		Reference to the parent's pointer to this node.
+	* @param pFrame		Variables of the current function call.
+	* @param pResult	Result of the node.
+	* @return			Error message.
+	*/
+	virtual short int execute(CSpecializingNode*& pSelf, CNodeFrame& pFrame, CValue& pResult) = 0;
+};
+
+
+
+/**
+* Instances of this class resemble a Lisp-function, whose expressions have been converted into nodes.
+*
+* @author	Christian-2003
+* @version	19.10.2026
+*/
+class CNodeFunction {
+private:
+	/**
+	* Stores the name of the function.
+	*/
+	string sName;
+
+	/**
+	* Stores the return type of the function.
+	*/
+	short int nReturnType;
+
+	/**
+	* Stores the interned name of every parameter.
+	*/
+	vector<const string*> lParameterNames;
+
+	/**
+	* Stores the type of every parameter.
+	*/
+	vector<short int> lParameterTypes;
+
+	/**
+	* Stores the nodes of the function's expressions.
+	*/
+	vector<CSpecializingNode*> lBody;
+
+
+
+public:
+	/**
+	* This constructor instantiates a new function without expressions.
+	*
+	* @param psName			Name of the function.
+	* @param pnReturnType	Return type of the function.
+	*/
+	CNodeFunction(string psName, short int pnReturnType) {
+		sName = psName;
+		nReturnType = pnReturnType;
+	}
+
+
+
+public:
+	/**
+	* Returns the name of the function.
+	*
+	* @return	Name of the function.
+	*/
+	string getName() {
+		return sName;
+	}
+
+	/**
+	* Returns the return type of the function.
+	*
+	* @return	Return type.
+	*/
+	short int getReturnType() {
+		return nReturnType;
+	}
+
+	/**
+	* Returns the interned names of the parameters.
+	*
+	* @return	Names of the parameters.
+	*/
+	vector<const string*>& getParameterNames() {
+		return lParameterNames;
+	}
+
+	/**
+	* Returns the types of the parameters.
+	*
+	* @return	Types of the parameters.
+	*/
+	vector<short int>& getParameterTypes() {
+		return lParameterTypes;
+	}
+
+	/**
+	* Returns the nodes of the function's expressions.
+	*
+	* @return	Body of the function.
+	*/
+	vector<CSpecializingNode*>& getBody() {
+		return lBody;
+	}
+};
+
+
+
+/**
+* This class stores everything, which is shared by the nodes of a program. Every node is owned by the context, so that
+* replaced nodes stay valid until the program is finished (a recursive function call might still execute them).
+*
+* @author	Christian-2003
+* @version	19.10.2026
+*/
+class CNodeContext {
+private:
+	/**
+	* Stores every node, which was created.
+	*/
+	vector<unique_ptr<CSpecializingNode>> lNodes;
+
+	/**
+	* Stores every function of the program.
+	*/
+	vector<CNodeFunction> lFunctions;
+
+	/**
+	* Stores every interned name.
+	*/
+	set<string> lNames;
+
+	/**
+	* Implements the operations.
+	*/
+	CValueOperations operations;
+
+	/**
+	* Stores the stream, into which the program prints it's output.
+	*/
+	ostream* pOutput;
+
+	/**
+	* Stores the number of nodes, that have been specialized.
+	*/
+	unsigned int nSpecializations;
+
+	/**
+	* Stores the number of nodes, that have been replaced by generic nodes.
+	*/
+	unsigned int nDeoptimizations;
+
+
+
+public:
+	/**
+	* The default constructor instantiates a new empty context.
+	*/
+	CNodeContext() {
+		pOutput = &cout;
+		nSpecializations = 0;
+		nDeoptimizations = 0;
+	}
+
+
+
+public:
+	/**
+	* Transfers the ownership of the passed node to the context.
+	*
+	* @param pNode	Node, which is owned by the context afterwards.
+	* @return		Passed node.
+	*/
+	CSpecializingNode* adopt(CSpecializingNode* pNode) {
+		lNodes.push_back(unique_ptr<CSpecializingNode>(pNode));
+		return pNode;
+	}
+
+	/**
+	* Returns the interned instance of the passed name.
+	*
+	* @param psName	Name, which should be interned.
+	* @return		Interned name.
+	*/
+	const string* intern(string psName) {
+		return &*lNames.insert(psName).first;
+	}
+
+	/**
+	* Returns the function list of the program.
+	*
+	* @return	Functions.
+	*/
+	vector<CNodeFunction>& getFunctions() {
+		return lFunctions;
+	}
+
+	/**
+	* Returns the first function with the passed name.
+	*
+	* @param psName	Name of the function.
+	* @return		Function or NULL, if the function does not exist.
+	*/
+	CNodeFunction* getFunction(string psName) {
+		for (unsigned int i = 0; i < lFunctions.size(); i++) {
+			if (lFunctions[i].getName() == psName) {
+				return &lFunctions[i];
+			}
+		}
+		return NULL;
+	}
+
+	/**
+	* Returns the implementation of the operations.
+	*
+	* @return	Operations.
+	*/
+	CValueOperations& getOperations() {
+		return operations;
+	}
+
+	/**
+	* Returns the stream, into which the program prints it's output.
+	*
+	* @return	Output.
+	*/
+	ostream& getOutput() {
+		return *pOutput;
+	}
+
+	/**
+	* This function changes the stream, into which the program prints it's output.
+	*
+	* @param pOutputStream	New output.
+	*/
+	void setOutput(ostream& pOutputStream) {
+		pOutput = &pOutputStream;
+	}
+
+	/**
+	* Notifies the context, that a node has been specialized.
+	*/
+	void countSpecialization() {
+		nSpecializations++;
+	}
+
+	/**
+	* Notifies the context, that a node has been deoptimized.
+	*/
+	void countDeoptimization() {
+		nDeoptimizations++;
+	}
+
+	/**
+	* Returns the number of nodes, that have been specialized.
+	*
+	* @return	Number of specializations.
+	*/
+	unsigned int getSpecializations() {
+		return nSpecializations;
+	}
+
+	/**
+	* Returns the number of nodes, that have been deoptimized.
+	*
+	* @return	Number of deoptimizations.
+	*/
+	unsigned int getDeoptimizations() {
+		return nDeoptimizations;
+	}
+};
+
+
+
+/**
+* This node returns a constant value with a constant error message.
+*
+* @author	Christian-2003
+* @version	19.10.2026
+*/
+class CConstantNode : public CSpecializingNode {
+private:
+	/**
+	* Stores the value.
+	*/
+	CValue value;
+
+	/**
+	* Stores the error message.
+	*/
+	short int nErrorMessage;
+
+
+
+public:
+	/**
+	* This constructor instantiates a new constant node.
+	*
+	* @param pValue			Value, which is returned.
+	* @param pnErrorMessage	Error message, which is returned.
+	*/
+	CConstantNode(CValue pValue, short int pnErrorMessage) {
+		value = pValue;
+		nErrorMessage = pnErrorMessage;
+	}
+
+
+
+public:
+	short int execute(CSpecializingNode*&, CNodeFrame&, CValue& pResult) {
+		pResult = value;
+		return nErrorMessage;
+	}
+};
+
+
+
+/**
+* This is the base class of every node, which evaluates an arithmetic, relational or boolean operation (equivalent to
+* "CInterpreter::evaluateOperation()"). Every operation starts as CUninitializedOperationNode.
+*
+* @author	Christian-2003
+* @version	19.10.2026
+*/
+class COperationNode : public CSpecializingNode {
+public:
+	/**
+	* Stores the maximum number of operands of specialized operations. The operands of specialized nodes are stored on the
+	* stack instead of the heap.
+	*/
+	static const unsigned int MAX_SPECIALIZED_OPERANDS = 4;
+
+
+
+protected:
+	/**
+	* Stores the context of the program.
+	*/
+	CNodeContext* pContext;
+
+	/**
+	* Stores the head node of the operation.
+	*/
+	CValue head;
+
+	/**
+	* Stores the lexeme of the operator.
+	*/
+	string sOperator;
+
+	/**
+	* Stores the type of the operator (Token::OPERATOR_ARITHMETIC, Token::OPERATOR_RELATIONAL or Token::OPERATOR_BOOL).
+	*/
+	short int nOperatorType;
+
+	/**
+	* Stores the nodes of the operands.
+	*/
+	vector<CSpecializingNode*> lOperands;
+
+
+
+public:
+	/**
+	* This constructor instantiates a new operation.
+	*
+	* @param ppContext		Context of the program.
+	* @param pHead			Head node of the operation.
+	* @param pnOperatorType	Type of the operator.
+	* @param plOperands		Nodes of the operands.
+	*/
+	COperationNode(CNodeContext* ppContext, CValue pHead, short int pnOperatorType, vector<CSpecializingNode*> plOperands) {
+		pContext = ppContext;
+		head = pHead;
+		sOperator = pHead.getLexeme();
+		nOperatorType = pnOperatorType;
+		lOperands = plOperands;
+	}
+
+
+
+protected:
+	/**
+	* Evaluates every operand.
+	*
+	* @param pFrame		Variables of the current function call.
+	* @param plValues	Array for the values of the operands.
+	* @param pResult	Token which caused the error.
+	* @return			Error message.
+	*/
+	short int evaluateOperands(CNodeFrame& pFrame, CValue* plValues, CValue& pResult) {
+		for (unsigned int i = 0; i < lOperands.size(); i++) {
+			short int nErrorMessage = lOperands[i]->execute(lOperands[i], pFrame, plValues[i]);
+			if (nErrorMessage != Error::SUCCESS) {
+				//An error occured:
+				pResult = plValues[i];
+				return nErrorMessage;
+			}
+			if (nOperatorType == Token::OPERATOR_BOOL && i + 1 < lOperands.size() && pContext->getOperations().isDecided(sOperator, plValues[i])) {
+				//The skipped operands are replaced with the deciding operand:
+				for (unsigned int j = i + 1; j < lOperands.size(); j++) {
+					plValues[j] = plValues[i];
+				}
+				break;
+			}
+		}
+		return Error::SUCCESS;
+	}
+
+	/**
+	* Evaluates the operation for operands of any type.
+	*
+	* @param plValues	Values of the operands.
+	* @param pResult	Result of the operation.
+	* @return			Error message.
+	*/
+	short int evaluateGeneric(vector<CValue>& plValues, CValue& pResult) {
+		CValueOperations& operations = pContext->getOperations();
+		if (nOperatorType == Token::OPERATOR_ARITHMETIC) {
+			switch (sOperator[0]) {
+			case '+':
+				return operations.add(plValues, pResult);
+			case '-':
+				return operations.subtract(plValues, pResult);
+			case '*':
+				return operations.multiply(plValues, pResult);
+			default:
+				return operations.divide(plValues, pResult);
+			}
+		}
+		else if (nOperatorType == Token::OPERATOR_RELATIONAL) {
+			return operations.compare(sOperator, head, plValues, pResult);
+		}
+		else if (nOperatorType == Token::OPERATOR_BOOL) {
+			return operations.logical(sOperator, head, plValues, pResult);
+		}
+		//Found invalid token:
+		pResult = head;
+		return Error::Interpreter::INCORRECT_TOKEN;
+	}
+
+	/**
+	* Replaces this node with a node of the passed type, which takes over the operator and the operands.
+	*
+	* @param pSelf	Reference to the parent's pointer to this node.
+	*/
+	template<class T> void rewrite(CSpecializingNode*& pSelf) {
+		pSelf = pContext->adopt(new T(*this));
+	}
+};
+
+
+
+/**
+* This node evaluates an operation for operands of any type.
+*
+* @author	Christian-2003
+* @version	19.10.2026
+*/
+class CGenericOperationNode : public COperationNode {
+public:
+	/**
+	* This constructor takes over the operator and operands of the passed operation.
+	*
+	* @param pOperation	Operation, which is replaced.
+	*/
+	CGenericOperationNode(COperationNode& pOperation) : COperationNode(pOperation) {
+		//Does nothing...
+	}
+
+
+
+public:
+	short int execute(CSpecializingNode*&, CNodeFrame& pFrame, CValue& pResult) {
+		vector<CValue> lValues(lOperands.size());
+		short int nErrorMessage = evaluateOperands(pFrame, lValues.data(), pResult);
+		if (nErrorMessage != Error::SUCCESS) {
+			return nErrorMessage;
+		}
+		return evaluateGeneric(lValues, pResult);
+	}
+};
+
+
+
+/**
+* This is the base class of every node, which is specialized on specific operand types. If the operands do not match
+* these types, the node is replaced with a CGenericOperationNode.
+*
+* @author	Christian-2003
+* @version	19.10.2026
+*/
+class CSpecializedOperationNode : public COperationNode {
+public:
+	/**
+	* This constructor takes over the operator and operands of the passed operation.
+	*
+	* @param pOperation	Operation, which is replaced.
+	*/
+	CSpecializedOperationNode(COperationNode& pOperation) : COperationNode(pOperation) {
+		//Does nothing...
+	}
+
+
+
+protected:
+	/**
+	* Replaces this node with a generic node and evaluates the already evaluated operands generically.
+	*
+	* @param pSelf		Reference to the parent's pointer to this node.
+	* @param plValues	Values of the operands.
+	* @param pResult	Result of the operation.
+	* @return			Error message.
+	*/
+	short int deoptimize(CSpecializingNode*& pSelf, CValue* plValues, CValue& pResult) {
+		rewrite<CGenericOperationNode>(pSelf);
+		pContext->countDeoptimization();
+		vector<CValue> lValues(plValues, plValues + lOperands.size());
+		return evaluateGeneric(lValues, pResult);
+	}
+};
+
+
+
+/**
+* This node evaluates "+", "-" or "*" for integer operands.
+*
+* @author	Christian-2003
+* @version	19.10.2026
+*/
+class CIntArithmeticNode : public CSpecializedOperationNode {
+public:
+	/**
+	* This constructor takes over the operator and operands of the passed operation.
+	*
+	* @param pOperation	Operation, which is replaced.
+	*/
+	CIntArithmeticNode(COperationNode& pOperation) : CSpecializedOperationNode(pOperation) {
+		//Does nothing...
+	}
+
+
+
+public:
+	short int execute(CSpecializingNode*& pSelf, CNodeFrame& pFrame, CValue& pResult) {
+		CValue lValues[MAX_SPECIALIZED_OPERANDS];
+		short int nErrorMessage = evaluateOperands(pFrame, lValues, pResult);
+		if (nErrorMessage != Error::SUCCESS) {
+			return nErrorMessage;
+		}
+		for (unsigned int i = 0; i < lOperands.size(); i++) {
+			if (lValues[i].getType() != Token::U_INT) {
+				//Operand types have changed:
+				return deoptimize(pSelf, lValues, pResult);
+			}
+		}
+		//Integers wrap around on overflow:
+		unsigned int nValue = (unsigned int)lValues[0].getInt();
+		for (unsigned int i = 1; i < lOperands.size(); i++) {
+			switch (sOperator[0]) {
+			case '+':
+				nValue += (unsigned int)lValues[i].getInt();
+				break;
+			case '-':
+				nValue -= (unsigned int)lValues[i].getInt();
+				break;
+			default:
+				nValue *= (unsigned int)lValues[i].getInt();
+				break;
+			}
+		}
+		pResult.setInt((int)nValue);
+		pResult.setLine(lValues[0].getLine());
+		return Error::SUCCESS;
+	}
+};
+
+
+
+/**
+* This node evaluates "+", "-", "*" or "/" for numeric operands, whose result is a double.
+*
+* @author	Christian-2003
+* @version	19.10.2026
+*/
+class CDoubleArithmeticNode : public CSpecializedOperationNode {
+public:
+	/**
+	* This constructor takes over the operator and operands of the passed operation.
+	*
+	* @param pOperation	Operation, which is replaced.
+	*/
+	CDoubleArithmeticNode(COperationNode& pOperation) : CSpecializedOperationNode(pOperation) {
+		//Does nothing...
+	}
+
+
+
+public:
+	short int execute(CSpecializingNode*& pSelf, CNodeFrame& pFrame, CValue& pResult) {
+		CValue lValues[MAX_SPECIALIZED_OPERANDS];
+		short int nErrorMessage = evaluateOperands(pFrame, lValues, pResult);
+		if (nErrorMessage != Error::SUCCESS) {
+			return nErrorMessage;
+		}
+		char chOperator = sOperator[0];
+		bool bDouble = chOperator == '/';
+		for (unsigned int i = 0; i < lOperands.size(); i++) {
+			if (lValues[i].getType() == Token::U_DOUBLE) {
+				bDouble = true;
+			}
+			else if (lValues[i].getType() != Token::U_INT) {
+				//Operand types have changed:
+				return deoptimize(pSelf, lValues, pResult);
+			}
+		}
+		if (!bDouble) {
+			//Every operand is an integer:
+			return deoptimize(pSelf, lValues, pResult);
+		}
+
+		double dValue = lValues[0].getNumber();
+		for (unsigned int i = 1; i < lOperands.size(); i++) {
+			if (chOperator == '/' && lValues[i].getNumber() == 0) {
+				pResult = lValues[i];
+				return Error::Interpreter::CANNOT_DIVIDE_BY_ZERO;
+			}
+		}
+		for (unsigned int i = 1; i < lOperands.size(); i++) {
+			switch (chOperator) {
+			case '+':
+				dValue = CValue::normalizeDouble(dValue + lValues[i].getNumber());
+				break;
+			case '-':
+				dValue = CValue::normalizeDouble(dValue - lValues[i].getNumber());
+				break;
+			case '*':
+				dValue = CValue::normalizeDouble(dValue * lValues[i].getNumber());
+				break;
+			default:
+				dValue = CValue::normalizeDouble(dValue / lValues[i].getNumber());
+				break;
+			}
+		}
+		pResult.setDouble(dValue);
+		pResult.setLine(lValues[0].getLine());
+		return Error::SUCCESS;
+	}
+};
+
+
+
+/**
+* This is the base class for relational operations with exactly two numeric operands.
+*
+* @author	Christian-2003
+* @version	19.10.2026
+*/
+class CCompareNode : public CSpecializedOperationNode {
+public:
+	/**
+	* This constructor takes over the operator and operands of the passed operation.
+	*
+	* @param pOperation	Operation, which is replaced.
+	*/
+	CCompareNode(COperationNode& pOperation) : CSpecializedOperationNode(pOperation) {
+		//Does nothing...
+	}
+
+
+
+protected:
+	/**
+	* Returns the result of the comparison of both numbers.
+	*
+	* @param pdFirst	First operand.
+	* @param pdSecond	Second operand.
+	* @return			Result of the comparison.
+	*/
+	template<class T> bool compare(T pFirst, T pSecond) {
+		if (sOperator == "=") {
+			return pFirst == pSecond;
+		}
+		else if (sOperator == ">") {
+			return pFirst > pSecond;
+		}
+		else if (sOperator == "<") {
+			return pFirst < pSecond;
+		}
+		else if (sOperator == ">=") {
+			return pFirst >= pSecond;
+		}
+		return pFirst <= pSecond;
+	}
+};
+
+
+
+/**
+* This node compares two integers.
+*
+* @author	Christian-2003
+* @version	19.10.2026
+*/
+class CIntCompareNode : public CCompareNode {
+public:
+	/**
+	* This constructor takes over the operator and operands of the passed operation.
+	*
+	* @param pOperation	Operation, which is replaced.
+	*/
+	CIntCompareNode(COperationNode& pOperation) : CCompareNode(pOperation) {
+		//Does nothing...
+	}
+
+
+
+public:
+	short int execute(CSpecializingNode*& pSelf, CNodeFrame& pFrame, CValue& pResult);
+};
+
+
+
+/**
+* This node compares two numbers, of which at least one has been a double.
+*
+* @author	Christian-2003
+* @version	19.10.2026
+*/
+class CDoubleCompareNode : public CCompareNode {
+public:
+	/**
+	* This constructor takes over the operator and operands of the passed operation.
+	*
+	* @param pOperation	Operation, which is replaced.
+	*/
+	CDoubleCompareNode(COperationNode& pOperation) : CCompareNode(pOperation) {
+		//Does nothing...
+	}
+
+
+
+public:
+	short int execute(CSpecializingNode*& pSelf, CNodeFrame& pFrame, CValue& pResult) {
+		CValue lValues[MAX_SPECIALIZED_OPERANDS];
+		short int nErrorMessage = evaluateOperands(pFrame, lValues, pResult);
+		if (nErrorMessage != Error::SUCCESS) {
+			return nErrorMessage;
+		}
+		short int nFirstType = lValues[0].getType();
+		short int nSecondType = lValues[1].getType();
+		if ((nFirstType != Token::U_INT && nFirstType != Token::U_DOUBLE) || (nSecondType != Token::U_INT && nSecondType != Token::U_DOUBLE)) {
+			//Operand types have changed:
+			return deoptimize(pSelf, lValues, pResult);
+		}
+		bool bResult = sOperator == "!" ? !pContext->getOperations().equalLexemes(lValues[0], lValues[1]) : compare<double>(lValues[0].getNumber(), lValues[1].getNumber());
+		pResult.setBool(bResult);
+		pResult.setLine(head.getLine());
+		return Error::SUCCESS;
+	}
+};
+
+
+
+/**
+* This node evaluates "&" or "|" for boolean operands.
+*
+* @author	Christian-2003
+* @version	19.10.2026
+*/
+class CBoolLogicNode : public CSpecializedOperationNode {
+public:
+	/**
+	* This constructor takes over the operator and operands of the passed operation.
+	*
+	* @param pOperation	Operation, which is replaced.
+	*/
+	CBoolLogicNode(COperationNode& pOperation) : CSpecializedOperationNode(pOperation) {
+		//Does nothing...
+	}
+
+
+
+public:
+	short int execute(CSpecializingNode*& pSelf, CNodeFrame& pFrame, CValue& pResult) {
+		CValue lValues[MAX_SPECIALIZED_OPERANDS];
+		short int nErrorMessage = evaluateOperands(pFrame, lValues, pResult);
+		if (nErrorMessage != Error::SUCCESS) {
+			return nErrorMessage;
+		}
+		bool bAnd = sOperator == "&";
+		bool bResult = bAnd;
+		for (unsigned int i = 0; i < lOperands.size(); i++) {
+			if (lValues[i].getType() != Token::U_BOOL) {
+				//Operand types have changed:
+				return deoptimize(pSelf, lValues, pResult);
+			}
+			bResult = bAnd ? bResult && lValues[i].getBool() : bResult || lValues[i].getBool();
+		}
+		pResult.setBool(bResult);
+		pResult.setLine(head.getLine());
+		return Error::SUCCESS;
+	}
+};
+
+
+
+/**
+* This node compares two integers. If one of the operands turns out to be a double, the node is replaced with a
+* CDoubleCompareNode.
+*/
+inline short int CIntCompareNode::execute(CSpecializingNode*& pSelf, CNodeFrame& pFrame, CValue& pResult) {
+	CValue lValues[MAX_SPECIALIZED_OPERANDS];
+	short int nErrorMessage = evaluateOperands(pFrame, lValues, pResult);
+	if (nErrorMessage != Error::SUCCESS) {
+		return nErrorMessage;
+	}
+	if (lValues[0].getType() != Token::U_INT || lValues[1].getType() != Token::U_INT) {
+		//Operand types have changed:
+		CSpecializingNode* pReplacement = pContext->adopt(new CDoubleCompareNode(*this));
+		pSelf = pReplacement;
+		pContext->countSpecialization();
+		for (unsigned int i = 0; i < 2; i++) {
+			if (lValues[i].getType() != Token::U_INT && lValues[i].getType() != Token::U_DOUBLE) {
+				return deoptimize(pSelf, lValues, pResult);
+			}
+		}
+		vector<CValue> lOperandValues(lValues, lValues + 2);
+		return evaluateGeneric(lOperandValues, pResult);
+	}
+	bool bResult = sOperator == "!" ? !pContext->getOperations().equalLexemes(lValues[0], lValues[1]) : compare<int>(lValues[0].getInt(), lValues[1].getInt());
+	pResult.setBool(bResult);
+	pResult.setLine(head.getLine());
+	return Error::SUCCESS;
+}
+
+
+
+/**
+* Every operation starts with this node. It evaluates the operation generically once and replaces itself with a node,
+* which is specialized on the types of the observed operands.
+*
+* @author	Christian-2003
+* @version	19.10.2026
+*/
+class CUninitializedOperationNode : public COperationNode {
+public:
+	/**
+	* This constructor instantiates a new operation.
+	*
+	* @param ppContext		Context of the program.
+	* @param pHead			Head node of the operation.
+	* @param pnOperatorType	Type of the operator.
+	* @param plOperands		Nodes of the operands.
+	*/
+	CUninitializedOperationNode(CNodeContext* ppContext, CValue pHead, short int pnOperatorType, vector<CSpecializingNode*> plOperands) : COperationNode(ppContext, pHead, pnOperatorType, plOperands) {
+		//Does nothing...
+	}
+
+
+
+public:
+	short int execute(CSpecializingNode*& pSelf, CNodeFrame& pFrame, CValue& pResult) {
+		vector<CValue> lValues(lOperands.size());
+		short int nErrorMessage = evaluateOperands(pFrame, lValues.data(), pResult);
+		if (nErrorMessage != Error::SUCCESS) {
+			return nErrorMessage;
+		}
+		specialize(pSelf, lValues);
+		return evaluateGeneric(lValues, pResult);
+	}
+
+
+
+private:
+	/**
+	* Replaces this node with the node, which fits the types of the passed operands best.
+	*
+	* @param pSelf		Reference to the parent's pointer to this node.
+	* @param plValues	Values of the operands.
+	*/
+	void specialize(CSpecializingNode*& pSelf, vector<CValue>& plValues) {
+		bool bIntegers = true;
+		bool bNumbers = true;
+		bool bBooleans = true;
+		for (unsigned int i = 0; i < plValues.size(); i++) {
+			short int nType = plValues[i].getType();
+			bIntegers = bIntegers && nType == Token::U_INT;
+			bNumbers = bNumbers && (nType == Token::U_INT || nType == Token::U_DOUBLE);
+			bBooleans = bBooleans && nType == Token::U_BOOL;
+		}
+
+		if (plValues.size() < 2 || plValues.size() > MAX_SPECIALIZED_OPERANDS) {
+			rewrite<CGenericOperationNode>(pSelf);
+			return;
+		}
+		else if (nOperatorType == Token::OPERATOR_ARITHMETIC && bIntegers && sOperator != "/") {
+			rewrite<CIntArithmeticNode>(pSelf);
+		}
+		else if (nOperatorType == Token::OPERATOR_ARITHMETIC && bNumbers) {
+			rewrite<CDoubleArithmeticNode>(pSelf);
+		}
+		else if (nOperatorType == Token::OPERATOR_RELATIONAL && plValues.size() == 2 && bIntegers) {
+			rewrite<CIntCompareNode>(pSelf);
+		}
+		else if (nOperatorType == Token::OPERATOR_RELATIONAL && plValues.size() == 2 && bNumbers) {
+			rewrite<CDoubleCompareNode>(pSelf);
+		}
+		else if (nOperatorType == Token::OPERATOR_BOOL && bBooleans) {
+			rewrite<CBoolLogicNode>(pSelf);
+		}
+		else {
+			rewrite<CGenericOperationNode>(pSelf);
+			return;
+		}
+		pContext->countSpecialization();
+	}
+};
+
+
+
+/**
+* This node calls a Lisp-function (equivalent to "CInterpreter::callFunction()").
+*
+* @author	Christian-2003
+* @version	19.10.2026
+*/
+class CCallNode : public CSpecializingNode {
+private:
+	/**
+	* Stores the context of the program.
+	*/
+	CNodeContext* pContext;
+
+	/**
+	* Stores the interned name of the function.
+	*/
+	const string* psName;
+
+	/**
+	* Stores the token of the function name.
+	*/
+	CValue name;
+
+	/**
+	* Stores the nodes of the arguments.
+	*/
+	vector<CSpecializingNode*> lArguments;
+
+	/**
+	* Stores the called function, after it has been searched once.
+	*/
+	CNodeFunction* pFunction;
+
+	/**
+	* Stores whether the function has been searched.
+	*/
+	bool bResolved;
+
+	/**
+	* Stores whether a variable with the function's name would be read instead of calling the function. This is the
+	* case for identifiers without arguments.
+	*/
+	bool bCheckVariable;
+
+	/**
+	* Stores the function, whose return statement consists of this call, or NULL if the call is not in tail position.
+	*/
+	CNodeFunction* pCaller;
+
+
+
+public:
+	/**
+	* This constructor instantiates a new function call.
+	*
+	* @param ppContext			Context of the program.
+	* @param ppsName			Interned name of the function.
+	* @param pName				Token of the function name.
+	* @param plArguments		Nodes of the arguments.
+	* @param pbCheckVariable	Whether a variable with the function's name would be read instead.
+	* @param ppCaller			Function, whose return statement consists of the call, or NULL.
+	*/
+	CCallNode(CNodeContext* ppContext, const string* ppsName, CValue pName, vector<CSpecializingNode*> plArguments, bool pbCheckVariable, CNodeFunction* ppCaller) {
+		pContext = ppContext;
+		psName = ppsName;
+		name = pName;
+		lArguments = plArguments;
+		pFunction = NULL;
+		bResolved = false;
+		bCheckVariable = pbCheckVariable;
+		pCaller = ppCaller;
+	}
+
+
+
+public:
+	short int execute(CSpecializingNode*& pSelf, CNodeFrame& pFrame, CValue& pResult);
+
+	static short int call(CNodeFunction* pFunction, CNodeFrame& pFrame, CValue& pResult, const CValue& pName);
+};
+
+
+
+/**
+* This node reads a variable or calls a function, depending on whether a variable with the identifier's name exists.
+* It replaces nodes, whose guess of the identifier's meaning was incorrect.
+*
+* @author	Christian-2003
+* @version	19.10.2026
+*/
+class CGenericIdentifierNode : public CSpecializingNode {
+private:
+	/**
+	* Stores the interned name of the identifier.
+	*/
+	const string* psName;
+
+	/**
+	* Stores the line of the identifier.
+	*/
+	unsigned int nLine;
+
+	/**
+	* Stores the node, which calls the function.
+	*/
+	CSpecializingNode* pCall;
+
+
+
+public:
+	/**
+	* This constructor instantiates a new identifier.
+	*
+	* @param ppContext	Context of the program.
+	* @param ppsName	Interned name of the identifier.
+	* @param pName		Token of the identifier.
+	*/
+	CGenericIdentifierNode(CNodeContext* ppContext, const string* ppsName, CValue pName) {
+		psName = ppsName;
+		nLine = pName.getLine();
+		pCall = ppContext->adopt(new CCallNode(ppContext, ppsName, pName, vector<CSpecializingNode*>(), false, NULL));
+	}
+
+
+
+public:
+	short int execute(CSpecializingNode*&, CNodeFrame& pFrame, CValue& pResult) {
+		int nSlot = pFrame.find(psName);
+		if (nSlot >= 0) {
+			//Identifier resembles variable name:
+			pResult = pFrame.getValue(nSlot);
+			pResult.setLine(nLine);
+			return Error::SUCCESS;
+		}
+		return pCall->execute(pCall, pFrame, pResult);
+	}
+};
+
+
+
+/**
+* This node reads the variable in a specific slot. The slot is guarded by the variable's name, if another variable is
+* stored in the slot, the node is replaced with a CGenericIdentifierNode.
+*
+* @author	Christian-2003
+* @version	19.10.2026
+*/
+class CSlotReadNode : public CSpecializingNode {
+private:
+	/**
+	* Stores the context of the program.
+	*/
+	CNodeContext* pContext;
+
+	/**
+	* Stores the interned name of the variable.
+	*/
+	const string* psName;
+
+	/**
+	* Stores the token of the identifier.
+	*/
+	CValue name;
+
+	/**
+	* Stores the slot of the variable.
+	*/
+	unsigned int nSlot;
+
+
+
+public:
+	/**
+	* This constructor instantiates a new variable read.
+	*
+	* @param ppContext	Context of the program.
+	* @param ppsName	Interned name of the variable.
+	* @param pName		Token of the identifier.
+	* @param pnSlot		Slot of the variable.
+	*/
+	CSlotReadNode(CNodeContext* ppContext, const string* ppsName, CValue pName, unsigned int pnSlot) {
+		pContext = ppContext;
+		psName = ppsName;
+		name = pName;
+		nSlot = pnSlot;
+	}
+
+
+
+public:
+	short int execute(CSpecializingNode*& pSelf, CNodeFrame& pFrame, CValue& pResult) {
+		if (!pFrame.isSlot(nSlot, psName)) {
+			//The variable is stored in a different slot or does not exist:
+			pSelf = pContext->adopt(new CGenericIdentifierNode(pContext, psName, name));
+			pContext->countDeoptimization();
+			return pSelf->execute(pSelf, pFrame, pResult);
+		}
+		pResult = pFrame.getValue(nSlot);
+		pResult.setLine(name.getLine());
+		return Error::SUCCESS;
+	}
+};
+
+
+
+/**
+* Every identifier without arguments starts with this node. When executed, it replaces itself either with a node,
+* that reads the variable's slot, or with a function call.
+*
+* @author	Christian-2003
+* @version	19.10.2026
+*/
+class CUninitializedIdentifierNode : public CSpecializingNode {
+private:
+	/**
+	* Stores the context of the program.
+	*/
+	CNodeContext* pContext;
+
+	/**
+	* Stores the interned name of the identifier.
+	*/
+	const string* psName;
+
+	/**
+	* Stores the token of the identifier.
+	*/
+	CValue name;
+
+
+
+public:
+	/**
+	* This constructor instantiates a new identifier.
+	*
+	* @param ppContext	Context of the program.
+	* @param ppsName	Interned name of the identifier.
+	* @param pName		Token of the identifier.
+	*/
+	CUninitializedIdentifierNode(CNodeContext* ppContext, const string* ppsName, CValue pName) {
+		pContext = ppContext;
+		psName = ppsName;
+		name = pName;
+	}
+
+
+
+public:
+	short int execute(CSpecializingNode*& pSelf, CNodeFrame& pFrame, CValue& pResult) {
+		int nSlot = pFrame.find(psName);
+		if (nSlot >= 0) {
+			//Identifier resembles variable name:
+			pSelf = pContext->adopt(new CSlotReadNode(pContext, psName, name, nSlot));
+		}
+		else {
+			//Identifier resembles a function name:
+			pSelf = pContext->adopt(new CCallNode(pContext, psName, name, vector<CSpecializingNode*>(), true, NULL));
+		}
+		pContext->countSpecialization();
+		return pSelf->execute(pSelf, pFrame, pResult);
+	}
+};
+
+
+
+/**
+* Calls the function. If the function is called without arguments and a variable with the function's name exists,
+* the node is replaced with a CGenericIdentifierNode.
+*/
+inline short int CCallNode::execute(CSpecializingNode*& pSelf, CNodeFrame& pFrame, CValue& pResult) {
+	if (bCheckVariable && pFrame.find(psName) >= 0) {
+		//Identifier resembles variable name:
+		pSelf = pContext->adopt(new CGenericIdentifierNode(pContext, psName, name));
+		pContext->countDeoptimization();
+		return pSelf->execute(pSelf, pFrame, pResult);
+	}
+
+	//Evaluate the arguments into the frame of the called function:
+	CNodeFrame calleeFrame;
+	for (unsigned int i = 0; i < lArguments.size(); i++) {
+		short int nErrorMessage = lArguments[i]->execute(lArguments[i], pFrame, pResult);
+		if (nErrorMessage != Error::SUCCESS) {
+			//An error occured:
+			return nErrorMessage;
+		}
+		calleeFrame.declare(NULL, pResult);
+	}
+
+	if (!bResolved) {
+		pFunction = pContext->getFunction(*psName);
+		bResolved = true;
+	}
+	if (pFunction == NULL) {
+		//The called function does not exist:
+		pResult = name;
+		return Error::Interpreter::FUNCTION_DOES_NOT_EXIST;
+	}
+	else if (pFunction->getParameterTypes().size() != lArguments.size()) {
+		//Incorrect number of arguments are passed:
+		pResult = name;
+		return Error::Interpreter::INCORRECT_NUMBER_OF_ARGUMENTS_PASSED;
+	}
+	for (unsigned int i = 0; i < lArguments.size(); i++) {
+		if (calleeFrame.getValue(i).getType() != pFunction->getParameterTypes()[i]) {
+			//Error: The passed type is not identical with the parameter type:
+			pResult = calleeFrame.getValue(i);
+			return Error::produceConvertError(pResult.getType(), pFunction->getParameterTypes()[i]);
+		}
+		calleeFrame.rename(i, pFunction->getParameterNames()[i]);
+	}
+
+	if (pCaller != NULL && pFunction->getReturnType() == pCaller->getReturnType()) {
+		//The conversion of the return value cannot fail -> Reuse the frame of the calling function:
+		pFrame.reuse(pFunction, calleeFrame);
+		pResult = name;
+		return Error::Interpreter::INFO_TAIL_CALL;
+	}
+	return call(pFunction, calleeFrame, pResult, name);
+}
+
+
+
+/**
+* Executes the expressions of the passed function within the passed frame, which contains the parameters. Every
+* function, which is called in tail position, is executed within the same frame.
+*/
+inline short int CCallNode::call(CNodeFunction* pFunction, CNodeFrame& pFrame, CValue& pResult, const CValue& pName) {
+	CNodeFunction* pCalled = pFunction; //Stores the function, which is executed within the frame.
+	while (true) {
+		//Execute the function's expressions:
+		short int nErrorMessage = Error::SUCCESS;
+		vector<CSpecializingNode*>& lBody = pCalled->getBody();
+		for (unsigned int i = 0; i < lBody.size(); i++) {
+			nErrorMessage = lBody[i]->execute(lBody[i], pFrame, pResult);
+			if (nErrorMessage != Error::SUCCESS) {
+				break;
+			}
+		}
+		if (nErrorMessage == Error::Interpreter::INFO_TAIL_CALL) {
+			//The frame has been reused for the called function:
+			pCalled = pFrame.getTailFunction();
+			continue;
+		}
+		if (nErrorMessage == Error::Interpreter::INFO_RETURN_STATEMENT_ENCOUNTERED) {
+			//The function's execution was terminated through a return statement:
+			if (pCalled->getReturnType() == Token::U_VOID) {
+				break;
+			}
+			if (pResult.getType() != pCalled->getReturnType()) {
+				return Error::produceConvertError(pResult.getType(), pCalled->getReturnType());
+			}
+			return Error::SUCCESS;
+		}
+		else if (nErrorMessage != Error::SUCCESS) {
+			//An error occured:
+			return nErrorMessage;
+		}
+		break;
+	}
+	pResult = pName;
+	return Error::SUCCESS;
+}
+
+
+
+/**
+* This node declares a new variable.
+*
+* @author	Christian-2003
+* @version	19.10.2026
+*/
+class CDeclarationNode : public CSpecializingNode {
+private:
+	/**
+	* Stores the interned name of the variable.
+	*/
+	const string* psName;
+
+	/**
+	* Stores the token of the variable's name.
+	*/
+	CValue name;
+
+	/**
+	* Stores the standard value of the variable.
+	*/
+	CValue standardValue;
+
+	/**
+	* Stores the node of the initializer or NULL, if the variable is initialized with the standard value.
+	*/
+	CSpecializingNode* pInitializer;
+
+
+
+public:
+	/**
+	* This constructor instantiates a new declaration.
+	*
+	* @param ppsName		Interned name of the variable.
+	* @param pName			Token of the variable's name.
+	* @param pStandardValue	Standard value of the variable.
+	* @param ppInitializer	Node of the initializer or NULL.
+	*/
+	CDeclarationNode(const string* ppsName, CValue pName, CValue pStandardValue, CSpecializingNode* ppInitializer) {
+		psName = ppsName;
+		name = pName;
+		standardValue = pStandardValue;
+		pInitializer = ppInitializer;
+	}
+
+
+
+public:
+	short int execute(CSpecializingNode*&, CNodeFrame& pFrame, CValue& pResult) {
+		if (pInitializer != NULL) {
+			short int nErrorMessage = pInitializer->execute(pInitializer, pFrame, pResult);
+			if (nErrorMessage != Error::SUCCESS) {
+				//An error occured:
+				return nErrorMessage;
+			}
+			else if (pResult.getType() != standardValue.getType()) {
+				return Error::produceConvertError(pResult.getType(), standardValue.getType());
+			}
+		}
+		else {
+			pResult = standardValue;
+		}
+		if (pFrame.find(psName) >= 0) {
+			//Variable's name does already exist:
+			pResult = name;
+			return Error::Interpreter::VARIABLE_NAME_ALREADY_IN_USE;
+		}
+		pFrame.declare(psName, pResult);
+		pResult = name;
+		return Error::SUCCESS;
+	}
+};
+
+
+
+/**
+* This node changes the value of a variable. The slot of the variable is cached.
+*
+* @author	Christian-2003
+* @version	19.10.2026
+*/
+class CSetNode : public CSpecializingNode {
+private:
+	/**
+	* Stores the interned name of the variable.
+	*/
+	const string* psName;
+
+	/**
+	* Stores the token of the variable's name.
+	*/
+	CValue name;
+
+	/**
+	* Stores the node of the new value.
+	*/
+	CSpecializingNode* pValue;
+
+	/**
+	* Stores the slot, in which the variable was found the last time.
+	*/
+	int nSlot;
+
+
+
+public:
+	/**
+	* This constructor instantiates a new set-node.
+	*
+	* @param ppsName	Interned name of the variable.
+	* @param pName		Token of the variable's name.
+	* @param ppValue	Node of the new value.
+	*/
+	CSetNode(const string* ppsName, CValue pName, CSpecializingNode* ppValue) {
+		psName = ppsName;
+		name = pName;
+		pValue = ppValue;
+		nSlot = -1;
+	}
+
+
+
+public:
+	short int execute(CSpecializingNode*&, CNodeFrame& pFrame, CValue& pResult) {
+		short int nErrorMessage = pValue->execute(pValue, pFrame, pResult);
+		if (nErrorMessage != Error::SUCCESS) {
+			//An error occured:
+			return nErrorMessage;
+		}
+		if (!pFrame.isSlot(nSlot, psName)) {
+			nSlot = pFrame.find(psName);
+		}
+		if (nSlot < 0) {
+			//Variable does not exist:
+			pResult = name;
+			return Error::Interpreter::VARIABLE_DOES_NOT_EXIST;
+		}
+		CValue& variable = pFrame.getValue(nSlot);
+		if (variable.getType() != pResult.getType()) {
+			//Error: New value has different data-type:
+			nErrorMessage = Error::produceConvertError(pResult.getType(), variable.getType());
+		}
+		else {
+			variable = pResult;
+		}
+		pResult = name;
+		return nErrorMessage;
+	}
+};
+
+
+
+/**
+* This node prints it's arguments.
+*
+* @author	Christian-2003
+* @version	19.10.2026
+*/
+class CPrintNode : public CSpecializingNode {
+private:
+	/**
+	* Stores the print-keyword.
+	*/
+	CValue head;
+
+	/**
+	* Stores the nodes of the printed values.
+	*/
+	vector<CSpecializingNode*> lValues;
+
+	/**
+	* Stores whether a line break is printed afterwards.
+	*/
+	bool bLineBreak;
+
+	/**
+	* Stores the stream, into which the values are printed.
+	*/
+	ostream* pOutput;
+
+
+
+public:
+	/**
+	* This constructor instantiates a new print-node.
+	*
+	* @param pHead			Print-keyword.
+	* @param plValues		Nodes of the printed values.
+	* @param pbLineBreak	Whether a line break is printed afterwards.
+	* @param pOutputStream	Stream, into which the values are printed.
+	*/
+	CPrintNode(CValue pHead, vector<CSpecializingNode*> plValues, bool pbLineBreak, ostream& pOutputStream) {
+		head = pHead;
+		lValues = plValues;
+		bLineBreak = pbLineBreak;
+		pOutput = &pOutputStream;
+	}
+
+
+
+public:
+	short int execute(CSpecializingNode*&, CNodeFrame& pFrame, CValue& pResult) {
+		for (unsigned int i = 0; i < lValues.size(); i++) {
+			short int nErrorMessage = lValues[i]->execute(lValues[i], pFrame, pResult);
+			if (nErrorMessage != Error::SUCCESS) {
+				//An error occured:
+				return nErrorMessage;
+			}
+			*pOutput << pResult.getLexeme();
+		}
+		if (bLineBreak) {
+			*pOutput << "\n";
+		}
+		pResult = head;
+		return Error::SUCCESS;
+	}
+};
+
+
+
+/**
+* This node returns from a function.
+*
+* @author	Christian-2003
+* @version	19.10.2026
+*/
+class CReturnNode : public CSpecializingNode {
+private:
+	/**
+	* Stores the node of the returned value.
+	*/
+	CSpecializingNode* pValue;
+
+
+
+public:
+	/**
+	* This constructor instantiates a new return-node.
+	*
+	* @param ppValue	Node of the returned value.
+	*/
+	CReturnNode(CSpecializingNode* ppValue) {
+		pValue = ppValue;
+	}
+
+
+
+public:
+	short int execute(CSpecializingNode*&, CNodeFrame& pFrame, CValue& pResult) {
+		short int nErrorMessage = pValue->execute(pValue, pFrame, pResult);
+		if (nErrorMessage != Error::SUCCESS) {
+			//An error occured:
+			return nErrorMessage;
+		}
+		return Error::Interpreter::INFO_RETURN_STATEMENT_ENCOUNTERED;
+	}
+};
+
+
+
+/**
+* This is the base class of the if-statement and the while-loop.
+*
+* @author	Christian-2003
+* @version	19.10.2026
+*/
+class CControlNode : public CSpecializingNode {
+protected:
+	/**
+	* Stores the keyword of the control structure.
+	*/
+	CValue head;
+
+	/**
+	* Stores the node of the condition.
+	*/
+	CSpecializingNode* pCondition;
+
+
+
+protected:
+	/**
+	* Evaluates the condition. If the condition is no boolean, the control structure is terminated with the error message
+	* of the interpreter, which is Error::SUCCESS for some datatypes.
+	*
+	* @param pFrame		Variables of the current function call.
+	* @param pResult	Value of the condition.
+	* @param pbValid	Whether the condition resembles a boolean.
+	* @return			Error message.
+	*/
+	short int evaluateCondition(CNodeFrame& pFrame, CValue& pResult, bool& pbValid) {
+		pbValid = false;
+		short int nErrorMessage = pCondition->execute(pCondition, pFrame, pResult);
+		if (nErrorMessage != Error::SUCCESS) {
+			//An error occured:
+			return nErrorMessage;
+		}
+		else if (pResult.getType() != Token::U_BOOL) {
+			//Error: Incorrect datatype encountered:
+			return Error::produceConvertError(pResult.getType(), Token::U_BOOL);
+		}
+		pbValid = true;
+		return Error::SUCCESS;
+	}
+
+	/**
+	* Executes the passed body. Variables, which are declared within the body, are removed afterwards.
+	*
+	* @param plBody		Nodes of the body.
+	* @param pFrame		Variables of the current function call.
+	* @param pResult	Token which caused an error.
+	* @return			Error message.
+	*/
+	short int executeBody(vector<CSpecializingNode*>& plBody, CNodeFrame& pFrame, CValue& pResult) {
+		unsigned int nFrameSize = pFrame.getSize();
+		for (unsigned int i = 0; i < plBody.size(); i++) {
+			short int nErrorMessage = plBody[i]->execute(plBody[i], pFrame, pResult);
+			if (nErrorMessage != Error::SUCCESS) {
+				//An error occured:
+				return nErrorMessage;
+			}
+		}
+		pFrame.truncate(nFrameSize);
+		return Error::SUCCESS;
+	}
+};
+
+
+
+/**
+* This node executes an if-statement.
+*
+* @author	Christian-2003
+* @version	19.10.2026
+*/
+class CIfNode : public CControlNode {
+private:
+	/**
+	* Stores the nodes of the body.
+	*/
+	vector<CSpecializingNode*> lBody;
+
+	/**
+	* Stores the nodes of the else-body.
+	*/
+	vector<CSpecializingNode*> lElseBody;
+
+	/**
+	* Stores the number of subtrees of the if-statement.
+	*/
+	unsigned int nSubTrees;
+
+
+
+public:
+	/**
+	* This constructor instantiates a new if-node.
+	*
+	* @param pHead			If-keyword.
+	* @param ppCondition	Node of the condition.
+	* @param plBody			Nodes of the body.
+	* @param plElseBody		Nodes of the else-body.
+	* @param pnSubTrees		Number of subtrees of the if-statement.
+	*/
+	CIfNode(CValue pHead, CSpecializingNode* ppCondition, vector<CSpecializingNode*> plBody, vector<CSpecializingNode*> plElseBody, unsigned int pnSubTrees) {
+		head = pHead;
+		pCondition = ppCondition;
+		lBody = plBody;
+		lElseBody = plElseBody;
+		nSubTrees = pnSubTrees;
+	}
+
+
+
+public:
+	short int execute(CSpecializingNode*&, CNodeFrame& pFrame, CValue& pResult) {
+		bool bValid = false;
+		short int nErrorMessage = evaluateCondition(pFrame, pResult, bValid);
+		if (!bValid) {
+			return nErrorMessage;
+		}
+		else if (nSubTrees < 2) {
+			//Error no body found:
+			pResult = head;
+			return Error::Interpreter::MISSING_BODY;
+		}
+		if (pResult.getBool()) {
+			nErrorMessage = executeBody(lBody, pFrame, pResult);
+		}
+		else if (nSubTrees >= 3) {
+			nErrorMessage = executeBody(lElseBody, pFrame, pResult);
+		}
+		if (nErrorMessage != Error::SUCCESS) {
+			//An error occured:
+			return nErrorMessage;
+		}
+		pResult = head;
+		return Error::SUCCESS;
+	}
+};
+
+
+
+/**
+* This node executes a while-loop.
+*
+* @author	Christian-2003
+* @version	19.10.2026
+*/
+class CWhileNode : public CControlNode {
+private:
+	/**
+	* Stores the nodes of the body.
+	*/
+	vector<CSpecializingNode*> lBody;
+
+	/**
+	* Stores the number of subtrees of the while-loop.
+	*/
+	unsigned int nSubTrees;
+
+	/**
+	* Stores the first superfluous subtree of the while-loop.
+	*/
+	CValue superfluousArgument;
+
+
+
+public:
+	/**
+	* This constructor instantiates a new while-node.
+	*
+	* @param pHead					While-keyword.
+	* @param ppCondition			Node of the condition.
+	* @param plBody					Nodes of the body.
+	* @param pnSubTrees				Number of subtrees of the while-loop.
+	* @param pSuperfluousArgument	First superfluous subtree of the while-loop.
+	*/
+	CWhileNode(CValue pHead, CSpecializingNode* ppCondition, vector<CSpecializingNode*> plBody, unsigned int pnSubTrees, CValue pSuperfluousArgument) {
+		head = pHead;
+		pCondition = ppCondition;
+		lBody = plBody;
+		nSubTrees = pnSubTrees;
+		superfluousArgument = pSuperfluousArgument;
+	}
+
+
+
+public:
+	short int execute(CSpecializingNode*&, CNodeFrame& pFrame, CValue& pResult) {
+		//The condition is evaluated once before the loop begins:
+		bool bValid = false;
+		short int nErrorMessage = evaluateCondition(pFrame, pResult, bValid);
+		if (!bValid) {
+			return nErrorMessage;
+		}
+		while (true) {
+			nErrorMessage = evaluateCondition(pFrame, pResult, bValid);
+			if (!bValid) {
+				return nErrorMessage;
+			}
+			else if (!pResult.getBool()) {
+				//The condition is false -> End the iteration of the while-loop:
+				break;
+			}
+			else if (nSubTrees < 2) {
+				//Error: The body is missing:
+				pResult = head;
+				return Error::Interpreter::MISSING_BODY;
+			}
+			else if (nSubTrees > 2) {
+				//Error: The statement has too many arguments:
+				pResult = superfluousArgument;
+				return Error::Interpreter::TOO_MANY_ARGUMENTS;
+			}
+			nErrorMessage = executeBody(lBody, pFrame, pResult);
+			if (nErrorMessage != Error::SUCCESS) {
+				//An error occured:
+				return nErrorMessage;
+			}
+		}
+		pResult = head;
+		return Error::SUCCESS;
+	}
+};
+
+
+
+/**
+* The class "CSpecializingEvaluator" converts the abstract syntax trees of the Lisp-functions into a tree of nodes. Unlike
+* the CClosureCompiler, no types are analyzed before the execution. Instead, every operation and identifier starts
+* uninitialized and replaces itself with a specialized node after it has been executed once (e.g. a "+" for integers or
+* a variable read from a fixed slot). If the types change later on, the specialized node replaces itself with a generic
+* node. Therefore, loops converge towards nodes, which do not need to check the types of their operands again.
+* The nodes behave exactly like the CInterpreter (including the error messages).
+*
+* @author	Christian-2003
+* @version	19.10.2026
+*/
+class CSpecializingEvaluator {
+private:
+	/**
+	* Stores the nodes and functions of the program.
+	*/
+	CNodeContext context;
+
+	/**
+	* Stores the function, whose expressions are currently converted into nodes.
+	*/
+	CNodeFunction* pBuiltFunction;
+
+	/**
+	* Stores the filename of the sourcecode.
+	*/
+	string sFilename;
+
+
+
+public:
+	/**
+	* The default constructor instantiates a new evaluator.
+	*/
+	CSpecializingEvaluator() {
+		pBuiltFunction = NULL;
+		sFilename = "";
+	}
+
+	/**
+	* The nodes reference the context, which is why the evaluator must never be copied.
+	*/
+	CSpecializingEvaluator(const CSpecializingEvaluator&) = delete;
+
+
+
+public:
+	/**
+	* This function changes, whether the nodes of "&" and "|" skip their remaining operands once the result is decided.
+	*
+	* @param pbShortCircuit	Whether the operands are evaluated lazily.
+	*/
+	void setShortCircuit(bool pbShortCircuit) {
+		context.getOperations().setShortCircuit(pbShortCircuit);
+	}
+
+	/**
+	* This function changes the stream, into which the print-nodes print the values. It has to be changed before the
+	* functions are converted into nodes.
+	*
+	* @param pOutputStream	Stream, into which the output is printed.
+	*/
+	void setOutput(ostream& pOutputStream) {
+		context.setOutput(pOutputStream);
+	}
+
+
+
+public:
+	/**
+	* This function converts every passed Lisp-function into nodes.
+	*
+	* @param plFunctions	Lisp-functions.
+	* @return				Error message (Error::Interpreter::INFO_ENGINE_UNSUPPORTED if the sourcecode cannot be executed).
+	*/
+	short int build(CLinkedList<CFunction> plFunctions) {
+		vector<CNodeFunction>& lFunctions = context.getFunctions();
+		lFunctions.clear();
+		for (CFunction function : plFunctions) {
+			if (function.getReturnType() != Token::U_VOID && !function.alwaysReturns()) {
+				//The interpreter does not restore the caller's variables, if the function does not return a value:
+				return Error::Interpreter::INFO_ENGINE_UNSUPPORTED;
+			}
+			lFunctions.push_back(CNodeFunction(function.getName(), function.getReturnType()));
+			CLinkedList<CVariable> lParameters = function.getParameters();
+			for (CVariable parameter : lParameters) {
+				lFunctions.back().getParameterNames().push_back(context.intern(parameter.getName()));
+				lFunctions.back().getParameterTypes().push_back(parameter.getType());
+			}
+		}
+
+		unsigned int nIndex = 0;
+		for (CFunction function : plFunctions) {
+			pBuiltFunction = &lFunctions[nIndex];
+			CLinkedList<CAbstractSyntaxTree<CToken>> lExpressions = function.getExpressions();
+			for (CAbstractSyntaxTree<CToken> expression : lExpressions) {
+				CRV<CSpecializingNode*> rvNode = buildExpression(expression);
+				if (rvNode.getErrorMessage() != Error::SUCCESS) {
+					return rvNode.getErrorMessage();
+				}
+				lFunctions[nIndex].getBody().push_back(rvNode.getContent());
+			}
+			nIndex++;
+		}
+		return Error::SUCCESS;
+	}
+
+	/**
+	* This function executes the function at the passed index, as the interpreter executes the main-function.
+	*
+	* @param pnFunctionIndex	Index of the function.
+	* @return					Error message and token, which caused the error.
+	*/
+	CRV<CToken> execute(unsigned int pnFunctionIndex) {
+		vector<CSpecializingNode*>& lBody = context.getFunctions()[pnFunctionIndex].getBody();
+		CNodeFrame frame;
+		CValue result;
+		for (unsigned int i = 0; i < lBody.size(); i++) {
+			short int nErrorMessage = lBody[i]->execute(lBody[i], frame, result);
+			if (nErrorMessage == Error::Interpreter::INFO_TAIL_CALL) {
+				//The returned call is executed, before the return statement terminates the main-function:
+				CValue name = result;
+				nErrorMessage = CCallNode::call(frame.getTailFunction(), frame, result, name);
+				if (nErrorMessage == Error::SUCCESS) {
+					nErrorMessage = Error::Interpreter::INFO_RETURN_STATEMENT_ENCOUNTERED;
+				}
+			}
+			if (nErrorMessage != Error::SUCCESS) {
+				//An error occured:
+				return CRV<CToken>(result.toToken(sFilename), nErrorMessage);
+			}
+		}
+		return CRV<CToken>(CToken(), Error::SUCCESS);
+	}
+
+	/**
+	* Returns the number of nodes, that have been specialized.
+	*
+	* @return	Number of specializations.
+	*/
+	unsigned int getSpecializations() {
+		return context.getSpecializations();
+	}
+
+	/**
+	* Returns the number of nodes, that have been deoptimized.
+	*
+	* @return	Number of deoptimizations.
+	*/
+	unsigned int getDeoptimizations() {
+		return context.getDeoptimizations();
+	}
+
+
+
+private:
+	/**
+	* This function converts an expression into a node (equivalent to "CInterpreter::interpretExpression()").
+	*
+	* @param pAST	Abstract syntax tree of the expression.
+	* @return		Node.
+	*/
+	CRV<CSpecializingNode*> buildExpression(CAbstractSyntaxTree<CToken> pAST) {
+		short int nType = pAST.getContent().getType();
+		if (pAST.getContent().getFilename() != "") {
+			sFilename = pAST.getContent().getFilename();
+		}
+		if (nType == Token::OPERATOR_ARITHMETIC || nType == Token::OPERATOR_RELATIONAL || nType == Token::OPERATOR_BOOL) {
+			return buildOperation(pAST);
+		}
+		else if (nType == Token::KEYWORD) {
+			return buildKeyword(pAST);
+		}
+		else if (nType == Token::IDENTIFIER) {
+			return buildIdentifier(pAST);
+		}
+		//Incorrect token found:
+		return constant(CValue(), Error::Interpreter::SYNTAX_I);
+	}
+
+	/**
+	* This function converts an operation into a node (equivalent to "CInterpreter::evaluateOperation()").
+	*
+	* @param pAST	Abstract syntax tree of the operation.
+	* @return		Node.
+	*/
+	CRV<CSpecializingNode*> buildOperation(CAbstractSyntaxTree<CToken> pAST) {
+		CRV<CValue> rvHead = convertToken(pAST.getContent());
+		if (rvHead.getErrorMessage() != Error::SUCCESS || !pAST.hasSubTrees()) {
+			//The AST has no subtrees -> The current node is returned:
+			return constant(rvHead.getContent(), rvHead.getErrorMessage());
+		}
+		vector<CSpecializingNode*> lOperands;
+		CLinkedList<CAbstractSyntaxTree<CToken>> lSubTrees = pAST.getSubTrees();
+		for (CAbstractSyntaxTree<CToken> current : lSubTrees) {
+			CRV<CSpecializingNode*> rvOperand;
+			if (isPrimitive(current.getContent().getType())) {
+				rvOperand = literal(current.getContent(), Error::SUCCESS);
+			}
+			else if (current.getContent().getType() == Token::IDENTIFIER) {
+				rvOperand = buildExpression(current);
+			}
+			else {
+				rvOperand = buildOperation(current);
+			}
+			if (rvOperand.getErrorMessage() != Error::SUCCESS) {
+				return rvOperand;
+			}
+			lOperands.push_back(rvOperand.getContent());
+		}
+		return node(new CUninitializedOperationNode(&context, rvHead.getContent(), pAST.getContent().getType(), lOperands));
+	}
+
+	/**
+	* This function converts a keyword into a node (equivalent to "CInterpreter::evaluateKeyword()").
+	*
+	* @param pAST	Abstract syntax tree of the keyword.
+	* @return		Node.
+	*/
+	CRV<CSpecializingNode*> buildKeyword(CAbstractSyntaxTree<CToken> pAST) {
+		CRV<CValue> rvHead = convertToken(pAST.getContent());
+		CValue head = rvHead.getContent();
+		if (!pAST.hasSubTrees()) {
+			//Erorr: The AST has no subtrees:
+			return constant(head, Error::Interpreter::EMPTY_AST_I);
+		}
+		CLinkedList<CAbstractSyntaxTree<CToken>> lASTs = pAST.getSubTrees();
+		string sKeyword = head.getLexeme();
+
+		if (sKeyword == Keyword::INT || sKeyword == Keyword::DOUBLE || sKeyword == Keyword::BOOL || sKeyword == Keyword::CHAR || sKeyword == Keyword::STRING) {
+			//Declaration of a new variable:
+			CToken standardValue;
+			if (sKeyword == Keyword::INT) {
+				standardValue = CToken("0", Token::U_INT);
+			}
+			else if (sKeyword == Keyword::DOUBLE) {
+				standardValue = CToken("0.0", Token::U_DOUBLE);
+			}
+			else if (sKeyword == Keyword::BOOL) {
+				standardValue = CToken("nil", Token::U_BOOL);
+			}
+			else if (sKeyword == Keyword::CHAR) {
+				standardValue = CToken(" ", Token::U_CHAR);
+			}
+			else {
+				standardValue = CToken("", Token::U_STRING);
+			}
+			if (lASTs.front().getContent().getType() != Token::IDENTIFIER) {
+				//Error: Incorrect token found:
+				return literal(lASTs.front().getContent(), Error::Interpreter::INCORRECT_TOKEN);
+			}
+			CToken variableName = lASTs.retrieve(0).getContent();
+			if (lASTs.size() > 1) {
+				//There are too many arguments with this declaration:
+				return constant(head, Error::Interpreter::TOO_MANY_ARGUMENTS);
+			}
+			CSpecializingNode* pInitializer = NULL;
+			if (lASTs.size() == 1) {
+				CToken initializer = lASTs.front().getContent();
+				CRV<CSpecializingNode*> rvInitializer;
+				if (isPrimitive(initializer.getType()) && initializer.getType() != standardValue.getType()) {
+					//Error: Invalid datatype:
+					return literal(initializer, Error::produceConvertError(initializer.getType(), standardValue.getType()));
+				}
+				else if (isPrimitive(initializer.getType())) {
+					rvInitializer = literal(initializer, Error::SUCCESS);
+				}
+				else {
+					rvInitializer = buildExpression(lASTs.front());
+				}
+				if (rvInitializer.getErrorMessage() != Error::SUCCESS) {
+					return rvInitializer;
+				}
+				pInitializer = rvInitializer.getContent();
+			}
+			return node(new CDeclarationNode(context.intern(variableName.getLexeme()), CValue(variableName), CValue(standardValue), pInitializer));
+		}
+
+		else if (sKeyword == Keyword::SET) {
+			if (lASTs.size() < 2) {
+				return constant(head, Error::Interpreter::NOT_ENOUGH_ARGUMENTS);
+			}
+			else if (lASTs.size() > 2) {
+				return constant(head, Error::Interpreter::TOO_MANY_ARGUMENTS);
+			}
+			else if (lASTs.front().getContent().getType() != Token::IDENTIFIER) {
+				return literal(lASTs.front().getContent(), Error::Interpreter::INCORRECT_TOKEN);
+			}
+			CToken variableName = lASTs.retrieve(0).getContent();
+			CRV<CSpecializingNode*> rvValue = isPrimitive(lASTs.front().getContent().getType()) ? literal(lASTs.front().getContent(), Error::SUCCESS) : buildExpression(lASTs.front());
+			if (rvValue.getErrorMessage() != Error::SUCCESS) {
+				return rvValue;
+			}
+			return node(new CSetNode(context.intern(variableName.getLexeme()), CValue(variableName), rvValue.getContent()));
+		}
+
+		else if (sKeyword == Keyword::PRINT || sKeyword == Keyword::PRINTLN) {
+			vector<CSpecializingNode*> lValues;
+			for (CAbstractSyntaxTree<CToken> current : lASTs) {
+				CRV<CSpecializingNode*> rvValue;
+				if (current.hasSubTrees() || current.getContent().getType() == Token::IDENTIFIER) {
+					rvValue = buildExpression(current);
+				}
+				else if (isPrimitive(current.getContent().getType())) {
+					rvValue = literal(current.getContent(), Error::SUCCESS);
+				}
+				else {
+					//Encountered invalid token:
+					rvValue = literal(current.getContent(), Error::Interpreter::INCORRECT_TOKEN);
+				}
+				if (rvValue.getErrorMessage() != Error::SUCCESS) {
+					return rvValue;
+				}
+				lValues.push_back(rvValue.getContent());
+			}
+			return node(new CPrintNode(head, lValues, sKeyword == Keyword::PRINTLN, context.getOutput()));
+		}
+
+		else if (sKeyword == Keyword::IF || sKeyword == Keyword::WHILE) {
+			CAbstractSyntaxTree<CToken> tCondition = lASTs.front();
+			CRV<CSpecializingNode*> rvCondition = tCondition.hasSubTrees() ? buildExpression(tCondition) : literal(tCondition.getContent(), Error::SUCCESS);
+			if (rvCondition.getErrorMessage() != Error::SUCCESS) {
+				return rvCondition;
+			}
+			vector<CSpecializingNode*> lBody;
+			vector<CSpecializingNode*> lElseBody;
+			if (lASTs.size() >= 2) {
+				short int nErrorMessage = buildBody(lASTs[1], lBody);
+				if (nErrorMessage != Error::SUCCESS) {
+					return CRV<CSpecializingNode*>(NULL, nErrorMessage);
+				}
+			}
+			if (sKeyword == Keyword::IF) {
+				if (lASTs.size() >= 3) {
+					short int nErrorMessage = buildBody(lASTs[2], lElseBody);
+					if (nErrorMessage != Error::SUCCESS) {
+						return CRV<CSpecializingNode*>(NULL, nErrorMessage);
+					}
+				}
+				return node(new CIfNode(head, rvCondition.getContent(), lBody, lElseBody, lASTs.size()));
+			}
+			CValue superfluousArgument;
+			if (lASTs.size() > 2) {
+				CRV<CValue> rvArgument = convertToken(lASTs[2].getContent());
+				if (rvArgument.getErrorMessage() != Error::SUCCESS) {
+					return CRV<CSpecializingNode*>(NULL, rvArgument.getErrorMessage());
+				}
+				superfluousArgument = rvArgument.getContent();
+			}
+			return node(new CWhileNode(head, rvCondition.getContent(), lBody, lASTs.size(), superfluousArgument));
+		}
+
+		else if (sKeyword == Keyword::RETURN) {
+			if (lASTs.size() != 1) {
+				//Too many values encountered which could be returned:
+				return constant(head, Error::Interpreter::TOO_MANY_VALUES_TO_RETURN);
+			}
+			CAbstractSyntaxTree<CToken> tReturnValue = lASTs.front();
+			if (!tReturnValue.hasSubTrees() && isPrimitive(tReturnValue.getContent().getType())) {
+				return literal(tReturnValue.getContent(), Error::Interpreter::INFO_RETURN_STATEMENT_ENCOUNTERED);
+			}
+			CRV<CSpecializingNode*> rvValue;
+			if (tReturnValue.getContent().getType() == Token::IDENTIFIER && tReturnValue.hasSubTrees()) {
+				//A returned call may reuse the frame of the function:
+				rvValue = buildCall(tReturnValue, pBuiltFunction);
+			}
+			else {
+				rvValue = buildExpression(tReturnValue);
+			}
+			if (rvValue.getErrorMessage() != Error::SUCCESS) {
+				return rvValue;
+			}
+			return node(new CReturnNode(rvValue.getContent()));
+		}
+		//Found invalid keyword:
+		return constant(head, Error::Interpreter::INCORRECT_TOKEN);
+	}
+
+	/**
+	* This function converts the body of a control structure into nodes.
+	*
+	* @param pBody		Abstract syntax tree of the body.
+	* @param plNodes	List, to which the nodes are added.
+	* @return			Error message.
+	*/
+	short int buildBody(CAbstractSyntaxTree<CToken> pBody, vector<CSpecializingNode*>& plNodes) {
+		CLinkedList<CAbstractSyntaxTree<CToken>> lExpressions;
+		if (pBody.getContent().getType() != Token::BRANCH) {
+			//Only one expression is represented in the body:
+			lExpressions.add(pBody);
+		}
+		else {
+			lExpressions.addAll(pBody.getSubTrees());
+		}
+		for (CAbstractSyntaxTree<CToken> current : lExpressions) {
+			CRV<CSpecializingNode*> rvNode = buildExpression(current);
+			if (rvNode.getErrorMessage() != Error::SUCCESS) {
+				return rvNode.getErrorMessage();
+			}
+			plNodes.push_back(rvNode.getContent());
+		}
+		return Error::SUCCESS;
+	}
+
+	/**
+	* This function converts an identifier into a node (equivalent to "CInterpreter::evaluateIdentifier()").
+	*
+	* @param pAST	Abstract syntax tree of the identifier.
+	* @return		Node.
+	*/
+	CRV<CSpecializingNode*> buildIdentifier(CAbstractSyntaxTree<CToken> pAST) {
+		if (!pAST.hasSubTrees()) {
+			//Identifier resembles either a variable or a function call without arguments:
+			CRV<CValue> rvName = convertToken(pAST.getContent());
+			return node(new CUninitializedIdentifierNode(&context, context.intern(pAST.getContent().getLexeme()), rvName.getContent()));
+		}
+		return buildCall(pAST, NULL);
+	}
+
+	/**
+	* This function converts a function call with arguments into a node. A call in tail position reuses the frame of the
+	* calling function, if the called function has the same return type.
+	*
+	* @param pAST		Abstract syntax tree of the call.
+	* @param pCaller	Function, whose return statement consists of the call, or NULL.
+	* @return			Node.
+	*/
+	CRV<CSpecializingNode*> buildCall(CAbstractSyntaxTree<CToken> pAST, CNodeFunction* pCaller) {
+		CRV<CValue> rvName = convertToken(pAST.getContent());
+		const string* psName = context.intern(pAST.getContent().getLexeme());
+		vector<CSpecializingNode*> lArguments;
+		CLinkedList<CAbstractSyntaxTree<CToken>> lSubTrees = pAST.getSubTrees();
+		for (CAbstractSyntaxTree<CToken> current : lSubTrees) {
+			CRV<CSpecializingNode*> rvArgument;
+			if (current.hasSubTrees() || !isPrimitive(current.getContent().getType())) {
+				rvArgument = buildExpression(current);
+			}
+			else {
+				rvArgument = literal(current.getContent(), Error::SUCCESS);
+			}
+			if (rvArgument.getErrorMessage() != Error::SUCCESS) {
+				return rvArgument;
+			}
+			lArguments.push_back(rvArgument.getContent());
+		}
+		return node(new CCallNode(&context, psName, rvName.getContent(), lArguments, false, pCaller));
+	}
+
+
+
+private:
+	/**
+	* Transfers the ownership of the passed node to the context.
+	*
+	* @param pNode	Node.
+	* @return		Node.
+	*/
+	CRV<CSpecializingNode*> node(CSpecializingNode* pNode) {
+		return CRV<CSpecializingNode*>(context.adopt(pNode), Error::SUCCESS);
+	}
+
+	/**
+	* Creates a node, which returns the passed value and error message.
+	*
+	* @param pValue			Value, which is returned.
+	* @param pnErrorMessage	Error message, which is returned.
+	* @return				Node.
+	*/
+	CRV<CSpecializingNode*> constant(CValue pValue, short int pnErrorMessage) {
+		if (pnErrorMessage == Error::Interpreter::INFO_ENGINE_UNSUPPORTED) {
+			return CRV<CSpecializingNode*>(NULL, pnErrorMessage);
+		}
+		return node(new CConstantNode(pValue, pnErrorMessage));
+	}
+
+	/**
+	* Creates a node, which returns the passed token and error message.
+	*
+	* @param pToken			Token, which is returned.
+	* @param pnErrorMessage	Error message, which is returned.
+	* @return				Node.
+	*/
+	CRV<CSpecializingNode*> literal(CToken pToken, short int pnErrorMessage) {
+		CRV<CValue> rvValue = convertToken(pToken);
+		if (rvValue.getErrorMessage() != Error::SUCCESS) {
+			return CRV<CSpecializingNode*>(NULL, rvValue.getErrorMessage());
+		}
+		return constant(rvValue.getContent(), pnErrorMessage);
+	}
+
+	/**
+	* Converts the passed token into a value.
+	*
+	* @param pToken	Token, which should be converted.
+	* @return		Value (or Error::Interpreter::INFO_ENGINE_UNSUPPORTED if the number cannot be converted).
+	*/
+	CRV<CValue> convertToken(CToken pToken) {
+		if (pToken.getFilename() != "") {
+			sFilename = pToken.getFilename();
+		}
+		try {
+			return CRV<CValue>(CValue(pToken), Error::SUCCESS);
+		}
+		catch (const exception&) {
+			//The interpreter would crash while converting the number:
+			return CRV<CValue>(CValue(), Error::Interpreter::INFO_ENGINE_UNSUPPORTED);
+		}
+	}
+
+	/**
+	* Returns whether the passed type resembles a primitive datatype.
+	*
+	* @param pnType	Type.
+	* @return		Whether the type is primitive.
+	*/
+	bool isPrimitive(short int pnType) {
+		return pnType == Token::U_INT || pnType == Token::U_DOUBLE || pnType == Token::U_BOOL || pnType == Token::U_CHAR || pnType == Token::U_STRING;
+	}
+};
@@ -0,0 +1,151 @@
+/*
+FILE:		CTaskTable.hpp
+
+REMARKS:	This file contains the class "CTaskTable", which stores the return value of every task, that has been spawned
+			by the Lisp-sourcecode.
+*/
+#pragma once
+
+#include <iostream>
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "CRV.hpp"
+#include "CToken.hpp"
+
+using namespace std;
+
+
+
+/**
+* The class "CTaskTable" stores every task, which has been spawned during the execution of a program. A task is identified
+* by it's handle, which is the integer, that is returned by "spawn" and passed to "await". Handles start at 1, so that
+* a variable, which has been declared without a value, cannot resemble a task.
+* The table is shared by the interpreters of every thread, therefore it is locked, whenever a task is added or found.
+* The tasks themselves are never removed until the table is cleared, so that they can be accessed without the lock. A
+* task is added, after it has been submitted to the CThreadPool, so that it cannot be awaited before.
+*
+* @author	Christian-2003
+* @version	19.10.2026
+*/
+class CTaskTable {
+public:
+	/**
+	* The class "CSpawnedTask" stores the result of a single task.
+	*/
+	class CSpawnedTask {
+	public:
+		/**
+		* Stores the return value of the called function or the error, which occured. It is only valid, once the task
+		* has finished.
+		*/
+		CRV<CToken> result;
+
+		/**
+		* Stores whether the task has not finished yet (1) or has finished (0). It is the group of the task within the
+		* CThreadPool.
+		*/
+		atomic<unsigned int> nPending;
+
+		/**
+		* The default constructor instantiates a new task, which has not been spawned yet.
+		*/
+		CSpawnedTask() {
+			nPending = 0;
+		}
+	};
+
+
+
+private:
+	/**
+	* Stores every task (the task with handle n is stored at index n - 1).
+	*/
+	deque<unique_ptr<CSpawnedTask>> lTasks;
+
+	/**
+	* Locks the tasks, since they are spawned by multiple threads.
+	*/
+	mutex lock;
+
+
+
+public:
+	/**
+	* This function adds the passed task to the table.
+	*
+	* @param pTask	Task, which has been spawned.
+	* @return		Handle of the task.
+	*/
+	unsigned int add(unique_ptr<CSpawnedTask> pTask) {
+		lock_guard<mutex> guard(lock);
+		lTasks.push_back(move(pTask));
+		return lTasks.size();
+	}
+
+	/**
+	* This function returns the task with the passed handle.
+	*
+	* @param pnHandle	Handle of the task.
+	* @return			Task or nullptr, if no task has the handle.
+	*/
+	CSpawnedTask* find(unsigned long long pnHandle) {
+		lock_guard<mutex> guard(lock);
+		if (pnHandle == 0 || pnHandle > lTasks.size()) {
+			return nullptr;
+		}
+		return lTasks[pnHandle - 1].get();
+	}
+
+	/**
+	* This function returns the task, whose handle is stored in the passed lexeme.
+	*
+	* @param psHandle	Lexeme of an integer.
+	* @return			Task or nullptr, if no task has the handle.
+	*/
+	CSpawnedTask* find(string psHandle) {
+		try {
+			return find(stoull(psHandle));
+		}
+		catch (const exception&) {
+			//The integer is negative or out of range:
+			return nullptr;
+		}
+	}
+
+	/**
+	* Returns the number of tasks, which have been spawned.
+	*
+	* @return	Number of tasks.
+	*/
+	unsigned int size() {
+		lock_guard<mutex> guard(lock);
+		return lTasks.size();
+	}
+
+	/**
+	* This function returns whether a task has not finished yet.
+	*
+	* @return	Whether a task is pending.
+	*/
+	bool hasPendingTasks() {
+		lock_guard<mutex> guard(lock);
+		for (size_t i = 0; i < lTasks.size(); i++) {
+			if (lTasks[i]->nPending > 0) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	/**
+	* This function removes every task, before a new program is executed.
+	*/
+	void clear() {
+		lock_guard<mutex> guard(lock);
+		lTasks.clear();
+	}
+};
@@ -0,0 +1,499 @@
+/*
+FILE:		CThreadPool.hpp
+
+REMARKS:	This file contains the class "CThreadPool", which executes tasks on a fixed number of threads, that steal tasks
+			from each other once they run out of work.
+*/
+#pragma once
+
+#include <iostream>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace std;
+#define POOL_SPARE_THREADS 256 //Maximum number of spare threads, which the pool of the interpreter starts.
+
+
+
+/**
+* The class "CThreadPool" starts a fixed number of threads, each of which has it's own queue of tasks. A thread adds the
+* tasks it submits to the back of it's own queue and takes the next task from the back as well, so that nested tasks are
+* executed while their data is still in the cache. If it's own queue is empty, the thread steals the oldest task from the
+* front of the queue of another thread. Tasks, which are submitted by a thread that does not belong to the pool, are
+* distributed over the queues.
+* Every task belongs to a group, which counts the tasks that have not finished yet. A thread, which waits for a group,
+* executes the pending tasks of that group in the meantime, so that a task may submit and wait for further tasks without
+* blocking a thread of the pool. Tasks of other groups are not executed while waiting, since they could wait themselves
+* and the stack of the thread would grow with every pending task. Furthermore, a task of another group could wait for
+* a task, which is suspended further down the same stack, which would never finish.
+* If every task of the group is already executed by other threads, the waiting thread blocks. Only a limited number of
+* threads execute tasks simultaneously, so that the pool can start spare threads, which execute the queued tasks in place
+* of the blocked threads, without using more processors than requested. A spare thread is started, once a task is queued
+* while a slot is free and every thread is either busy or blocked (e.g. because every thread waits for a channel, whose
+* values are sent by a queued task), so that a blocked thread never waits for a task, that no thread could execute.
+* Afterwards, the spare thread executes tasks like every other thread.
+*
+* @author	Christian-2003
+* @version	19.10.2026
+*/
+class CThreadPool {
+private:
+	/**
+	* The class "CTask" stores a task together with it's group.
+	*/
+	class CTask {
+	public:
+		/**
+		* Stores the function, which is executed.
+		*/
+		function<void()> run;
+
+		/**
+		* Stores the number of unfinished tasks of the group, to which the task belongs.
+		*/
+		atomic<unsigned int>* pGroup;
+	};
+
+	/**
+	* The class "CTaskQueue" stores the tasks of one thread.
+	*/
+	class CTaskQueue {
+	public:
+		/**
+		* Stores the tasks, which have not been started yet.
+		*/
+		deque<CTask> lTasks;
+
+		/**
+		* Locks the tasks, since they are stolen by other threads.
+		*/
+		mutex lock;
+	};
+
+
+
+private:
+	/**
+	* Stores the threads of the pool (only changed while idleLock is held).
+	*/
+	vector<thread> lThreads;
+
+	/**
+	* Stores the queue of each thread (same index as lThreads). The vector contains an empty pointer for every spare
+	* thread, which has not been started yet, so that it is never resized while other threads read it.
+	*/
+	vector<unique_ptr<CTaskQueue>> lQueues;
+
+	/**
+	* Stores the number of threads, which have been started. The queue of a thread is created, before the counter is
+	* incremented.
+	*/
+	atomic<unsigned int> nStartedThreads;
+
+	/**
+	* Stores the function, which is executed by every thread, before it executes it's first task.
+	*/
+	function<void(unsigned int)> initialize;
+
+	/**
+	* Stores the number of tasks, which have been submitted but not started yet.
+	*/
+	atomic<unsigned int> nQueuedTasks;
+
+	/**
+	* Stores the queue, to which the next task of a thread outside the pool is added.
+	*/
+	atomic<unsigned int> nNextQueue;
+
+	/**
+	* Stores whether the threads should terminate.
+	*/
+	atomic<bool> bStopping;
+
+	/**
+	* Stores how many more threads can execute tasks simultaneously (only changed while idleLock is held).
+	*/
+	unsigned int nFreeSlots;
+
+	/**
+	* Stores the number of threads, which wait for a group, whose tasks are executed by other threads, or which are
+	* suspended.
+	*/
+	atomic<unsigned int> nBlockedThreads;
+
+	/**
+	* Stores the number of threads, which neither hold a slot nor are blocked (only changed while idleLock is held).
+	*/
+	unsigned int nIdleThreads;
+
+	/**
+	* Stores the number of tasks, which have been executed.
+	*/
+	atomic<unsigned long long> nExecutedTasks;
+
+	/**
+	* Stores the number of tasks, which a thread of the pool has stolen from the queue of another thread.
+	*/
+	atomic<unsigned long long> nStolenTasks;
+
+	/**
+	* Locks the idle threads, while they wait for new tasks.
+	*/
+	mutex idleLock;
+
+	/**
+	* Wakes up the idle threads, if a task is submitted.
+	*/
+	condition_variable idle;
+
+	/**
+	* Wakes up the blocked threads, if a group has finished or a thread stops executing tasks.
+	*/
+	condition_variable finished;
+
+	/**
+	* Stores the pool, to which the current thread belongs (nullptr for threads outside a pool).
+	*/
+	inline static thread_local CThreadPool* pCurrentPool = nullptr;
+
+	/**
+	* Stores the index of the current thread within it's pool.
+	*/
+	inline static thread_local int nCurrentIndex = -1;
+
+
+
+public:
+	/**
+	* This constructor starts the passed number of threads. The spare threads are only started, once every thread is
+	* blocked or busy while tasks are queued.
+	*
+	* @param pnThreads			Number of threads, which execute tasks simultaneously (at least 1).
+	* @param pnSpareThreads		Maximum number of spare threads.
+	* @param pInitialize		Function, which is executed by every thread with it's index, before it executes it's
+	*							first task (nullptr, if the threads do not need to be initialized).
+	*/
+	CThreadPool(unsigned int pnThreads, unsigned int pnSpareThreads = 0, function<void(unsigned int)> pInitialize = nullptr) {
+		nQueuedTasks = 0;
+		nNextQueue = 0;
+		bStopping = false;
+		nBlockedThreads = 0;
+		nIdleThreads = 0;
+		nStartedThreads = 0;
+		nExecutedTasks = 0;
+		nStolenTasks = 0;
+		initialize = pInitialize;
+		if (pnThreads == 0) {
+			pnThreads = 1;
+		}
+		nFreeSlots = pnThreads;
+		lQueues.resize(pnThreads + pnSpareThreads);
+		lock_guard<mutex> lock(idleLock);
+		for (unsigned int i = 0; i < pnThreads; i++) {
+			startThread();
+		}
+	}
+
+	/**
+	* The destructor terminates every thread, after it has finished it's current task.
+	*/
+	~CThreadPool() {
+		{
+			lock_guard<mutex> lock(idleLock);
+			bStopping = true;
+		}
+		idle.notify_all();
+		for (unsigned int i = 0; i < lThreads.size(); i++) {
+			lThreads[i].join();
+		}
+	}
+
+
+
+public:
+	/**
+	* This function adds the passed task to the queue of the current thread, or to the next queue, if the current thread
+	* does not belong to the pool. The counter of the group is incremented and decremented again, once the task has
+	* finished.
+	*
+	* @param pTask		Task, which should be executed.
+	* @param pnGroup	Number of unfinished tasks of the group, to which the task belongs.
+	*/
+	void submit(function<void()> pTask, atomic<unsigned int>& pnGroup) {
+		pnGroup++;
+		int nIndex = getWorkerIndex(); //Stores the index of the current thread.
+		unsigned int nQueue = nIndex >= 0 ? nIndex : nNextQueue++ % nStartedThreads; //Stores the queue of the task.
+		{
+			lock_guard<mutex> lock(lQueues[nQueue]->lock);
+			lQueues[nQueue]->lTasks.push_back(CTask{ move(pTask), &pnGroup });
+		}
+		{
+			//The counter is changed while the lock is held, so that an idle thread cannot miss the task:
+			lock_guard<mutex> lock(idleLock);
+			nQueuedTasks++;
+			startSpareThread();
+		}
+		idle.notify_one();
+	}
+
+	/**
+	* This function returns, once every task of the passed group has finished. Pending tasks of the group are executed
+	* by the current thread in the meantime, if they are executed by other threads, the current thread blocks.
+	*
+	* @param pnGroup	Number of unfinished tasks of the group.
+	*/
+	void wait(atomic<unsigned int>& pnGroup) {
+		while (pnGroup > 0) {
+			if (!runTask(&pnGroup)) {
+				block(pnGroup);
+			}
+		}
+	}
+
+	/**
+	* This function hands the slot of the current thread over to another thread, before the current thread waits for an
+	* event, that is caused by another task (e.g. a value, which is sent through a channel). Threads, which do not belong
+	* to the pool, do not hold a slot.
+	*/
+	void suspend() {
+		if (getWorkerIndex() < 0) {
+			return;
+		}
+		{
+			lock_guard<mutex> lock(idleLock);
+			nBlockedThreads++;
+			nFreeSlots++;
+			startSpareThread();
+		}
+		idle.notify_one();
+		finished.notify_all();
+	}
+
+	/**
+	* This function returns, once the current thread, which has been suspended, got a slot again.
+	*/
+	void resume() {
+		if (getWorkerIndex() < 0) {
+			return;
+		}
+		unique_lock<mutex> lock(idleLock);
+		finished.wait(lock, [this]() { return nFreeSlots > 0; });
+		nFreeSlots--;
+		nBlockedThreads--;
+	}
+
+	/**
+	* Returns the index of the current thread within the pool.
+	*
+	* @return	Index of the thread or -1, if the thread does not belong to the pool.
+	*/
+	int getWorkerIndex() {
+		return pCurrentPool == this ? nCurrentIndex : -1;
+	}
+
+	/**
+	* Returns the number of threads, which have been started (including the spare threads).
+	*
+	* @return	Number of threads.
+	*/
+	unsigned int getThreads() {
+		return nStartedThreads;
+	}
+
+	/**
+	* Returns the number of threads, which could be started (including the spare threads). The index of every thread of
+	* the pool is smaller.
+	*
+	* @return	Maximum number of threads.
+	*/
+	unsigned int getMaximumThreads() {
+		return lQueues.size();
+	}
+
+	/**
+	* Returns the number of tasks, which have been executed.
+	*
+	* @return	Number of executed tasks.
+	*/
+	unsigned long long getExecutedTasks() {
+		return nExecutedTasks;
+	}
+
+	/**
+	* Returns the number of tasks, which have been stolen from the queue of another thread.
+	*
+	* @return	Number of stolen tasks.
+	*/
+	unsigned long long getStolenTasks() {
+		return nStolenTasks;
+	}
+
+	/**
+	* This function returns the number of threads, which are executed simultaneously by the hardware.
+	*
+	* @return	Number of hardware threads (at least 1).
+	*/
+	static unsigned int getHardwareThreads() {
+		unsigned int nThreads = thread::hardware_concurrency();
+		return nThreads > 0 ? nThreads : 1;
+	}
+
+
+
+private:
+	/**
+	* This function is executed by every thread of the pool, until the pool is destroyed.
+	*
+	* @param pnIndex	Index of the thread.
+	*/
+	void work(unsigned int pnIndex) {
+		pCurrentPool = this;
+		nCurrentIndex = pnIndex;
+		bool bInitialized = false; //Stores whether the thread has been initialized.
+		while (true) {
+			{
+				unique_lock<mutex> lock(idleLock);
+				idle.wait(lock, [this]() { return bStopping || (nQueuedTasks > 0 && nFreeSlots > 0); });
+				if (bStopping) {
+					return;
+				}
+				nFreeSlots--;
+				nIdleThreads--;
+			}
+			if (!bInitialized && initialize) {
+				initialize(pnIndex);
+			}
+			bInitialized = true;
+			while (runTask(nullptr)) {
+				//Execute tasks, until every queue is empty...
+			}
+			{
+				lock_guard<mutex> lock(idleLock);
+				nFreeSlots++;
+				nIdleThreads++;
+			}
+			//A task might have been submitted, while the thread held it's slot:
+			idle.notify_one();
+			if (nBlockedThreads > 0) {
+				finished.notify_all();
+			}
+		}
+	}
+
+	/**
+	* This function blocks the current thread, until the tasks of the passed group, which are executed by other threads,
+	* have finished. A thread of the pool hands it's slot over to another thread in the meantime.
+	*
+	* @param pnGroup	Number of unfinished tasks of the group.
+	*/
+	void block(atomic<unsigned int>& pnGroup) {
+		bool bWorker = getWorkerIndex() >= 0; //Stores whether the thread holds a slot.
+		unique_lock<mutex> lock(idleLock);
+		nBlockedThreads++;
+		if (bWorker) {
+			nFreeSlots++;
+			startSpareThread();
+			idle.notify_one();
+			finished.notify_all();
+		}
+		finished.wait(lock, [&pnGroup]() { return pnGroup == 0; });
+		if (bWorker) {
+			finished.wait(lock, [this]() { return nFreeSlots > 0; });
+			nFreeSlots--;
+		}
+		nBlockedThreads--;
+	}
+
+	/**
+	* This function executes one pending task. A thread of the pool takes the newest task of it's own queue, every other
+	* thread (or a thread with an empty queue) steals the oldest task of another queue.
+	*
+	* @param ppGroup	Group, to which the task has to belong (nullptr for any group).
+	* @return			Whether a task has been executed.
+	*/
+	bool runTask(atomic<unsigned int>* ppGroup) {
+		CTask task; //Stores the task, which is executed.
+		int nIndex = getWorkerIndex(); //Stores the index of the current thread.
+		if (nIndex >= 0 && takeTask(nIndex, false, ppGroup, task)) {
+			execute(task);
+			return true;
+		}
+		unsigned int nQueues = nStartedThreads; //Stores the number of queues, which have been created.
+		unsigned int nStart = nIndex >= 0 ? nIndex + 1 : 0; //Stores the queue, at which the search begins.
+		for (unsigned int i = 0; i < nQueues; i++) {
+			unsigned int nQueue = (nStart + i) % nQueues; //Stores the queue, from which a task is stolen.
+			if ((int)nQueue != nIndex && takeTask(nQueue, true, ppGroup, task)) {
+				nStolenTasks += nIndex >= 0 && ppGroup == nullptr ? 1 : 0;
+				execute(task);
+				return true;
+			}
+		}
+		return false;
+	}
+
+	/**
+	* This function executes the passed task and marks it as finished within it's group.
+	*
+	* @param pTask	Task, which is executed.
+	*/
+	void execute(CTask& pTask) {
+		pTask.run();
+		nExecutedTasks++;
+		if (--(*pTask.pGroup) == 0 && nBlockedThreads > 0) {
+			//The lock ensures, that a blocked thread does not miss the notification:
+			lock_guard<mutex> lock(idleLock);
+			finished.notify_all();
+		}
+	}
+
+	/**
+	* This function starts the next thread of the pool. The lock of the idle threads has to be held.
+	*/
+	void startThread() {
+		unsigned int nIndex = nStartedThreads; //Stores the index of the new thread.
+		lQueues[nIndex] = make_unique<CTaskQueue>();
+		nIdleThreads++;
+		nStartedThreads = nIndex + 1;
+		lThreads.push_back(thread(&CThreadPool::work, this, nIndex));
+	}
+
+	/**
+	* This function starts a spare thread, if tasks are queued while a slot is free, but no thread is idle, which could
+	* take the slot. The lock of the idle threads has to be held.
+	*/
+	void startSpareThread() {
+		if (nIdleThreads == 0 && nFreeSlots > 0 && nQueuedTasks > 0 && nStartedThreads < lQueues.size() && !bStopping) {
+			startThread();
+		}
+	}
+
+	/**
+	* This function removes a task from the passed queue.
+	*
+	* @param pnQueue	Index of the queue.
+	* @param pbOldest	Whether the oldest task is removed (otherwise the newest).
+	* @param ppGroup	Group, to which the task has to belong (nullptr for any group).
+	* @param pTask		Task, into which the removed task is moved.
+	* @return			Whether the queue contained a suitable task.
+	*/
+	bool takeTask(unsigned int pnQueue, bool pbOldest, atomic<unsigned int>* ppGroup, CTask& pTask) {
+		lock_guard<mutex> lock(lQueues[pnQueue]->lock);
+		deque<CTask>& lTasks = lQueues[pnQueue]->lTasks;
+		for (size_t i = 0; i < lTasks.size(); i++) {
+			size_t nPosition = pbOldest ? i : lTasks.size() - 1 - i; //Stores the position of the current task.
+			if (ppGroup == nullptr || lTasks[nPosition].pGroup == ppGroup) {
+				pTask = move(lTasks[nPosition]);
+				lTasks.erase(lTasks.begin() + nPosition);
+				nQueuedTasks--;
+				return true;
+			}
+		}
+		return false;
+	}
+};
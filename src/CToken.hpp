@@ -38,6 +38,39 @@ private:
 	*/
 	unsigned int nLine;
 
+	/**
+	* This represents the opcode, with which the interpreter executes the node of this token (see Variables/OpcodeTypes.hpp).
+	*/
+	short int nOpcode;
+
+	/**
+	* This represents the error, which is caused by the number of arguments of the node of this token (Error::SUCCESS if the
+	* number of arguments is valid).
+	*/
+	short int nArityError;
+
+	/**
+	* This represents whether the type checker has verified, that the runtime checks of the node of this token cannot fail.
+	*/
+	bool bVerified;
+
+	/**
+	* This represents the kernel, with which the operation of the node of this token is evaluated (see
+	* Variables/OperationKernels.hpp).
+	*/
+	short int nKernel;
+
+	/**
+	* This represents whether the subtrees of the node of this token (the arguments of a call or the operands of an
+	* operation) are evaluated by multiple threads.
+	*/
+	bool bParallel;
+
+	/**
+	* This represents whether the node of this token is evaluated by another thread than the node, to which it belongs.
+	*/
+	bool bForked;
+
 
 
 public:
@@ -49,6 +82,12 @@ public:
 		nType = 0;
 		sFilename = "";
 		nLine = 0;
+		nOpcode = 0;
+		nArityError = 0;
+		bVerified = false;
+		nKernel = 0;
+		bParallel = false;
+		bForked = false;
 	}
 
 	/**
@@ -62,6 +101,12 @@ public:
 		nType = pnType;
 		sFilename = "";
 		nLine = 0;
+		nOpcode = 0;
+		nArityError = 0;
+		bVerified = false;
+		nKernel = 0;
+		bParallel = false;
+		bForked = false;
 	}
 
 	/**
@@ -77,6 +122,12 @@ public:
 		nType = pnType;
 		sFilename = psFilename;
 		nLine = pnLine;
+		nOpcode = 0;
+		nArityError = 0;
+		bVerified = false;
+		nKernel = 0;
+		bParallel = false;
+		bForked = false;
 	}
 
 
@@ -117,4 +168,108 @@ public:
 	unsigned int getLine() {
 		return nLine;
 	}
+
+	/**
+	* Returns the opcode, with which the node of the token is executed.
+	* 
+	* @return	Opcode of the token.
+	*/
+	short int getOpcode() {
+		return nOpcode;
+	}
+
+	/**
+	* Returns the error, which is caused by the number of arguments of the token's node.
+	* 
+	* @return	Error of the token's arity.
+	*/
+	short int getArityError() {
+		return nArityError;
+	}
+
+	/**
+	* Returns whether the runtime checks of the token's node have been verified by the type checker.
+	* 
+	* @return	Whether the node is verified.
+	*/
+	bool isVerified() {
+		return bVerified;
+	}
+
+	/**
+	* Returns the kernel, with which the operation of the token's node is evaluated.
+	* 
+	* @return	Kernel of the operation.
+	*/
+	short int getKernel() {
+		return nKernel;
+	}
+
+	/**
+	* Returns whether the subtrees of the token's node are evaluated by multiple threads.
+	*
+	* @return	Whether the node is parallel.
+	*/
+	bool isParallel() {
+		return bParallel;
+	}
+
+	/**
+	* Returns whether the token's node is evaluated by another thread.
+	*
+	* @return	Whether the node is forked.
+	*/
+	bool isForked() {
+		return bForked;
+	}
+
+
+
+public:
+	/**
+	* Stamps the token with the passed opcode and the result of the validation of its node's arity.
+	* 
+	* @param pnOpcode		Opcode of the token.
+	* @param pnArityError	Error of the token's arity.
+	*/
+	void setOpcode(short int pnOpcode, short int pnArityError) {
+		nOpcode = pnOpcode;
+		nArityError = pnArityError;
+	}
+
+	/**
+	* Marks the token's node as verified by the type checker.
+	* 
+	* @param pbVerified	Whether the node is verified.
+	*/
+	void setVerified(bool pbVerified) {
+		bVerified = pbVerified;
+	}
+
+	/**
+	* Selects the kernel, with which the operation of the token's node is evaluated.
+	* 
+	* @param pnKernel	Kernel of the operation.
+	*/
+	void setKernel(short int pnKernel) {
+		nKernel = pnKernel;
+	}
+
+	/**
+	* Marks the subtrees of the token's node to be evaluated by multiple threads.
+	*
+	* @param pbParallel	Whether the node is parallel.
+	*/
+	void setParallel(bool pbParallel) {
+		bParallel = pbParallel;
+	}
+
+	/**
+	* Marks the token's node to be evaluated by another thread.
+	*
+	* @param pbForked	Whether the node is forked.
+	*/
+	void setForked(bool pbForked) {
+		bForked = pbForked;
+	}
 };
@@ -14,7 +14,7 @@ REMARKS:	This file contains the class "CTokenizer", which is used to split up th
 #include "Variables/TokenTypes.hpp"
 #include "Variables/ErrorMessages.hpp"
 #include "Variables/KeywordTypes.hpp"
-#include "CLog.hpp"
+#include "CContext.hpp"
 
 using namespace std;
 
@@ -48,6 +48,11 @@ private:
 	*/
 	unsigned int nCurrentLine;
 
+	/**
+	* Stores the context, into whose log the events are written.
+	*/
+	CContext context;
+
 
 
 private:
@@ -64,12 +69,12 @@ private:
 		if (sSourceCode[0] == '(') {
 			//Found opened parenthesis:
 			lTokensObj.add(CToken(string(1, sSourceCode[0]), Token::PARENTHESES_OPENED, sFilename, nCurrentLine));
-			//logger.addEntry_tokenizerAddToken(lTokensObj.back());
+			//context.getLog().addEntry_tokenizerAddToken(lTokensObj.back());
 		}
 		else if (sSourceCode[0] == ')') {
 			//Found closed parenthesis:
 			lTokensObj.add(CToken(string(1, sSourceCode[0]), Token::PARENTHESES_CLOSED, sFilename, nCurrentLine));
-			//logger.addEntry_tokenizerAddToken(lTokensObj.back());
+			//context.getLog().addEntry_tokenizerAddToken(lTokensObj.back());
 		}
 		sSourceCode.erase(0, 1); //Remove the parenthesis.
 		return Error::SUCCESS;
@@ -94,21 +99,21 @@ private:
 			}
 			sString += chCurrentCharacter;
 		}
-		if (sString == Keyword::INT || sString == Keyword::DOUBLE || sString == Keyword::BOOL || sString == Keyword::CHAR || sString == Keyword::STRING || sString == Keyword::SET || sString == Keyword::DEFINE || sString == Keyword::IF || sString == Keyword::WHILE || sString == Keyword::PRINT || sString == Keyword::PRINTLN || sString == Keyword::RETURN) {
+		if (sString == Keyword::INT || sString == Keyword::DOUBLE || sString == Keyword::BOOL || sString == Keyword::CHAR || sString == Keyword::STRING || sString == Keyword::SET || sString == Keyword::DEFINE || sString == Keyword::IF || sString == Keyword::WHILE || sString == Keyword::PRINT || sString == Keyword::PRINTLN || sString == Keyword::RETURN || sString == Keyword::SPAWN || sString == Keyword::AWAIT || sString == Keyword::FOR || sString == Keyword::PFOR || sString == Keyword::MAKE_CHANNEL || sString == Keyword::SEND || sString == Keyword::RECV || sString == Keyword::TRY_SEND || sString == Keyword::TRY_RECV) {
 			lTokensObj.add(CToken(sString, Token::KEYWORD, sFilename, nCurrentLine));
-			//logger.addEntry_tokenizerAddToken(lTokensObj.back());
+			//context.getLog().addEntry_tokenizerAddToken(lTokensObj.back());
 		}
 		else {
 			string sCopyString = sString;
 			for_each(sCopyString.begin(), sCopyString.end(), [](char& c) {c = ::tolower(c); }); //Convert string to lowercase.
 			if (sCopyString == "t" || sCopyString == "nil") {
 				lTokensObj.add(CToken(sCopyString, Token::U_BOOL, sFilename, nCurrentLine));
-				//logger.addEntry_tokenizerAddToken(lTokensObj.back());
+				//context.getLog().addEntry_tokenizerAddToken(lTokensObj.back());
 				sSourceCode.erase(0, sCopyString.length()); //Remove identifier / keyword from source code.
 				return Error::SUCCESS;
 			}
 			lTokensObj.add(CToken(sString, Token::IDENTIFIER, sFilename, nCurrentLine));
-			//logger.addEntry_tokenizerAddToken(lTokensObj.back());
+			//context.getLog().addEntry_tokenizerAddToken(lTokensObj.back());
 		}
 		sSourceCode.erase(0, sString.length()); //Remove identifier / keyword from source code.
 		return Error::SUCCESS;
@@ -127,7 +132,7 @@ private:
 		if (sSourceCode[0] == '+' || sSourceCode[0] == '*' || sSourceCode[0] == '/') {
 			//Found arithmetic operator:
 			lTokensObj.add(CToken(string(1, sSourceCode[0]), Token::OPERATOR_ARITHMETIC, sFilename, nCurrentLine));
-			//logger.addEntry_tokenizerAddToken(lTokensObj.back());
+			//context.getLog().addEntry_tokenizerAddToken(lTokensObj.back());
 			sSourceCode.erase(0, 1); //Remove arithmetic operator from sourcecode.
 		}
 		else if (sSourceCode[0] == '-') {
@@ -138,7 +143,7 @@ private:
 			else {
 				//Found arithmetic operator:
 				lTokensObj.add(CToken(string(1, sSourceCode[0]), Token::OPERATOR_ARITHMETIC, sFilename, nCurrentLine));
-				//logger.addEntry_tokenizerAddToken(lTokensObj.back());
+				//context.getLog().addEntry_tokenizerAddToken(lTokensObj.back());
 				sSourceCode.erase(0, 1); //Remove arithmetic operator from sourcecode.
 			}
 		}
@@ -146,19 +151,19 @@ private:
 			if (sSourceCode.length() >= 2 && (sSourceCode[0] == '>' || sSourceCode[0] == '<') && sSourceCode[1] == '=') {
 				//Found relational operator >= or <=:
 				lTokensObj.add(CToken(string(1, sSourceCode[0]) + string(1, sSourceCode[1]), Token::OPERATOR_RELATIONAL, sFilename, nCurrentLine));
-				logger.addEntry_tokenizerAddToken(lTokensObj.back());
+				context.getLog().addEntry_tokenizerAddToken(lTokensObj.back());
 				sSourceCode.erase(0, 2); //Remove relational operator from sourcecode.
 				return Error::SUCCESS;
 			}
 			//Found relational operator:
 			lTokensObj.add(CToken(string(1, sSourceCode[0]), Token::OPERATOR_RELATIONAL, sFilename, nCurrentLine));
-			//logger.addEntry_tokenizerAddToken(lTokensObj.back());
+			//context.getLog().addEntry_tokenizerAddToken(lTokensObj.back());
 			sSourceCode.erase(0, 1); //Remove relational operator from sourcecode.
 		}
 		else if (sSourceCode[0] == '&' || sSourceCode[0] == '|') {
 			//Found boolean operator:
 			lTokensObj.add(CToken(string(1, sSourceCode[0]), Token::OPERATOR_BOOL, sFilename, nCurrentLine));
-			//logger.addEntry_tokenizerAddToken(lTokensObj.back());
+			//context.getLog().addEntry_tokenizerAddToken(lTokensObj.back());
 			sSourceCode.erase(0, 1); //Remove boolean operator from sourcecode.
 		}
 		return Error::SUCCESS;
@@ -203,14 +208,14 @@ private:
 				if (incorrectNumber) {
 					return Error::Tokenizer::TOO_MANY_DECIMALS;
 				}
-				//logger.addEntry_tokenizerAddToken(lTokensObj.back());
+				//context.getLog().addEntry_tokenizerAddToken(lTokensObj.back());
 			}
 			else {
 				lTokensObj.add(CToken(sDigitsOfNumber, Token::U_INT, sFilename, nCurrentLine));
 				if (incorrectNumber) {
 					return Error::Tokenizer::TOO_MANY_DECIMALS;
 				}
-				//logger.addEntry_tokenizerAddToken(lTokensObj.back());
+				//context.getLog().addEntry_tokenizerAddToken(lTokensObj.back());
 			}
 			sSourceCode.erase(0, sDigitsOfNumber.length());
 		}
@@ -229,7 +234,7 @@ private:
 				sString += currentCharacter;
 			}
 			lTokensObj.add(CToken(sString, Token::U_STRING, sFilename, nCurrentLine));
-			//logger.addEntry_tokenizerAddToken(lTokensObj.back());
+			//context.getLog().addEntry_tokenizerAddToken(lTokensObj.back());
 			sSourceCode.erase(0, sString.length()); //Remove String from sourcecode.
 		}
 
@@ -249,7 +254,7 @@ private:
 			}
 			sSourceCode.erase(0, 1); //Remove quotation marks.
 			lTokensObj.add(CToken(sCharacter, Token::U_CHAR, sFilename, nCurrentLine));
-			//logger.addEntry_tokenizerAddToken(lTokensObj.back());
+			//context.getLog().addEntry_tokenizerAddToken(lTokensObj.back());
 		}
 		return Error::SUCCESS;
 	}
@@ -269,6 +274,15 @@ public:
 
 
 public:
+	/**
+	* This function changes the context, into whose log the events are written.
+	*
+	* @param pContext	Context of the execution.
+	*/
+	void setContext(CContext pContext) {
+		context = pContext;
+	}
+
 	/**
 	* This function starts the process of splitting up the source code into Tokens.
 	*
@@ -277,7 +291,7 @@ public:
 	* @return				List of Tokens.
 	*/
 	CRV<CLinkedList<CToken>> tokenize(string psSourceCode, string psFilename) {
-		logger.addEntry("Begin lexical analysis (Tokenizer).", LogEntryComponent::TOKENIZER, LogEntryType::INF);
+		context.getLog().addEntry("Begin lexical analysis (Tokenizer).", LogEntryComponent::TOKENIZER, LogEntryType::INF);
 		sFilename = psFilename;
 		sSourceCode = psSourceCode;
 		//transform(sSourceCode.begin(), sSourceCode.end(), sSourceCode.begin(), ::tolower); //Transform input to only include lowercase characters.
@@ -290,7 +304,7 @@ public:
 				//Found operator:
 				short int nErrorMessage = tokenizeOperator();
 				if (nErrorMessage != Error::SUCCESS) {
-					logger.addEntry_tokenException(lTokensObj.back(), LogEntryComponent::TOKENIZER, LogEntryType::FATAL, nErrorMessage, Error::generateErrorMessage(nErrorMessage));
+					context.getLog().addEntry_tokenException(lTokensObj.back(), LogEntryComponent::TOKENIZER, LogEntryType::FATAL, nErrorMessage, Error::generateErrorMessage(nErrorMessage));
 					return CRV<CLinkedList<CToken>>(lTokensObj, nErrorMessage);
 				}
 			}
@@ -298,7 +312,7 @@ public:
 				//Found parenthesis:
 				short int nErrorMessage = tokenizeParenthesis();
 				if (nErrorMessage != Error::SUCCESS) {
-					logger.addEntry_tokenException(lTokensObj.back(), LogEntryComponent::TOKENIZER, LogEntryType::FATAL, nErrorMessage, Error::generateErrorMessage(nErrorMessage));
+					context.getLog().addEntry_tokenException(lTokensObj.back(), LogEntryComponent::TOKENIZER, LogEntryType::FATAL, nErrorMessage, Error::generateErrorMessage(nErrorMessage));
 					return CRV<CLinkedList<CToken>>(lTokensObj, nErrorMessage);
 				}
 			}
@@ -306,7 +320,7 @@ public:
 				//Found atom:
 				short int nErrorMessage = tokenizeAtom();
 				if (nErrorMessage != Error::SUCCESS) {
-					logger.addEntry_tokenException(lTokensObj.back(), LogEntryComponent::TOKENIZER, LogEntryType::FATAL, nErrorMessage, Error::generateErrorMessage(nErrorMessage));
+					context.getLog().addEntry_tokenException(lTokensObj.back(), LogEntryComponent::TOKENIZER, LogEntryType::FATAL, nErrorMessage, Error::generateErrorMessage(nErrorMessage));
 					return CRV<CLinkedList<CToken>>(lTokensObj, nErrorMessage);
 				}
 			}
@@ -332,12 +346,12 @@ public:
 				//Something else (probably an identifier or keyword) found:
 				short int nErrorMessage = tokenizeIdentifierAndKeyword();
 				if (nErrorMessage != Error::SUCCESS) {
-					logger.addEntry_tokenException(lTokensObj.back(), LogEntryComponent::TOKENIZER, LogEntryType::FATAL, nErrorMessage, Error::generateErrorMessage(nErrorMessage));
+					context.getLog().addEntry_tokenException(lTokensObj.back(), LogEntryComponent::TOKENIZER, LogEntryType::FATAL, nErrorMessage, Error::generateErrorMessage(nErrorMessage));
 					return CRV<CLinkedList<CToken>>(lTokensObj, nErrorMessage);
 				}
 			}
 		}
-		logger.addEntry("End lexical analysis (Tokenizer) successfully.", LogEntryComponent::TOKENIZER, LogEntryType::INF);
+		context.getLog().addEntry("End lexical analysis (Tokenizer) successfully.", LogEntryComponent::TOKENIZER, LogEntryType::INF);
 		return CRV<CLinkedList<CToken>>(lTokensObj, Error::SUCCESS);
 	}
 };
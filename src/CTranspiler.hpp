@@ -0,0 +1,2121 @@
+/*
+FILE:		CTranspiler.hpp
+
+REMARKS:	This file contains the class "CTranspiler", which translates a Lisp-program into a standalone C++ translation
+			unit, which can be compiled ahead of time by the system's C++ compiler.
+*/
+#pragma once
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <map>
+#include <sstream>
+#include <iomanip>
+#include <cmath>
+#include <climits>
+
+#include "CAbstractSyntaxTree.hpp"
+#include "CFunction.hpp"
+#include "CLinkedList.hpp"
+#include "CRV.hpp"
+#include "CToken.hpp"
+#include "CValue.hpp"
+#include "Variables/ErrorMessages.hpp"
+#include "Variables/KeywordTypes.hpp"
+#include "Variables/TokenTypes.hpp"
+
+using namespace std;
+
+
+
+/**
+* Command, with which the TRANSPILE-command compiles the generated sourcecode into an executable. The sourcecode and the
+* executable are appended to the command.
+*/
+#ifndef TRANSPILER_COMPILER_COMMAND
+#define TRANSPILER_COMPILER_COMMAND "g++ -std=c++17 -O2"
+#endif
+
+
+
+/**
+* Runtime of every generated program. The class "Value" and the operations behave exactly like "CValue" and
+* "CValueOperations", the type constants and tables, which are referenced, are generated by the transpiler.
+*/
+const string TRANSPILER_RUNTIME = R"RUNTIME(
+inline double normalizeDouble(double pdValue) {
+	double dScaled = pdValue * 1000000.0;
+	if (dScaled > -1.0e12 && dScaled < 1.0e12) {
+		double dFraction = dScaled - floor(dScaled);
+		if (dFraction < 0.499 || dFraction > 0.501) {
+			return nearbyint(dScaled) / 1000000.0;
+		}
+	}
+	return stod(to_string(pdValue));
+}
+
+struct Value {
+	short int type;
+	int i;
+	double d;
+	string text;
+	unsigned int line;
+
+	Value() : type(UNKNOWN), i(0), d(0.0), line(0) {}
+	Value(short int pnType, int pnInt, double pdDouble, const string& psText, unsigned int pnLine) : type(pnType), i(pnInt), d(pdDouble), text(psText), line(pnLine) {}
+
+	double number() const {
+		return type == U_INT ? (double)i : d;
+	}
+
+	string lexeme() const {
+		if (type == U_INT) {
+			return text.empty() ? to_string(i) : text;
+		}
+		else if (type == U_DOUBLE) {
+			return text.empty() ? to_string(d) : text;
+		}
+		else if (type == U_BOOL) {
+			return i != 0 ? "t" : "nil";
+		}
+		return text;
+	}
+
+	bool hasLexeme(const string& psLexeme) const {
+		if (type == U_BOOL) {
+			return psLexeme == (i != 0 ? "t" : "nil");
+		}
+		else if (type == U_INT || type == U_DOUBLE) {
+			return lexeme() == psLexeme;
+		}
+		return text == psLexeme;
+	}
+
+	void setInt(int pnValue) {
+		type = U_INT;
+		i = pnValue;
+		text.clear();
+	}
+
+	void setDouble(double pdValue) {
+		setRawDouble(normalizeDouble(pdValue));
+	}
+
+	void setRawDouble(double pdValue) {
+		type = U_DOUBLE;
+		d = pdValue;
+		text.clear();
+	}
+
+	void setDouble(double pdValue, const string& psLexeme) {
+		type = U_DOUBLE;
+		d = pdValue;
+		text = to_string(pdValue) != psLexeme ? psLexeme : "";
+	}
+
+	void setBool(bool pbValue) {
+		type = U_BOOL;
+		i = pbValue ? 1 : 0;
+		text.clear();
+	}
+
+	void setText(const string& psValue, short int pnType) {
+		type = pnType;
+		text = psValue;
+	}
+};
+
+inline short int convertError(short int pnConvert, short int pnTarget) {
+	if (pnConvert < 0 || pnConvert >= TYPES || pnTarget < 0 || pnTarget >= TYPES) {
+		return 0;
+	}
+	return CONVERT_ERRORS[pnConvert][pnTarget];
+}
+
+inline bool equalLexemes(const Value& pFirst, const Value& pSecond) {
+	if ((pFirst.type == U_INT || pFirst.type == U_DOUBLE) && pFirst.text.empty() && pSecond.text.empty()) {
+		if (pFirst.type != pSecond.type) {
+			return false;
+		}
+		return pFirst.type == U_INT ? pFirst.i == pSecond.i : pFirst.d == pSecond.d;
+	}
+	return pFirst.lexeme() == pSecond.lexeme();
+}
+
+inline short int foldNumbers(char pchOperator, short int pnReturnType, const Value* const* plOperands, unsigned int pnSize, Value& pResult) {
+	pResult = *plOperands[0];
+	if (pnSize == 1) {
+		if (pnReturnType == U_DOUBLE && pResult.type == U_INT) {
+			pResult.setDouble(pResult.number(), pResult.lexeme());
+		}
+		return 0;
+	}
+	if (pnReturnType == U_INT) {
+		unsigned int nValue = (unsigned int)plOperands[0]->i;
+		for (unsigned int i = 1; i < pnSize; i++) {
+			unsigned int nOperand = (unsigned int)plOperands[i]->i;
+			if (pchOperator == '+') {
+				nValue += nOperand;
+			}
+			else if (pchOperator == '-') {
+				nValue -= nOperand;
+			}
+			else {
+				nValue *= nOperand;
+			}
+		}
+		pResult.setInt((int)nValue);
+	}
+	else {
+		double dValue = plOperands[0]->number();
+		for (unsigned int i = 1; i < pnSize; i++) {
+			double dOperand = plOperands[i]->number();
+			if (pchOperator == '+') {
+				dValue = normalizeDouble(dValue + dOperand);
+			}
+			else if (pchOperator == '-') {
+				dValue = normalizeDouble(dValue - dOperand);
+			}
+			else if (pchOperator == '*') {
+				dValue = normalizeDouble(dValue * dOperand);
+			}
+			else {
+				dValue = normalizeDouble(dValue / dOperand);
+			}
+		}
+		pResult.setDouble(dValue);
+	}
+	return 0;
+}
+
+inline short int opAdd(const Value* const* plOperands, unsigned int pnSize, Value& pResult) {
+	short int nReturnType = plOperands[0]->type;
+	if (nReturnType == U_STRING || nReturnType == U_CHAR) {
+		for (unsigned int i = 1; i < pnSize; i++) {
+			if (plOperands[i]->type != U_STRING && plOperands[i]->type != U_CHAR) {
+				pResult = *plOperands[i];
+				return ERROR_OPERANDS_ARE_OF_DIFFERENT_TYPE;
+			}
+		}
+		string sReturnValue = "";
+		for (unsigned int i = 0; i < pnSize; i++) {
+			sReturnValue += plOperands[i]->lexeme();
+		}
+		pResult = *plOperands[0];
+		pResult.setText(sReturnValue, U_STRING);
+		return 0;
+	}
+	else if (nReturnType == U_INT || nReturnType == U_DOUBLE) {
+		for (unsigned int i = 1; i < pnSize; i++) {
+			if (plOperands[i]->type != U_INT && plOperands[i]->type != U_DOUBLE) {
+				pResult = *plOperands[i];
+				return ERROR_OPERANDS_ARE_OF_DIFFERENT_TYPE;
+			}
+			if (plOperands[i]->type == U_DOUBLE) {
+				nReturnType = U_DOUBLE;
+			}
+		}
+	}
+	else if (nReturnType == U_BOOL) {
+		pResult = *plOperands[0];
+		return ERROR_CANNOT_ADD_BOOLEANS;
+	}
+	else {
+		pResult = *plOperands[0];
+		return ERROR_SYNTAX;
+	}
+	return foldNumbers('+', nReturnType, plOperands, pnSize, pResult);
+}
+
+inline short int opSubtract(const Value* const* plOperands, unsigned int pnSize, Value& pResult) {
+	short int nReturnType = U_INT;
+	for (unsigned int i = 0; i < pnSize; i++) {
+		if (plOperands[i]->type == U_DOUBLE) {
+			nReturnType = U_DOUBLE;
+		}
+		else if (plOperands[i]->type != U_INT) {
+			pResult = *plOperands[i];
+			return ERROR_CANNOT_SUBTRACT_NON_NUMERIC_VALUES;
+		}
+	}
+	return foldNumbers('-', nReturnType, plOperands, pnSize, pResult);
+}
+
+inline short int opMultiply(const Value* const* plOperands, unsigned int pnSize, Value& pResult) {
+	short int nReturnType = plOperands[0]->type;
+	for (unsigned int i = 0; i < pnSize; i++) {
+		if (plOperands[i]->type != U_INT && plOperands[i]->type != U_DOUBLE) {
+			pResult = *plOperands[i];
+			return ERROR_CANNOT_MULTIPLY_NON_NUMERIC_VALUES;
+		}
+		else if (plOperands[i]->type == U_DOUBLE) {
+			nReturnType = U_DOUBLE;
+		}
+	}
+	return foldNumbers('*', nReturnType, plOperands, pnSize, pResult);
+}
+
+inline short int opDivide(const Value* const* plOperands, unsigned int pnSize, Value& pResult) {
+	for (unsigned int i = 0; i < pnSize; i++) {
+		if (plOperands[i]->type != U_INT && plOperands[i]->type != U_DOUBLE) {
+			pResult = *plOperands[i];
+			return ERROR_CANNOT_DIVIDE_NON_NUMERIC_VALUES;
+		}
+		else if (i >= 1 && plOperands[i]->number() == 0) {
+			pResult = *plOperands[i];
+			return ERROR_CANNOT_DIVIDE_BY_ZERO;
+		}
+	}
+	return foldNumbers('/', U_DOUBLE, plOperands, pnSize, pResult);
+}
+
+inline short int opCompare(short int pnComparison, const Value& pHead, const Value* const* plOperands, unsigned int pnSize, Value& pResult) {
+	if (pnSize != 2) {
+		pResult = pHead;
+		return pnSize < 2 ? ERROR_NOT_ENOUGH_ARGUMENTS : ERROR_TOO_MANY_ARGUMENTS;
+	}
+	const Value& firstOperand = *plOperands[0];
+	const Value& secondOperand = *plOperands[1];
+	bool bResult = false;
+	if (pnComparison <= 1) {
+		short int nFirstType = firstOperand.type;
+		short int nSecondType = secondOperand.type;
+		if (nFirstType != nSecondType && !((nFirstType == U_INT && nSecondType == U_DOUBLE) || (nFirstType == U_DOUBLE && nSecondType == U_INT))) {
+			pResult = pHead;
+			return convertError(nFirstType, nSecondType);
+		}
+		if (pnComparison == 0) {
+			if (nFirstType == U_INT || nFirstType == U_DOUBLE) {
+				bResult = firstOperand.number() == secondOperand.number();
+			}
+			else {
+				bResult = firstOperand.lexeme() == secondOperand.lexeme();
+			}
+		}
+		else {
+			bResult = !equalLexemes(firstOperand, secondOperand);
+		}
+	}
+	else {
+		if (firstOperand.type != U_INT && firstOperand.type != U_DOUBLE) {
+			pResult = firstOperand;
+			return convertError(firstOperand.type, U_DOUBLE);
+		}
+		else if (secondOperand.type != U_INT && secondOperand.type != U_DOUBLE) {
+			pResult = secondOperand;
+			return convertError(secondOperand.type, U_DOUBLE);
+		}
+		double dVal1 = firstOperand.number();
+		double dVal2 = secondOperand.number();
+		if (pnComparison == 2) {
+			bResult = dVal1 > dVal2;
+		}
+		else if (pnComparison == 3) {
+			bResult = dVal1 < dVal2;
+		}
+		else if (pnComparison == 4) {
+			bResult = dVal1 >= dVal2;
+		}
+		else {
+			bResult = dVal1 <= dVal2;
+		}
+	}
+	pResult = pHead;
+	pResult.setBool(bResult);
+	return 0;
+}
+
+inline short int opLogical(bool pbAnd, const Value& pHead, const Value* const* plOperands, unsigned int pnSize, Value& pResult) {
+	if (pnSize < 2) {
+		pResult = pHead;
+		return ERROR_NOT_ENOUGH_ARGUMENTS;
+	}
+	string sSearched = pbAnd ? "nil" : "t";
+	bool bFound = false;
+	for (unsigned int i = 0; i < pnSize; i++) {
+		if (plOperands[i]->hasLexeme(sSearched)) {
+			bFound = true;
+			break;
+		}
+	}
+	pResult = pHead;
+	pResult.setBool(pbAnd ? !bFound : bFound);
+	return 0;
+}
+
+inline void printError(short int pnErrorMessage, const Value& pToken) {
+	if (pToken.line != 0) {
+		cerr << FILENAME << "(" << pToken.line << "): \"" << pToken.lexeme() << "\": ";
+	}
+	cerr << "error " << pnErrorMessage << ":" << endl;
+	cerr << (pnErrorMessage >= 0 && pnErrorMessage < ERROR_MESSAGE_COUNT ? ERROR_MESSAGES[pnErrorMessage] : "Encountered unknown error.") << endl;
+}
+)RUNTIME";
+
+
+
+/**
+* Instances of this class resemble a transpiled expression. After the code of the expression has been executed, the value
+* is either stored in a C++ variable (e.g. a temporary value or a constant) or it is described through a statement, which
+* writes the value into a variable (the placeholder "@" is replaced by the variable). If the type of the value is a number or
+* a boolean, the native C++ expression of the value is known as well.
+*
+* @author	Christian-2003
+* @version	19.10.2026
+*/
+class CTranspiledExpression {
+private:
+	/**
+	* Stores the type of the expression's value (Token::UNKNOWN if the type is only known while executing).
+	*/
+	short int nType;
+
+	/**
+	* Stores the C++ variable, in which the value is stored.
+	*/
+	string sValue;
+
+	/**
+	* Stores the statement, which writes the value into the placeholder "@", if the value is not stored in a variable.
+	*/
+	string sMaterialize;
+
+	/**
+	* Stores the native C++ expression of an integer (int), double (double) or boolean (bool).
+	*/
+	string sNative;
+
+	/**
+	* Stores the C++ expression of the line, from which the value originates.
+	*/
+	string sLine;
+
+	/**
+	* Stores whether the native expression or the statement reads a variable of the Lisp-function, so that it must be
+	* evaluated before the variable is changed.
+	*/
+	bool bVolatile;
+
+
+
+public:
+	/**
+	* This default constructor is just in place in order not to get an error message when used as template-type of an CRV.
+	*/
+	CTranspiledExpression() {
+		nType = Token::UNKNOWN;
+		sLine = "0";
+		bVolatile = false;
+	}
+
+	/**
+	* This constructor instantiates a new transpiled expression.
+	*
+	* @param pnType			Type of the value.
+	* @param psValue		C++ variable, in which the value is stored.
+	* @param psMaterialize	Statement, which writes the value into the placeholder "@".
+	* @param psNative		Native C++ expression of the value.
+	* @param psLine			C++ expression of the line.
+	* @param pbVolatile		Whether a variable of the Lisp-function is read.
+	*/
+	CTranspiledExpression(short int pnType, string psValue, string psMaterialize, string psNative, string psLine, bool pbVolatile) {
+		nType = pnType;
+		sValue = psValue;
+		sMaterialize = psMaterialize;
+		sNative = psNative;
+		sLine = psLine;
+		bVolatile = pbVolatile;
+	}
+
+
+
+public:
+	/**
+	* Returns the type of the expression's value.
+	*
+	* @return	Type of the value.
+	*/
+	short int getType() {
+		return nType;
+	}
+
+	/**
+	* Returns the C++ variable, in which the value is stored.
+	*
+	* @return	Variable or an empty string.
+	*/
+	string getValue() {
+		return sValue;
+	}
+
+	/**
+	* Returns the statement, which writes the value into the placeholder "@".
+	*
+	* @return	Statement.
+	*/
+	string getMaterialize() {
+		return sMaterialize;
+	}
+
+	/**
+	* Returns the native C++ expression of the value.
+	*
+	* @return	Native expression or an empty string.
+	*/
+	string getNative() {
+		return sNative;
+	}
+
+	/**
+	* Returns the C++ expression of the line, from which the value originates.
+	*
+	* @return	Line.
+	*/
+	string getLine() {
+		return sLine;
+	}
+
+	/**
+	* Returns whether the expression reads a variable of the Lisp-function.
+	*
+	* @return	Whether the expression is volatile.
+	*/
+	bool isVolatile() {
+		return bVolatile;
+	}
+};
+
+
+
+/**
+* The class "CTranspiler" translates a Lisp-program into a single C++ translation unit, which does not depend on this
+* project. Every Lisp-function becomes a C++ function and every variable a local C++ variable. The declared types of
+* the variables, parameters and return values are used to translate operations on integers, doubles and booleans into
+* native C++ arithmetic, every other operation is executed by a small runtime, which is embedded into the generated code.
+* The generated program produces exactly the same output and error messages as the CInterpreter. The transpiler accepts
+* the same sourcecode as the CClosureCompiler, if the behaviour of the sourcecode cannot be resolved ahead of time, the
+* transpilation returns Error::Interpreter::INFO_ENGINE_UNSUPPORTED.
+*
+* @author	Christian-2003
+* @version	19.10.2026
+*/
+class CTranspiler {
+private:
+	/**
+	* Stores every Lisp-function, which is transpiled.
+	*/
+	vector<CFunction> lFunctions;
+
+	/**
+	* Stores the types of the parameters of every function (same index as lFunctions).
+	*/
+	vector<vector<short int>> lParameterTypes;
+
+	/**
+	* Stores the name and slot of every variable, which is visible at the currently transpiled node.
+	*/
+	vector<pair<string, unsigned int>> lScope;
+
+	/**
+	* Stores the declared type of every slot of the currently transpiled function.
+	*/
+	vector<short int> lSlotTypes;
+
+	/**
+	* Stores whether the currently transpiled function returns a value whose type is not known while transpiling.
+	*/
+	bool bUnknownReturnType;
+
+	/**
+	* Stores the index of the currently transpiled function.
+	*/
+	unsigned int nFunction;
+
+	/**
+	* Stores whether the currently transpiled function calls itself in tail position.
+	*/
+	bool bTailCall;
+
+	/**
+	* Stores the body of the currently transpiled function.
+	*/
+	string sBody;
+
+	/**
+	* Stores the indentation of the next line of the body.
+	*/
+	unsigned int nIndent;
+
+	/**
+	* Stores the number of temporary values of the currently transpiled function.
+	*/
+	unsigned int nTemporaries;
+
+	/**
+	* Stores the number of labels of the currently transpiled function.
+	*/
+	unsigned int nLabels;
+
+	/**
+	* Stores the definition of every constant value (initializer -> name of the constant).
+	*/
+	map<string, string> lConstants;
+
+	/**
+	* Stores the definitions of the constants in the order in which they are created.
+	*/
+	string sConstants;
+
+	/**
+	* Stores the filename of the sourcecode.
+	*/
+	string sFilename;
+
+	/**
+	* Stores the generated sourcecode.
+	*/
+	string sSourcecode;
+
+	/**
+	* Stores whether "&" and "|" skip their remaining operands once the result is decided.
+	*/
+	bool bShortCircuit;
+
+
+
+public:
+	/**
+	* The default constructor instantiates a new transpiler.
+	*/
+	CTranspiler() {
+		bUnknownReturnType = false;
+		nFunction = 0;
+		bTailCall = false;
+		nIndent = 1;
+		nTemporaries = 0;
+		nLabels = 0;
+		sFilename = "";
+		bShortCircuit = true;
+	}
+
+
+
+public:
+	/**
+	* This function changes, whether the generated code of "&" and "|" skips the remaining operands once the result is
+	* decided.
+	*
+	* @param pbShortCircuit	Whether the operands are evaluated lazily.
+	*/
+	void setShortCircuit(bool pbShortCircuit) {
+		bShortCircuit = pbShortCircuit;
+	}
+
+
+
+public:
+	/**
+	* This function transpiles the passed abstract syntax trees, which resemble the functions of a Lisp-program. The
+	* functions are validated the same way the CInterpreter validates them.
+	*
+	* @param pltASTs	Abstract syntax trees of every function.
+	* @return			Error message including the token which caused the error.
+	*/
+	CRV<CToken> transpile(CLinkedList<CAbstractSyntaxTree<CToken>> pltASTs) {
+		CLinkedList<CFunction> lDefinedFunctions;
+		for (unsigned int i = 0; i < pltASTs.size(); i++) {
+			CFunction newFunc;
+			CRV<CToken> funcReturn = newFunc.evaluateFunctionSourceCode(pltASTs[i]);
+			if (funcReturn.getErrorMessage() != Error::SUCCESS) {
+				//An error occured:
+				return funcReturn;
+			}
+			lDefinedFunctions.add(newFunc);
+		}
+
+		//Find the main function:
+		for (unsigned int i = 0; i < lDefinedFunctions.size(); i++) {
+			if (lDefinedFunctions[i].getName() == Keyword::MAIN_FUNCTION) {
+				if (lDefinedFunctions[i].getParameterAmount() != 0) {
+					//The function has too many parameters:
+					return CRV<CToken>(CToken(), Error::Interpreter::MAIN_FUNCTION_HAS_PARAMETERS);
+				}
+				else if (lDefinedFunctions[i].getReturnType() != Token::U_VOID) {
+					//The function does not have "void" as return type:
+					return CRV<CToken>(CToken(), Error::Interpreter::MAIN_FUNCTION_HAS_INCORRECT_RETURN_TYPE);
+				}
+				return CRV<CToken>(CToken(), generate(lDefinedFunctions, i));
+			}
+		}
+		//Main function does not exist:
+		return CRV<CToken>(CToken(), Error::Interpreter::MISSING_MAIN_FUNCTION);
+	}
+
+	/**
+	* Returns the generated C++ sourcecode.
+	*
+	* @return	Sourcecode of the translation unit.
+	*/
+	string getSourcecode() {
+		return sSourcecode;
+	}
+
+
+
+private:
+	/**
+	* This function generates the translation unit for the passed functions.
+	*
+	* @param plFunctions	Lisp-functions of the program.
+	* @param pnMainIndex	Index of the main-function.
+	* @return				Error message (Error::Interpreter::INFO_ENGINE_UNSUPPORTED if the program cannot be transpiled).
+	*/
+	short int generate(CLinkedList<CFunction> plFunctions, unsigned int pnMainIndex) {
+		lFunctions.clear();
+		for (CFunction current : plFunctions) {
+			lFunctions.push_back(current);
+		}
+		lParameterTypes.clear();
+		lParameterTypes.resize(lFunctions.size());
+		lConstants.clear();
+		sConstants = "";
+		sSourcecode = "";
+
+		//Resolve the signature of every function, before any function call is transpiled:
+		string sPrototypes = "";
+		for (unsigned int i = 0; i < lFunctions.size(); i++) {
+			CLinkedList<CVariable> lParameters = lFunctions[i].getParameters();
+			string sParameters = "";
+			for (CVariable parameter : lParameters) {
+				if (!isPrimitive(parameter.getType())) {
+					//Parameter has no valid type:
+					return Error::Interpreter::INFO_ENGINE_UNSUPPORTED;
+				}
+				sParameters += "Value s" + to_string(lParameterTypes[i].size()) + ", ";
+				lParameterTypes[i].push_back(parameter.getType());
+			}
+			sPrototypes += "[[maybe_unused]] static short int f" + to_string(i) + "(" + sParameters + "Value& result);\n";
+		}
+
+		//Transpile the functions:
+		string sFunctions = "";
+		for (unsigned int i = 0; i < lFunctions.size(); i++) {
+			CRV<string> rvFunction = transpileFunction(i);
+			if (rvFunction.getErrorMessage() != Error::SUCCESS) {
+				return rvFunction.getErrorMessage();
+			}
+			sFunctions += rvFunction.getContent() + "\n";
+		}
+
+		//Generate the tables of the runtime:
+		string sTables = "static const char* const FILENAME = " + quote(sFilename) + ";\n";
+		sTables += "const short int UNKNOWN = " + to_string(Token::UNKNOWN) + ";\n";
+		sTables += "const short int U_INT = " + to_string(Token::U_INT) + ";\n";
+		sTables += "const short int U_DOUBLE = " + to_string(Token::U_DOUBLE) + ";\n";
+		sTables += "const short int U_STRING = " + to_string(Token::U_STRING) + ";\n";
+		sTables += "const short int U_CHAR = " + to_string(Token::U_CHAR) + ";\n";
+		sTables += "const short int U_BOOL = " + to_string(Token::U_BOOL) + ";\n";
+		sTables += "const short int ERROR_SYNTAX = " + to_string(Error::Interpreter::SYNTAX_I) + ";\n";
+		sTables += "const short int ERROR_OPERANDS_ARE_OF_DIFFERENT_TYPE = " + to_string(Error::Interpreter::OPERANDS_ARE_OF_DIFFERENT_TYPE) + ";\n";
+		sTables += "const short int ERROR_CANNOT_ADD_BOOLEANS = " + to_string(Error::Interpreter::CANNOT_ADD_BOOLEANS) + ";\n";
+		sTables += "const short int ERROR_CANNOT_SUBTRACT_NON_NUMERIC_VALUES = " + to_string(Error::Interpreter::CANNOT_SUBTRACT_NON_NUMERIC_VALUES) + ";\n";
+		sTables += "const short int ERROR_CANNOT_MULTIPLY_NON_NUMERIC_VALUES = " + to_string(Error::Interpreter::CANNOT_MULTIPLY_NON_NUMERIC_VALUES) + ";\n";
+		sTables += "const short int ERROR_CANNOT_DIVIDE_NON_NUMERIC_VALUES = " + to_string(Error::Interpreter::CANNOT_DIVIDE_NON_NUMERIC_VALUES) + ";\n";
+		sTables += "const short int ERROR_CANNOT_DIVIDE_BY_ZERO = " + to_string(Error::Interpreter::CANNOT_DIVIDE_BY_ZERO) + ";\n";
+		sTables += "const short int ERROR_TOO_MANY_ARGUMENTS = " + to_string(Error::Interpreter::TOO_MANY_ARGUMENTS) + ";\n";
+		sTables += "const short int ERROR_NOT_ENOUGH_ARGUMENTS = " + to_string(Error::Interpreter::NOT_ENOUGH_ARGUMENTS) + ";\n";
+		sTables += "const short int TYPES = " + to_string(Token::U_VOID + 1) + ";\n";
+		sTables += "static const short int CONVERT_ERRORS[TYPES][TYPES] = {\n";
+		for (short int i = 0; i <= Token::U_VOID; i++) {
+			sTables += "\t{ ";
+			for (short int j = 0; j <= Token::U_VOID; j++) {
+				sTables += to_string(Error::produceConvertError(i, j)) + (j < Token::U_VOID ? ", " : "");
+			}
+			sTables += i < Token::U_VOID ? " },\n" : " }\n";
+		}
+		sTables += "};\n";
+		sTables += "const short int ERROR_MESSAGE_COUNT = " + to_string(Error::Interpreter::INFO_ENGINE_UNSUPPORTED + 1) + ";\n";
+		sTables += "static const char* const ERROR_MESSAGES[ERROR_MESSAGE_COUNT] = {\n";
+		for (short int i = 0; i <= Error::Interpreter::INFO_ENGINE_UNSUPPORTED; i++) {
+			sTables += "\t" + quote(Error::generateErrorMessage(i)) + (i < Error::Interpreter::INFO_ENGINE_UNSUPPORTED ? ",\n" : "\n");
+		}
+		sTables += "};\n";
+
+		sSourcecode = "/*\nThis file has been generated by the Lisp-transpiler from \"" + sFilename + "\".\n*/\n";
+		sSourcecode += "#include <iostream>\n#include <string>\n#include <cmath>\n\nusing namespace std;\n\n\n\n";
+		sSourcecode += sTables + TRANSPILER_RUNTIME + "\n\n\n";
+		sSourcecode += sConstants + "\n\n\n";
+		sSourcecode += sPrototypes + "\n\n\n";
+		sSourcecode += sFunctions + "\n\n";
+		sSourcecode += "int main() {\n";
+		sSourcecode += "\tValue result;\n";
+		sSourcecode += "\tshort int e = f" + to_string(pnMainIndex) + "(result);\n";
+		sSourcecode += "\tif (e != 0) {\n";
+		sSourcecode += "\t\tcout << '\\n';\n";
+		sSourcecode += "\t\tprintError(e, result);\n";
+		sSourcecode += "\t\treturn 1;\n";
+		sSourcecode += "\t}\n";
+		sSourcecode += "\treturn 0;\n";
+		sSourcecode += "}\n";
+		return Error::SUCCESS;
+	}
+
+	/**
+	* This function transpiles the function at the passed index.
+	*
+	* @param pnIndex	Index of the function.
+	* @return			C++ definition of the function.
+	*/
+	CRV<string> transpileFunction(unsigned int pnIndex) {
+		CFunction function = lFunctions[pnIndex];
+		lScope.clear();
+		lSlotTypes.clear();
+		bUnknownReturnType = false;
+		nFunction = pnIndex;
+		bTailCall = false;
+		sBody = "";
+		nIndent = 1;
+		nTemporaries = 0;
+		nLabels = 0;
+
+		//Parameters occupy the first slots:
+		CLinkedList<CVariable> lParameters = function.getParameters();
+		for (CVariable parameter : lParameters) {
+			if (findVariable(parameter.getName()) >= 0) {
+				//Multiple parameters with identical name:
+				return CRV<string>("", Error::Interpreter::INFO_ENGINE_UNSUPPORTED);
+			}
+			declareVariable(parameter.getName(), parameter.getType());
+		}
+
+		CLinkedList<CAbstractSyntaxTree<CToken>> lExpressions = function.getExpressions();
+		for (CAbstractSyntaxTree<CToken> expression : lExpressions) {
+			CRV<CTranspiledExpression> rvExpression = transpileExpression(expression);
+			if (rvExpression.getErrorMessage() != Error::SUCCESS) {
+				return CRV<string>("", rvExpression.getErrorMessage());
+			}
+		}
+
+		if (function.getReturnType() != Token::U_VOID && (!function.alwaysReturns() || bUnknownReturnType)) {
+			//The interpreter would return a value of unknown type:
+			return CRV<string>("", Error::Interpreter::INFO_ENGINE_UNSUPPORTED);
+		}
+
+		string sParameters = "";
+		for (unsigned int i = 0; i < lParameterTypes[pnIndex].size(); i++) {
+			sParameters += "Value s" + to_string(i) + ", ";
+		}
+		string sFunction = "//Lisp-function \"" + function.getName() + "\":\n";
+		sFunction += "static short int f" + to_string(pnIndex) + "(" + sParameters + "Value& result) {\n";
+		sFunction += "\tshort int e = 0;\n\t(void)e;\n";
+		for (unsigned int i = lParameterTypes[pnIndex].size(); i < lSlotTypes.size(); i++) {
+			sFunction += "\tValue s" + to_string(i) + ";\n";
+		}
+		for (unsigned int i = 0; i < nTemporaries; i++) {
+			sFunction += "\tValue t" + to_string(i) + ";\n";
+		}
+		if (bTailCall) {
+			sFunction += "tail:\n";
+		}
+		sFunction += sBody;
+		sFunction += "\treturn 0;\n}\n";
+		return CRV<string>(sFunction, Error::SUCCESS);
+	}
+
+
+
+private:
+	/**
+	* This function transpiles an expression (equivalent to "CInterpreter::interpretExpression()").
+	*
+	* @param pAST	Abstract syntax tree of the expression.
+	* @return		Transpiled expression.
+	*/
+	CRV<CTranspiledExpression> transpileExpression(CAbstractSyntaxTree<CToken> pAST) {
+		short int nType = pAST.getContent().getType();
+		if (pAST.getContent().getFilename() != "") {
+			sFilename = pAST.getContent().getFilename();
+		}
+		if (nType == Token::OPERATOR_ARITHMETIC || nType == Token::OPERATOR_RELATIONAL || nType == Token::OPERATOR_BOOL) {
+			return transpileOperation(pAST);
+		}
+		else if (nType == Token::KEYWORD) {
+			return transpileKeyword(pAST);
+		}
+		else if (nType == Token::IDENTIFIER) {
+			return transpileIdentifier(pAST);
+		}
+		//Incorrect token found:
+		return constant(CValue(), Error::Interpreter::SYNTAX_I);
+	}
+
+
+
+private:
+	/**
+	* This function transpiles an operation (equivalent to "CInterpreter::evaluateOperation()").
+	*
+	* @param pAST	Abstract syntax tree of the operation.
+	* @return		Transpiled operation.
+	*/
+	CRV<CTranspiledExpression> transpileOperation(CAbstractSyntaxTree<CToken> pAST) {
+		CToken headNode = pAST.getContent();
+		CRV<CValue> rvHead = convertToken(headNode);
+		if (rvHead.getErrorMessage() != Error::SUCCESS) {
+			return CRV<CTranspiledExpression>(CTranspiledExpression(), rvHead.getErrorMessage());
+		}
+		if (!pAST.hasSubTrees()) {
+			//The AST has no subtrees -> The current node is returned:
+			return constant(rvHead.getContent(), Error::SUCCESS);
+		}
+
+		//Transpile the operands:
+		vector<CTranspiledExpression> lOperands;
+		vector<unsigned int> lEnds; //Stores the end of the code of every operand.
+		CLinkedList<CAbstractSyntaxTree<CToken>> lSubTrees = pAST.getSubTrees();
+		for (CAbstractSyntaxTree<CToken> current : lSubTrees) {
+			CRV<CTranspiledExpression> rvOperand = transpileOperand(current);
+			if (rvOperand.getErrorMessage() != Error::SUCCESS) {
+				return rvOperand;
+			}
+			lOperands.push_back(rvOperand.getContent());
+			lEnds.push_back(sBody.size());
+		}
+
+		if (headNode.getType() == Token::OPERATOR_BOOL && bShortCircuit && lEnds.size() >= 2 && lEnds.back() > lEnds[0]) {
+			//The code of the later operands is transpiled again, so that it can be skipped:
+			sBody.erase(lEnds[0]);
+			return transpileLazyLogical(headNode.getLexeme(), rvHead.getContent(), lOperands[0], lSubTrees);
+		}
+
+		//Variables, which are read by an operand, are copied if the code of a later operand might change them:
+		for (int i = (int)lOperands.size() - 2; i >= 0; i--) {
+			if (lOperands[i].isVolatile() && lEnds.back() > lEnds[i]) {
+				string sTemporary = newTemporary();
+				sBody.insert(lEnds[i], indentation() + replacePlaceholder(lOperands[i].getMaterialize(), sTemporary) + "\n");
+				lOperands[i] = held(lOperands[i].getType(), sTemporary);
+			}
+		}
+
+		short int nHeadType = headNode.getType();
+		if (nHeadType == Token::OPERATOR_ARITHMETIC) {
+			return CRV<CTranspiledExpression>(transpileArithmetic(headNode.getLexeme(), lOperands), Error::SUCCESS);
+		}
+		else if (nHeadType == Token::OPERATOR_RELATIONAL) {
+			return CRV<CTranspiledExpression>(transpileRelational(headNode.getLexeme(), rvHead.getContent(), lOperands), Error::SUCCESS);
+		}
+		else if (nHeadType == Token::OPERATOR_BOOL) {
+			return CRV<CTranspiledExpression>(transpileLogical(headNode.getLexeme(), rvHead.getContent(), lOperands), Error::SUCCESS);
+		}
+
+		//Found invalid token -> The operands have been evaluated nonetheless:
+		return constant(rvHead.getContent(), Error::Interpreter::INCORRECT_TOKEN);
+	}
+
+	/**
+	* This function transpiles an operand of an operation.
+	*
+	* @param pAST	Abstract syntax tree of the operand.
+	* @return		Transpiled operand.
+	*/
+	CRV<CTranspiledExpression> transpileOperand(CAbstractSyntaxTree<CToken> pAST) {
+		if (isPrimitive(pAST.getContent().getType())) {
+			return literal(pAST.getContent(), Error::SUCCESS);
+		}
+		else if (pAST.getContent().getType() == Token::IDENTIFIER) {
+			return transpileExpression(pAST);
+		}
+		return transpileOperation(pAST);
+	}
+
+	/**
+	* This function transpiles an arithmetic operation. If the types of the operands are known, the operation is
+	* translated into native arithmetic, otherwise the runtime checks the operands while executing.
+	*
+	* @param psOperator	Arithmetic operator.
+	* @param plOperands	Transpiled operands.
+	* @return			Transpiled operation.
+	*/
+	CTranspiledExpression transpileArithmetic(string psOperator, vector<CTranspiledExpression>& plOperands) {
+		char chOperator = psOperator[0];
+		bool bIntegers = true;
+		bool bNumbers = true;
+		bool bVolatile = false;
+		for (unsigned int i = 0; i < plOperands.size(); i++) {
+			bIntegers = bIntegers && plOperands[i].getType() == Token::U_INT;
+			bNumbers = bNumbers && isNumeric(plOperands[i].getType());
+			bVolatile = bVolatile || plOperands[i].isVolatile();
+		}
+
+		if (bIntegers && plOperands.size() >= 2 && chOperator != '/') {
+			//Every operand is an integer, which wraps around on overflow:
+			string sValue = "(unsigned int)(" + plOperands[0].getNative() + ")";
+			for (unsigned int i = 1; i < plOperands.size(); i++) {
+				sValue = "(" + sValue + " " + chOperator + " (unsigned int)(" + plOperands[i].getNative() + "))";
+			}
+			sValue = "(int)" + sValue;
+			string sLine = plOperands[0].getLine();
+			return CTranspiledExpression(Token::U_INT, "", "@.setInt(" + sValue + "); @.line = " + sLine + ";", sValue, sLine, bVolatile);
+		}
+
+		else if (bNumbers && plOperands.size() >= 2) {
+			//Every operand is numeric and at least one is a double (or division):
+			if (chOperator == '/') {
+				//Every operand has been evaluated before checking for division by zero:
+				for (unsigned int i = 1; i < plOperands.size(); i++) {
+					emit("if (" + number(plOperands[i]) + " == 0) {");
+					nIndent++;
+					emitError(materialize(plOperands[i]), to_string(Error::Interpreter::CANNOT_DIVIDE_BY_ZERO));
+					nIndent--;
+					emit("}");
+				}
+			}
+			string sValue = number(plOperands[0]);
+			for (unsigned int i = 1; i < plOperands.size(); i++) {
+				sValue = "normalizeDouble(" + sValue + " " + chOperator + " " + number(plOperands[i]) + ")";
+			}
+			//The result is rounded again when it is stored:
+			sValue = "normalizeDouble(" + sValue + ")";
+			string sLine = plOperands[0].getLine();
+			return CTranspiledExpression(Token::U_DOUBLE, "", "@.setRawDouble(" + sValue + "); @.line = " + sLine + ";", sValue, sLine, bVolatile);
+		}
+
+		//Types are checked while executing:
+		short int nType = Token::UNKNOWN;
+		if (chOperator == '/' || (bNumbers && (!bIntegers || plOperands.size() == 1))) {
+			nType = chOperator == '/' ? Token::U_DOUBLE : (bIntegers ? Token::U_INT : Token::U_DOUBLE);
+		}
+		else if (chOperator == '+' && (plOperands[0].getType() == Token::U_STRING || plOperands[0].getType() == Token::U_CHAR)) {
+			nType = Token::U_STRING;
+		}
+		if (nType == Token::U_INT && chOperator != '/' && plOperands.size() == 1 && plOperands[0].getType() != Token::U_INT) {
+			nType = Token::UNKNOWN;
+		}
+		string sFunction = chOperator == '+' ? "opAdd" : chOperator == '-' ? "opSubtract" : chOperator == '*' ? "opMultiply" : "opDivide";
+		string sResult = newTemporary();
+		emitOperation(sFunction + "(", plOperands, sResult);
+		return held(nType, sResult);
+	}
+
+	/**
+	* This function transpiles a relational operation.
+	*
+	* @param psOperator	Relational operator.
+	* @param pHead		Head node of the operation.
+	* @param plOperands	Transpiled operands.
+	* @return			Transpiled operation.
+	*/
+	CTranspiledExpression transpileRelational(string psOperator, CValue pHead, vector<CTranspiledExpression>& plOperands) {
+		short int nComparison = psOperator == "=" ? 0 : psOperator == "!" ? 1 : psOperator == ">" ? 2 : psOperator == "<" ? 3 : psOperator == ">=" ? 4 : 5;
+		if (plOperands.size() == 2 && isNumeric(plOperands[0].getType()) && isNumeric(plOperands[1].getType())) {
+			//Both operands are numeric:
+			string sValue;
+			bool bVolatile = plOperands[0].isVolatile() || plOperands[1].isVolatile();
+			if (nComparison == 1) {
+				//The lexemes of the operands are compared:
+				sValue = "!equalLexemes(" + materialize(plOperands[0]) + ", " + materialize(plOperands[1]) + ")";
+				bVolatile = false;
+			}
+			else {
+				bool bIntegers = plOperands[0].getType() == Token::U_INT && plOperands[1].getType() == Token::U_INT;
+				string sFirst = bIntegers ? plOperands[0].getNative() : number(plOperands[0]);
+				string sSecond = bIntegers ? plOperands[1].getNative() : number(plOperands[1]);
+				string sOperator = nComparison == 0 ? "==" : nComparison == 2 ? ">" : nComparison == 3 ? "<" : nComparison == 4 ? ">=" : "<=";
+				sValue = "(" + sFirst + " " + sOperator + " " + sSecond + ")";
+			}
+			string sLine = to_string(pHead.getLine());
+			return CTranspiledExpression(Token::U_BOOL, "", "@.setBool(" + sValue + "); @.line = " + sLine + ";", sValue, sLine, bVolatile);
+		}
+
+		//Types are checked while executing:
+		string sResult = newTemporary();
+		emitOperation("opCompare(" + to_string(nComparison) + ", " + constantName(pHead) + ", ", plOperands, sResult);
+		return held(plOperands.size() == 2 && plOperands[0].getType() == plOperands[1].getType() && isPrimitive(plOperands[0].getType()) ? Token::U_BOOL : Token::UNKNOWN, sResult);
+	}
+
+	/**
+	* This function transpiles a boolean operation.
+	*
+	* @param psOperator	Boolean operator.
+	* @param pHead		Head node of the operation.
+	* @param plOperands	Transpiled operands.
+	* @return			Transpiled operation.
+	*/
+	CTranspiledExpression transpileLogical(string psOperator, CValue pHead, vector<CTranspiledExpression>& plOperands) {
+		bool bBooleans = plOperands.size() >= 2;
+		bool bVolatile = false;
+		for (unsigned int i = 0; i < plOperands.size(); i++) {
+			bBooleans = bBooleans && plOperands[i].getType() == Token::U_BOOL;
+			bVolatile = bVolatile || plOperands[i].isVolatile();
+		}
+		if (bBooleans) {
+			//Every operand is a boolean, which is "nil" if it is false:
+			string sValue = "(" + plOperands[0].getNative();
+			for (unsigned int i = 1; i < plOperands.size(); i++) {
+				sValue += (psOperator == "&" ? " && " : " || ") + plOperands[i].getNative();
+			}
+			sValue += ")";
+			string sLine = to_string(pHead.getLine());
+			return CTranspiledExpression(Token::U_BOOL, "", "@.setBool(" + sValue + "); @.line = " + sLine + ";", sValue, sLine, bVolatile);
+		}
+
+		//Types are checked while executing:
+		string sResult = newTemporary();
+		emitOperation(string("opLogical(") + (psOperator == "&" ? "true" : "false") + ", " + constantName(pHead) + ", ", plOperands, sResult);
+		return held(plOperands.size() >= 2 ? Token::U_BOOL : Token::UNKNOWN, sResult);
+	}
+
+	/**
+	* This function transpiles a boolean operation, whose operands after the first one execute code. Every such operand is
+	* only executed, if the result has not been decided by an earlier operand.
+	*
+	* @param psOperator	Boolean operator.
+	* @param pHead		Head node of the operation.
+	* @param pFirst		Transpiled first operand.
+	* @param plSubTrees	Abstract syntax trees of every operand.
+	* @return			Transpiled operation.
+	*/
+	CRV<CTranspiledExpression> transpileLazyLogical(string psOperator, CValue pHead, CTranspiledExpression pFirst, CLinkedList<CAbstractSyntaxTree<CToken>>& plSubTrees) {
+		bool bAnd = psOperator == "&";
+		string sResult = newTemporary();
+		emit(sResult + " = " + constantName(pHead) + ";");
+		emit(sResult + ".setBool(" + truthValue(bAnd, pFirst) + ");");
+		unsigned int nBlocks = 0; //Stores the number of opened blocks.
+		for (unsigned int i = 1; i < plSubTrees.size(); i++) {
+			emit("if (" + sResult + (bAnd ? ".i != 0" : ".i == 0") + ") {");
+			nIndent++;
+			nBlocks++;
+			CRV<CTranspiledExpression> rvOperand = transpileOperand(plSubTrees[i]);
+			if (rvOperand.getErrorMessage() != Error::SUCCESS) {
+				nIndent -= nBlocks;
+				return rvOperand;
+			}
+			emit(sResult + ".setBool(" + truthValue(bAnd, rvOperand.getContent()) + ");");
+		}
+		for (; nBlocks > 0; nBlocks--) {
+			nIndent--;
+			emit("}");
+		}
+		return CRV<CTranspiledExpression>(held(Token::U_BOOL, sResult), Error::SUCCESS);
+	}
+
+	/**
+	* Returns the C++ expression, which is false if the passed operand of "&" is "nil", or which is true if the passed
+	* operand of "|" is "t".
+	*
+	* @param pbAnd		Whether the operator is "&".
+	* @param pOperand	Transpiled operand.
+	* @return			Native boolean expression.
+	*/
+	string truthValue(bool pbAnd, CTranspiledExpression pOperand) {
+		if (pOperand.getType() == Token::U_BOOL && pOperand.getNative() != "") {
+			return pOperand.getNative();
+		}
+		string sValue = materialize(pOperand);
+		return pbAnd ? "!" + sValue + ".hasLexeme(\"nil\")" : sValue + ".hasLexeme(\"t\")";
+	}
+
+	/**
+	* This function emits the call of an operation of the runtime.
+	*
+	* @param psCall		Beginning of the call (function name and leading arguments).
+	* @param plOperands	Transpiled operands.
+	* @param psResult	Variable, in which the result is stored.
+	*/
+	void emitOperation(string psCall, vector<CTranspiledExpression>& plOperands, string psResult) {
+		string sOperands = "";
+		for (unsigned int i = 0; i < plOperands.size(); i++) {
+			sOperands += (i > 0 ? ", &" : "&") + materialize(plOperands[i]);
+		}
+		emit("{");
+		nIndent++;
+		emit("const Value* o[] = { " + sOperands + " };");
+		emit("e = " + psCall + "o, " + to_string(plOperands.size()) + ", " + psResult + ");");
+		emit("if (e != 0) {");
+		nIndent++;
+		emitError(psResult, "e");
+		nIndent--;
+		emit("}");
+		nIndent--;
+		emit("}");
+	}
+
+
+
+private:
+	/**
+	* This function transpiles a keyword (equivalent to "CInterpreter::evaluateKeyword()").
+	*
+	* @param pAST	Abstract syntax tree of the keyword.
+	* @return		Transpiled keyword.
+	*/
+	CRV<CTranspiledExpression> transpileKeyword(CAbstractSyntaxTree<CToken> pAST) {
+		CToken headNode = pAST.getContent();
+		CValue head(headNode);
+		if (!pAST.hasSubTrees()) {
+			//Erorr: The AST has no subtrees:
+			return constant(head, Error::Interpreter::EMPTY_AST_I);
+		}
+		CLinkedList<CAbstractSyntaxTree<CToken>> lASTs = pAST.getSubTrees();
+		string sKeyword = headNode.getLexeme();
+
+		if (sKeyword == Keyword::INT || sKeyword == Keyword::DOUBLE || sKeyword == Keyword::BOOL || sKeyword == Keyword::CHAR || sKeyword == Keyword::STRING) {
+			return transpileDeclaration(pAST);
+		}
+		else if (sKeyword == Keyword::SET) {
+			return transpileSet(pAST);
+		}
+		else if (sKeyword == Keyword::PRINT || sKeyword == Keyword::PRINTLN) {
+			for (CAbstractSyntaxTree<CToken> current : lASTs) {
+				CRV<CTranspiledExpression> rvArgument;
+				if (current.hasSubTrees() || current.getContent().getType() == Token::IDENTIFIER) {
+					rvArgument = transpileExpression(current);
+				}
+				else if (isPrimitive(current.getContent().getType())) {
+					rvArgument = literal(current.getContent(), Error::SUCCESS);
+				}
+				else {
+					//Encountered invalid token:
+					rvArgument = literal(current.getContent(), Error::Interpreter::INCORRECT_TOKEN);
+				}
+				if (rvArgument.getErrorMessage() != Error::SUCCESS) {
+					return rvArgument;
+				}
+				emit("cout << " + materialize(rvArgument.getContent()) + ".lexeme();");
+			}
+			if (sKeyword == Keyword::PRINTLN) {
+				emit("cout << \"\\n\";");
+			}
+			return CRV<CTranspiledExpression>(held(Token::KEYWORD, constantName(head)), Error::SUCCESS);
+		}
+		else if (sKeyword == Keyword::IF) {
+			return transpileIf(pAST);
+		}
+		else if (sKeyword == Keyword::WHILE) {
+			return transpileWhile(pAST);
+		}
+		else if (sKeyword == Keyword::RETURN) {
+			if (lASTs.size() != 1) {
+				//Too many values encountered which could be returned:
+				return constant(head, Error::Interpreter::TOO_MANY_VALUES_TO_RETURN);
+			}
+			CAbstractSyntaxTree<CToken> tReturnValue = lASTs.front();
+			if (!tReturnValue.hasSubTrees() && isPrimitive(tReturnValue.getContent().getType())) {
+				return literal(tReturnValue.getContent(), Error::Interpreter::INFO_RETURN_STATEMENT_ENCOUNTERED);
+			}
+			else if (isTailCall(tReturnValue)) {
+				return transpileTailCall(tReturnValue, head);
+			}
+			CRV<CTranspiledExpression> rvValue = transpileExpression(tReturnValue);
+			if (rvValue.getErrorMessage() != Error::SUCCESS) {
+				return rvValue;
+			}
+			if (!isPrimitive(rvValue.getContent().getType())) {
+				bUnknownReturnType = true;
+			}
+			emitError(materialize(rvValue.getContent()), to_string(Error::Interpreter::INFO_RETURN_STATEMENT_ENCOUNTERED));
+			return CRV<CTranspiledExpression>(held(Token::UNKNOWN, constantName(head)), Error::SUCCESS);
+		}
+		else if (sKeyword == Keyword::SPAWN || sKeyword == Keyword::AWAIT || sKeyword == Keyword::FOR || sKeyword == Keyword::PFOR || sKeyword == Keyword::MAKE_CHANNEL || sKeyword == Keyword::SEND || sKeyword == Keyword::RECV || sKeyword == Keyword::TRY_SEND || sKeyword == Keyword::TRY_RECV) {
+			//Tasks, counted loops and channels are scheduled by the thread pool of the interpreter:
+			return CRV<CTranspiledExpression>(CTranspiledExpression(), Error::Interpreter::INFO_ENGINE_UNSUPPORTED);
+		}
+		//Found invalid keyword:
+		return constant(head, Error::Interpreter::INCORRECT_TOKEN);
+	}
+
+	/**
+	* This function transpiles the declaration of a variable.
+	*
+	* @param pAST	Abstract syntax tree of the declaration.
+	* @return		Transpiled declaration.
+	*/
+	CRV<CTranspiledExpression> transpileDeclaration(CAbstractSyntaxTree<CToken> pAST) {
+		CToken headNode = pAST.getContent();
+		CLinkedList<CAbstractSyntaxTree<CToken>> lASTs = pAST.getSubTrees();
+		CValue variableValue; //Stores the standard value of the new variable.
+		if (headNode.getLexeme() == Keyword::INT) {
+			variableValue = CValue(CToken("0", Token::U_INT));
+		}
+		else if (headNode.getLexeme() == Keyword::DOUBLE) {
+			variableValue = CValue(CToken("0.0", Token::U_DOUBLE));
+		}
+		else if (headNode.getLexeme() == Keyword::BOOL) {
+			variableValue = CValue(CToken("nil", Token::U_BOOL));
+		}
+		else if (headNode.getLexeme() == Keyword::CHAR) {
+			variableValue = CValue(CToken(" ", Token::U_CHAR));
+		}
+		else {
+			variableValue = CValue(CToken("", Token::U_STRING));
+		}
+		short int nVariableType = variableValue.getType();
+
+		if (lASTs.front().getContent().getType() != Token::IDENTIFIER) {
+			//Error: Incorrect token found:
+			return literal(lASTs.front().getContent(), Error::Interpreter::INCORRECT_TOKEN);
+		}
+		CValue variableName(lASTs.retrieve(0).getContent());
+		if (lASTs.size() > 1) {
+			//There are too many arguments with this declaration:
+			return constant(CValue(headNode), Error::Interpreter::TOO_MANY_ARGUMENTS);
+		}
+
+		bool bInitialized = false;
+		CTranspiledExpression initializer;
+		if (lASTs.size() == 1) {
+			CToken initializerToken = lASTs.front().getContent();
+			if (isPrimitive(initializerToken.getType())) {
+				//Value can be used directly:
+				if (initializerToken.getType() != nVariableType) {
+					return literal(initializerToken, Error::produceConvertError(initializerToken.getType(), nVariableType));
+				}
+				CRV<CTranspiledExpression> rvLiteral = literal(initializerToken, Error::SUCCESS);
+				if (rvLiteral.getErrorMessage() != Error::SUCCESS) {
+					return rvLiteral;
+				}
+				initializer = rvLiteral.getContent();
+			}
+			else {
+				//Need to evaluate the token:
+				CRV<CTranspiledExpression> rvValue = transpileExpression(lASTs.front());
+				if (rvValue.getErrorMessage() != Error::SUCCESS) {
+					return rvValue;
+				}
+				if (!isPrimitive(rvValue.getContent().getType())) {
+					//The interpreter would not declare the variable, depending on the value's type:
+					return CRV<CTranspiledExpression>(CTranspiledExpression(), Error::Interpreter::INFO_ENGINE_UNSUPPORTED);
+				}
+				initializer = rvValue.getContent();
+				if (initializer.getType() != nVariableType) {
+					emitError(materialize(initializer), to_string(Error::produceConvertError(initializer.getType(), nVariableType)));
+					return CRV<CTranspiledExpression>(held(Token::UNKNOWN, constantName(variableName)), Error::SUCCESS);
+				}
+			}
+			bInitialized = true;
+		}
+
+		if (findVariable(variableName.getLexeme()) >= 0) {
+			//Variable's name does already exist:
+			return constant(variableName, Error::Interpreter::VARIABLE_NAME_ALREADY_IN_USE);
+		}
+
+		unsigned int nSlot = declareVariable(variableName.getLexeme(), nVariableType);
+		string sSlot = "s" + to_string(nSlot);
+		if (bInitialized) {
+			assign(initializer, sSlot);
+		}
+		else {
+			emit(sSlot + " = " + constantName(variableValue) + ";");
+		}
+		return CRV<CTranspiledExpression>(held(Token::IDENTIFIER, constantName(variableName)), Error::SUCCESS);
+	}
+
+	/**
+	* This function transpiles the set-keyword.
+	*
+	* @param pAST	Abstract syntax tree of the set-keyword.
+	* @return		Transpiled keyword.
+	*/
+	CRV<CTranspiledExpression> transpileSet(CAbstractSyntaxTree<CToken> pAST) {
+		CToken headNode = pAST.getContent();
+		CLinkedList<CAbstractSyntaxTree<CToken>> lASTs = pAST.getSubTrees();
+		if (lASTs.size() < 2) {
+			return constant(CValue(headNode), Error::Interpreter::NOT_ENOUGH_ARGUMENTS);
+		}
+		else if (lASTs.size() > 2) {
+			return constant(CValue(headNode), Error::Interpreter::TOO_MANY_ARGUMENTS);
+		}
+		else if (lASTs.front().getContent().getType() != Token::IDENTIFIER) {
+			return literal(lASTs.front().getContent(), Error::Interpreter::INCORRECT_TOKEN);
+		}
+		CValue variableName(lASTs.retrieve(0).getContent());
+
+		//Get the new value for the variable:
+		CRV<CTranspiledExpression> rvValue;
+		if (isPrimitive(lASTs.front().getContent().getType())) {
+			rvValue = literal(lASTs.front().getContent(), Error::SUCCESS);
+		}
+		else {
+			rvValue = transpileExpression(lASTs.front());
+		}
+		if (rvValue.getErrorMessage() != Error::SUCCESS) {
+			return rvValue;
+		}
+		CTranspiledExpression value = rvValue.getContent();
+
+		int nSlot = findVariable(variableName.getLexeme());
+		if (nSlot < 0) {
+			//Variable does not exist:
+			return constant(variableName, Error::Interpreter::VARIABLE_DOES_NOT_EXIST);
+		}
+
+		short int nVariableType = lSlotTypes[nSlot];
+		string sSlot = "s" + to_string(nSlot);
+		if (value.getType() == nVariableType) {
+			assign(value, sSlot);
+		}
+		else if (isPrimitive(value.getType())) {
+			//Error: New value has different data-type:
+			emitError(constantName(variableName), to_string(Error::produceConvertError(value.getType(), nVariableType)));
+		}
+		else {
+			//The type of the new value is checked while executing:
+			string sValue = materialize(value);
+			emit("if (" + sValue + ".type != " + to_string(nVariableType) + ") {");
+			nIndent++;
+			emit("e = convertError(" + sValue + ".type, " + to_string(nVariableType) + ");");
+			emit("if (e != 0) {");
+			nIndent++;
+			emitError(constantName(variableName), "e");
+			nIndent--;
+			emit("}");
+			nIndent--;
+			emit("}");
+			emit("else {");
+			nIndent++;
+			emit(sSlot + " = " + sValue + ";");
+			nIndent--;
+			emit("}");
+		}
+		return CRV<CTranspiledExpression>(held(Token::IDENTIFIER, constantName(variableName)), Error::SUCCESS);
+	}
+
+
+
+private:
+	/**
+	* This function transpiles the condition of an if-statement or while-loop. If the type of the condition is only known
+	* while executing and the condition cannot be converted into a boolean, the interpreter returns the error message of the
+	* conversion, which is Error::SUCCESS for some datatypes. In this case the condition is written into the passed variable
+	* and the generated code jumps to the passed label, which skips the statement.
+	*
+	* @param pCondition	Abstract syntax tree of the condition.
+	* @param psTarget	Variable, into which the condition is written, if the statement is skipped.
+	* @param psLabel	Label, which skips the statement.
+	* @param pbSkip		Is set to true, if the generated code might jump to the label.
+	* @return			Transpiled condition (if the type is not Token::U_BOOL, the statement is always skipped).
+	*/
+	CRV<CTranspiledExpression> transpileCondition(CAbstractSyntaxTree<CToken> pCondition, string psTarget, string psLabel, bool& pbSkip) {
+		if (!pCondition.hasSubTrees()) {
+			//No further evaluation needed:
+			CToken condToken = pCondition.getContent();
+			if (condToken.getType() != Token::U_BOOL) {
+				return literal(condToken, Error::produceConvertError(condToken.getType(), Token::U_BOOL));
+			}
+			return literal(condToken, Error::SUCCESS);
+		}
+		CRV<CTranspiledExpression> rvCondition = transpileExpression(pCondition);
+		if (rvCondition.getErrorMessage() != Error::SUCCESS || rvCondition.getContent().getType() == Token::U_BOOL) {
+			return rvCondition;
+		}
+		string sCondition = materialize(rvCondition.getContent());
+		emit("if (" + sCondition + ".type != " + to_string(Token::U_BOOL) + ") {");
+		nIndent++;
+		emit("e = convertError(" + sCondition + ".type, " + to_string(Token::U_BOOL) + ");");
+		emit("if (e != 0) {");
+		nIndent++;
+		emitError(sCondition, "e");
+		nIndent--;
+		emit("}");
+		emit(psTarget + " = " + sCondition + ";");
+		emit("goto " + psLabel + ";");
+		nIndent--;
+		emit("}");
+		pbSkip = true;
+		return CRV<CTranspiledExpression>(held(Token::U_BOOL, sCondition), Error::SUCCESS);
+	}
+
+	/**
+	* This function transpiles the body of an if-statement or while-loop within a new scope.
+	*
+	* @param pBody	Abstract syntax tree of the body.
+	* @return		Error message.
+	*/
+	short int transpileBody(CAbstractSyntaxTree<CToken> pBody) {
+		unsigned int nScopeSize = lScope.size();
+		if (pBody.getContent().getType() != Token::BRANCH) {
+			//Only one expression is represented in the body:
+			CRV<CTranspiledExpression> rvExpression = transpileExpression(pBody);
+			if (rvExpression.getErrorMessage() != Error::SUCCESS) {
+				return rvExpression.getErrorMessage();
+			}
+		}
+		else {
+			CLinkedList<CAbstractSyntaxTree<CToken>> ltBodyExpressions = pBody.getSubTrees();
+			for (CAbstractSyntaxTree<CToken> current : ltBodyExpressions) {
+				CRV<CTranspiledExpression> rvExpression = transpileExpression(current);
+				if (rvExpression.getErrorMessage() != Error::SUCCESS) {
+					return rvExpression.getErrorMessage();
+				}
+			}
+		}
+		lScope.resize(nScopeSize); //Variables of the body are erased afterwards.
+		return Error::SUCCESS;
+	}
+
+	/**
+	* This function transpiles an if-statement (equivalent to "CInterpreter::ifStatement()").
+	*
+	* @param pAST	Abstract syntax tree of the if-statement.
+	* @return		Transpiled if-statement.
+	*/
+	CRV<CTranspiledExpression> transpileIf(CAbstractSyntaxTree<CToken> pAST) {
+		CValue head(pAST.getContent());
+		CLinkedList<CAbstractSyntaxTree<CToken>> lSubTrees = pAST.getSubTrees();
+		string sResult = newTemporary();
+		string sLabel = newLabel();
+		bool bSkip = false;
+		CRV<CTranspiledExpression> rvCondition = transpileCondition(lSubTrees.front(), sResult, sLabel, bSkip);
+		if (rvCondition.getErrorMessage() != Error::SUCCESS) {
+			return rvCondition;
+		}
+		CTranspiledExpression condition = rvCondition.getContent();
+		bool bReachable = condition.getType() == Token::U_BOOL; //The statement is always skipped, if the condition is no boolean.
+		unsigned int nBodyStart = sBody.size();
+
+		if (lSubTrees.size() < 2) {
+			//Error no body found:
+			emitError(constantName(head), to_string(Error::Interpreter::MISSING_BODY));
+		}
+		else {
+			emit("if (" + condition.getNative() + ") {");
+			nIndent++;
+			short int nErrorMessage = transpileBody(lSubTrees[1]);
+			if (nErrorMessage != Error::SUCCESS) {
+				return CRV<CTranspiledExpression>(CTranspiledExpression(), nErrorMessage);
+			}
+			nIndent--;
+			emit("}");
+			if (lSubTrees.size() >= 3) {
+				emit("else {");
+				nIndent++;
+				nErrorMessage = transpileBody(lSubTrees[2]);
+				if (nErrorMessage != Error::SUCCESS) {
+					return CRV<CTranspiledExpression>(CTranspiledExpression(), nErrorMessage);
+				}
+				nIndent--;
+				emit("}");
+			}
+		}
+		return finishStatement(head, condition, bReachable, bSkip, nBodyStart, sResult, sLabel);
+	}
+
+	/**
+	* This function transpiles a while-loop (equivalent to "CInterpreter::whileLoop()"). The condition is evaluated once
+	* before the loop begins, which is why the first iteration only evaluates the condition.
+	*
+	* @param pAST	Abstract syntax tree of the while-loop.
+	* @return		Transpiled while-loop.
+	*/
+	CRV<CTranspiledExpression> transpileWhile(CAbstractSyntaxTree<CToken> pAST) {
+		CValue head(pAST.getContent());
+		CLinkedList<CAbstractSyntaxTree<CToken>> lSubTrees = pAST.getSubTrees();
+		string sResult = newTemporary();
+		string sLabel = newLabel();
+		string sPass = "p" + sLabel;
+		emit("for (int " + sPass + " = 0; ; " + sPass + " = 1) {");
+		nIndent++;
+		bool bSkip = false;
+		CRV<CTranspiledExpression> rvCondition = transpileCondition(lSubTrees.front(), sResult, sLabel, bSkip);
+		if (rvCondition.getErrorMessage() != Error::SUCCESS) {
+			return rvCondition;
+		}
+		CTranspiledExpression condition = rvCondition.getContent();
+		bool bReachable = condition.getType() == Token::U_BOOL;
+		if (!bReachable) {
+			//The loop is never executed:
+			emit("break;");
+			nIndent--;
+			emit("}");
+			unsigned int nBodyStart = sBody.size();
+			if (lSubTrees.size() == 2) {
+				short int nErrorMessage = transpileBody(lSubTrees[1]);
+				if (nErrorMessage != Error::SUCCESS) {
+					return CRV<CTranspiledExpression>(CTranspiledExpression(), nErrorMessage);
+				}
+			}
+			return finishStatement(head, condition, false, false, nBodyStart, sResult, sLabel);
+		}
+		emit("if (" + sPass + " == 0) {");
+		emit("\tcontinue;");
+		emit("}");
+		emit("if (!" + condition.getNative() + ") {");
+		emit("\tbreak;");
+		emit("}");
+
+		if (lSubTrees.size() < 2) {
+			//Error: The body is missing:
+			emitError(constantName(head), to_string(Error::Interpreter::MISSING_BODY));
+		}
+		else if (lSubTrees.size() > 2) {
+			//Error: The statement has too many arguments:
+			CRV<CValue> rvArgument = convertToken(lSubTrees[2].getContent());
+			if (rvArgument.getErrorMessage() != Error::SUCCESS) {
+				return CRV<CTranspiledExpression>(CTranspiledExpression(), rvArgument.getErrorMessage());
+			}
+			emitError(constantName(rvArgument.getContent()), to_string(Error::Interpreter::TOO_MANY_ARGUMENTS));
+		}
+		else {
+			short int nErrorMessage = transpileBody(lSubTrees[1]);
+			if (nErrorMessage != Error::SUCCESS) {
+				return CRV<CTranspiledExpression>(CTranspiledExpression(), nErrorMessage);
+			}
+		}
+		nIndent--;
+		emit("}");
+		return finishStatement(head, condition, true, bSkip, sBody.size(), sResult, sLabel);
+	}
+
+	/**
+	* This function finishes an if-statement or while-loop. If the condition is never a boolean, the code of the body is
+	* removed, since it is never executed.
+	*
+	* @param pHead			Head node of the statement.
+	* @param pCondition		Transpiled condition.
+	* @param pbReachable	Whether the body can be executed.
+	* @param pbSkip			Whether the generated code might jump to the label.
+	* @param pnBodyStart	Beginning of the body's code.
+	* @param psResult		Variable, into which the skipped condition is written.
+	* @param psLabel		Label, which skips the statement.
+	* @return				Value of the statement.
+	*/
+	CRV<CTranspiledExpression> finishStatement(CValue pHead, CTranspiledExpression pCondition, bool pbReachable, bool pbSkip, unsigned int pnBodyStart, string psResult, string psLabel) {
+		if (!pbReachable) {
+			sBody.resize(pnBodyStart);
+			return CRV<CTranspiledExpression>(pCondition, Error::SUCCESS);
+		}
+		if (!pbSkip) {
+			return CRV<CTranspiledExpression>(held(Token::KEYWORD, constantName(pHead)), Error::SUCCESS);
+		}
+		emit(psResult + " = " + constantName(pHead) + ";");
+		emit(psLabel + ":;");
+		return CRV<CTranspiledExpression>(held(Token::UNKNOWN, psResult), Error::SUCCESS);
+	}
+
+
+
+private:
+	/**
+	* This function transpiles an identifier (equivalent to "CInterpreter::evaluateIdentifier()"). Every variable is
+	* resolved to it's C++ variable, every function call to the called C++ function.
+	*
+	* @param pAST	Abstract syntax tree of the identifier.
+	* @return		Transpiled identifier.
+	*/
+	CRV<CTranspiledExpression> transpileIdentifier(CAbstractSyntaxTree<CToken> pAST) {
+		CValue name(pAST.getContent());
+		if (!pAST.hasSubTrees()) {
+			int nSlot = findVariable(name.getLexeme());
+			if (nSlot >= 0) {
+				//Identifier resembles variable name:
+				string sSlot = "s" + to_string(nSlot);
+				string sLine = to_string(name.getLine());
+				return CRV<CTranspiledExpression>(CTranspiledExpression(lSlotTypes[nSlot], "", "@ = " + sSlot + "; @.line = " + sLine + ";", native(lSlotTypes[nSlot], sSlot), sLine, true), Error::SUCCESS);
+			}
+		}
+
+		//Identifier resembles a function name:
+		vector<CTranspiledExpression> lArguments;
+		vector<string> lValues;
+		CLinkedList<CAbstractSyntaxTree<CToken>> lSubTrees = pAST.getSubTrees();
+		for (CAbstractSyntaxTree<CToken> current : lSubTrees) {
+			CRV<CTranspiledExpression> rvArgument;
+			if (current.hasSubTrees() || !isPrimitive(current.getContent().getType())) {
+				rvArgument = transpileExpression(current);
+			}
+			else {
+				rvArgument = literal(current.getContent(), Error::SUCCESS);
+			}
+			if (rvArgument.getErrorMessage() != Error::SUCCESS) {
+				return rvArgument;
+			}
+			lArguments.push_back(rvArgument.getContent());
+			lValues.push_back(materialize(lArguments.back()));
+		}
+
+		//Find the function:
+		int nFunctionIndex = -1;
+		for (unsigned int i = 0; i < lFunctions.size(); i++) {
+			if (lFunctions[i].getName() == name.getLexeme()) {
+				nFunctionIndex = i;
+				break;
+			}
+		}
+		if (nFunctionIndex < 0) {
+			//The called function does not exist:
+			return constant(name, Error::Interpreter::FUNCTION_DOES_NOT_EXIST);
+		}
+		else if (lParameterTypes[nFunctionIndex].size() != lArguments.size()) {
+			//Incorrect number of arguments are passed:
+			return constant(name, Error::Interpreter::INCORRECT_NUMBER_OF_ARGUMENTS_PASSED);
+		}
+		vector<short int>& lTypes = lParameterTypes[nFunctionIndex];
+		for (unsigned int i = 0; i < lArguments.size(); i++) {
+			if (!isPrimitive(lArguments[i].getType())) {
+				//The interpreter's behaviour depends on the argument's type:
+				return CRV<CTranspiledExpression>(CTranspiledExpression(), Error::Interpreter::INFO_ENGINE_UNSUPPORTED);
+			}
+			if (lArguments[i].getType() != lTypes[i]) {
+				//Error: The passed type is not identical with the parameter type:
+				emitError(lValues[i], to_string(Error::produceConvertError(lArguments[i].getType(), lTypes[i])));
+				return CRV<CTranspiledExpression>(held(Token::UNKNOWN, lValues[i]), Error::SUCCESS);
+			}
+		}
+
+		string sResult = newTemporary();
+		string sArguments = "";
+		for (unsigned int i = 0; i < lValues.size(); i++) {
+			sArguments += lValues[i] + ", ";
+		}
+		emit("e = f" + to_string(nFunctionIndex) + "(" + sArguments + sResult + ");");
+		short int nReturnType = lFunctions[nFunctionIndex].getReturnType();
+		string sReturn = to_string(Error::Interpreter::INFO_RETURN_STATEMENT_ENCOUNTERED);
+		if (nReturnType == Token::U_VOID) {
+			emit("if (e != 0 && e != " + sReturn + ") {");
+			nIndent++;
+			emitError(sResult, "e");
+			nIndent--;
+			emit("}");
+			return CRV<CTranspiledExpression>(held(Token::IDENTIFIER, constantName(name)), Error::SUCCESS);
+		}
+		emit("if (e == " + sReturn + ") {");
+		nIndent++;
+		emit("if (" + sResult + ".type != " + to_string(nReturnType) + ") {");
+		nIndent++;
+		emit("e = convertError(" + sResult + ".type, " + to_string(nReturnType) + ");");
+		emit("if (e != 0) {");
+		nIndent++;
+		emitError(sResult, "e");
+		nIndent--;
+		emit("}");
+		nIndent--;
+		emit("}");
+		nIndent--;
+		emit("}");
+		emit("else if (e != 0) {");
+		nIndent++;
+		emitError(sResult, "e");
+		nIndent--;
+		emit("}");
+		emit("else {");
+		nIndent++;
+		emit(sResult + " = " + constantName(name) + ";");
+		nIndent--;
+		emit("}");
+		return CRV<CTranspiledExpression>(held(nReturnType, sResult), Error::SUCCESS);
+	}
+
+
+
+private:
+	/**
+	* This function returns whether the passed value of a return statement calls the currently transpiled function with
+	* the correct number of arguments.
+	*
+	* @param pAST	Abstract syntax tree of the returned value.
+	* @return		Whether the function calls itself in tail position.
+	*/
+	bool isTailCall(CAbstractSyntaxTree<CToken> pAST) {
+		string sName = pAST.getContent().getLexeme();
+		if (pAST.getContent().getType() != Token::IDENTIFIER || (!pAST.hasSubTrees() && findVariable(sName) >= 0)) {
+			return false;
+		}
+		for (unsigned int i = 0; i < lFunctions.size(); i++) {
+			if (lFunctions[i].getName() == sName) {
+				return i == nFunction && lParameterTypes[i].size() == pAST.getSubTreeNumber();
+			}
+		}
+		return false;
+	}
+
+	/**
+	* This function transpiles a call of the currently transpiled function in tail position into a jump to the beginning
+	* of the function, which replaces the parameters with the arguments (equivalent to the reused frames of
+	* "CInterpreter::callFunction()"). Therefore, such recursions do not need the stack of the C++ program.
+	*
+	* @param pAST	Abstract syntax tree of the function call.
+	* @param pHead	Head of the return statement.
+	* @return		Transpiled return statement.
+	*/
+	CRV<CTranspiledExpression> transpileTailCall(CAbstractSyntaxTree<CToken> pAST, CValue pHead) {
+		vector<string> lValues;
+		vector<short int>& lTypes = lParameterTypes[nFunction];
+		CLinkedList<CAbstractSyntaxTree<CToken>> lSubTrees = pAST.getSubTrees();
+		for (CAbstractSyntaxTree<CToken> current : lSubTrees) {
+			CRV<CTranspiledExpression> rvArgument;
+			if (current.hasSubTrees() || !isPrimitive(current.getContent().getType())) {
+				rvArgument = transpileExpression(current);
+			}
+			else {
+				rvArgument = literal(current.getContent(), Error::SUCCESS);
+			}
+			if (rvArgument.getErrorMessage() != Error::SUCCESS) {
+				return rvArgument;
+			}
+			//The arguments are copied, since they might read the parameters, which are replaced afterwards:
+			string sArgument = newTemporary();
+			emit(sArgument + " = " + materialize(rvArgument.getContent()) + ";");
+			lValues.push_back(sArgument);
+			short int nType = rvArgument.getContent().getType();
+			if (!isPrimitive(nType)) {
+				//The interpreter's behaviour depends on the argument's type:
+				return CRV<CTranspiledExpression>(CTranspiledExpression(), Error::Interpreter::INFO_ENGINE_UNSUPPORTED);
+			}
+			if (nType != lTypes[lValues.size() - 1]) {
+				//Error: The passed type is not identical with the parameter type:
+				emitError(sArgument, to_string(Error::produceConvertError(nType, lTypes[lValues.size() - 1])));
+				return CRV<CTranspiledExpression>(held(Token::UNKNOWN, sArgument), Error::SUCCESS);
+			}
+		}
+		for (unsigned int i = 0; i < lValues.size(); i++) {
+			emit("s" + to_string(i) + " = " + lValues[i] + ";");
+		}
+		emit("goto tail;");
+		bTailCall = true;
+		return CRV<CTranspiledExpression>(held(Token::UNKNOWN, constantName(pHead)), Error::SUCCESS);
+	}
+
+	/**
+	* Creates a transpiled expression, which returns the passed value and error message.
+	*
+	* @param pValue			Value, which is returned.
+	* @param pnErrorMessage	Error message, which is returned.
+	* @return				Transpiled expression.
+	*/
+	CRV<CTranspiledExpression> constant(CValue pValue, short int pnErrorMessage) {
+		string sConstant = constantName(pValue);
+		if (pnErrorMessage != Error::SUCCESS) {
+			emitError(sConstant, to_string(pnErrorMessage));
+			return CRV<CTranspiledExpression>(held(Token::UNKNOWN, sConstant), Error::SUCCESS);
+		}
+		string sNative = "";
+		if (pValue.getType() == Token::U_INT) {
+			sNative = intLiteral(pValue.getInt());
+		}
+		else if (pValue.getType() == Token::U_DOUBLE) {
+			sNative = doubleLiteral(pValue.getDouble());
+		}
+		else if (pValue.getType() == Token::U_BOOL) {
+			sNative = pValue.getBool() ? "true" : "false";
+		}
+		return CRV<CTranspiledExpression>(CTranspiledExpression(pValue.getType(), sConstant, "", sNative, to_string(pValue.getLine()), false), Error::SUCCESS);
+	}
+
+	/**
+	* Creates a transpiled expression, which returns the passed token and error message.
+	*
+	* @param pToken			Token, which is returned.
+	* @param pnErrorMessage	Error message, which is returned.
+	* @return				Transpiled expression.
+	*/
+	CRV<CTranspiledExpression> literal(CToken pToken, short int pnErrorMessage) {
+		CRV<CValue> rvValue = convertToken(pToken);
+		if (rvValue.getErrorMessage() != Error::SUCCESS) {
+			return CRV<CTranspiledExpression>(CTranspiledExpression(), rvValue.getErrorMessage());
+		}
+		return constant(rvValue.getContent(), pnErrorMessage);
+	}
+
+	/**
+	* Converts the passed token into a value.
+	*
+	* @param pToken	Token, which should be converted.
+	* @return		Value (or Error::Interpreter::INFO_ENGINE_UNSUPPORTED if the number cannot be converted).
+	*/
+	CRV<CValue> convertToken(CToken pToken) {
+		if (pToken.getFilename() != "") {
+			sFilename = pToken.getFilename();
+		}
+		try {
+			return CRV<CValue>(CValue(pToken), Error::SUCCESS);
+		}
+		catch (const exception&) {
+			//The interpreter would crash while converting the number:
+			return CRV<CValue>(CValue(), Error::Interpreter::INFO_ENGINE_UNSUPPORTED);
+		}
+	}
+
+	/**
+	* Returns the name of the global constant, which stores the passed value. The constant is created if it does not exist.
+	*
+	* @param pValue	Value of the constant.
+	* @return		Name of the constant.
+	*/
+	string constantName(CValue pValue) {
+		string sText = "";
+		if (!((pValue.getType() == Token::U_INT || pValue.getType() == Token::U_DOUBLE) && pValue.hasDefaultLexeme()) && pValue.getType() != Token::U_BOOL) {
+			sText = pValue.getLexeme();
+		}
+		string sInitializer = "Value(" + to_string(pValue.getType()) + ", " + intLiteral(pValue.getInt()) + ", " + doubleLiteral(pValue.getDouble()) + ", string(" + quote(sText) + ", " + to_string(sText.size()) + "), " + to_string(pValue.getLine()) + ")";
+		map<string, string>::iterator it = lConstants.find(sInitializer);
+		if (it != lConstants.end()) {
+			return it->second;
+		}
+		string sName = "c" + to_string(lConstants.size());
+		lConstants[sInitializer] = sName;
+		sConstants += "static const Value " + sName + " = " + sInitializer + ";\n";
+		return sName;
+	}
+
+
+
+private:
+	/**
+	* Creates a transpiled expression, whose value is stored in the passed variable.
+	*
+	* @param pnType		Type of the value.
+	* @param psValue	Variable, which stores the value.
+	* @return			Transpiled expression.
+	*/
+	CTranspiledExpression held(short int pnType, string psValue) {
+		return CTranspiledExpression(pnType, psValue, "", native(pnType, psValue), psValue + ".line", false);
+	}
+
+	/**
+	* Returns the native C++ expression of the passed variable (an empty string if the type is no number or boolean).
+	*
+	* @param pnType		Type of the value.
+	* @param psValue	Variable, which stores the value.
+	* @return			Native expression.
+	*/
+	string native(short int pnType, string psValue) {
+		if (pnType == Token::U_INT) {
+			return psValue + ".i";
+		}
+		else if (pnType == Token::U_DOUBLE) {
+			return psValue + ".d";
+		}
+		else if (pnType == Token::U_BOOL) {
+			return "(" + psValue + ".i != 0)";
+		}
+		return "";
+	}
+
+	/**
+	* Returns the native C++ expression of the passed numeric expression as double.
+	*
+	* @param pExpression	Numeric expression.
+	* @return				Native expression of type double.
+	*/
+	string number(CTranspiledExpression pExpression) {
+		return pExpression.getType() == Token::U_INT ? "(double)(" + pExpression.getNative() + ")" : pExpression.getNative();
+	}
+
+	/**
+	* Returns the variable, which stores the value of the passed expression. If the value is not stored yet, it is written
+	* into a new temporary value.
+	*
+	* @param pExpression	Transpiled expression.
+	* @return				Variable, which stores the value.
+	*/
+	string materialize(CTranspiledExpression pExpression) {
+		if (pExpression.getValue() != "") {
+			return pExpression.getValue();
+		}
+		string sTemporary = newTemporary();
+		emit(replacePlaceholder(pExpression.getMaterialize(), sTemporary));
+		return sTemporary;
+	}
+
+	/**
+	* Writes the value of the passed expression into the passed variable.
+	*
+	* @param pExpression	Transpiled expression.
+	* @param psTarget		Variable.
+	*/
+	void assign(CTranspiledExpression pExpression, string psTarget) {
+		if (pExpression.getValue() != "") {
+			emit(psTarget + " = " + pExpression.getValue() + ";");
+		}
+		else {
+			emit(replacePlaceholder(pExpression.getMaterialize(), psTarget));
+		}
+	}
+
+	/**
+	* Emits the code, which terminates the C++ function with the passed error message.
+	*
+	* @param psToken		Variable, which stores the token that caused the error.
+	* @param psErrorMessage	C++ expression of the error message.
+	*/
+	void emitError(string psToken, string psErrorMessage) {
+		emit("result = " + psToken + ";");
+		emit("return " + psErrorMessage + ";");
+	}
+
+	/**
+	* Appends the passed line to the body of the current function.
+	*
+	* @param psLine	Line of C++ code.
+	*/
+	void emit(string psLine) {
+		sBody += indentation() + psLine + "\n";
+	}
+
+	/**
+	* Returns the indentation of the current line.
+	*
+	* @return	Indentation.
+	*/
+	string indentation() {
+		return string(nIndent, '\t');
+	}
+
+	/**
+	* Replaces every placeholder "@" of the passed statement with the passed variable.
+	*
+	* @param psStatement	Statement.
+	* @param psVariable		Variable.
+	* @return				Statement with the variable.
+	*/
+	string replacePlaceholder(string psStatement, string psVariable) {
+		string sResult = "";
+		for (unsigned int i = 0; i < psStatement.size(); i++) {
+			if (psStatement[i] == '@') {
+				sResult += psVariable;
+			}
+			else {
+				sResult += psStatement[i];
+			}
+		}
+		return sResult;
+	}
+
+	/**
+	* Creates a new temporary value within the current function.
+	*
+	* @return	Name of the temporary value.
+	*/
+	string newTemporary() {
+		return "t" + to_string(nTemporaries++);
+	}
+
+	/**
+	* Creates a new label within the current function.
+	*
+	* @return	Name of the label.
+	*/
+	string newLabel() {
+		return "L" + to_string(nLabels++);
+	}
+
+
+
+private:
+	/**
+	* Returns the passed string as C++ string literal.
+	*
+	* @param psText	String.
+	* @return		String literal.
+	*/
+	string quote(string psText) {
+		string sLiteral = "\"";
+		for (unsigned int i = 0; i < psText.size(); i++) {
+			unsigned char chCurrent = (unsigned char)psText[i];
+			if (chCurrent == '\\' || chCurrent == '"') {
+				sLiteral += '\\';
+				sLiteral += (char)chCurrent;
+			}
+			else if (chCurrent == '\n') {
+				sLiteral += "\\n";
+			}
+			else if (chCurrent == '\t') {
+				sLiteral += "\\t";
+			}
+			else if (chCurrent < 32 || chCurrent >= 127 || chCurrent == '?') {
+				//Octal escape sequences always have three digits, so that the following character is not part of it:
+				sLiteral += '\\';
+				sLiteral += (char)('0' + ((chCurrent >> 6) & 7));
+				sLiteral += (char)('0' + ((chCurrent >> 3) & 7));
+				sLiteral += (char)('0' + (chCurrent & 7));
+			}
+			else {
+				sLiteral += (char)chCurrent;
+			}
+		}
+		return sLiteral + "\"";
+	}
+
+	/**
+	* Returns the passed integer as C++ literal.
+	*
+	* @param pnValue	Integer.
+	* @return			Literal.
+	*/
+	string intLiteral(int pnValue) {
+		if (pnValue == INT_MIN) {
+			return "(-" + to_string(INT_MAX) + " - 1)";
+		}
+		return pnValue < 0 ? "(" + to_string(pnValue) + ")" : to_string(pnValue);
+	}
+
+	/**
+	* Returns the passed double as C++ literal, which is converted back into exactly the same double.
+	*
+	* @param pdValue	Double.
+	* @return			Literal.
+	*/
+	string doubleLiteral(double pdValue) {
+		ostringstream stream;
+		stream << setprecision(17) << pdValue;
+		string sLiteral = stream.str();
+		if (sLiteral.find('.') == string::npos && sLiteral.find('e') == string::npos) {
+			sLiteral += ".0";
+		}
+		return pdValue < 0 || signbit(pdValue) ? "(" + sLiteral + ")" : sLiteral;
+	}
+
+
+
+private:
+	/**
+	* Returns the slot of the visible variable with the passed name.
+	*
+	* @param psName	Name of the variable.
+	* @return		Slot of the variable or -1, if the variable does not exist.
+	*/
+	int findVariable(string psName) {
+		for (unsigned int i = 0; i < lScope.size(); i++) {
+			if (lScope[i].first == psName) {
+				return lScope[i].second;
+			}
+		}
+		return -1;
+	}
+
+	/**
+	* Declares a new variable within the current scope.
+	*
+	* @param psName	Name of the variable.
+	* @param pnType	Type of the variable.
+	* @return		Slot of the variable.
+	*/
+	unsigned int declareVariable(string psName, short int pnType) {
+		unsigned int nSlot = lSlotTypes.size();
+		lSlotTypes.push_back(pnType);
+		lScope.push_back(pair<string, unsigned int>(psName, nSlot));
+		return nSlot;
+	}
+
+	/**
+	* Returns whether the passed type resembles a primitive datatype.
+	*
+	* @param pnType	Type.
+	* @return		Whether the type is primitive.
+	*/
+	bool isPrimitive(short int pnType) {
+		return pnType == Token::U_INT || pnType == Token::U_DOUBLE || pnType == Token::U_BOOL || pnType == Token::U_CHAR || pnType == Token::U_STRING;
+	}
+
+	/**
+	* Returns whether the passed type resembles a number.
+	*
+	* @param pnType	Type.
+	* @return		Whether the type is numeric.
+	*/
+	bool isNumeric(short int pnType) {
+		return pnType == Token::U_INT || pnType == Token::U_DOUBLE;
+	}
+};
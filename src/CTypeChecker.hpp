@@ -0,0 +1,966 @@
+/*
+FILE:		CTypeChecker.hpp
+
+REMARKS:	This file contains the class "CTypeChecker", which infers and verifies the types of every expression before the
+			sourcecode is executed.
+*/
+#pragma once
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "CAbstractSyntaxTree.hpp"
+#include "CCountedLoop.hpp"
+#include "CFunction.hpp"
+#include "CLinkedList.hpp"
+#include "CRV.hpp"
+#include "CSourceAnalyzer.hpp"
+#include "CToken.hpp"
+#include "CVariable.hpp"
+#include "Variables/ErrorMessages.hpp"
+#include "Variables/KeywordTypes.hpp"
+#include "Variables/OpcodeTypes.hpp"
+#include "Variables/OperationKernels.hpp"
+#include "Variables/TokenTypes.hpp"
+
+using namespace std;
+
+
+
+/**
+* The class "CTypeChecker" checks the abstract syntax trees of every Lisp-function once, before they are executed. The type of
+* every expression is inferred in the same way, in which the interpreter would compute it, and every error, that occurs
+* whenever the erroneous expression is executed, is reported together with it's position. The checker does not stop at the
+* first error, so that every error of the sourcecode can be reported at once.
+* Afterwards, the nodes, whose runtime checks cannot fail, are marked as verified, so that the interpreter can skip these
+* checks:
+*	- Function calls:	The function exists and the types of the arguments are identical with the types of the parameters.
+*	- If-statements:	The condition always results in a boolean.
+*	- While-loops:		The condition always results in a boolean and the loop has exactly one body.
+*	- Counted loops:	The range always results in integers.
+*	- Declarations:		The initializer always results in the type of the variable.
+*	- Operations:		The types of the operands are known and cannot cause an error. The kernel of COperationKernels,
+*						with which the operation is evaluated, is stored in the head node.
+*
+* The variables of a function are only known, if no variables are declared within expressions and if every called function
+* with a return type always returns a value of this type. Otherwise, the interpreter does not restore the variables of the
+* calling function, which is why identifiers of such functions are not resolved into variables.
+*
+* @author	Christian-2003
+* @version	19.10.2026
+*/
+class CTypeChecker {
+private:
+	/**
+	* Stores every Lisp-function in the order of the abstract syntax trees.
+	*/
+	vector<CFunction> vFunctions;
+
+	/**
+	* Stores whether the function at the same index always returns a value of it's return type, if it's execution does not
+	* cause an error.
+	*/
+	vector<bool> vbReturnsType;
+
+	/**
+	* Stores whether the variables of the function at the same index are known while checking it.
+	*/
+	vector<bool> vbKnownVariables;
+
+	/**
+	* Stores the variables, which exist at the currently checked node.
+	*/
+	vector<CVariable> vScope;
+
+	/**
+	* Stores the index of the currently checked function.
+	*/
+	unsigned int nFunction;
+
+	/**
+	* Stores whether the errors are reported and the nodes are marked during the current check.
+	*/
+	bool bFinal;
+
+	/**
+	* Stores whether every return statement of the currently checked function returns a value of it's return type.
+	*/
+	bool bReturnsType;
+
+	/**
+	* Stores whether the latest checked expression always terminates it's function through a return statement.
+	*/
+	bool bReturned;
+
+	/**
+	* Stores every error, that has been found.
+	*/
+	CLinkedList<CRV<CToken>> lErrors;
+
+	/**
+	* Stores the number of nodes, that have been marked as verified.
+	*/
+	unsigned int nVerifiedNodes;
+
+	/**
+	* Analyzes the abstract syntax trees.
+	*/
+	CSourceAnalyzer analyzer;
+
+
+
+public:
+	/**
+	* The default constructor instantiates a new type checker.
+	*/
+	CTypeChecker() {
+		nFunction = 0;
+		bFinal = false;
+		bReturnsType = true;
+		bReturned = false;
+		nVerifiedNodes = 0;
+	}
+
+
+
+public:
+	/**
+	* This function checks the passed abstract syntax trees, whose nodes have to be stamped with their opcodes, and returns
+	* them with every verified node marked. The errors can be retrieved through "getErrors()" afterwards.
+	*
+	* @param pltASTs	List of abstract syntax trees, which resemble Lisp-functions.
+	* @return			Abstract syntax trees with verified nodes.
+	*/
+	CLinkedList<CAbstractSyntaxTree<CToken>> check(CLinkedList<CAbstractSyntaxTree<CToken>> pltASTs) {
+		vector<CAbstractSyntaxTree<CToken>> vtFunctions; //Stores the abstract syntax trees of the functions.
+		for (unsigned int i = 0; i < pltASTs.size(); i++) {
+			CFunction function;
+			CRV<CToken> rvFunction = function.evaluateFunctionSourceCode(pltASTs[i]);
+			if (rvFunction.getErrorMessage() != Error::SUCCESS) {
+				//The interpreter does not execute the sourcecode:
+				lErrors.add(rvFunction);
+				return pltASTs;
+			}
+			vFunctions.push_back(function);
+			vtFunctions.push_back(pltASTs[i]);
+			vbReturnsType.push_back(function.getReturnType() != Token::U_VOID);
+			vbKnownVariables.push_back(true);
+		}
+		int nMain = findFunction(Keyword::MAIN_FUNCTION);
+		if (nMain < 0) {
+			lErrors.add(CRV<CToken>(CToken(), Error::Interpreter::MISSING_MAIN_FUNCTION));
+		}
+		else if (vFunctions[nMain].getParameterAmount() != 0) {
+			lErrors.add(CRV<CToken>(CToken(), Error::Interpreter::MAIN_FUNCTION_HAS_PARAMETERS));
+		}
+		else if (vFunctions[nMain].getReturnType() != Token::U_VOID) {
+			lErrors.add(CRV<CToken>(CToken(), Error::Interpreter::MAIN_FUNCTION_HAS_INCORRECT_RETURN_TYPE));
+		}
+
+		//Remove functions, which might not return a value of their type, until every remaining function is confirmed:
+		bool bChanged = true;
+		while (bChanged) {
+			bChanged = false;
+			for (unsigned int i = 0; i < vtFunctions.size(); i++) {
+				vbKnownVariables[i] = !declaresInExpression(i) && !callsUntypedFunction(i);
+			}
+			for (unsigned int i = 0; i < vtFunctions.size(); i++) {
+				if (vbReturnsType[i] && !checkFunction(i, vtFunctions[i])) {
+					vbReturnsType[i] = false;
+					bChanged = true;
+				}
+			}
+		}
+
+		//Report the errors and mark the verified nodes:
+		bFinal = true;
+		CLinkedList<CAbstractSyntaxTree<CToken>> ltChecked; //Stores the checked abstract syntax trees.
+		for (unsigned int i = 0; i < vtFunctions.size(); i++) {
+			checkFunction(i, vtFunctions[i]);
+			ltChecked.add(vtFunctions[i]);
+		}
+		return ltChecked;
+	}
+
+	/**
+	* This function returns every error, that has been found by the latest call of "check()".
+	*
+	* @return	Errors including the token, which causes them.
+	*/
+	CLinkedList<CRV<CToken>> getErrors() {
+		return lErrors;
+	}
+
+	/**
+	* This function returns the number of nodes, that have been marked as verified.
+	*
+	* @return	Number of verified nodes.
+	*/
+	unsigned int getVerifiedNodes() {
+		return nVerifiedNodes;
+	}
+
+
+
+private:
+	/**
+	* This function checks the passed function.
+	*
+	* @param pnFunction	Index of the function.
+	* @param pAST		Abstract syntax tree of the function.
+	* @return			Whether the function always returns a value of it's return type.
+	*/
+	bool checkFunction(unsigned int pnFunction, CAbstractSyntaxTree<CToken>& pAST) {
+		nFunction = pnFunction;
+		bReturnsType = true;
+		vScope.clear();
+		CLinkedList<CVariable> lParameters = vFunctions[pnFunction].getParameters();
+		for (unsigned int i = 0; i < lParameters.size(); i++) {
+			vScope.push_back(lParameters[i]);
+		}
+		vector<CAbstractSyntaxTree<CToken>> vtSubTrees = getSubTrees(pAST);
+		bool bAlwaysReturns = checkBody(vtSubTrees[vtSubTrees.size() - 1]);
+		rebuild(pAST, vtSubTrees, false, OperationKernel::KERNEL_NONE);
+		return bReturnsType && bAlwaysReturns;
+	}
+
+	/**
+	* This function checks the statements of the passed body. Variables, that are declared within the body, are only known
+	* within the body.
+	*
+	* @param pAST	Abstract syntax tree of the body.
+	* @return		Whether the body always terminates it's function through a return statement.
+	*/
+	bool checkBody(CAbstractSyntaxTree<CToken>& pAST) {
+		size_t nScope = vScope.size();
+		bool bAlwaysReturns = false;
+		if (pAST.getContent().getType() != Token::BRANCH) {
+			//Only one statement:
+			bReturned = false;
+			checkExpression(pAST);
+			bAlwaysReturns = bReturned;
+		}
+		else {
+			vector<CAbstractSyntaxTree<CToken>> vtStatements = getSubTrees(pAST);
+			for (unsigned int i = 0; i < vtStatements.size(); i++) {
+				bReturned = false;
+				checkExpression(vtStatements[i]);
+				bAlwaysReturns = bAlwaysReturns || bReturned;
+			}
+			rebuild(pAST, vtStatements, false, OperationKernel::KERNEL_NONE);
+		}
+		vScope.resize(nScope);
+		return bAlwaysReturns;
+	}
+
+	/**
+	* This function checks the passed expression in the same way, in which "CInterpreter::interpretExpression()" would
+	* evaluate it.
+	*
+	* @param pAST	Abstract syntax tree of the expression.
+	* @return		Type of the result or Token::UNKNOWN, if it cannot be inferred.
+	*/
+	short int checkExpression(CAbstractSyntaxTree<CToken>& pAST) {
+		switch (pAST.getContent().getOpcode()) {
+		case Opcode::OPCODE_ADD:
+		case Opcode::OPCODE_SUBTRACT:
+		case Opcode::OPCODE_MULTIPLY:
+		case Opcode::OPCODE_DIVIDE:
+		case Opcode::OPCODE_EQUAL:
+		case Opcode::OPCODE_NOT_EQUAL:
+		case Opcode::OPCODE_GREATER:
+		case Opcode::OPCODE_LESS:
+		case Opcode::OPCODE_GREATER_EQUAL:
+		case Opcode::OPCODE_LESS_EQUAL:
+		case Opcode::OPCODE_AND:
+		case Opcode::OPCODE_OR:
+			return checkOperation(pAST);
+
+		case Opcode::OPCODE_DECLARE_INT:
+		case Opcode::OPCODE_DECLARE_DOUBLE:
+		case Opcode::OPCODE_DECLARE_BOOL:
+		case Opcode::OPCODE_DECLARE_CHAR:
+		case Opcode::OPCODE_DECLARE_STRING:
+		case Opcode::OPCODE_SET:
+		case Opcode::OPCODE_PRINT:
+		case Opcode::OPCODE_PRINTLN:
+		case Opcode::OPCODE_IF:
+		case Opcode::OPCODE_WHILE:
+		case Opcode::OPCODE_RETURN:
+		case Opcode::OPCODE_KEYWORD:
+		case Opcode::OPCODE_SPAWN:
+		case Opcode::OPCODE_AWAIT:
+		case Opcode::OPCODE_FOR:
+		case Opcode::OPCODE_PFOR:
+		case Opcode::OPCODE_MAKE_CHANNEL:
+		case Opcode::OPCODE_SEND:
+		case Opcode::OPCODE_RECV:
+		case Opcode::OPCODE_TRY_SEND:
+		case Opcode::OPCODE_TRY_RECV:
+			return checkKeyword(pAST);
+
+		case Opcode::OPCODE_IDENTIFIER:
+			return checkIdentifier(pAST);
+
+		default:
+			report(pAST.getContent(), Error::Interpreter::SYNTAX_I);
+			return Token::UNKNOWN;
+		}
+	}
+
+	/**
+	* This function checks the passed operation in the same way, in which "CInterpreter::evaluateOperation()" and
+	* "COperationEvaluator::evaluate()" would evaluate it.
+	*
+	* @param pAST	Abstract syntax tree of the operation.
+	* @return		Type of the result or Token::UNKNOWN, if it cannot be inferred.
+	*/
+	short int checkOperation(CAbstractSyntaxTree<CToken>& pAST) {
+		CToken headNode = pAST.getContent();
+		if (!pAST.hasSubTrees()) {
+			//The node itself is the result:
+			return headNode.getType();
+		}
+		vector<CAbstractSyntaxTree<CToken>> vtOperands = getSubTrees(pAST);
+		vector<short int> vnTypes; //Stores the types of the operands.
+		bool bKnown = true; //Stores whether the type of every operand is known.
+		for (unsigned int i = 0; i < vtOperands.size(); i++) {
+			short int nType = vtOperands[i].getContent().getType();
+			if (!analyzer.isValue(nType)) {
+				nType = nType == Token::IDENTIFIER ? checkExpression(vtOperands[i]) : checkOperation(vtOperands[i]);
+			}
+			vnTypes.push_back(nType);
+			bKnown = bKnown && nType != Token::UNKNOWN;
+		}
+		short int nType = checkOperator(headNode, vtOperands, vnTypes, bKnown); //Stores the type of the result.
+		rebuild(pAST, vtOperands, false, selectKernel(headNode.getOpcode(), nType, vtOperands.size()));
+		return nType;
+	}
+
+	/**
+	* This function checks the types of the operands of the passed operator.
+	*
+	* @param pHeadNode		Head node of the operation.
+	* @param pvtOperands	Abstract syntax trees of the operands.
+	* @param pvnTypes		Types of the operands.
+	* @param pbKnown		Whether the type of every operand is known.
+	* @return				Type of the result or Token::UNKNOWN, if it cannot be inferred.
+	*/
+	short int checkOperator(CToken pHeadNode, vector<CAbstractSyntaxTree<CToken>>& pvtOperands, vector<short int>& pvnTypes, bool pbKnown) {
+		switch (pHeadNode.getOpcode()) {
+		case Opcode::OPCODE_ADD:
+		case Opcode::OPCODE_SUBTRACT:
+		case Opcode::OPCODE_MULTIPLY:
+		case Opcode::OPCODE_DIVIDE:
+			if (!pbKnown) {
+				return Token::UNKNOWN;
+			}
+			return checkArithmetic(pHeadNode.getOpcode(), pvtOperands, pvnTypes);
+
+		case Opcode::OPCODE_EQUAL:
+		case Opcode::OPCODE_NOT_EQUAL:
+			if (pHeadNode.getArityError() != Error::SUCCESS) {
+				report(pHeadNode, pHeadNode.getArityError());
+				return Token::UNKNOWN;
+			}
+			else if (!pbKnown) {
+				return Token::UNKNOWN;
+			}
+			else if (pvnTypes[0] != pvnTypes[1] && !(isNumeric(pvnTypes[0]) && isNumeric(pvnTypes[1]))) {
+				//The head node itself is the result, if the types cannot be converted without error:
+				report(pHeadNode, Error::produceConvertError(pvnTypes[0], pvnTypes[1]));
+				return Error::produceConvertError(pvnTypes[0], pvnTypes[1]) == Error::SUCCESS ? pHeadNode.getType() : (short int)Token::UNKNOWN;
+			}
+			return Token::U_BOOL;
+
+		case Opcode::OPCODE_GREATER:
+		case Opcode::OPCODE_LESS:
+		case Opcode::OPCODE_GREATER_EQUAL:
+		case Opcode::OPCODE_LESS_EQUAL:
+			if (pHeadNode.getArityError() != Error::SUCCESS) {
+				report(pHeadNode, pHeadNode.getArityError());
+				return Token::UNKNOWN;
+			}
+			for (unsigned int i = 0; i < 2; i++) {
+				if (pvnTypes[i] == Token::UNKNOWN) {
+					return Token::UNKNOWN;
+				}
+				else if (!isNumeric(pvnTypes[i])) {
+					//The operand itself is the result, if it's type cannot be converted without error:
+					report(pvtOperands[i].getContent(), Error::produceConvertError(pvnTypes[i], Token::U_DOUBLE));
+					return Error::produceConvertError(pvnTypes[i], Token::U_DOUBLE) == Error::SUCCESS ? pvnTypes[i] : (short int)Token::UNKNOWN;
+				}
+			}
+			return Token::U_BOOL;
+
+		case Opcode::OPCODE_AND:
+		case Opcode::OPCODE_OR:
+			if (pHeadNode.getArityError() != Error::SUCCESS) {
+				report(pHeadNode, pHeadNode.getArityError());
+				return Token::UNKNOWN;
+			}
+			return Token::U_BOOL;
+
+		default:
+			report(pHeadNode, Error::Interpreter::INCORRECT_TOKEN);
+			return Token::UNKNOWN;
+		}
+	}
+
+	/**
+	* This function checks the types of the operands of an arithmetic operation.
+	*
+	* @param pnOpcode	Opcode of the operator.
+	* @param pvtOperands	Abstract syntax trees of the operands.
+	* @param pvnTypes	Types of the operands.
+	* @return			Type of the result or Token::UNKNOWN, if the operation causes an error.
+	*/
+	short int checkArithmetic(short int pnOpcode, vector<CAbstractSyntaxTree<CToken>>& pvtOperands, vector<short int>& pvnTypes) {
+		short int nReturnType = Token::U_INT; //Stores the type of the result.
+		if (pnOpcode == Opcode::OPCODE_ADD) {
+			if (pvnTypes[0] == Token::U_BOOL) {
+				report(pvtOperands[0].getContent(), Error::Interpreter::CANNOT_ADD_BOOLEANS);
+				return Token::UNKNOWN;
+			}
+			else if (pvnTypes[0] != Token::U_STRING && pvnTypes[0] != Token::U_CHAR && !isNumeric(pvnTypes[0])) {
+				report(pvtOperands[0].getContent(), Error::Interpreter::SYNTAX_I);
+				return Token::UNKNOWN;
+			}
+			bool bText = !isNumeric(pvnTypes[0]); //Stores whether strings and characters are added.
+			for (unsigned int i = 1; i < pvnTypes.size(); i++) {
+				if (bText ? (pvnTypes[i] != Token::U_STRING && pvnTypes[i] != Token::U_CHAR) : !isNumeric(pvnTypes[i])) {
+					report(pvtOperands[i].getContent(), Error::Interpreter::OPERANDS_ARE_OF_DIFFERENT_TYPE);
+					return Token::UNKNOWN;
+				}
+			}
+			if (bText) {
+				return Token::U_STRING;
+			}
+		}
+		for (unsigned int i = 0; i < pvnTypes.size(); i++) {
+			if (!isNumeric(pvnTypes[i])) {
+				report(pvtOperands[i].getContent(), pnOpcode == Opcode::OPCODE_SUBTRACT ? Error::Interpreter::CANNOT_SUBTRACT_NON_NUMERIC_VALUES : pnOpcode == Opcode::OPCODE_MULTIPLY ? Error::Interpreter::CANNOT_MULTIPLY_NON_NUMERIC_VALUES : Error::Interpreter::CANNOT_DIVIDE_NON_NUMERIC_VALUES);
+				return Token::UNKNOWN;
+			}
+			else if (pnOpcode == Opcode::OPCODE_DIVIDE && i >= 1 && analyzer.isValue(pvtOperands[i].getContent().getType()) && stod(pvtOperands[i].getContent().getLexeme()) == 0) {
+				//Only divisors, which are values, are known to be zero:
+				report(pvtOperands[i].getContent(), Error::Interpreter::CANNOT_DIVIDE_BY_ZERO);
+				return Token::UNKNOWN;
+			}
+			else if (pvnTypes[i] == Token::U_DOUBLE) {
+				nReturnType = Token::U_DOUBLE;
+			}
+		}
+		return pnOpcode == Opcode::OPCODE_DIVIDE ? (short int)Token::U_DOUBLE : nReturnType;
+	}
+
+	/**
+	* This function checks the passed keyword in the same way, in which "CInterpreter::evaluateKeyword()" would evaluate it.
+	*
+	* @param pAST	Abstract syntax tree of the keyword.
+	* @return		Type of the result or Token::UNKNOWN, if it cannot be inferred.
+	*/
+	short int checkKeyword(CAbstractSyntaxTree<CToken>& pAST) {
+		CToken headNode = pAST.getContent();
+		if (!pAST.hasSubTrees()) {
+			report(headNode, Error::Interpreter::EMPTY_AST_I);
+			return Token::UNKNOWN;
+		}
+		else if (headNode.getType() != Token::KEYWORD) {
+			report(headNode, Error::Interpreter::SYNTAX_I);
+			return Token::UNKNOWN;
+		}
+		vector<CAbstractSyntaxTree<CToken>> vtSubTrees = getSubTrees(pAST);
+		short int nType = Token::UNKNOWN; //Stores the type of the result.
+		bool bVerified = false; //Stores whether the node is verified.
+
+		switch (headNode.getOpcode()) {
+		case Opcode::OPCODE_DECLARE_INT:
+		case Opcode::OPCODE_DECLARE_DOUBLE:
+		case Opcode::OPCODE_DECLARE_BOOL:
+		case Opcode::OPCODE_DECLARE_CHAR:
+		case Opcode::OPCODE_DECLARE_STRING: {
+			short int nDeclared = analyzer.typeOf(headNode); //Stores the type of the variable.
+			CToken variableName = vtSubTrees[0].getContent();
+			if (variableName.getType() != Token::IDENTIFIER) {
+				report(variableName, Error::Interpreter::INCORRECT_TOKEN);
+				break;
+			}
+			if (vtSubTrees.size() == 2) {
+				short int nInitializer = analyzer.isValue(vtSubTrees[1].getContent().getType()) ? vtSubTrees[1].getContent().getType() : checkExpression(vtSubTrees[1]); //Stores the type of the initializer.
+				if (nInitializer != nDeclared && nInitializer != Token::UNKNOWN) {
+					report(vtSubTrees[1].getContent(), Error::produceConvertError(nInitializer, nDeclared));
+					if (Error::produceConvertError(nInitializer, nDeclared) == Error::SUCCESS) {
+						//The initializer is the result and the variable is not declared:
+						nType = nInitializer;
+						break;
+					}
+				}
+				bVerified = nInitializer == nDeclared;
+			}
+			else if (vtSubTrees.size() > 2) {
+				report(headNode, headNode.getArityError());
+			}
+			nType = Token::IDENTIFIER;
+			if (vbKnownVariables[nFunction] && findVariable(variableName.getLexeme()) >= 0) {
+				report(variableName, Error::Interpreter::VARIABLE_NAME_ALREADY_IN_USE);
+				bVerified = false;
+				break;
+			}
+			vScope.push_back(CVariable(variableName.getLexeme(), "", nDeclared));
+			break;
+		}
+
+		case Opcode::OPCODE_SET: {
+			if (headNode.getArityError() != Error::SUCCESS) {
+				report(headNode, headNode.getArityError());
+				break;
+			}
+			CToken variableName = vtSubTrees[0].getContent();
+			if (variableName.getType() != Token::IDENTIFIER) {
+				report(variableName, Error::Interpreter::INCORRECT_TOKEN);
+				break;
+			}
+			short int nValue = analyzer.isValue(vtSubTrees[1].getContent().getType()) ? vtSubTrees[1].getContent().getType() : checkExpression(vtSubTrees[1]); //Stores the type of the new value.
+			nType = Token::IDENTIFIER;
+			if (!vbKnownVariables[nFunction]) {
+				break;
+			}
+			int nVariable = findVariable(variableName.getLexeme());
+			if (nVariable < 0) {
+				report(variableName, Error::Interpreter::VARIABLE_DOES_NOT_EXIST);
+			}
+			else if (nValue != vScope[nVariable].getType() && nValue != Token::UNKNOWN) {
+				report(variableName, Error::produceConvertError(nValue, vScope[nVariable].getType()));
+			}
+			break;
+		}
+
+		case Opcode::OPCODE_PRINT:
+		case Opcode::OPCODE_PRINTLN:
+			for (unsigned int i = 0; i < vtSubTrees.size(); i++) {
+				if (vtSubTrees[i].hasSubTrees() || vtSubTrees[i].getContent().getType() == Token::IDENTIFIER) {
+					checkExpression(vtSubTrees[i]);
+				}
+				else if (!analyzer.isValue(vtSubTrees[i].getContent().getType())) {
+					report(vtSubTrees[i].getContent(), Error::Interpreter::INCORRECT_TOKEN);
+				}
+			}
+			nType = Token::KEYWORD;
+			break;
+
+		case Opcode::OPCODE_IF:
+		case Opcode::OPCODE_WHILE: {
+			short int nCondition = vtSubTrees[0].hasSubTrees() ? checkExpression(vtSubTrees[0]) : vtSubTrees[0].getContent().getType();
+			bool bConditionReturned = bReturned; //Stores whether the condition always returns.
+			if (nCondition != Token::U_BOOL && nCondition != Token::UNKNOWN) {
+				report(vtSubTrees[0].getContent(), Error::produceConvertError(nCondition, Token::U_BOOL));
+			}
+			if (vtSubTrees.size() < 2) {
+				report(headNode, Error::Interpreter::MISSING_BODY);
+			}
+			else if (headNode.getOpcode() == Opcode::OPCODE_WHILE && vtSubTrees.size() > 2) {
+				report(vtSubTrees[2].getContent(), Error::Interpreter::TOO_MANY_ARGUMENTS);
+			}
+			bool bBodiesReturn = vtSubTrees.size() >= 3 && headNode.getOpcode() == Opcode::OPCODE_IF; //Stores whether every body always returns.
+			for (unsigned int i = 1; i < vtSubTrees.size() && i <= (headNode.getOpcode() == Opcode::OPCODE_IF ? 2u : 1u); i++) {
+				bBodiesReturn = checkBody(vtSubTrees[i]) && bBodiesReturn;
+			}
+			bReturned = bConditionReturned || (nCondition == Token::U_BOOL && bBodiesReturn);
+			bVerified = nCondition == Token::U_BOOL && (headNode.getOpcode() == Opcode::OPCODE_IF ? vtSubTrees.size() >= 2 : vtSubTrees.size() == 2);
+			nType = Token::KEYWORD;
+			break;
+		}
+
+		case Opcode::OPCODE_FOR:
+		case Opcode::OPCODE_PFOR: {
+			CCountedLoop loop;
+			CRV<CToken> rvLoop = loop.read(pAST);
+			if (rvLoop.getErrorMessage() != Error::SUCCESS) {
+				report(rvLoop.getContent(), rvLoop.getErrorMessage());
+				break;
+			}
+			bool bConditionReturned = false; //Stores whether the range always returns.
+			bVerified = true;
+			for (unsigned int i = 1; i <= 2; i++) {
+				bReturned = false;
+				short int nBound = checkValue(vtSubTrees[i]); //Stores the type of the bound.
+				bConditionReturned = bConditionReturned || bReturned;
+				if (nBound != Token::U_INT && nBound != Token::UNKNOWN) {
+					report(vtSubTrees[i].getContent(), Error::produceConvertError(nBound, Token::U_INT));
+				}
+				bVerified = bVerified && nBound == Token::U_INT;
+			}
+			for (unsigned int i = 3; i + 1 < vtSubTrees.size(); i++) {
+				if (!vtSubTrees[i].hasSubTrees()) {
+					//The clause is the schedule:
+					continue;
+				}
+				CToken variable = vtSubTrees[i].getSubTreeAtIndex(0).getContent(); //Stores the reduced variable.
+				int nVariable = vbKnownVariables[nFunction] ? findVariable(variable.getLexeme()) : -1; //Stores the index of the reduced variable.
+				if (nVariable >= 0 && vScope[nVariable].getType() != Token::U_INT && vScope[nVariable].getType() != Token::U_DOUBLE) {
+					report(variable, Error::Interpreter::INVALID_LOOP_CLAUSE);
+				}
+			}
+			//The counter is only known within the body, which might not be executed:
+			size_t nScope = vScope.size();
+			vScope.push_back(CVariable(loop.getCounter(), "", Token::U_INT));
+			checkBody(vtSubTrees[vtSubTrees.size() - 1]);
+			vScope.resize(nScope);
+			bReturned = bConditionReturned;
+			nType = Token::KEYWORD;
+			break;
+		}
+
+		case Opcode::OPCODE_RETURN: {
+			if (headNode.getArityError() != Error::SUCCESS) {
+				report(headNode, headNode.getArityError());
+				bReturned = true;
+				break;
+			}
+			short int nValue = checkValue(vtSubTrees[0]); //Stores the type of the returned value.
+			short int nReturnType = vFunctions[nFunction].getReturnType();
+			if (nReturnType != Token::U_VOID && nValue != nReturnType) {
+				if (nValue != Token::UNKNOWN) {
+					report(vtSubTrees[0].getContent(), Error::produceConvertError(nValue, nReturnType));
+				}
+				bReturnsType = false;
+			}
+			bReturned = true;
+			break;
+		}
+
+		case Opcode::OPCODE_SPAWN:
+			if (headNode.getArityError() != Error::SUCCESS) {
+				report(headNode, headNode.getArityError());
+				break;
+			}
+			else if (vtSubTrees[0].getContent().getType() != Token::IDENTIFIER) {
+				report(vtSubTrees[0].getContent(), Error::Interpreter::INCORRECT_TOKEN);
+				break;
+			}
+			checkIdentifier(vtSubTrees[0]);
+			nType = Token::U_INT;
+			break;
+
+		case Opcode::OPCODE_AWAIT: {
+			if (headNode.getArityError() != Error::SUCCESS) {
+				report(headNode, headNode.getArityError());
+				break;
+			}
+			short int nHandle = checkValue(vtSubTrees[0]); //Stores the type of the handle.
+			if (nHandle != Token::U_INT && nHandle != Token::UNKNOWN) {
+				report(vtSubTrees[0].getContent(), Error::produceConvertError(nHandle, Token::U_INT));
+			}
+			//The type of the returned value depends on the awaited task...
+			break;
+		}
+
+		case Opcode::OPCODE_MAKE_CHANNEL:
+		case Opcode::OPCODE_SEND:
+		case Opcode::OPCODE_RECV:
+		case Opcode::OPCODE_TRY_SEND:
+		case Opcode::OPCODE_TRY_RECV: {
+			if (headNode.getArityError() != Error::SUCCESS) {
+				report(headNode, headNode.getArityError());
+				break;
+			}
+			short int nHandle = checkValue(vtSubTrees[0]); //Stores the type of the capacity or the handle.
+			if (nHandle != Token::U_INT && nHandle != Token::UNKNOWN) {
+				report(vtSubTrees[0].getContent(), Error::produceConvertError(nHandle, Token::U_INT));
+			}
+			if (headNode.getOpcode() == Opcode::OPCODE_MAKE_CHANNEL) {
+				nType = Token::U_INT;
+			}
+			else if (headNode.getOpcode() == Opcode::OPCODE_SEND || headNode.getOpcode() == Opcode::OPCODE_TRY_SEND) {
+				checkValue(vtSubTrees[1]);
+				nType = Token::U_BOOL;
+			}
+			else if (headNode.getOpcode() == Opcode::OPCODE_TRY_RECV) {
+				if (vtSubTrees[1].getContent().getType() != Token::IDENTIFIER || vtSubTrees[1].hasSubTrees()) {
+					report(vtSubTrees[1].getContent(), Error::Interpreter::INCORRECT_TOKEN);
+				}
+				nType = Token::U_BOOL;
+			}
+			//The type of a received value depends on the sent value...
+			break;
+		}
+
+		default:
+			report(headNode, Error::Interpreter::INCORRECT_TOKEN);
+			break;
+		}
+		rebuild(pAST, vtSubTrees, bVerified, OperationKernel::KERNEL_NONE);
+		return nType;
+	}
+
+	/**
+	* This function checks the passed identifier in the same way, in which "CInterpreter::evaluateIdentifier()" and
+	* "CInterpreter::callFunction()" would evaluate it.
+	*
+	* @param pAST	Abstract syntax tree of the identifier.
+	* @return		Type of the result or Token::UNKNOWN, if it cannot be inferred.
+	*/
+	short int checkIdentifier(CAbstractSyntaxTree<CToken>& pAST) {
+		CToken calledName = pAST.getContent();
+		if (!pAST.hasSubTrees()) {
+			if (!vbKnownVariables[nFunction]) {
+				//The identifier might resemble a variable:
+				return Token::UNKNOWN;
+			}
+			int nVariable = findVariable(calledName.getLexeme());
+			if (nVariable >= 0) {
+				return vScope[nVariable].getType();
+			}
+		}
+
+		//Identifier resembles a function call:
+		vector<CAbstractSyntaxTree<CToken>> vtArguments = getSubTrees(pAST);
+		vector<short int> vnTypes; //Stores the types of the arguments.
+		for (unsigned int i = 0; i < vtArguments.size(); i++) {
+			vnTypes.push_back(checkValue(vtArguments[i]));
+		}
+		int nCalled = findFunction(calledName.getLexeme());
+		short int nType = Token::UNKNOWN; //Stores the type of the result.
+		bool bVerified = false; //Stores whether the node is verified.
+		if (nCalled < 0) {
+			report(calledName, Error::Interpreter::FUNCTION_DOES_NOT_EXIST);
+		}
+		else if (vFunctions[nCalled].getParameterAmount() != vtArguments.size()) {
+			report(calledName, Error::Interpreter::INCORRECT_NUMBER_OF_ARGUMENTS_PASSED);
+		}
+		else {
+			CLinkedList<CVariable> lParameters = vFunctions[nCalled].getParameters();
+			bVerified = true;
+			for (unsigned int i = 0; i < vnTypes.size(); i++) {
+				if (vnTypes[i] != lParameters[i].getType()) {
+					bVerified = false;
+					if (vnTypes[i] != Token::UNKNOWN) {
+						//The argument itself is the result, if it's type can be converted without error:
+						report(vtArguments[i].getContent(), Error::produceConvertError(vnTypes[i], lParameters[i].getType()));
+						nType = Error::produceConvertError(vnTypes[i], lParameters[i].getType()) == Error::SUCCESS ? vnTypes[i] : (short int)Token::UNKNOWN;
+						break;
+					}
+				}
+			}
+			if (bVerified) {
+				if (vFunctions[nCalled].getReturnType() == Token::U_VOID) {
+					//The name of the function is the result:
+					nType = calledName.getType();
+				}
+				else if (vbReturnsType[nCalled]) {
+					nType = vFunctions[nCalled].getReturnType();
+				}
+			}
+		}
+		rebuild(pAST, vtArguments, bVerified, OperationKernel::KERNEL_NONE);
+		return nType;
+	}
+
+	/**
+	* This function checks the passed return value or argument, which is only evaluated, if it is no value without
+	* subtrees.
+	*
+	* @param pAST	Abstract syntax tree of the value.
+	* @return		Type of the value or Token::UNKNOWN, if it cannot be inferred.
+	*/
+	short int checkValue(CAbstractSyntaxTree<CToken>& pAST) {
+		if (analyzer.isValue(pAST.getContent().getType()) && !pAST.hasSubTrees()) {
+			return pAST.getContent().getType();
+		}
+		return checkExpression(pAST);
+	}
+
+
+
+private:
+	/**
+	* This function reports the passed error, if errors are reported during the current check.
+	*
+	* @param pToken		Token, which causes the error.
+	* @param pnError	Error message.
+	*/
+	void report(CToken pToken, short int pnError) {
+		if (bFinal && pnError != Error::SUCCESS) {
+			lErrors.add(CRV<CToken>(pToken, pnError));
+		}
+	}
+
+	/**
+	* This function replaces the subtrees of the passed node with the checked subtrees and marks the node as verified, if
+	* the nodes are marked during the current check. Operations, for which a kernel is selected, are verified as well.
+	*
+	* @param pAST			Abstract syntax tree of the node.
+	* @param pvtSubTrees	Checked subtrees.
+	* @param pbVerified		Whether the node is verified.
+	* @param pnKernel		Kernel of the operation or OperationKernel::KERNEL_NONE.
+	*/
+	void rebuild(CAbstractSyntaxTree<CToken>& pAST, vector<CAbstractSyntaxTree<CToken>>& pvtSubTrees, bool pbVerified, short int pnKernel) {
+		if (!bFinal) {
+			return;
+		}
+		CToken content = pAST.getContent();
+		content.setKernel(pnKernel);
+		if (pbVerified || pnKernel != OperationKernel::KERNEL_NONE) {
+			content.setVerified(true);
+			nVerifiedNodes++;
+		}
+		CLinkedList<CAbstractSyntaxTree<CToken>> ltSubTrees;
+		for (unsigned int i = 0; i < pvtSubTrees.size(); i++) {
+			ltSubTrees.add(pvtSubTrees[i]);
+		}
+		pAST = CAbstractSyntaxTree<CToken>(content, ltSubTrees);
+	}
+
+	/**
+	* This function returns the subtrees of the passed node.
+	*
+	* @param pAST	Abstract syntax tree of the node.
+	* @return		Subtrees of the node.
+	*/
+	vector<CAbstractSyntaxTree<CToken>> getSubTrees(CAbstractSyntaxTree<CToken> pAST) {
+		CLinkedList<CAbstractSyntaxTree<CToken>> ltSubTrees = pAST.getSubTrees();
+		vector<CAbstractSyntaxTree<CToken>> vtSubTrees;
+		for (unsigned int i = 0; i < ltSubTrees.size(); i++) {
+			vtSubTrees.push_back(ltSubTrees[i]);
+		}
+		return vtSubTrees;
+	}
+
+	/**
+	* This function returns whether a statement of the passed function declares variables within an expression.
+	*
+	* @param pnFunction	Index of the function.
+	* @return			Whether variables are declared within an expression.
+	*/
+	bool declaresInExpression(unsigned int pnFunction) {
+		CLinkedList<CAbstractSyntaxTree<CToken>> ltExpressions = vFunctions[pnFunction].getExpressions();
+		for (unsigned int i = 0; i < ltExpressions.size(); i++) {
+			if (analyzer.declaresInExpression(ltExpressions[i])) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	/**
+	* This function returns whether a statement of the passed function calls another function with return type, which might
+	* not return a value of this type. The name of the function and calls of itself are ignored, since the variables, which
+	* a call of the function itself does not restore, have the same types as the variables of the calling function.
+	*
+	* @param pnFunction	Index of the function.
+	* @return			Whether such a function might be called.
+	*/
+	bool callsUntypedFunction(unsigned int pnFunction) {
+		CLinkedList<CAbstractSyntaxTree<CToken>> ltExpressions = vFunctions[pnFunction].getExpressions();
+		for (unsigned int i = 0; i < ltExpressions.size(); i++) {
+			if (callsUntypedFunction(pnFunction, ltExpressions[i])) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	/**
+	* This function returns whether the passed node contains an identifier of a function with return type, which might not
+	* return a value of this type and is not the passed function.
+	*
+	* @param pnFunction	Index of the function, which contains the node.
+	* @param pAST		Abstract syntax tree of the node.
+	* @return			Whether such a function might be called.
+	*/
+	bool callsUntypedFunction(unsigned int pnFunction, CAbstractSyntaxTree<CToken> pAST) {
+		if (pAST.getContent().getType() == Token::IDENTIFIER) {
+			int nCalled = findFunction(pAST.getContent().getLexeme());
+			if (nCalled >= 0 && (unsigned int)nCalled != pnFunction && vFunctions[nCalled].getReturnType() != Token::U_VOID && !vbReturnsType[nCalled]) {
+				return true;
+			}
+		}
+		for (unsigned int i = 0; i < pAST.getSubTreeNumber(); i++) {
+			if (callsUntypedFunction(pnFunction, pAST.getSubTreeAtIndex(i))) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	/**
+	* This function returns the index of the first function with the passed name.
+	*
+	* @param psName	Name of the function.
+	* @return		Index of the function or -1, if it does not exist.
+	*/
+	int findFunction(string psName) {
+		for (unsigned int i = 0; i < vFunctions.size(); i++) {
+			if (vFunctions[i].getName() == psName) {
+				return i;
+			}
+		}
+		return -1;
+	}
+
+	/**
+	* This function returns the index of the first variable with the passed name in the current scope.
+	*
+	* @param psName	Name of the variable.
+	* @return		Index of the variable or -1, if it does not exist.
+	*/
+	int findVariable(string psName) {
+		for (unsigned int i = 0; i < vScope.size(); i++) {
+			if (vScope[i].getName() == psName) {
+				return i;
+			}
+		}
+		return -1;
+	}
+
+	/**
+	* This function selects the kernel of an operation, whose result has the passed type. Arithmetic operations are computed
+	* in the type of their result, divisions always as doubles.
+	*
+	* @param pnOpcode		Opcode of the operator.
+	* @param pnType			Type of the result or Token::UNKNOWN.
+	* @param pnOperands		Number of operands.
+	* @return				Kernel of the operation or OperationKernel::KERNEL_NONE.
+	*/
+	short int selectKernel(short int pnOpcode, short int pnType, unsigned int pnOperands) {
+		switch (pnOpcode) {
+		case Opcode::OPCODE_ADD:
+		case Opcode::OPCODE_SUBTRACT:
+		case Opcode::OPCODE_MULTIPLY:
+		case Opcode::OPCODE_DIVIDE:
+			if (pnType == Token::U_STRING) {
+				return OperationKernel::KERNEL_STRING_VARIADIC;
+			}
+			else if (pnType == Token::U_INT) {
+				return pnOperands == 2 ? OperationKernel::KERNEL_INT_BINARY : pnOperands == 3 ? OperationKernel::KERNEL_INT_TERNARY : OperationKernel::KERNEL_INT_VARIADIC;
+			}
+			else if (pnType == Token::U_DOUBLE) {
+				return pnOperands == 2 ? OperationKernel::KERNEL_DOUBLE_BINARY : pnOperands == 3 ? OperationKernel::KERNEL_DOUBLE_TERNARY : OperationKernel::KERNEL_DOUBLE_VARIADIC;
+			}
+			return OperationKernel::KERNEL_NONE;
+
+		case Opcode::OPCODE_EQUAL:
+		case Opcode::OPCODE_NOT_EQUAL:
+		case Opcode::OPCODE_GREATER:
+		case Opcode::OPCODE_LESS:
+		case Opcode::OPCODE_GREATER_EQUAL:
+		case Opcode::OPCODE_LESS_EQUAL:
+			return pnType == Token::U_BOOL ? OperationKernel::KERNEL_COMPARISON : OperationKernel::KERNEL_NONE;
+
+		default:
+			return OperationKernel::KERNEL_NONE;
+		}
+	}
+
+	/**
+	* This function returns whether the passed type is numeric.
+	*
+	* @param pnType	Type.
+	* @return		Whether the type is Token::U_INT or Token::U_DOUBLE.
+	*/
+	bool isNumeric(short int pnType) {
+		return pnType == Token::U_INT || pnType == Token::U_DOUBLE;
+	}
+};
@@ -0,0 +1,303 @@
+/*
+FILE:		CValue.hpp
+
+REMARKS:	This file contains the class "CValue", which stores a runtime value as native number instead of a lexeme.
+*/
+#pragma once
+
+#include <iostream>
+#include <string>
+#include <cmath>
+
+#include "CToken.hpp"
+#include "Variables/TokenTypes.hpp"
+
+using namespace std;
+
+
+
+/**
+* Instances of this class resemble a value, which is produced while executing compiled Lisp-code. Unlike a CToken,
+* integers and doubles are stored as native numbers, so that they do not need to be converted with "stoi()" and
+* "stod()" for every operation. The lexeme of the value is only generated when it is needed (e.g. when printing).
+*
+* @author	Christian-2003
+* @version	19.10.2026
+*/
+class CValue {
+private:
+	/**
+	* Stores the type of the value (same types as used with CToken).
+	*/
+	short int nType;
+
+	/**
+	* Stores the value of an integer. Booleans are stored as 1 ("t") or 0 ("nil").
+	*/
+	int nInt;
+
+	/**
+	* Stores the value of a double.
+	*/
+	double dDouble;
+
+	/**
+	* Stores the lexeme of every value, which is no number. Integers and doubles only store a lexeme if it differs from the
+	* lexeme, that would be generated by "to_string()" (e.g. "0.5" instead of "0.500000"). Otherwise this string is empty.
+	*/
+	string sText;
+
+	/**
+	* Stores the line, from which the value originates. 0 indicates, that the value does not originate from the sourcecode.
+	*/
+	unsigned int nLine;
+
+
+
+public:
+	/**
+	* The default constructor creates a new value without content or type. This resembles the default CToken.
+	*/
+	CValue() {
+		nType = Token::UNKNOWN;
+		nInt = 0;
+		dDouble = 0.0;
+		nLine = 0;
+	}
+
+	/**
+	* This constructor converts the passed token into a value. If the token resembles an integer or double, the lexeme is
+	* converted into a number. This might throw an exception if the lexeme cannot be converted.
+	*
+	* @param pToken	Token, which should be converted into a value.
+	*/
+	CValue(CToken pToken) {
+		nType = pToken.getType();
+		nInt = 0;
+		dDouble = 0.0;
+		nLine = pToken.getLine();
+		if (nType == Token::U_INT) {
+			nInt = stoi(pToken.getLexeme());
+			if (to_string(nInt) != pToken.getLexeme()) {
+				//Lexeme is not in the default format (e.g. "007"):
+				sText = pToken.getLexeme();
+			}
+		}
+		else if (nType == Token::U_DOUBLE) {
+			dDouble = stod(pToken.getLexeme());
+			if (to_string(dDouble) != pToken.getLexeme()) {
+				//Lexeme is not in the default format (e.g. "0.5"):
+				sText = pToken.getLexeme();
+			}
+		}
+		else if (nType == Token::U_BOOL) {
+			nInt = pToken.getLexeme() == "t" ? 1 : 0;
+		}
+		else {
+			sText = pToken.getLexeme();
+		}
+	}
+
+
+
+public:
+	/**
+	* Returns the type of the value.
+	*
+	* @return	Type of the value.
+	*/
+	short int getType() {
+		return nType;
+	}
+
+	/**
+	* Returns the integer value (or 1 / 0 for booleans).
+	*
+	* @return	Integer value.
+	*/
+	int getInt() {
+		return nInt;
+	}
+
+	/**
+	* Returns the double value.
+	*
+	* @return	Double value.
+	*/
+	double getDouble() {
+		return dDouble;
+	}
+
+	/**
+	* Returns the numeric value of an integer or double as double. This resembles "stod()" of the value's lexeme.
+	*
+	* @return	Numeric value.
+	*/
+	double getNumber() {
+		return nType == Token::U_INT ? (double)nInt : dDouble;
+	}
+
+	/**
+	* Returns whether the value resembles the boolean "t".
+	*
+	* @return	Whether the value is "t".
+	*/
+	bool getBool() {
+		return nInt != 0;
+	}
+
+	/**
+	* Returns the line, from which the value originates.
+	*
+	* @return	Line of the value.
+	*/
+	unsigned int getLine() {
+		return nLine;
+	}
+
+	/**
+	* Returns whether the lexeme of the value is the default lexeme for the number (no custom lexeme stored).
+	*
+	* @return	Whether the lexeme is generated through "to_string()".
+	*/
+	bool hasDefaultLexeme() {
+		return sText.empty();
+	}
+
+	/**
+	* Returns the lexeme of the value. This is identical to the lexeme of the token which would be created by the
+	* interpreter.
+	*
+	* @return	Lexeme of the value.
+	*/
+	string getLexeme() {
+		if (nType == Token::U_INT) {
+			return sText.empty() ? to_string(nInt) : sText;
+		}
+		else if (nType == Token::U_DOUBLE) {
+			return sText.empty() ? to_string(dDouble) : sText;
+		}
+		else if (nType == Token::U_BOOL) {
+			return nInt != 0 ? "t" : "nil";
+		}
+		return sText;
+	}
+
+	/**
+	* Returns whether the lexeme of the value is identical to the passed lexeme without generating the lexeme of numbers.
+	*
+	* @param psLexeme	Lexeme, to which the value is compared.
+	* @return			Whether the lexemes are identical.
+	*/
+	bool hasLexeme(string psLexeme) {
+		if (nType == Token::U_BOOL) {
+			return psLexeme == (nInt != 0 ? "t" : "nil");
+		}
+		else if (nType == Token::U_INT || nType == Token::U_DOUBLE) {
+			return getLexeme() == psLexeme;
+		}
+		return sText == psLexeme;
+	}
+
+	/**
+	* Converts the value back into a token.
+	*
+	* @param psFilename	Filename of the sourcecode, the value originates from.
+	* @return			Token which resembles the value.
+	*/
+	CToken toToken(string psFilename) {
+		return CToken(getLexeme(), nType, nLine != 0 ? psFilename : "", nLine);
+	}
+
+
+
+public:
+	/**
+	* Changes the value to an integer.
+	*
+	* @param pnValue	New integer value.
+	*/
+	void setInt(int pnValue) {
+		nType = Token::U_INT;
+		nInt = pnValue;
+		sText.clear();
+	}
+
+	/**
+	* Changes the value to a double. The passed double is rounded the same way the interpreter does when storing the
+	* double as lexeme, so that "to_string()" and "stod()" do not need to be called.
+	*
+	* @param pdValue	New double value.
+	*/
+	void setDouble(double pdValue) {
+		nType = Token::U_DOUBLE;
+		dDouble = normalizeDouble(pdValue);
+		sText.clear();
+	}
+
+	/**
+	* Changes the value to a double with a custom lexeme.
+	*
+	* @param pdValue	New double value.
+	* @param psLexeme	Lexeme of the double.
+	*/
+	void setDouble(double pdValue, string psLexeme) {
+		nType = Token::U_DOUBLE;
+		dDouble = pdValue;
+		sText = to_string(pdValue) != psLexeme ? psLexeme : "";
+	}
+
+	/**
+	* Changes the value to a boolean.
+	*
+	* @param pbValue	New boolean value.
+	*/
+	void setBool(bool pbValue) {
+		nType = Token::U_BOOL;
+		nInt = pbValue ? 1 : 0;
+		sText.clear();
+	}
+
+	/**
+	* Changes the value to a string (or any other type, which is stored as lexeme).
+	*
+	* @param psValue	New lexeme.
+	* @param pnType		New type.
+	*/
+	void setText(string psValue, short int pnType) {
+		nType = pnType;
+		sText = psValue;
+	}
+
+	/**
+	* Changes the line, from which the value originates.
+	*
+	* @param pnLine	New line.
+	*/
+	void setLine(unsigned int pnLine) {
+		nLine = pnLine;
+	}
+
+
+
+public:
+	/**
+	* This function rounds the passed double the same way the interpreter does when it stores the double as a lexeme
+	* ("stod(to_string(value))"), since the lexeme only contains six decimal places. If the number is small enough and not
+	* close to a rounding boundary, this is done without "to_string()".
+	*
+	* @param pdValue	Double, which should be rounded.
+	* @return			Rounded double.
+	*/
+	static double normalizeDouble(double pdValue) {
+		double dScaled = pdValue * 1000000.0;
+		if (dScaled > -1.0e12 && dScaled < 1.0e12) {
+			double dFraction = dScaled - floor(dScaled);
+			if (dFraction < 0.499 || dFraction > 0.501) {
+				//Rounding direction is unambiguous:
+				return nearbyint(dScaled) / 1000000.0;
+			}
+		}
+		return stod(to_string(pdValue));
+	}
+};
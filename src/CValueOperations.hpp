@@ -0,0 +1,363 @@
+/*
+FILE:		CValueOperations.hpp
+
+REMARKS:	This file contains the class "CValueOperations", which implements every arithmetic, relational and boolean operation
+			for values of the type "CValue".
+*/
+#pragma once
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "CValue.hpp"
+#include "Variables/ErrorMessages.hpp"
+#include "Variables/TokenTypes.hpp"
+
+using namespace std;
+
+
+
+/**
+* This class implements the operations of the interpreter ("CInterpreter::evaluateOperation()") for already evaluated
+* operands of the type CValue. Every function behaves exactly like the respective part of the interpreter, including the
+* order in which the operands are checked and the token which is returned with an error message.
+* Each function returns the error message and writes the result (or the token which caused the error) into pResult.
+*
+* @author	Christian-2003
+* @version	19.10.2026
+*/
+class CValueOperations {
+private:
+	/**
+	* Stores whether "&" and "|" stop evaluating their operands, as soon as an operand decides the result.
+	*/
+	bool bShortCircuit;
+
+
+
+public:
+	/**
+	* The default constructor instantiates new operations, with which "&" and "|" are short-circuited.
+	*/
+	CValueOperations() {
+		bShortCircuit = true;
+	}
+
+	/**
+	* Changes whether "&" and "|" are short-circuited.
+	*
+	* @param pbShortCircuit	Whether boolean operations are short-circuited.
+	*/
+	void setShortCircuit(bool pbShortCircuit) {
+		bShortCircuit = pbShortCircuit;
+	}
+
+	/**
+	* Returns whether the passed operand decides the result of a boolean operation ("nil" for "&", "t" for "|"), so that
+	* the remaining operands are not evaluated.
+	*
+	* @param psOperator	Lexeme of the operator.
+	* @param pOperand	Evaluated operand.
+	* @return			Whether the remaining operands are skipped.
+	*/
+	bool isDecided(string& psOperator, CValue& pOperand) {
+		return bShortCircuit && pOperand.hasLexeme(psOperator == "&" ? "nil" : "t");
+	}
+
+
+
+public:
+	/**
+	* Evaluates the addition of the passed operands ("+").
+	*
+	* @param plOperands	Evaluated operands.
+	* @param pResult	Result of the operation.
+	* @return			Error message.
+	*/
+	short int add(vector<CValue>& plOperands, CValue& pResult) {
+		short int nReturnType = plOperands[0].getType();
+		if (nReturnType == Token::U_STRING || nReturnType == Token::U_CHAR) {
+			//Every other operand must be string or character:
+			for (unsigned int i = 1; i < plOperands.size(); i++) {
+				if (plOperands[i].getType() != Token::U_STRING && plOperands[i].getType() != Token::U_CHAR) {
+					pResult = plOperands[i];
+					return Error::Interpreter::OPERANDS_ARE_OF_DIFFERENT_TYPE;
+				}
+			}
+			string sReturnValue = "";
+			for (unsigned int i = 0; i < plOperands.size(); i++) {
+				sReturnValue += plOperands[i].getLexeme();
+			}
+			pResult = plOperands[0];
+			pResult.setText(sReturnValue, Token::U_STRING);
+			return Error::SUCCESS;
+		}
+		else if (nReturnType == Token::U_INT || nReturnType == Token::U_DOUBLE) {
+			//Every other operand must be integer or double:
+			for (unsigned int i = 1; i < plOperands.size(); i++) {
+				if (plOperands[i].getType() != Token::U_INT && plOperands[i].getType() != Token::U_DOUBLE) {
+					pResult = plOperands[i];
+					return Error::Interpreter::OPERANDS_ARE_OF_DIFFERENT_TYPE;
+				}
+				if (plOperands[i].getType() == Token::U_DOUBLE) {
+					nReturnType = Token::U_DOUBLE;
+				}
+			}
+		}
+		else if (nReturnType == Token::U_BOOL) {
+			pResult = plOperands[0];
+			return Error::Interpreter::CANNOT_ADD_BOOLEANS;
+		}
+		else {
+			pResult = plOperands[0];
+			return Error::Interpreter::SYNTAX_I;
+		}
+		return foldNumbers('+', nReturnType, plOperands, pResult);
+	}
+
+	/**
+	* Evaluates the subtraction of the passed operands ("-").
+	*
+	* @param plOperands	Evaluated operands.
+	* @param pResult	Result of the operation.
+	* @return			Error message.
+	*/
+	short int subtract(vector<CValue>& plOperands, CValue& pResult) {
+		short int nReturnType = Token::U_INT;
+		for (unsigned int i = 0; i < plOperands.size(); i++) {
+			if (plOperands[i].getType() == Token::U_DOUBLE) {
+				nReturnType = Token::U_DOUBLE;
+			}
+			else if (plOperands[i].getType() != Token::U_INT) {
+				pResult = plOperands[i];
+				return Error::Interpreter::CANNOT_SUBTRACT_NON_NUMERIC_VALUES;
+			}
+		}
+		return foldNumbers('-', nReturnType, plOperands, pResult);
+	}
+
+	/**
+	* Evaluates the multiplication of the passed operands ("*").
+	*
+	* @param plOperands	Evaluated operands.
+	* @param pResult	Result of the operation.
+	* @return			Error message.
+	*/
+	short int multiply(vector<CValue>& plOperands, CValue& pResult) {
+		short int nReturnType = plOperands[0].getType();
+		for (unsigned int i = 0; i < plOperands.size(); i++) {
+			if (plOperands[i].getType() != Token::U_INT && plOperands[i].getType() != Token::U_DOUBLE) {
+				pResult = plOperands[i];
+				return Error::Interpreter::CANNOT_MULTIPLY_NON_NUMERIC_VALUES;
+			}
+			else if (plOperands[i].getType() == Token::U_DOUBLE) {
+				nReturnType = Token::U_DOUBLE;
+			}
+		}
+		return foldNumbers('*', nReturnType, plOperands, pResult);
+	}
+
+	/**
+	* Evaluates the division of the passed operands ("/"). The result is always a double.
+	*
+	* @param plOperands	Evaluated operands.
+	* @param pResult	Result of the operation.
+	* @return			Error message.
+	*/
+	short int divide(vector<CValue>& plOperands, CValue& pResult) {
+		for (unsigned int i = 0; i < plOperands.size(); i++) {
+			if (plOperands[i].getType() != Token::U_INT && plOperands[i].getType() != Token::U_DOUBLE) {
+				pResult = plOperands[i];
+				return Error::Interpreter::CANNOT_DIVIDE_NON_NUMERIC_VALUES;
+			}
+			else if (i >= 1 && plOperands[i].getNumber() == 0) {
+				pResult = plOperands[i];
+				return Error::Interpreter::CANNOT_DIVIDE_BY_ZERO;
+			}
+		}
+		return foldNumbers('/', Token::U_DOUBLE, plOperands, pResult);
+	}
+
+
+
+public:
+	/**
+	* Evaluates a relational operation ("=", "!", ">", "<", ">=", "<=").
+	*
+	* @param psOperator	Lexeme of the operator.
+	* @param pHead		Head node of the operation.
+	* @param plOperands	Evaluated operands.
+	* @param pResult	Result of the operation.
+	* @return			Error message.
+	*/
+	short int compare(string psOperator, CValue& pHead, vector<CValue>& plOperands, CValue& pResult) {
+		if (plOperands.size() != 2) {
+			//Error: Relational operations do only work with exactly 2 operators:
+			pResult = pHead;
+			return plOperands.size() < 2 ? Error::Interpreter::NOT_ENOUGH_ARGUMENTS : Error::Interpreter::TOO_MANY_ARGUMENTS;
+		}
+		CValue& firstOperand = plOperands[0];
+		CValue& secondOperand = plOperands[1];
+		bool bResult = false;
+
+		if (psOperator == "=" || psOperator == "!") {
+			short int nFirstType = firstOperand.getType();
+			short int nSecondType = secondOperand.getType();
+			if (nFirstType != nSecondType && !((nFirstType == Token::U_INT && nSecondType == Token::U_DOUBLE) || (nFirstType == Token::U_DOUBLE && nSecondType == Token::U_INT))) {
+				//Error operands are of different type:
+				pResult = pHead;
+				return Error::produceConvertError(nFirstType, nSecondType);
+			}
+			if (psOperator == "=") {
+				if (nFirstType == Token::U_INT || nFirstType == Token::U_DOUBLE) {
+					//Identical lexemes always resemble identical numbers:
+					bResult = firstOperand.getNumber() == secondOperand.getNumber();
+				}
+				else {
+					bResult = firstOperand.getLexeme() == secondOperand.getLexeme();
+				}
+			}
+			else {
+				bResult = !equalLexemes(firstOperand, secondOperand);
+			}
+		}
+		else {
+			if (firstOperand.getType() != Token::U_INT && firstOperand.getType() != Token::U_DOUBLE) {
+				pResult = firstOperand;
+				return Error::produceConvertError(firstOperand.getType(), Token::U_DOUBLE);
+			}
+			else if (secondOperand.getType() != Token::U_INT && secondOperand.getType() != Token::U_DOUBLE) {
+				pResult = secondOperand;
+				return Error::produceConvertError(secondOperand.getType(), Token::U_DOUBLE);
+			}
+			double dVal1 = firstOperand.getNumber();
+			double dVal2 = secondOperand.getNumber();
+			if (psOperator == ">") {
+				bResult = dVal1 > dVal2;
+			}
+			else if (psOperator == "<") {
+				bResult = dVal1 < dVal2;
+			}
+			else if (psOperator == ">=") {
+				bResult = dVal1 >= dVal2;
+			}
+			else {
+				bResult = dVal1 <= dVal2;
+			}
+		}
+		pResult = pHead;
+		pResult.setBool(bResult);
+		return Error::SUCCESS;
+	}
+
+	/**
+	* Evaluates a boolean operation ("&", "|").
+	*
+	* @param psOperator	Lexeme of the operator.
+	* @param pHead		Head node of the operation.
+	* @param plOperands	Evaluated operands.
+	* @param pResult	Result of the operation.
+	* @return			Error message.
+	*/
+	short int logical(string psOperator, CValue& pHead, vector<CValue>& plOperands, CValue& pResult) {
+		if (plOperands.size() < 2) {
+			//Error: Boolean operation must contain at least two arguments:
+			pResult = pHead;
+			return Error::Interpreter::NOT_ENOUGH_ARGUMENTS;
+		}
+		//"&" returns "nil" if any operand is "nil", "|" returns "t" if any operand is "t":
+		string sSearched = psOperator == "&" ? "nil" : "t";
+		bool bFound = false;
+		for (unsigned int i = 0; i < plOperands.size(); i++) {
+			if (plOperands[i].hasLexeme(sSearched)) {
+				bFound = true;
+				break;
+			}
+		}
+		pResult = pHead;
+		pResult.setBool(psOperator == "&" ? !bFound : bFound);
+		return Error::SUCCESS;
+	}
+
+
+
+public:
+	/**
+	* Returns whether the lexemes of both values are identical. Lexemes of numbers are only generated if necessary.
+	*
+	* @param pFirst		First value.
+	* @param pSecond	Second value.
+	* @return			Whether the lexemes are identical.
+	*/
+	bool equalLexemes(CValue& pFirst, CValue& pSecond) {
+		if ((pFirst.getType() == Token::U_INT || pFirst.getType() == Token::U_DOUBLE) && pFirst.hasDefaultLexeme() && pSecond.hasDefaultLexeme()) {
+			if (pFirst.getType() != pSecond.getType()) {
+				//Default lexemes of integers never contain a decimal point:
+				return false;
+			}
+			return pFirst.getType() == Token::U_INT ? pFirst.getInt() == pSecond.getInt() : pFirst.getDouble() == pSecond.getDouble();
+		}
+		return pFirst.getLexeme() == pSecond.getLexeme();
+	}
+
+
+
+private:
+	/**
+	* Folds the operands (which have been checked to be numeric) from left to right with the passed arithmetic operator.
+	* Integers wrap around on overflow, doubles are rounded after every step the same way the interpreter does.
+	*
+	* @param pchOperator	Arithmetic operator.
+	* @param pnReturnType	Type of the result.
+	* @param plOperands		Evaluated operands.
+	* @param pResult		Result of the operation.
+	* @return				Error message.
+	*/
+	short int foldNumbers(char pchOperator, short int pnReturnType, vector<CValue>& plOperands, CValue& pResult) {
+		pResult = plOperands[0];
+		if (plOperands.size() == 1) {
+			//The lexeme of the only operand is returned with the return type:
+			if (pnReturnType == Token::U_DOUBLE && pResult.getType() == Token::U_INT) {
+				pResult.setDouble(pResult.getNumber(), pResult.getLexeme());
+			}
+			return Error::SUCCESS;
+		}
+		if (pnReturnType == Token::U_INT) {
+			unsigned int nValue = (unsigned int)plOperands[0].getInt();
+			for (unsigned int i = 1; i < plOperands.size(); i++) {
+				unsigned int nOperand = (unsigned int)plOperands[i].getInt();
+				if (pchOperator == '+') {
+					nValue += nOperand;
+				}
+				else if (pchOperator == '-') {
+					nValue -= nOperand;
+				}
+				else {
+					nValue *= nOperand;
+				}
+			}
+			pResult.setInt((int)nValue);
+		}
+		else {
+			double dValue = plOperands[0].getNumber();
+			for (unsigned int i = 1; i < plOperands.size(); i++) {
+				double dOperand = plOperands[i].getNumber();
+				if (pchOperator == '+') {
+					dValue = CValue::normalizeDouble(dValue + dOperand);
+				}
+				else if (pchOperator == '-') {
+					dValue = CValue::normalizeDouble(dValue - dOperand);
+				}
+				else if (pchOperator == '*') {
+					dValue = CValue::normalizeDouble(dValue * dOperand);
+				}
+				else {
+					dValue = CValue::normalizeDouble(dValue / dOperand);
+				}
+			}
+			pResult.setDouble(dValue);
+		}
+		return Error::SUCCESS;
+	}
+};
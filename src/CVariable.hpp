@@ -71,7 +71,7 @@ public:
 	* 
 	* @return	Name of the variable.
 	*/
-	string getName() {
+	const string& getName() const {
 		return sName;
 	}
 
@@ -80,7 +80,7 @@ public:
 	* 
 	* @return	Variable's value.
 	*/
-	string getValue() {
+	const string& getValue() const {
 		return sValue;
 	}
 
@@ -89,7 +89,7 @@ public:
 	* 
 	* @return	Value's type.
 	*/
-	short int getType() {
+	short int getType() const {
 		return nType;
 	}
 
@@ -0,0 +1,290 @@
+/*
+FILE:		CVectorReduction.hpp
+
+REMARKS:	This file contains the class "CVectorReduction", which adds or multiplies long lists of numeric operands with SIMD
+			instructions.
+*/
+#pragma once
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <climits>
+#include <cmath>
+
+#include "CLinkedList.hpp"
+#include "CRV.hpp"
+#include "CToken.hpp"
+#include "Variables/ErrorMessages.hpp"
+#include "Variables/OpcodeTypes.hpp"
+#include "Variables/TokenTypes.hpp"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define VECTOR_REDUCTION_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define VECTOR_REDUCTION_SSE2
+#endif
+
+using namespace std;
+
+#define VECTOR_REDUCTION_MINIMUM_OPERANDS 8
+#define VECTOR_REDUCTION_MAXIMUM_DECIMAL 1073741824000000LL
+
+
+
+/**
+* The class "CVectorReduction" evaluates additions, subtractions and multiplications with many numeric operands. Instead of
+* converting the intermediate result into a string after every operand, every operand is parsed once into an array, which
+* is reduced with AVX2 or SSE2 instructions (or a scalar loop, if neither is available when compiling).
+* The reduction always produces exactly the same lexeme as the step-by-step evaluation of COperationEvaluator:
+*	- Integers are added in 64 bit lanes. If the sum does not fit into an integer, the reduction is not done, so that the
+*	  overflow behaves as it did before.
+*	- Integers are multiplied in double lanes, which is exact as long as the absolute value of the product fits into an
+*	  integer (every partial product is smaller, since no operand is zero). Otherwise, the reduction is not done.
+*	- Doubles are added as integer multiples of 0.000001. The interpreter rounds every intermediate sum to six decimal
+*	  places, which is exact as long as every operand has at most six decimal places and the sum of the absolute values is
+*	  smaller than 2^30. Therefore, the result is deterministic and does not depend on the order of the lanes.
+* Multiplications of doubles are rounded differently after every step and are never reduced.
+*
+* @author	Christian-2003
+* @version	19.10.2026
+*/
+class CVectorReduction {
+public:
+	/**
+	* This function reduces the passed operands, whose types have already been checked.
+	*
+	* @param pnOpcode		Opcode of the operator.
+	* @param pnReturnType	Type of the result.
+	* @param plOperands		Evaluated operands of the operation.
+	* @return				Lexeme of the result or Error::Interpreter::INFO_ENGINE_UNSUPPORTED, if the operands cannot be
+	*						reduced without changing the result.
+	*/
+	CRV<string> reduce(short int pnOpcode, short int pnReturnType, CLinkedList<CToken>& plOperands) {
+		if (plOperands.size() < VECTOR_REDUCTION_MINIMUM_OPERANDS) {
+			return CRV<string>("", Error::Interpreter::INFO_ENGINE_UNSUPPORTED);
+		}
+		else if (pnReturnType == Token::U_INT && (pnOpcode == Opcode::OPCODE_ADD || pnOpcode == Opcode::OPCODE_SUBTRACT)) {
+			return addIntegers(pnOpcode, plOperands);
+		}
+		else if (pnReturnType == Token::U_INT && pnOpcode == Opcode::OPCODE_MULTIPLY) {
+			return multiplyIntegers(plOperands);
+		}
+		else if (pnReturnType == Token::U_DOUBLE && (pnOpcode == Opcode::OPCODE_ADD || pnOpcode == Opcode::OPCODE_SUBTRACT)) {
+			return addDecimals(pnOpcode, plOperands);
+		}
+		return CRV<string>("", Error::Interpreter::INFO_ENGINE_UNSUPPORTED);
+	}
+
+
+
+private:
+	/**
+	* This function adds or subtracts integers.
+	*
+	* @param pnOpcode	Opcode of the operator.
+	* @param plOperands	Evaluated operands of the operation.
+	* @return			Lexeme of the result or Error::Interpreter::INFO_ENGINE_UNSUPPORTED.
+	*/
+	CRV<string> addIntegers(short int pnOpcode, CLinkedList<CToken>& plOperands) {
+		vector<long long> vnValues; //Stores the parsed operands.
+		vnValues.reserve(plOperands.size());
+		for (CLinkedList<CToken>::iterator operand = plOperands.begin(); operand != plOperands.end(); operand++) {
+			long long nValue = 0;
+			if (!parseInteger(operand->getLexeme(), nValue)) {
+				return CRV<string>("", Error::Interpreter::INFO_ENGINE_UNSUPPORTED);
+			}
+			//Every operand after the first one is subtracted:
+			vnValues.push_back(pnOpcode == Opcode::OPCODE_SUBTRACT && !vnValues.empty() ? -nValue : nValue);
+		}
+		long long nSum = sum(vnValues);
+		if (nSum < INT_MIN || nSum > INT_MAX) {
+			//The intermediate results overflow:
+			return CRV<string>("", Error::Interpreter::INFO_ENGINE_UNSUPPORTED);
+		}
+		return CRV<string>(to_string((int)nSum), Error::SUCCESS);
+	}
+
+	/**
+	* This function multiplies integers.
+	*
+	* @param plOperands	Evaluated operands of the operation.
+	* @return			Lexeme of the result or Error::Interpreter::INFO_ENGINE_UNSUPPORTED.
+	*/
+	CRV<string> multiplyIntegers(CLinkedList<CToken>& plOperands) {
+		vector<double> vnValues; //Stores the parsed operands.
+		vnValues.reserve(plOperands.size());
+		bool bZero = false; //Stores whether an operand is zero.
+		for (CLinkedList<CToken>::iterator operand = plOperands.begin(); operand != plOperands.end(); operand++) {
+			long long nValue = 0;
+			if (!parseInteger(operand->getLexeme(), nValue)) {
+				return CRV<string>("", Error::Interpreter::INFO_ENGINE_UNSUPPORTED);
+			}
+			bZero = bZero || nValue == 0;
+			vnValues.push_back((double)nValue);
+		}
+		if (bZero) {
+			//Every product, which contains zero, is zero:
+			return CRV<string>("0", Error::SUCCESS);
+		}
+		double nProduct = product(vnValues);
+		if (fabs(nProduct) > INT_MAX) {
+			//The intermediate results overflow:
+			return CRV<string>("", Error::Interpreter::INFO_ENGINE_UNSUPPORTED);
+		}
+		return CRV<string>(to_string((int)nProduct), Error::SUCCESS);
+	}
+
+	/**
+	* This function adds or subtracts doubles as integer multiples of 0.000001.
+	*
+	* @param pnOpcode	Opcode of the operator.
+	* @param plOperands	Evaluated operands of the operation.
+	* @return			Lexeme of the result or Error::Interpreter::INFO_ENGINE_UNSUPPORTED.
+	*/
+	CRV<string> addDecimals(short int pnOpcode, CLinkedList<CToken>& plOperands) {
+		vector<long long> vnValues; //Stores the parsed operands in millionths.
+		vnValues.reserve(plOperands.size());
+		long long nMagnitude = 0; //Stores the sum of the absolute values.
+		for (CLinkedList<CToken>::iterator operand = plOperands.begin(); operand != plOperands.end(); operand++) {
+			long long nValue = 0;
+			if (!parseDecimal(operand->getLexeme(), nValue)) {
+				return CRV<string>("", Error::Interpreter::INFO_ENGINE_UNSUPPORTED);
+			}
+			nMagnitude += nValue < 0 ? -nValue : nValue;
+			if (nMagnitude >= VECTOR_REDUCTION_MAXIMUM_DECIMAL) {
+				//The intermediate results could be rounded:
+				return CRV<string>("", Error::Interpreter::INFO_ENGINE_UNSUPPORTED);
+			}
+			vnValues.push_back(pnOpcode == Opcode::OPCODE_SUBTRACT && !vnValues.empty() ? -nValue : nValue);
+		}
+		long long nSum = sum(vnValues);
+		long long nAbsolute = nSum < 0 ? -nSum : nSum;
+		string sFraction = to_string(nAbsolute % 1000000);
+		return CRV<string>((nSum < 0 ? "-" : "") + to_string(nAbsolute / 1000000) + "." + string(6 - sFraction.size(), '0') + sFraction, Error::SUCCESS);
+	}
+
+	/**
+	* This function parses the lexeme of an integer, which can be parsed with "stoi()" without error.
+	*
+	* @param psLexeme	Lexeme of the integer.
+	* @param pnValue	Parsed integer.
+	* @return			Whether the lexeme could be parsed.
+	*/
+	bool parseInteger(const string& psLexeme, long long& pnValue) {
+		unsigned int nStart = !psLexeme.empty() && psLexeme[0] == '-' ? 1 : 0; //Stores the index of the first digit.
+		if (psLexeme.size() <= nStart || psLexeme.size() - nStart > 10) {
+			return false;
+		}
+		pnValue = 0;
+		for (unsigned int i = nStart; i < psLexeme.size(); i++) {
+			if (psLexeme[i] < '0' || psLexeme[i] > '9') {
+				return false;
+			}
+			pnValue = pnValue * 10 + (psLexeme[i] - '0');
+		}
+		pnValue = nStart == 1 ? -pnValue : pnValue;
+		return pnValue >= INT_MIN && pnValue <= INT_MAX;
+	}
+
+	/**
+	* This function parses the lexeme of a number with at most six decimal places into millionths. Negative zeros are not
+	* parsed, since their sum could be a negative zero as well.
+	*
+	* @param psLexeme	Lexeme of the number.
+	* @param pnValue	Parsed number in millionths.
+	* @return			Whether the lexeme could be parsed.
+	*/
+	bool parseDecimal(const string& psLexeme, long long& pnValue) {
+		unsigned int nStart = !psLexeme.empty() && psLexeme[0] == '-' ? 1 : 0; //Stores the index of the first digit.
+		size_t nPoint = psLexeme.find('.'); //Stores the index of the decimal point.
+		size_t nEnd = nPoint == string::npos ? psLexeme.size() : nPoint; //Stores the index after the integer part.
+		if (nEnd <= nStart || nEnd - nStart > 10 || (nPoint != string::npos && psLexeme.size() - nPoint - 1 > 6)) {
+			return false;
+		}
+		pnValue = 0;
+		for (unsigned int i = nStart; i < psLexeme.size(); i++) {
+			if (i == nPoint) {
+				continue;
+			}
+			else if (psLexeme[i] < '0' || psLexeme[i] > '9') {
+				return false;
+			}
+			pnValue = pnValue * 10 + (psLexeme[i] - '0');
+		}
+		for (size_t nDecimals = nPoint == string::npos ? 0 : psLexeme.size() - nPoint - 1; nDecimals < 6; nDecimals++) {
+			pnValue *= 10;
+		}
+		if (nStart == 1 && pnValue == 0) {
+			return false;
+		}
+		pnValue = nStart == 1 ? -pnValue : pnValue;
+		return true;
+	}
+
+	/**
+	* This function adds every value of the passed array.
+	*
+	* @param pvnValues	Values, which are added.
+	* @return			Sum.
+	*/
+	long long sum(vector<long long>& pvnValues) {
+		long long nSum = 0; //Stores the sum.
+		size_t i = 0;
+#if defined(VECTOR_REDUCTION_AVX2)
+		__m256i lanes = _mm256_setzero_si256();
+		for (; i + 4 <= pvnValues.size(); i += 4) {
+			lanes = _mm256_add_epi64(lanes, _mm256_loadu_si256((const __m256i*)&pvnValues[i]));
+		}
+		long long vnLanes[4];
+		_mm256_storeu_si256((__m256i*)vnLanes, lanes);
+		nSum = vnLanes[0] + vnLanes[1] + vnLanes[2] + vnLanes[3];
+#elif defined(VECTOR_REDUCTION_SSE2)
+		__m128i lanes = _mm_setzero_si128();
+		for (; i + 2 <= pvnValues.size(); i += 2) {
+			lanes = _mm_add_epi64(lanes, _mm_loadu_si128((const __m128i*)&pvnValues[i]));
+		}
+		long long vnLanes[2];
+		_mm_storeu_si128((__m128i*)vnLanes, lanes);
+		nSum = vnLanes[0] + vnLanes[1];
+#endif
+		for (; i < pvnValues.size(); i++) {
+			nSum += pvnValues[i];
+		}
+		return nSum;
+	}
+
+	/**
+	* This function multiplies every value of the passed array.
+	*
+	* @param pvnValues	Values, which are multiplied.
+	* @return			Product.
+	*/
+	double product(vector<double>& pvnValues) {
+		double nProduct = 1; //Stores the product.
+		size_t i = 0;
+#if defined(VECTOR_REDUCTION_AVX2)
+		__m256d lanes = _mm256_set1_pd(1);
+		for (; i + 4 <= pvnValues.size(); i += 4) {
+			lanes = _mm256_mul_pd(lanes, _mm256_loadu_pd(&pvnValues[i]));
+		}
+		double vnLanes[4];
+		_mm256_storeu_pd(vnLanes, lanes);
+		nProduct = vnLanes[0] * vnLanes[1] * vnLanes[2] * vnLanes[3];
+#elif defined(VECTOR_REDUCTION_SSE2)
+		__m128d lanes = _mm_set1_pd(1);
+		for (; i + 2 <= pvnValues.size(); i += 2) {
+			lanes = _mm_mul_pd(lanes, _mm_loadu_pd(&pvnValues[i]));
+		}
+		double vnLanes[2];
+		_mm_storeu_pd(vnLanes, lanes);
+		nProduct = vnLanes[0] * vnLanes[1];
+#endif
+		for (; i < pvnValues.size(); i++) {
+			nProduct *= pvnValues[i];
+		}
+		return nProduct;
+	}
+};
@@ -0,0 +1,29 @@
+/*
+FILE:		LispInterpreter.hpp
+
+REMARKS:	This file includes everything, that an application needs to embed the interpreter. The sourcecode is loaded once
+			into a program, whose functions are afterwards called by any number of sessions:
+
+				CContext context;
+				shared_ptr<CProgram> program = make_shared<CProgram>();
+				CRV<CToken> rvLoad = program->load(sSourcecode, "rules.lsp", context, CPassManager());
+				CSession session(program, context);
+				CValue argument;
+				argument.setInt(7);
+				CRV<CValue> rvResult = session.call("square", { argument });
+
+			The error messages of "load()" and "call()" can be converted into text through "Error::generateErrorMessage()".
+			Every thread of the application should use a session of it's own.
+			Functions, which wait for the application (e.g. for I/O), are executed by an event loop (see CEventLoop),
+			which suspends an execution, while the host executes a function, that the program does not define.
+*/
+#pragma once
+
+#include "CContext.hpp"
+#include "CEventLoop.hpp"
+#include "CPassManager.hpp"
+#include "CProgram.hpp"
+#include "CRV.hpp"
+#include "CSession.hpp"
+#include "CValue.hpp"
+#include "Variables/ErrorMessages.hpp"
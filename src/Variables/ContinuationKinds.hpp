@@ -0,0 +1,27 @@
+/*
+FILE:		ContinuationKinds.hpp
+
+REMARKS:	Every kind of continuation of the continuation evaluator is stored in this file.
+*/
+#pragma once
+
+using namespace std;
+
+
+
+/**
+* This enumeration contains every kind of continuation, with which the CContinuationEvaluator resumes the evaluation of a
+* node, after one of it's subtrees has been evaluated.
+*/
+enum ContinuationKind : const short int {
+	CONTINUATION_MAIN = 0, //Statements of the main-function.
+	CONTINUATION_OPERATION = 1, //Operands of an arithmetic, relational or boolean operation.
+	CONTINUATION_DECLARATION = 2, //Initializer of a declaration.
+	CONTINUATION_SET = 3, //New value of a variable, which is changed with "set".
+	CONTINUATION_PRINT = 4, //Arguments of "print" or "println".
+	CONTINUATION_IF = 5, //Condition and body of an if-statement.
+	CONTINUATION_WHILE = 6, //Condition and body of a while-loop.
+	CONTINUATION_RETURN = 7, //Value of a return-statement.
+	CONTINUATION_ARGUMENTS = 8, //Arguments of a function call.
+	CONTINUATION_CALL = 9 //Statements of a called function.
+};
@@ -91,7 +91,18 @@ namespace Error {
 		INCORRECT_NUMBER_OF_ARGUMENTS_PASSED = 52, //An incorrect number of arguments are passed during a function call.
 		INFO_RETURN_STATEMENT_ENCOUNTERED = 53, //An return statement was encountered. THIS IS NO ERROR MESSAGE, JUST A NOTIFICATION FOR THE INTERPRETER ! ! !
 		TOO_MANY_VALUES_TO_RETURN = 54, //There are too many values which are supposed to be returned by a function.
-		STACK_OVERFLOW = 55 //Stackoverflow error.
+		STACK_OVERFLOW = 55, //Stackoverflow error.
+		INFO_ENGINE_UNSUPPORTED = 56, //The sourcecode cannot be executed by the selected execution engine. THIS IS NO ERROR MESSAGE, JUST A NOTIFICATION FOR THE INTERPRETER ! ! !
+		INFO_TAIL_CALL = 57, //A function is called in tail position and reuses the frame of the calling function. THIS IS NO ERROR MESSAGE, JUST A NOTIFICATION FOR THE INTERPRETER ! ! !
+		TASK_DOES_NOT_EXIST = 58, //An awaited task has not been spawned.
+		LOOP_COUNTER_CHANGED = 59, //The counter of a for-loop is changed within the loop.
+		LOOP_DEPENDENCY = 60, //The iterations of a parallel loop depend on each other.
+		INVALID_LOOP_CLAUSE = 61, //A clause of a parallel loop is neither a schedule nor a reduction.
+		INVALID_CHANNEL_CAPACITY = 62, //The capacity of a channel is not positive.
+		CHANNEL_DOES_NOT_EXIST = 63, //A channel has not been created.
+		CHANNEL_BLOCKS_FOREVER = 64, //A channel is full or empty, while no other thread could receive or send.
+		PROCESS_CRASHED = 65, //The process, which executed the sourcecode, crashed.
+		INFO_HOST_CALL = 66 //The execution is suspended, while the host executes a called function. THIS IS NO ERROR MESSAGE, JUST A NOTIFICATION FOR THE INTERPRETER ! ! !
 	};
 
 
@@ -297,6 +308,24 @@ namespace Error {
 			return "An incorrect number of arguments is passed.";
 		case Error::Interpreter::TOO_MANY_VALUES_TO_RETURN:
 			return "LISP function can only return up to exactly one argument.";
+		case Error::Interpreter::STACK_OVERFLOW:
+			return "Stack overflow occured.";
+		case Error::Interpreter::TASK_DOES_NOT_EXIST:
+			return "The awaited task does not exist.";
+		case Error::Interpreter::LOOP_COUNTER_CHANGED:
+			return "The counter of a for-loop cannot be changed.";
+		case Error::Interpreter::LOOP_DEPENDENCY:
+			return "The iterations of the parallel loop depend on each other.";
+		case Error::Interpreter::INVALID_LOOP_CLAUSE:
+			return "The clause of the parallel loop is neither a schedule nor a reduction.";
+		case Error::Interpreter::INVALID_CHANNEL_CAPACITY:
+			return "The capacity of a channel must be positive.";
+		case Error::Interpreter::CHANNEL_DOES_NOT_EXIST:
+			return "The channel does not exist.";
+		case Error::Interpreter::CHANNEL_BLOCKS_FOREVER:
+			return "The channel is full or empty and no other thread can receive or send.";
+		case Error::Interpreter::PROCESS_CRASHED:
+			return "The process, which executed the sourcecode, crashed.";
 		default:
 			return "Encountered unknown error.";
 		}
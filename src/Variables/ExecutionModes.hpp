@@ -0,0 +1,22 @@
+/*
+FILE:		ExecutionModes.hpp
+
+REMARKS:	Every execution mode of the interpreter is stored in this file.
+*/
+#pragma once
+
+using namespace std;
+
+
+
+/**
+* This enumeration contains every execution engine, with which the interpreter can execute the sourcecode.
+*/
+enum ExecutionMode : const short int {
+	TREE_WALKING = 0, //The abstract syntax trees are evaluated directly (CInterpreter).
+	CLOSURE_COMPILATION = 1, //The abstract syntax trees are converted into pre-bound C++ callables once (CClosureCompiler).
+	SELF_SPECIALIZATION = 2, //The abstract syntax trees are converted into nodes, that specialize on observed types (CSpecializingEvaluator).
+	NATIVE_COMPILATION = 3, //Numeric functions are compiled into x86-64 machine code, everything else is interpreted (CJitCompiler).
+	EXPLICIT_CONTINUATION = 4, //The abstract syntax trees are evaluated through a stack of continuations on the heap (CContinuationEvaluator).
+	PARALLEL_EVALUATION = 5 //The abstract syntax trees are evaluated directly, expensive pure arguments of calls are evaluated by a thread pool (CThreadPool).
+};
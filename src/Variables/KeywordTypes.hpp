@@ -81,4 +81,69 @@ namespace Keyword {
 	* Keyword to return a value from a function.
 	*/
 	const string RETURN = "return";
+
+	/**
+	* Keyword to call a function in another task.
+	*/
+	const string SPAWN = "spawn";
+
+	/**
+	* Keyword to wait for a spawned task and get it's return value.
+	*/
+	const string AWAIT = "await";
+
+	/**
+	* Keyword for a counted loop.
+	*/
+	const string FOR = "for";
+
+	/**
+	* Keyword for a counted loop, whose iterations are executed by multiple threads.
+	*/
+	const string PFOR = "pfor";
+
+	/**
+	* Name of the schedule, which splits the range of a parallel loop into one chunk per thread.
+	*/
+	const string STATIC = "static";
+
+	/**
+	* Name of the schedule, which hands small chunks of a parallel loop to the threads, that are idle.
+	*/
+	const string DYNAMIC = "dynamic";
+
+	/**
+	* Name of the reduction, which keeps the smallest value.
+	*/
+	const string MIN = "min";
+
+	/**
+	* Name of the reduction, which keeps the largest value.
+	*/
+	const string MAX = "max";
+
+	/**
+	* Keyword to create a channel, through which tasks send values to each other.
+	*/
+	const string MAKE_CHANNEL = "make-channel";
+
+	/**
+	* Keyword to send a value through a channel, once the channel is not full.
+	*/
+	const string SEND = "send";
+
+	/**
+	* Keyword to receive a value from a channel, once the channel is not empty.
+	*/
+	const string RECV = "recv";
+
+	/**
+	* Keyword to send a value through a channel, if the channel is not full.
+	*/
+	const string TRY_SEND = "try-send";
+
+	/**
+	* Keyword to receive a value from a channel into a variable, if the channel is not empty.
+	*/
+	const string TRY_RECV = "try-recv";
 }
@@ -0,0 +1,52 @@
+/*
+FILE:		OpcodeTypes.hpp
+
+REMARKS:	The opcode of every node of the abstract syntax tree is stored in this file.
+*/
+#pragma once
+
+using namespace std;
+
+
+
+/**
+* This enumeration contains every opcode, with which a node of an abstract syntax tree is stamped by the COpcodeResolver.
+* The interpreter dispatches on these opcodes instead of comparing the lexemes of the nodes.
+*/
+enum Opcode : const short int {
+	OPCODE_NONE = 0, //Node, which is not executed (value, branch, unknown token or unresolved node).
+	OPCODE_IDENTIFIER = 1, //Variable or function call.
+	OPCODE_ADD = 2, //Arithmetic operator "+".
+	OPCODE_SUBTRACT = 3, //Arithmetic operator "-".
+	OPCODE_MULTIPLY = 4, //Arithmetic operator "*".
+	OPCODE_DIVIDE = 5, //Arithmetic operator "/".
+	OPCODE_EQUAL = 6, //Relational operator "=".
+	OPCODE_NOT_EQUAL = 7, //Relational operator "!".
+	OPCODE_GREATER = 8, //Relational operator ">".
+	OPCODE_LESS = 9, //Relational operator "<".
+	OPCODE_GREATER_EQUAL = 10, //Relational operator ">=".
+	OPCODE_LESS_EQUAL = 11, //Relational operator "<=".
+	OPCODE_AND = 12, //Boolean operator "&".
+	OPCODE_OR = 13, //Boolean operator "|".
+	OPCODE_DECLARE_INT = 14, //Declaration of an integer variable.
+	OPCODE_DECLARE_DOUBLE = 15, //Declaration of a double variable.
+	OPCODE_DECLARE_BOOL = 16, //Declaration of a boolean variable.
+	OPCODE_DECLARE_CHAR = 17, //Declaration of a character variable.
+	OPCODE_DECLARE_STRING = 18, //Declaration of a string variable.
+	OPCODE_SET = 19, //Keyword "set".
+	OPCODE_PRINT = 20, //Keyword "print".
+	OPCODE_PRINTLN = 21, //Keyword "println".
+	OPCODE_IF = 22, //Keyword "if".
+	OPCODE_WHILE = 23, //Keyword "while".
+	OPCODE_RETURN = 24, //Keyword "return".
+	OPCODE_KEYWORD = 25, //Every other keyword, which cannot be executed (e.g. "defun").
+	OPCODE_SPAWN = 26, //Keyword "spawn".
+	OPCODE_AWAIT = 27, //Keyword "await".
+	OPCODE_FOR = 28, //Keyword "for".
+	OPCODE_PFOR = 29, //Keyword "pfor".
+	OPCODE_MAKE_CHANNEL = 30, //Keyword "make-channel".
+	OPCODE_SEND = 31, //Keyword "send".
+	OPCODE_RECV = 32, //Keyword "recv".
+	OPCODE_TRY_SEND = 33, //Keyword "try-send".
+	OPCODE_TRY_RECV = 34 //Keyword "try-recv".
+};
@@ -0,0 +1,26 @@
+/*
+FILE:		OperationKernels.hpp
+
+REMARKS:	Every kernel, with which an operation with statically known operand types can be evaluated, is stored in this file.
+*/
+#pragma once
+
+using namespace std;
+
+
+
+/**
+* This enumeration contains every kernel of the COperationKernels. The type checker selects a kernel for an operation, if the
+* types of every operand are known before the sourcecode is executed. The operator is taken from the opcode of the operation.
+*/
+enum OperationKernel : const short int {
+	KERNEL_NONE = 0, //The operation is evaluated by the generic loop of COperationEvaluator.
+	KERNEL_INT_BINARY = 1, //Two integers.
+	KERNEL_INT_TERNARY = 2, //Three integers.
+	KERNEL_INT_VARIADIC = 3, //Any number of integers.
+	KERNEL_DOUBLE_BINARY = 4, //Two numbers, which are computed as doubles.
+	KERNEL_DOUBLE_TERNARY = 5, //Three numbers, which are computed as doubles.
+	KERNEL_DOUBLE_VARIADIC = 6, //Any number of numbers, which are computed as doubles.
+	KERNEL_STRING_VARIADIC = 7, //Any number of strings and characters, which are concatenated.
+	KERNEL_COMPARISON = 8 //Two operands of a relational operator, whose types can be compared without error.
+};
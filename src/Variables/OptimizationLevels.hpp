@@ -0,0 +1,20 @@
+/*
+FILE:		OptimizationLevels.hpp
+
+REMARKS:	Every optimization level of the pass manager is stored in this file.
+*/
+#pragma once
+
+using namespace std;
+
+
+
+/**
+* This enumeration contains every optimization level, which selects the passes that are run by the CPassManager before the
+* sourcecode is executed. Every level runs the passes of the lower levels as well.
+*/
+enum OptimizationLevel : const short int {
+	OPTIMIZATION_NONE = 0, //The abstract syntax trees are executed as they are parsed ("-O0").
+	OPTIMIZATION_BASIC = 1, //Operations with constant operands are folded ("-O1").
+	OPTIMIZATION_FULL = 2 //Every pass is run ("-O2").
+};
@@ -4,9 +4,23 @@ FILE:		main.cpp
 REMARKS:	This file contains the "main()"-function, everything that is needed to execute sourcecode and everything for the UX.
 */
 #include <iostream>
+#include <fstream>
 #include <string>
+#include <chrono>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+#include <algorithm>
 #include <Windows.h>
 #include <cctype>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#if !defined(_WIN32)
+#include <unistd.h>
+#endif
 
 #include "CLinkedList.hpp"
 #include "CAbstractSyntaxTree.hpp"
@@ -15,12 +29,49 @@ REMARKS:	This file contains the "main()"-function, everything that is needed to
 #include "CParser.hpp"
 #include "CFileScanner.hpp"
 #include "CInterpreter.hpp"
+#include "CPassManager.hpp"
+#include "CTranspiler.hpp"
+#include "CTypeChecker.hpp"
+#include "COperationEvaluator.hpp"
 #include "CLog.hpp"
+#include "CMemoCache.hpp"
+#include "CThreadPool.hpp"
+#include "CChannel.hpp"
+#include "CContext.hpp"
+#include "CDaemon.hpp"
+#include "CEventLoop.hpp"
+#include "CProcessPool.hpp"
+#include "CProgram.hpp"
+#include "CSession.hpp"
+#include "Variables/ExecutionModes.hpp"
+#include "Variables/OperationKernels.hpp"
+#include "Variables/OptimizationLevels.hpp"
 
 using namespace std;
-void execute(string, bool);
+short int execute(string, bool, CContext, CPassManager&);
+bool readBatch(string, string, vector<string>&, CContext&);
+short int executeCaptured(string, CContext&, CPassManager&, string&);
+unsigned int printBatch(vector<string>&, vector<short int>&, vector<long long>&, vector<string>&, long long, string);
+void printLatency(vector<long long>&);
+void executeBatch(string, string, unsigned int, CContext&, CPassManager&);
+void executeSharded(string, string, unsigned int, CContext&, CPassManager&);
+short int prepare(string, CLinkedList<CAbstractSyntaxTree<CToken>>&, CContext&, CPassManager&);
+short int prepareSourcecode(string, string, CLinkedList<CAbstractSyntaxTree<CToken>>&, CContext&, CPassManager&);
+short int executeSubmission(const string&, CLinkedList<CAbstractSyntaxTree<CToken>>&, CContext&, CPassManager&, string&);
+void serveDaemon(string, string, bool, CContext&, CPassManager&);
+void submit(string, string, unsigned int, CContext&);
+void transpile(string, string, string, CContext, CPassManager&);
+void check(string, CContext);
+void benchmark(unsigned int, CLog&);
+void benchmarkKernel(string, string, short int, short int, unsigned int, short int, unsigned int, CLog&);
+void benchmarkChannels(unsigned int, CLog&);
+void benchmarkChannel(unsigned int, unsigned int, CLog&);
+void benchmarkSessions(unsigned int, CContext&, CPassManager&);
+void benchmarkAsync(unsigned int, CContext&, CPassManager&);
+size_t measureThreads(unsigned int, function<void(function<void()>)>);
+size_t getResidentMemory();
 void printAST(CAbstractSyntaxTree<CToken>, int);
-void printError(CToken, short int);
+void printError(CToken, short int, CContext&);
 
 
 
@@ -37,18 +88,23 @@ void SetTextColor(int pnColor) {
 
 
 /**
-* This function executes sourcecode from a specific file.
+* This function executes sourcecode from a specific file. Everything, that is needed besides the file, is taken from the
+* passed context and pass manager, so that multiple files can be executed simultaneously with different contexts.
 *
 * @param psFilename		File, in which the sourcecode is located.
+* @param pbDebugMode	Indicates whether debug-information should be shown.
+* @param pContext		Context, which provides the log, the output and the configuration of the interpreter.
+* @param pPassManager	Pass manager, which optimizes the abstract syntax trees before they are executed.
+* @return				Error message (Error::SUCCESS, if the sourcecode has been executed without errors).
 */
-void execute(string psFilename, bool pbDebugMode) {
+short int execute(string psFilename, bool pbDebugMode, CContext pContext, CPassManager& pPassManager) {
 	//-+-+-+-+-+-+- READ THE FILE -+-+-+-+-+-+-
 	CFileScanner fileScanner;
 	CRV<string> rvFileContent = fileScanner.scan(psFilename);
 	if (rvFileContent.getErrorMessage() != Error::SUCCESS) {
 		//An error occured:
-		printError(CToken(), rvFileContent.getErrorMessage());
-		return;
+		printError(CToken(), rvFileContent.getErrorMessage(), pContext);
+		return rvFileContent.getErrorMessage();
 	}
 	//----- DEBUG BEGIN -----
 	if (pbDebugMode) {
@@ -59,12 +115,13 @@ void execute(string psFilename, bool pbDebugMode) {
 
 	//-+-+-+-+-+-+- TOKENIZING -+-+-+-+-+-+-
 	CTokenizer tokenizer;
+	tokenizer.setContext(pContext);
 	CRV<CLinkedList<CToken>> rvTokens = tokenizer.tokenize(rvFileContent.getContent(), psFilename);
 	CLinkedList<CToken> tokens;
 	if (rvTokens.getErrorMessage() != Error::SUCCESS) {
 		//An error occured:
-		printError(rvTokens.getContent()[rvTokens.getContent().size() - 1], rvTokens.getErrorMessage());
-		return;
+		printError(rvTokens.getContent()[rvTokens.getContent().size() - 1], rvTokens.getErrorMessage(), pContext);
+		return rvTokens.getErrorMessage();
 	}
 	tokens.addAll(rvTokens.getContent());
 	//----- DEBUG BEGIN -----
@@ -81,35 +138,944 @@ void execute(string psFilename, bool pbDebugMode) {
 
 	//-+-+-+-+-+-+- PARSING -+-+-+-+-+-+-
 	CParser parser;
+	parser.setContext(pContext);
 	CRV<CLinkedList<CAbstractSyntaxTree<CToken>>> rvAST = parser.parse(tokens);
 	if (rvAST.getErrorMessage() != Error::SUCCESS) {
 		//An error occured:
-		printError(rvAST.getContent()[0].getContent(), rvAST.getErrorMessage());
+		printError(rvAST.getContent()[0].getContent(), rvAST.getErrorMessage(), pContext);
+		return rvAST.getErrorMessage();
+	}
+	CLinkedList<CAbstractSyntaxTree<CToken>> lASTs = rvAST.getContent();
+	//----- DEBUG BEGIN -----
+	if (pbDebugMode) {
+		SetTextColor(8);
+		for (unsigned int i = 0; i < lASTs.size(); i++) {
+			cout << "AbstractSyntaxTree " << i << "=" << endl;
+			printAST(lASTs[i], 0);
+			cout << "\n";
+		}
+	}
+	//------ DEBUG END ------
+
+	//-+-+-+-+-+-+- OPTIMIZING -+-+-+-+-+-+-
+	pPassManager.setContext(pContext);
+	lASTs = pPassManager.run(lASTs);
+	CLinkedList<CPassStatistics> lStatistics = pPassManager.getStatistics();
+	for (unsigned int i = 0; i < lStatistics.size(); i++) {
+		CPassStatistics statistics = lStatistics[i];
+		//----- DEBUG BEGIN -----
+		if (pbDebugMode) {
+			SetTextColor(8);
+			cout << "Pass \"" << statistics.getName() << "\": " << statistics.getChangedNodes() << " nodes changed in " << statistics.getMicroseconds() << " microseconds." << endl;
+		}
+		//------ DEBUG END ------
+		if (statistics.isDumped()) {
+			//Print the abstract syntax trees after the pass:
+			SetTextColor(8);
+			CLinkedList<CAbstractSyntaxTree<CToken>> ltDumped = statistics.getASTs();
+			for (unsigned int j = 0; j < ltDumped.size(); j++) {
+				cout << "AbstractSyntaxTree " << j << " after \"" << statistics.getName() << "\"=" << endl;
+				printAST(ltDumped[j], 0);
+				cout << "\n";
+			}
+		}
+	}
+
+	//-+-+-+-+-+-+- INTERPRETING -+-+-+-+-+-+-
+	CInterpreter interpreter;
+	interpreter.setContext(pContext);
+	if (pContext.isConsole()) {
+		SetTextColor(7); //Change textcolor for output while interpreting.
+	}
+	CRV<CToken> rvInterpreter;
+	rvInterpreter = interpreter.interpret(lASTs);
+	if (rvInterpreter.getErrorMessage() != Error::SUCCESS) {
+		//An error occured:
+		pContext.getOutput() << '\n';
+		printError(rvInterpreter.getContent(), rvInterpreter.getErrorMessage(), pContext);
+		return rvInterpreter.getErrorMessage();
+	}
+	return Error::SUCCESS;
+}
+
+/**
+* This function reads the files, which are listed in the passed file (one file per line).
+*
+* @param psList			File, which lists the files.
+* @param psDirectory	Directory, in which the listed files are located (empty for the current directory).
+* @param pvsFiles		Vector, into which the files are written.
+* @param pContext		Context, into whose errors a missing list is printed.
+* @return				Whether the list has been read.
+*/
+bool readBatch(string psList, string psDirectory, vector<string>& pvsFiles, CContext& pContext) {
+	CFileScanner fileScanner;
+	CRV<string> rvList = fileScanner.scan(psList);
+	if (rvList.getErrorMessage() != Error::SUCCESS) {
+		//An error occured:
+		printError(CToken(), rvList.getErrorMessage(), pContext);
+		return false;
+	}
+	istringstream list(rvList.getContent());
+	string sLine = "";
+	while (getline(list, sLine)) {
+		if (!sLine.empty() && sLine.back() == '\r') {
+			sLine.pop_back();
+		}
+		if (!sLine.empty()) {
+			pvsFiles.push_back(psDirectory != "" ? psDirectory + "/" + sLine : sLine);
+		}
+	}
+	return true;
+}
+
+/**
+* This function executes a file of a batch with a copy of the passed context, which prints into a buffer and memoizes
+* into a cache of it's own, so that the file cannot influence other files.
+*
+* @param psFilename		File, in which the sourcecode is located.
+* @param pContext		Context of the terminal, whose log and configuration are used.
+* @param pPassManager	Pass manager, which is only used by this file.
+* @param psOutput		String, into which the output of the file is written.
+* @return				Error message (Error::SUCCESS, if the sourcecode has been executed without errors).
+*/
+short int executeCaptured(string psFilename, CContext& pContext, CPassManager& pPassManager, string& psOutput) {
+	ostringstream output;
+	CMemoCache memoCache;
+	memoCache.setEnabled(pContext.getMemoCache() != nullptr && pContext.getMemoCache()->isEnabled());
+	memoCache.setCapacity(pContext.getMemoCache() != nullptr ? pContext.getMemoCache()->getCapacity() : MEMO_DEFAULT_CAPACITY);
+	CContext context = pContext.redirect(output);
+	context.setMemoCache(&memoCache);
+	short int nStatus = execute(psFilename, false, context, pPassManager);
+	psOutput = output.str();
+	return nStatus;
+}
+
+/**
+* This function prints the status, the time and the output of every file of a batch in the order of the list, followed by
+* the throughput and the percentiles of the times, that the files needed.
+*
+* @param pvsFiles		Files, which have been executed.
+* @param pvnStatus		Error message of every file.
+* @param pvnTimes		Time in microseconds, which every file needed.
+* @param pvsOutputs		Output of every file.
+* @param pnTime			Time in microseconds, which the whole batch needed.
+* @param psExecutors	Description of the threads or processes, which executed the files.
+* @return				Number of files, which caused an error.
+*/
+unsigned int printBatch(vector<string>& pvsFiles, vector<short int>& pvnStatus, vector<long long>& pvnTimes, vector<string>& pvsOutputs, long long pnTime, string psExecutors) {
+	unsigned int nFailed = 0; //Stores the number of files, which caused an error.
+	for (size_t i = 0; i < pvsFiles.size(); i++) {
+		nFailed += pvnStatus[i] != Error::SUCCESS ? 1 : 0;
+		SetTextColor(pvnStatus[i] == Error::SUCCESS ? 10 : 12);
+		cout << "[" << (i + 1) << "/" << pvsFiles.size() << "] " << pvsFiles[i] << ": " << (pvnStatus[i] == Error::SUCCESS ? "success" : "error " + to_string(pvnStatus[i])) << " (" << fixed << setprecision(2) << pvnTimes[i] / 1000.0 << defaultfloat << " ms)" << endl;
+		SetTextColor(7);
+		cout << pvsOutputs[i];
+		if (!pvsOutputs[i].empty() && pvsOutputs[i].back() != '\n') {
+			cout << '\n';
+		}
+	}
+	SetTextColor(7);
+	cout << pvsFiles.size() << " files executed by " << psExecutors << " in " << fixed << setprecision(1) << pnTime / 1000.0 << " ms (" << setprecision(0) << (pnTime > 0 ? pvsFiles.size() * 1000000.0 / pnTime : 0.0) << defaultfloat << " files/s), " << nFailed << " failed." << endl;
+	printLatency(pvnTimes);
+	return nFailed;
+}
+
+/**
+* This function prints the median (p50), the 90th and 99th percentile and the maximum of the passed times.
+*
+* @param pvnTimes	Times in microseconds.
+*/
+void printLatency(vector<long long>& pvnTimes) {
+	if (pvnTimes.empty()) {
+		return;
+	}
+	vector<long long> vnSorted = pvnTimes; //Stores the times in ascending order.
+	sort(vnSorted.begin(), vnSorted.end());
+	function<double(double)> percentile = [&vnSorted](double pnPercent) {
+		return vnSorted[(size_t)(pnPercent / 100.0 * (vnSorted.size() - 1) + 0.5)] / 1000.0;
+	};
+	cout << "Latency: p50 " << fixed << setprecision(2) << percentile(50) << " ms, p90 " << percentile(90) << " ms, p99 " << percentile(99) << " ms, max " << percentile(100) << defaultfloat << " ms." << endl;
+}
+
+/**
+* This function executes every file, which is listed in the passed file (one file per line), on the passed number of
+* threads. Every file is executed with a copy of the passed context and pass manager, so that the files cannot influence
+* each other. Once every file has been executed, the status, the time and the output of every file are printed in the
+* order of the list.
+*
+* @param psList			File, which lists the files, that are executed.
+* @param psDirectory	Directory, in which the listed files are located (empty for the current directory).
+* @param pnThreads		Number of threads, which execute files simultaneously.
+* @param pContext		Context of the terminal, whose log and configuration are used for every file.
+* @param pPassManager	Pass manager of the terminal, which is copied for every file.
+*/
+void executeBatch(string psList, string psDirectory, unsigned int pnThreads, CContext& pContext, CPassManager& pPassManager) {
+	vector<string> vsFiles; //Stores every file, which is executed.
+	if (!readBatch(psList, psDirectory, vsFiles, pContext)) {
+		return;
+	}
+	vector<string> vsOutputs(vsFiles.size()); //Stores the output of every file.
+	vector<short int> vnStatus(vsFiles.size(), Error::SUCCESS); //Stores the error message of every file.
+	vector<long long> vnTimes(vsFiles.size(), 0); //Stores the time in microseconds, which every file needed.
+	vector<CPassManager> vPassManagers(vsFiles.size(), pPassManager); //Stores the pass manager of every file.
+	function<void(size_t)> run = [&](size_t i) {
+		chrono::steady_clock::time_point begin = chrono::steady_clock::now();
+		vnStatus[i] = executeCaptured(vsFiles[i], pContext, vPassManagers[i], vsOutputs[i]);
+		vnTimes[i] = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - begin).count();
+	};
+	pContext.getLog().addEntry("Begin batch of " + to_string(vsFiles.size()) + " files on " + to_string(pnThreads) + " threads.", LogEntryComponent::TERMINAL, LogEntryType::INF);
+	chrono::steady_clock::time_point begin = chrono::steady_clock::now();
+	if (pnThreads <= 1) {
+		for (size_t i = 0; i < vsFiles.size(); i++) {
+			run(i);
+		}
+	}
+	else {
+		//The current thread executes files as well, while it waits for the pool:
+		CThreadPool pool(pnThreads - 1);
+		atomic<unsigned int> nPending(0); //Stores the number of files, which have not been executed yet.
+		for (size_t i = 0; i < vsFiles.size(); i++) {
+			pool.submit([&run, i]() { run(i); }, nPending);
+		}
+		pool.wait(nPending);
+	}
+	long long nTime = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - begin).count();
+	unsigned int nFailed = printBatch(vsFiles, vnStatus, vnTimes, vsOutputs, nTime, to_string(pnThreads) + " threads");
+	pContext.getLog().addEntry("End batch with " + to_string(nFailed) + " failed files in " + to_string(nTime) + " microseconds.", LogEntryComponent::TERMINAL, LogEntryType::INF);
+}
+
+/**
+* This function executes every file, which is listed in the passed file (one file per line), in the passed number of
+* worker processes, so that a file, which crashes, cannot take down the other files. Every worker is forked from the
+* terminal and executes it's files with the context and the pass manager of the terminal. If processes cannot be forked
+* on this platform, the files are executed by threads instead.
+*
+* @param psList			File, which lists the files, that are executed.
+* @param psDirectory	Directory, in which the listed files are located (empty for the current directory).
+* @param pnProcesses	Number of worker processes.
+* @param pContext		Context of the terminal, whose log and configuration are used for every file.
+* @param pPassManager	Pass manager of the terminal, which is copied for every file.
+*/
+void executeSharded(string psList, string psDirectory, unsigned int pnProcesses, CContext& pContext, CPassManager& pPassManager) {
+	if (!CProcessPool::isSupported()) {
+		SetTextColor(12);
+		cerr << "Processes cannot be forked on this platform, the files are executed by threads instead." << endl;
+		pContext.getLog().addEntry("Processes cannot be forked, the batch is executed by threads.", LogEntryComponent::TERMINAL, LogEntryType::WARN);
+		executeBatch(psList, psDirectory, pnProcesses, pContext, pPassManager);
+		return;
+	}
+	vector<string> vsFiles; //Stores every file, which is executed.
+	if (!readBatch(psList, psDirectory, vsFiles, pContext)) {
+		return;
+	}
+	vector<string> vsOutputs; //Stores the output of every file.
+	vector<short int> vnStatus; //Stores the error message of every file.
+	vector<long long> vnTimes; //Stores the time in microseconds, which every file needed within it's worker.
+	CProcessPool pool(pnProcesses, [&pContext, &pPassManager](const string& psFile, string& psOutput) {
+		CPassManager passManager = pPassManager;
+		return executeCaptured(psFile, pContext, passManager, psOutput);
+	});
+	pContext.getLog().addEntry("Begin sharded batch of " + to_string(vsFiles.size()) + " files in " + to_string(pool.getProcesses()) + " processes.", LogEntryComponent::TERMINAL, LogEntryType::INF);
+	chrono::steady_clock::time_point begin = chrono::steady_clock::now();
+	if (!pool.run(vsFiles, vnStatus, vnTimes, vsOutputs)) {
+		//An error occured:
+		SetTextColor(12);
+		cerr << "The worker processes could not be started." << endl;
+		pContext.getLog().addEntry("Cannot fork the worker processes.", LogEntryComponent::TERMINAL, LogEntryType::ERR);
+		return;
+	}
+	long long nTime = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - begin).count();
+	unsigned int nFailed = printBatch(vsFiles, vnStatus, vnTimes, vsOutputs, nTime, to_string(pool.getProcesses()) + " processes (" + to_string(pool.getRespawns()) + " respawned)");
+	pContext.getLog().addEntry("End sharded batch with " + to_string(nFailed) + " failed files and " + to_string(pool.getRespawns()) + " respawned processes in " + to_string(nTime) + " microseconds.", LogEntryComponent::TERMINAL, LogEntryType::INF);
+}
+
+/**
+* This function reads, tokenizes, parses and optimizes the sourcecode from a specific file, without executing it, so that
+* the prepared abstract syntax trees can be executed together with other sourcecode later on.
+*
+* @param psFilename		File, in which the sourcecode is located.
+* @param plASTs			List, into which the abstract syntax trees are written.
+* @param pContext		Context, which provides the log and into whose errors the errors are printed.
+* @param pPassManager	Pass manager, which optimizes the abstract syntax trees.
+* @return				Error message (Error::SUCCESS, if the sourcecode has been prepared without errors).
+*/
+short int prepare(string psFilename, CLinkedList<CAbstractSyntaxTree<CToken>>& plASTs, CContext& pContext, CPassManager& pPassManager) {
+	CFileScanner fileScanner;
+	CRV<string> rvFileContent = fileScanner.scan(psFilename);
+	if (rvFileContent.getErrorMessage() != Error::SUCCESS) {
+		//An error occured:
+		printError(CToken(), rvFileContent.getErrorMessage(), pContext);
+		return rvFileContent.getErrorMessage();
+	}
+	return prepareSourcecode(rvFileContent.getContent(), psFilename, plASTs, pContext, pPassManager);
+}
+
+/**
+* This function tokenizes, parses and optimizes the passed sourcecode, without executing it.
+*
+* @param psSourcecode	Sourcecode, which is prepared.
+* @param psFilename		Name, which is shown with the errors of the sourcecode.
+* @param plASTs			List, into which the abstract syntax trees are written.
+* @param pContext		Context, which provides the log and into whose errors the errors are printed.
+* @param pPassManager	Pass manager, which optimizes the abstract syntax trees.
+* @return				Error message (Error::SUCCESS, if the sourcecode has been prepared without errors).
+*/
+short int prepareSourcecode(string psSourcecode, string psFilename, CLinkedList<CAbstractSyntaxTree<CToken>>& plASTs, CContext& pContext, CPassManager& pPassManager) {
+	CTokenizer tokenizer;
+	tokenizer.setContext(pContext);
+	CRV<CLinkedList<CToken>> rvTokens = tokenizer.tokenize(psSourcecode, psFilename);
+	if (rvTokens.getErrorMessage() != Error::SUCCESS) {
+		//An error occured:
+		printError(rvTokens.getContent()[rvTokens.getContent().size() - 1], rvTokens.getErrorMessage(), pContext);
+		return rvTokens.getErrorMessage();
+	}
+	CParser parser;
+	parser.setContext(pContext);
+	CRV<CLinkedList<CAbstractSyntaxTree<CToken>>> rvAST = parser.parse(rvTokens.getContent());
+	if (rvAST.getErrorMessage() != Error::SUCCESS) {
+		//An error occured:
+		printError(rvAST.getContent()[0].getContent(), rvAST.getErrorMessage(), pContext);
+		return rvAST.getErrorMessage();
+	}
+	pPassManager.setContext(pContext);
+	plASTs.addAll(pPassManager.run(rvAST.getContent()));
+	return Error::SUCCESS;
+}
+
+/**
+* This function executes the sourcecode of a submission together with the prepared functions of the prelude. The
+* submission is executed with a copy of the passed context, which prints into a buffer and memoizes into a cache of it's
+* own, and with a new interpreter, so that nothing is left over from previous submissions.
+*
+* @param psSourcecode	Sourcecode of the submission.
+* @param plPrelude		Prepared abstract syntax trees of the prelude.
+* @param pContext		Context of the terminal, whose log and configuration are used.
+* @param pPassManager	Pass manager, which optimizes the sourcecode of the submission.
+* @param psOutput		String, into which the output of the submission is written.
+* @return				Error message (Error::SUCCESS, if the sourcecode has been executed without errors).
+*/
+short int executeSubmission(const string& psSourcecode, CLinkedList<CAbstractSyntaxTree<CToken>>& plPrelude, CContext& pContext, CPassManager& pPassManager, string& psOutput) {
+	ostringstream output;
+	CMemoCache memoCache;
+	memoCache.setEnabled(pContext.getMemoCache() != nullptr && pContext.getMemoCache()->isEnabled());
+	memoCache.setCapacity(pContext.getMemoCache() != nullptr ? pContext.getMemoCache()->getCapacity() : MEMO_DEFAULT_CAPACITY);
+	CContext context = pContext.redirect(output);
+	context.setMemoCache(&memoCache);
+	CLinkedList<CAbstractSyntaxTree<CToken>> lASTs = plPrelude; //Stores the prelude, followed by the submission.
+	short int nStatus = prepareSourcecode(psSourcecode, "submission", lASTs, context, pPassManager);
+	if (nStatus == Error::SUCCESS) {
+		CInterpreter interpreter;
+		interpreter.setContext(context);
+		CRV<CToken> rvInterpreter = interpreter.interpret(lASTs);
+		if (rvInterpreter.getErrorMessage() != Error::SUCCESS) {
+			//An error occured:
+			output << '\n';
+			printError(rvInterpreter.getContent(), rvInterpreter.getErrorMessage(), context);
+		}
+		nStatus = rvInterpreter.getErrorMessage();
+	}
+	psOutput = output.str();
+	return nStatus;
+}
+
+/**
+* This function prepares the functions of the prelude once and executes every submission, which is sent to the passed
+* socket, until the daemon is stopped.
+*
+* @param psSocket		Path of the socket, on which the daemon listens.
+* @param psPrelude		File, whose functions are prepared for every submission (empty for no prelude).
+* @param pbFork			Whether every submission is executed by a forked child process.
+* @param pContext		Context of the terminal, whose log and configuration are used for every submission.
+* @param pPassManager	Pass manager of the terminal, which is copied for every submission.
+*/
+void serveDaemon(string psSocket, string psPrelude, bool pbFork, CContext& pContext, CPassManager& pPassManager) {
+	if (!CDaemon::isSupported()) {
+		SetTextColor(12);
+		cerr << "Unix domain sockets and processes are not supported on this platform." << endl;
+		pContext.getLog().addEntry("The daemon is not supported on this platform.", LogEntryComponent::TERMINAL, LogEntryType::ERR);
+		return;
+	}
+	CLinkedList<CAbstractSyntaxTree<CToken>> lPrelude; //Stores the prepared functions of the prelude.
+	chrono::steady_clock::time_point begin = chrono::steady_clock::now();
+	if (psPrelude != "" && prepare(psPrelude, lPrelude, pContext, pPassManager) != Error::SUCCESS) {
+		return;
+	}
+	long long nTime = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - begin).count();
+	CDaemon daemon([&lPrelude, &pContext, &pPassManager](const string& psSourcecode, string& psOutput) {
+		CPassManager passManager = pPassManager;
+		return executeSubmission(psSourcecode, lPrelude, pContext, passManager, psOutput);
+	}, pbFork);
+	SetTextColor(7);
+	cout << "The prelude (" << lPrelude.size() << " functions) has been prepared in " << fixed << setprecision(2) << nTime / 1000.0 << defaultfloat << " ms." << endl;
+	cout << "The daemon is listening on \"" << psSocket << "\" (" << (pbFork ? "fork" : "reset") << " mode). Submit \"stop\" to stop it." << endl;
+	pContext.getLog().addEntry("Begin daemon on \"" + psSocket + "\" with " + to_string(lPrelude.size()) + " prepared functions.", LogEntryComponent::TERMINAL, LogEntryType::INF);
+	if (!daemon.serve(psSocket)) {
+		//An error occured:
+		SetTextColor(12);
+		cerr << "The daemon cannot listen on \"" << psSocket << "\"." << endl;
+		pContext.getLog().addEntry("Cannot listen on \"" + psSocket + "\".", LogEntryComponent::TERMINAL, LogEntryType::ERR);
+		return;
+	}
+	SetTextColor(7);
+	cout << "The daemon has been stopped after " << daemon.getSubmissions() << " submissions." << endl;
+	pContext.getLog().addEntry("End daemon after " + to_string(daemon.getSubmissions()) + " submissions.", LogEntryComponent::TERMINAL, LogEntryType::INF);
+}
+
+/**
+* This function submits the sourcecode from a specific file to the daemon, which listens on the passed socket, and prints
+* the output of the first submission, followed by the percentiles of the times until the results arrived.
+*
+* @param psSocket		Path of the socket of the daemon.
+* @param psFilename		File, in which the sourcecode is located (empty, if the daemon is stopped).
+* @param pnRepetitions	Number of times, the sourcecode is submitted.
+* @param pContext		Context, into whose errors the errors are printed.
+*/
+void submit(string psSocket, string psFilename, unsigned int pnRepetitions, CContext& pContext) {
+	string sSourcecode = ""; //Stores the sourcecode, which is submitted.
+	if (psFilename != "") {
+		CFileScanner fileScanner;
+		CRV<string> rvFileContent = fileScanner.scan(psFilename);
+		if (rvFileContent.getErrorMessage() != Error::SUCCESS) {
+			//An error occured:
+			printError(CToken(), rvFileContent.getErrorMessage(), pContext);
+			return;
+		}
+		sSourcecode = rvFileContent.getContent();
+	}
+	vector<long long> vnTimes; //Stores the time in microseconds until every result arrived.
+	unsigned int nFailed = 0; //Stores the number of submissions, which caused an error.
+	for (unsigned int i = 0; i < pnRepetitions; i++) {
+		short int nStatus = Error::SUCCESS;
+		long long nMicroseconds = 0;
+		string sOutput = "";
+		chrono::steady_clock::time_point begin = chrono::steady_clock::now();
+		if (!CDaemon::submit(psSocket, psFilename != "" ? DaemonRequest::DAEMON_EXECUTE : DaemonRequest::DAEMON_STOP, sSourcecode, nStatus, nMicroseconds, sOutput)) {
+			//The daemon cannot be reached:
+			SetTextColor(12);
+			cerr << "No daemon is listening on \"" << psSocket << "\"." << endl;
+			pContext.getLog().addEntry("Cannot connect to \"" + psSocket + "\".", LogEntryComponent::TERMINAL, LogEntryType::ERR);
+			return;
+		}
+		vnTimes.push_back(chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - begin).count());
+		nFailed += nStatus != Error::SUCCESS ? 1 : 0;
+		if (i == 0) {
+			SetTextColor(nStatus == Error::SUCCESS ? 7 : 12);
+			cout << sOutput;
+			if (!sOutput.empty() && sOutput.back() != '\n') {
+				cout << '\n';
+			}
+		}
+	}
+	SetTextColor(7);
+	if (psFilename == "") {
+		cout << "The daemon has been stopped." << endl;
+		return;
+	}
+	cout << pnRepetitions << " submissions, " << nFailed << " failed." << endl;
+	printLatency(vnTimes);
+}
+
+/**
+* This function transpiles the sourcecode from a specific file into a C++ file, which can be compiled into an executable.
+*
+* @param psFilename		File, in which the sourcecode is located.
+* @param psOutput		File, into which the C++ sourcecode is written.
+* @param psExecutable	Executable, into which the C++ sourcecode is compiled (no compilation if empty).
+* @param pContext		Context, which provides the log and the configuration.
+* @param pPassManager	Pass manager, which optimizes the abstract syntax trees before they are transpiled.
+*/
+void transpile(string psFilename, string psOutput, string psExecutable, CContext pContext, CPassManager& pPassManager) {
+	//-+-+-+-+-+-+- READ THE FILE -+-+-+-+-+-+-
+	CFileScanner fileScanner;
+	CRV<string> rvFileContent = fileScanner.scan(psFilename);
+	if (rvFileContent.getErrorMessage() != Error::SUCCESS) {
+		//An error occured:
+		printError(CToken(), rvFileContent.getErrorMessage(), pContext);
+		return;
+	}
+
+	//-+-+-+-+-+-+- TOKENIZING -+-+-+-+-+-+-
+	CTokenizer tokenizer;
+	tokenizer.setContext(pContext);
+	CRV<CLinkedList<CToken>> rvTokens = tokenizer.tokenize(rvFileContent.getContent(), psFilename);
+	if (rvTokens.getErrorMessage() != Error::SUCCESS) {
+		//An error occured:
+		printError(rvTokens.getContent()[rvTokens.getContent().size() - 1], rvTokens.getErrorMessage(), pContext);
+		return;
+	}
+
+	//-+-+-+-+-+-+- PARSING -+-+-+-+-+-+-
+	CParser parser;
+	parser.setContext(pContext);
+	CRV<CLinkedList<CAbstractSyntaxTree<CToken>>> rvAST = parser.parse(rvTokens.getContent());
+	if (rvAST.getErrorMessage() != Error::SUCCESS) {
+		//An error occured:
+		printError(rvAST.getContent()[0].getContent(), rvAST.getErrorMessage(), pContext);
+		return;
+	}
+
+	//-+-+-+-+-+-+- OPTIMIZING -+-+-+-+-+-+-
+	pPassManager.setContext(pContext);
+	CLinkedList<CAbstractSyntaxTree<CToken>> lASTs = pPassManager.run(rvAST.getContent());
+
+	//-+-+-+-+-+-+- TRANSPILING -+-+-+-+-+-+-
+	pContext.getLog().addEntry("Begin transpilation of \"" + psFilename + "\".", LogEntryComponent::INTERPRETER, LogEntryType::INF);
+	CTranspiler transpiler;
+	transpiler.setShortCircuit(pContext.isShortCircuit());
+	CRV<CToken> rvTranspiler = transpiler.transpile(lASTs);
+	if (rvTranspiler.getErrorMessage() == Error::Interpreter::INFO_ENGINE_UNSUPPORTED) {
+		//The sourcecode cannot be transpiled:
+		SetTextColor(12);
+		cerr << "The sourcecode cannot be transpiled, since it's behaviour depends on values which are only known while" << endl;
+		cerr << "interpreting. Use \"EXECUTE\" instead." << endl;
+		pContext.getLog().addEntry("The sourcecode cannot be transpiled.", LogEntryComponent::INTERPRETER, LogEntryType::WARN);
+		return;
+	}
+	else if (rvTranspiler.getErrorMessage() != Error::SUCCESS) {
+		//An error occured:
+		printError(rvTranspiler.getContent(), rvTranspiler.getErrorMessage(), pContext);
+		return;
+	}
+	ofstream outputFile(psOutput, ios::binary);
+	if (!outputFile) {
+		//The file cannot be written:
+		SetTextColor(12);
+		cerr << "The file \"" << psOutput << "\" cannot be written." << endl;
+		pContext.getLog().addEntry("Cannot write the file \"" + psOutput + "\".", LogEntryComponent::FILE_SYSTEM, LogEntryType::ERR);
+		return;
+	}
+	outputFile << transpiler.getSourcecode();
+	outputFile.close();
+	SetTextColor(7);
+	cout << "The sourcecode has been transpiled into \"" << psOutput << "\"." << endl;
+	pContext.getLog().addEntry("End transpilation successfully.", LogEntryComponent::INTERPRETER, LogEntryType::INF);
+
+	//-+-+-+-+-+-+- COMPILING -+-+-+-+-+-+-
+	if (psExecutable != "") {
+		string sCommand = string(TRANSPILER_COMPILER_COMMAND) + " \"" + psOutput + "\" -o \"" + psExecutable + "\"";
+		if (system(sCommand.c_str()) != 0) {
+			//The compiler reported an error:
+			SetTextColor(12);
+			cerr << "The command \"" << sCommand << "\" failed." << endl;
+			pContext.getLog().addEntry("The command \"" + sCommand + "\" failed.", LogEntryComponent::TERMINAL, LogEntryType::ERR);
+			return;
+		}
+		SetTextColor(7);
+		cout << "The sourcecode has been compiled into \"" << psExecutable << "\"." << endl;
+	}
+}
+
+/**
+* This function checks the types of every expression in the sourcecode from a specific file without executing it, and prints
+* every error, that has been found.
+*
+* @param psFilename	File, in which the sourcecode is located.
+* @param pContext	Context, which provides the log.
+*/
+void check(string psFilename, CContext pContext) {
+	//-+-+-+-+-+-+- READ THE FILE -+-+-+-+-+-+-
+	CFileScanner fileScanner;
+	CRV<string> rvFileContent = fileScanner.scan(psFilename);
+	if (rvFileContent.getErrorMessage() != Error::SUCCESS) {
+		//An error occured:
+		printError(CToken(), rvFileContent.getErrorMessage(), pContext);
+		return;
+	}
+
+	//-+-+-+-+-+-+- TOKENIZING -+-+-+-+-+-+-
+	CTokenizer tokenizer;
+	tokenizer.setContext(pContext);
+	CRV<CLinkedList<CToken>> rvTokens = tokenizer.tokenize(rvFileContent.getContent(), psFilename);
+	if (rvTokens.getErrorMessage() != Error::SUCCESS) {
+		//An error occured:
+		printError(rvTokens.getContent()[rvTokens.getContent().size() - 1], rvTokens.getErrorMessage(), pContext);
+		return;
+	}
+
+	//-+-+-+-+-+-+- PARSING -+-+-+-+-+-+-
+	CParser parser;
+	parser.setContext(pContext);
+	CRV<CLinkedList<CAbstractSyntaxTree<CToken>>> rvAST = parser.parse(rvTokens.getContent());
+	if (rvAST.getErrorMessage() != Error::SUCCESS) {
+		//An error occured:
+		printError(rvAST.getContent()[0].getContent(), rvAST.getErrorMessage(), pContext);
+		return;
+	}
+
+	//-+-+-+-+-+-+- CHECKING -+-+-+-+-+-+-
+	pContext.getLog().addEntry("Begin type check of \"" + psFilename + "\".", LogEntryComponent::INTERPRETER, LogEntryType::INF);
+	COpcodeResolver resolver;
+	CTypeChecker checker;
+	checker.check(resolver.resolve(rvAST.getContent()));
+	CLinkedList<CRV<CToken>> lErrors = checker.getErrors();
+	for (unsigned int i = 0; i < lErrors.size(); i++) {
+		printError(lErrors[i].getContent(), lErrors[i].getErrorMessage(), pContext);
+	}
+	SetTextColor(7);
+	if (lErrors.empty()) {
+		cout << "No errors have been found." << endl;
+	}
+	else {
+		cout << lErrors.size() << " errors have been found." << endl;
+	}
+	pContext.getLog().addEntry("End type check with " + to_string(lErrors.size()) + " errors.", LogEntryComponent::INTERPRETER, LogEntryType::INF);
+}
+
+/**
+* This function measures every kernel of the COperationKernels against the generic evaluation of COperationEvaluator and
+* prints the results as table.
+*
+* @param pnIterations	Number of times, every operation is evaluated.
+* @param pLog			Log, into which the results are written.
+*/
+void benchmark(unsigned int pnIterations, CLog& pLog) {
+	pLog.addEntry("Begin benchmark with " + to_string(pnIterations) + " iterations.", LogEntryComponent::INTERPRETER, LogEntryType::INF);
+	SetTextColor(7);
+	cout << left << setw(20) << "Operation" << right << setw(14) << "Generic (us)" << setw(14) << "Kernel (us)" << setw(10) << "Speedup" << endl;
+	benchmarkKernel("int + int", "+", Opcode::OPCODE_ADD, Token::U_INT, 2, OperationKernel::KERNEL_INT_BINARY, pnIterations, pLog);
+	benchmarkKernel("int * int * int", "*", Opcode::OPCODE_MULTIPLY, Token::U_INT, 3, OperationKernel::KERNEL_INT_TERNARY, pnIterations, pLog);
+	benchmarkKernel("int - ... (8)", "-", Opcode::OPCODE_SUBTRACT, Token::U_INT, 8, OperationKernel::KERNEL_INT_VARIADIC, pnIterations, pLog);
+	benchmarkKernel("double + double", "+", Opcode::OPCODE_ADD, Token::U_DOUBLE, 2, OperationKernel::KERNEL_DOUBLE_BINARY, pnIterations, pLog);
+	benchmarkKernel("int / int / int", "/", Opcode::OPCODE_DIVIDE, Token::U_INT, 3, OperationKernel::KERNEL_DOUBLE_TERNARY, pnIterations, pLog);
+	benchmarkKernel("double * ... (8)", "*", Opcode::OPCODE_MULTIPLY, Token::U_DOUBLE, 8, OperationKernel::KERNEL_DOUBLE_VARIADIC, pnIterations, pLog);
+	benchmarkKernel("string + ... (4)", "+", Opcode::OPCODE_ADD, Token::U_STRING, 4, OperationKernel::KERNEL_STRING_VARIADIC, pnIterations, pLog);
+	benchmarkKernel("int < int", "<", Opcode::OPCODE_LESS, Token::U_INT, 2, OperationKernel::KERNEL_COMPARISON, pnIterations, pLog);
+	benchmarkKernel("double = double", "=", Opcode::OPCODE_EQUAL, Token::U_DOUBLE, 2, OperationKernel::KERNEL_COMPARISON, pnIterations, pLog);
+	cout << endl;
+	pLog.addEntry("End benchmark.", LogEntryComponent::INTERPRETER, LogEntryType::INF);
+}
+
+/**
+* This function measures a single kernel against the generic evaluation of the same operation and prints one row of the
+* table. The kernel is only measured, if both evaluations produce the same token.
+*
+* @param psName			Name of the operation in the table.
+* @param psOperator		Lexeme of the operator.
+* @param pnOpcode		Opcode of the operator.
+* @param pnType			Type of every operand.
+* @param pnOperands		Number of operands.
+* @param pnKernel		Kernel, which is measured.
+* @param pnIterations	Number of times, the operation is evaluated.
+* @param pLog			Log, into which an incorrect kernel is written.
+*/
+void benchmarkKernel(string psName, string psOperator, short int pnOpcode, short int pnType, unsigned int pnOperands, short int pnKernel, unsigned int pnIterations, CLog& pLog) {
+	CToken headNode(psOperator, pnOpcode == Opcode::OPCODE_LESS || pnOpcode == Opcode::OPCODE_EQUAL ? Token::OPERATOR_RELATIONAL : Token::OPERATOR_ARITHMETIC, "benchmark", 1);
+	headNode.setOpcode(pnOpcode, Error::SUCCESS);
+	CLinkedList<CToken> lOperands;
+	for (unsigned int i = 0; i < pnOperands; i++) {
+		string sLexeme = pnType == Token::U_INT ? to_string(i + 2) : pnType == Token::U_DOUBLE ? to_string(i + 1.25) : "ab";
+		lOperands.add(CToken(sLexeme, pnType, "benchmark", 1));
+	}
+	COperationEvaluator evaluator;
+	CToken kernelNode = headNode;
+	kernelNode.setKernel(pnKernel);
+	CRV<CToken> rvGeneric = evaluator.evaluate(headNode, lOperands);
+	CRV<CToken> rvKernel = evaluator.evaluate(kernelNode, lOperands);
+	cout << left << setw(20) << psName << right;
+	if (rvGeneric.getErrorMessage() != rvKernel.getErrorMessage() || rvGeneric.getContent().getLexeme() != rvKernel.getContent().getLexeme() || rvGeneric.getContent().getType() != rvKernel.getContent().getType()) {
+		//The kernel is incorrect:
+		SetTextColor(12);
+		cout << "  kernel returns \"" << rvKernel.getContent().getLexeme() << "\" instead of \"" << rvGeneric.getContent().getLexeme() << "\"" << endl;
+		SetTextColor(7);
+		pLog.addEntry("The kernel of \"" + psName + "\" returns an incorrect result.", LogEntryComponent::INTERPRETER, LogEntryType::ERR);
+		return;
+	}
+
+	chrono::steady_clock::time_point begin = chrono::steady_clock::now();
+	for (unsigned int i = 0; i < pnIterations; i++) {
+		evaluator.evaluate(headNode, lOperands);
+	}
+	long long nGeneric = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - begin).count();
+	begin = chrono::steady_clock::now();
+	for (unsigned int i = 0; i < pnIterations; i++) {
+		evaluator.evaluate(kernelNode, lOperands);
+	}
+	long long nKernel = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - begin).count();
+	cout << setw(14) << nGeneric << setw(14) << nKernel << setw(9) << fixed << setprecision(2) << (nKernel > 0 ? (double)nGeneric / nKernel : 0.0) << "x" << defaultfloat << endl;
+}
+
+/**
+* This function measures how many values per second are sent through a CChannel by 1 to 16 threads and prints the
+* results as table. Half of the threads send values, the other half receives them.
+*
+* @param pnMessages	Number of values, which are sent with every number of threads.
+* @param pLog			Log, into which the results are written.
+*/
+void benchmarkChannels(unsigned int pnMessages, CLog& pLog) {
+	pLog.addEntry("Begin channel benchmark with " + to_string(pnMessages) + " messages.", LogEntryComponent::INTERPRETER, LogEntryType::INF);
+	SetTextColor(7);
+	cout << right << setw(8) << "Threads" << setw(11) << "Senders" << setw(11) << "Receivers" << setw(12) << "Time (ms)" << setw(16) << "Messages/s" << endl;
+	for (unsigned int nThreads = 1; nThreads <= 16; nThreads *= 2) {
+		benchmarkChannel(nThreads, pnMessages, pLog);
+	}
+	cout << endl;
+	pLog.addEntry("End channel benchmark.", LogEntryComponent::INTERPRETER, LogEntryType::INF);
+}
+
+/**
+* This function sends the passed number of values through a channel with the passed number of threads and prints one
+* row of the table. A single thread sends and receives every value itself. The sum of the received values is compared
+* with the sum of the sent values, so that a value, which is lost or received twice, is shown as an error.
+*
+* @param pnThreads		Number of threads.
+* @param pnMessages		Number of values, which are sent.
+* @param pLog			Log, into which lost values are written.
+*/
+void benchmarkChannel(unsigned int pnThreads, unsigned int pnMessages, CLog& pLog) {
+	CChannel channel(1024);
+	vector<CToken> vValues; //Stores the values, which are sent, so that they are not converted while measuring.
+	for (unsigned int i = 0; i < 256; i++) {
+		vValues.push_back(CToken(to_string(i), Token::U_INT, "benchmark", 1));
+	}
+	unsigned int nSenders = pnThreads > 1 ? pnThreads / 2 : 1; //Stores the number of threads, which send values.
+	unsigned int nReceivers = pnThreads > 1 ? pnThreads - nSenders : 1; //Stores the number of threads, which receive values.
+	atomic<long long> nRemaining(pnMessages); //Stores the number of values, which have not been claimed by a receiver.
+	atomic<long long> nReceived(0); //Stores the sum of the received values.
+	long long nSent = 0; //Stores the sum of the sent values.
+	for (unsigned int i = 0; i < pnMessages; i++) {
+		nSent += i % vValues.size();
+	}
+
+	chrono::steady_clock::time_point begin = chrono::steady_clock::now();
+	if (pnThreads == 1) {
+		long long nSum = 0; //Stores the sum of the received values.
+		for (unsigned int i = 0; i < pnMessages; i++) {
+			channel.send(vValues[i % vValues.size()], nullptr);
+			nSum += stoi(channel.receive(nullptr).getLexeme());
+		}
+		nReceived = nSum;
+	}
+	else {
+		vector<thread> vThreads;
+		for (unsigned int i = 0; i < nSenders; i++) {
+			vThreads.push_back(thread([&channel, &vValues, i, nSenders, pnMessages]() {
+				for (unsigned int j = i; j < pnMessages; j += nSenders) {
+					channel.send(vValues[j % vValues.size()], nullptr);
+				}
+			}));
+		}
+		for (unsigned int i = 0; i < nReceivers; i++) {
+			vThreads.push_back(thread([&channel, &nRemaining, &nReceived]() {
+				long long nSum = 0; //Stores the sum of the values, which have been received by this thread.
+				while (nRemaining.fetch_sub(1) > 0) {
+					nSum += stoi(channel.receive(nullptr).getLexeme());
+				}
+				nReceived += nSum;
+			}));
+		}
+		for (unsigned int i = 0; i < vThreads.size(); i++) {
+			vThreads[i].join();
+		}
+	}
+	long long nTime = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - begin).count();
+
+	cout << setw(8) << pnThreads << setw(11) << nSenders << setw(11) << nReceivers;
+	if (nReceived != nSent) {
+		//Values have been lost or received twice:
+		SetTextColor(12);
+		cout << "  received sum " << nReceived << " instead of " << nSent << endl;
+		SetTextColor(7);
+		pLog.addEntry("The channel lost values with " + to_string(pnThreads) + " threads.", LogEntryComponent::INTERPRETER, LogEntryType::ERR);
 		return;
 	}
-	CLinkedList<CAbstractSyntaxTree<CToken>> lASTs = rvAST.getContent();
-	//----- DEBUG BEGIN -----
-	if (pbDebugMode) {
-		SetTextColor(8);
-		for (unsigned int i = 0; i < lASTs.size(); i++) {
-			cout << "AbstractSyntaxTree " << i << "=" << endl;
-			printAST(lASTs[i], 0);
-			cout << "\n";
-		}
+	cout << setw(12) << fixed << setprecision(1) << nTime / 1000.0 << setw(16) << setprecision(0) << (nTime > 0 ? pnMessages * 1000000.0 / nTime : 0.0) << defaultfloat << endl;
+}
+
+/**
+* This function generates a program with many functions and measures the memory, which the passed number of simultaneous
+* executions of the program need: Once with sessions, which share a single program, and once with executions, which
+* prepare the program themselves, as every execution did before programs could be shared. The results are printed as
+* table.
+*
+* @param pnSessions		Number of simultaneous executions.
+* @param pContext		Context, which provides the log and the configuration.
+* @param pPassManager	Pass manager, which optimizes the program.
+*/
+void benchmarkSessions(unsigned int pnSessions, CContext& pContext, CPassManager& pPassManager) {
+	const unsigned int nFunctions = 100; //Stores the number of functions of the generated program.
+	if (getResidentMemory() == 0) {
+		//Memory cannot be measured:
+		SetTextColor(12);
+		cerr << "The memory of the process cannot be measured on this platform.\n" << endl;
+		return;
+	}
+	pContext.getLog().addEntry("Begin session benchmark with " + to_string(pnSessions) + " sessions.", LogEntryComponent::INTERPRETER, LogEntryType::INF);
+	//Every function calls the previous one, so that a call of the last function executes 50 of them:
+	string sSourcecode = "(int f0 (int x) ((return x)))\n";
+	for (unsigned int i = 1; i < nFunctions; i++) {
+		sSourcecode += "(int f" + to_string(i) + " (int x) (\n\t(if (< x 1) ((return " + to_string(i) + ")))\n\t(return (+ (* x 2) (- x 1) (f" + to_string(i - 1) + " (- x 1))))\n))\n";
+	}
+	string sFunction = "f" + to_string(nFunctions - 1); //Stores the name of the function, which is called.
+	CContext context = pContext;
+	atomic<unsigned int> nErrors(0); //Stores the number of executions, which failed.
+	function<void(CSession&)> call = [&sFunction, &nErrors](CSession& pSession) {
+		CValue argument;
+		argument.setInt(50);
+		nErrors += pSession.call(sFunction, { argument }).getErrorMessage() != Error::SUCCESS ? 1 : 0;
+	};
+
+	size_t nBefore = getResidentMemory(); //Stores the memory before the program has been loaded.
+	shared_ptr<CProgram> program = make_shared<CProgram>();
+	program->load(sSourcecode, "benchmark", context, pPassManager);
+	size_t nProgram = getResidentMemory() - nBefore; //Stores the memory of the program.
+	nBefore = getResidentMemory();
+	size_t nShared = measureThreads(pnSessions, [&program, &context, &call](function<void()> pFinish) {
+		CSession session(program, context);
+		call(session);
+		pFinish();
+	}) - nBefore; //Stores the memory of the sessions, which share the program.
+	nBefore = getResidentMemory();
+	size_t nCopied = measureThreads(pnSessions, [&sSourcecode, &context, &pPassManager, &call](function<void()> pFinish) {
+		shared_ptr<CProgram> ownProgram = make_shared<CProgram>();
+		ownProgram->load(sSourcecode, "benchmark", context, pPassManager);
+		CSession session(ownProgram, context);
+		call(session);
+		pFinish();
+	}) - nBefore; //Stores the memory of the executions, which prepare the program themselves.
+
+	SetTextColor(7);
+	cout << left << setw(34) << "Program (" + to_string(nFunctions) + " functions)" << right << setw(14) << "Memory (KB)" << setw(16) << "Per execution" << endl;
+	cout << left << setw(34) << "Loaded once" << right << setw(14) << nProgram / 1024 << endl;
+	cout << left << setw(34) << to_string(pnSessions) + " sessions, shared program" << right << setw(14) << nShared / 1024 << setw(16) << nShared / 1024 / pnSessions << endl;
+	cout << left << setw(34) << to_string(pnSessions) + " executions, own program" << right << setw(14) << nCopied / 1024 << setw(16) << nCopied / 1024 / pnSessions << endl;
+	if (nErrors > 0) {
+		SetTextColor(12);
+		cout << nErrors << " executions failed." << endl;
+		SetTextColor(7);
+		pContext.getLog().addEntry(to_string(nErrors) + " executions of the session benchmark failed.", LogEntryComponent::INTERPRETER, LogEntryType::ERR);
+	}
+	cout << endl;
+	pContext.getLog().addEntry("End session benchmark.", LogEntryComponent::INTERPRETER, LogEntryType::INF);
+}
+
+/**
+* This function submits the passed number of executions to an event loop and measures the memory, which the executions
+* need, while every one of them waits for a host function. Afterwards the host answers every call, so that the executions
+* wait for a second call, and finally finish. The results are printed as table.
+*
+* @param pnExecutions	Number of executions.
+* @param pContext		Context, which provides the log and the configuration.
+* @param pPassManager	Pass manager, which optimizes the program.
+*/
+void benchmarkAsync(unsigned int pnExecutions, CContext& pContext, CPassManager& pPassManager) {
+	if (getResidentMemory() == 0) {
+		//Memory cannot be measured:
+		SetTextColor(12);
+		cerr << "The memory of the process cannot be measured on this platform.\n" << endl;
+		return;
+	}
+	pContext.getLog().addEntry("Begin async benchmark with " + to_string(pnExecutions) + " executions.", LogEntryComponent::INTERPRETER, LogEntryType::INF);
+	//Every execution calls the host function "fetch" twice, which returns it's argument multiplied by 2:
+	string sSourcecode = "(int handle (int x) (\n\t(int y (fetch x))\n\t(return (+ y (fetch (+ x 1))))\n))\n";
+	shared_ptr<CProgram> program = make_shared<CProgram>();
+	program->load(sSourcecode, "benchmark", pContext, pPassManager);
+	CEventLoop loop(program, pContext);
+	vector<pair<long long, HostResult>> vCalls; //Stores the arguments of the host calls, which have not been answered.
+	loop.setHostFunction("fetch", [&vCalls](CLinkedList<CToken> plArguments, HostResult pResult) {
+		vCalls.push_back(make_pair(stoll(plArguments[0].getLexeme()), pResult));
+	});
+	long long nSum = 0; //Stores the sum of the results.
+	unsigned int nErrors = 0; //Stores the number of executions, which failed.
+	Completion completion = [&nSum, &nErrors](CRV<CToken> prvResult, const string&) {
+		if (prvResult.getErrorMessage() != Error::SUCCESS) {
+			nErrors++;
+			return;
+		}
+		nSum += stoll(prvResult.getContent().getLexeme());
+	};
+
+	size_t nBefore = getResidentMemory(); //Stores the memory before the executions have been submitted.
+	chrono::steady_clock::time_point begin = chrono::steady_clock::now();
+	for (unsigned int i = 0; i < pnExecutions; i++) {
+		CLinkedList<CToken> lArguments;
+		lArguments.add(CToken(to_string(i), Token::U_INT));
+		loop.submit("handle", lArguments, completion);
+	}
+	size_t nSuspended = getResidentMemory() - nBefore; //Stores the memory of the suspended executions.
+	unsigned int nSuspendedExecutions = loop.getExecutions(); //Stores the number of suspended executions.
+	for (unsigned int nRound = 0; nRound < 2; nRound++) {
+		//The host answers every call, which has been made so far:
+		vector<pair<long long, HostResult>> vAnswered;
+		vAnswered.swap(vCalls);
+		for (unsigned int i = 0; i < vAnswered.size(); i++) {
+			vAnswered[i].second(CToken(to_string(vAnswered[i].first * 2), Token::U_INT), Error::SUCCESS);
+		}
+		loop.poll();
+	}
+	long long nTime = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - begin).count();
+
+	SetTextColor(7);
+	cout << right << setw(12) << "Executions" << setw(12) << "Suspended" << setw(14) << "Memory (KB)" << setw(20) << "Bytes / execution" << setw(12) << "Time (ms)" << setw(16) << "Executions/s" << endl;
+	cout << setw(12) << pnExecutions << setw(12) << nSuspendedExecutions << setw(14) << nSuspended / 1024 << setw(20) << nSuspended / pnExecutions;
+	cout << setw(12) << fixed << setprecision(1) << nTime / 1000.0 << setw(16) << setprecision(0) << (nTime > 0 ? pnExecutions * 1000000.0 / nTime : 0.0) << defaultfloat << endl;
+	long long nExpected = 2LL * pnExecutions * pnExecutions; //Stores the sum of "4x + 2" for every argument.
+	if (nErrors > 0 || loop.getExecutions() > 0 || nSum != nExpected) {
+		//Executions failed or have not finished:
+		SetTextColor(12);
+		cout << nErrors << " executions failed, " << loop.getExecutions() << " have not finished, the sum is " << nSum << " instead of " << nExpected << "." << endl;
+		SetTextColor(7);
+		pContext.getLog().addEntry("The async benchmark returned incorrect results.", LogEntryComponent::INTERPRETER, LogEntryType::ERR);
+	}
+	cout << endl;
+	pContext.getLog().addEntry("End async benchmark.", LogEntryComponent::INTERPRETER, LogEntryType::INF);
+}
+
+/**
+* This function executes the passed function with the passed number of threads and measures the memory of the process,
+* once every thread has finished it's execution, but before any thread has released it's memory.
+*
+* @param pnThreads	Number of threads.
+* @param pExecute	Function, which is executed by every thread. It calls it's argument after the execution and only
+*					releases it's memory after that call has returned.
+* @return			Memory of the process in bytes.
+*/
+size_t measureThreads(unsigned int pnThreads, function<void(function<void()>)> pExecute) {
+	mutex lock;
+	condition_variable changed;
+	unsigned int nFinished = 0; //Stores the number of threads, which have finished their execution.
+	bool bMeasured = false; //Stores whether the memory has been measured.
+	function<void()> finish = [&lock, &changed, &nFinished, &bMeasured]() {
+		unique_lock<mutex> guard(lock);
+		nFinished++;
+		changed.notify_all();
+		changed.wait(guard, [&bMeasured]() { return bMeasured; });
+	};
+	vector<thread> vThreads;
+	for (unsigned int i = 0; i < pnThreads; i++) {
+		vThreads.push_back(thread(pExecute, finish));
+	}
+	size_t nMemory = 0; //Stores the memory of the process.
+	{
+		unique_lock<mutex> guard(lock);
+		changed.wait(guard, [&nFinished, pnThreads]() { return nFinished == pnThreads; });
+		nMemory = getResidentMemory();
+		bMeasured = true;
+		changed.notify_all();
 	}
-	//------ DEBUG END ------
+	for (unsigned int i = 0; i < vThreads.size(); i++) {
+		vThreads[i].join();
+	}
+	return nMemory;
+}
 
-	//-+-+-+-+-+-+- INTERPRETING -+-+-+-+-+-+-
-	CInterpreter interpreter;
-	SetTextColor(7); //Change textcolor for output while interpreting.
-	CRV<CToken> rvInterpreter;
-	rvInterpreter = interpreter.interpret(lASTs);
-	if (rvInterpreter.getErrorMessage() != Error::SUCCESS) {
-		//An error occured:
-		cout << '\n';
-		printError(rvInterpreter.getContent(), rvInterpreter.getErrorMessage());
-		return;
+/**
+* This function returns the memory of the process, which currently resides in the RAM. The memory is read from
+* "/proc/self/statm", therefore it can only be measured on Linux.
+*
+* @return	Memory in bytes or 0, if it cannot be measured.
+*/
+size_t getResidentMemory() {
+#if defined(_WIN32)
+	return 0;
+#else
+	ifstream statm("/proc/self/statm");
+	size_t nPages = 0; //Stores the size of the process.
+	size_t nResidentPages = 0; //Stores the number of pages, which reside in the RAM.
+	if (!(statm >> nPages >> nResidentPages)) {
+		return 0;
 	}
+	return nResidentPages * (size_t)sysconf(_SC_PAGESIZE);
+#endif
 }
 
 /**
@@ -145,23 +1111,27 @@ void printAST(CAbstractSyntaxTree<CToken> pAST, int nDepth) {
 }
 
 /**
-* This function prints the error message to the console.
+* This function prints the error message into the errors of the passed context.
 *
 * @param errorToken	Token, which caused the occuring error.
+* @param pContext	Context, into whose errors the message is printed.
 */
-void printError(CToken errorToken, short int pnErrorMessage) {
+void printError(CToken errorToken, short int pnErrorMessage, CContext& pContext) {
 	if (pnErrorMessage == Error::SUCCESS || pnErrorMessage == Error::Parser::EMPTY_AST_P) {
 		//No error occured:
 		return;
 	}
-	SetTextColor(12);
+	if (pContext.isConsole()) {
+		SetTextColor(12);
+	}
+	ostream& errors = pContext.getErrors(); //Stores the stream, into which the error is printed.
 	//Check wether information about token does exist:
 	if (errorToken.getFilename() != "") {
-		cerr << errorToken.getFilename() << "(" << errorToken.getLine() << "): \"" << errorToken.getLexeme() << "\": ";
+		errors << errorToken.getFilename() << "(" << errorToken.getLine() << "): \"" << errorToken.getLexeme() << "\": ";
 	}
-	cerr << "error " << pnErrorMessage << ":" << endl;
+	errors << "error " << pnErrorMessage << ":" << endl;
 	//Print the error message:
-	cerr << Error::generateErrorMessage(pnErrorMessage) << endl;
+	errors << Error::generateErrorMessage(pnErrorMessage) << endl;
 }
 
 
@@ -180,6 +1150,12 @@ int main() {
 	string sFilePath = ""; //Stores the filepath (Can be changed through cd).
 	bool bDebugStatus = false; //Indicates, wether advanced debug-information should be shown or not.
 	bool logEvents = false; //Indicates, whether everything should be logged or not.
+	CContext context; //Stores the log and the configuration of the interpreter (Can be changed through engine and shortcircuit).
+	CLog& logger = context.getLog(); //Stores the log of the terminal (Can be changed through log).
+	CPassManager passManager; //Stores the optimization passes (Can be changed through optimize).
+	CMemoCache memoCache; //Stores the return values of pure functions (Can be changed through memoize).
+	context.setThreads(CThreadPool::getHardwareThreads());
+	context.setMemoCache(&memoCache);
 	logger.close(); //Close logger, since logging is deactivated normally.
 	//While loop repeats forever:
 	while (true) {
@@ -224,9 +1200,22 @@ int main() {
 				cout << "HELP          Shows help information for commands." << endl;
 				cout << "EXIT          Exits the interpreter." << endl;
 				cout << "EXECUTE       Executes sourcecode from a file." << endl;
+				cout << "BATCH         Executes the sourcecode from multiple files simultaneously." << endl;
+				cout << "SHARD         Executes the sourcecode from multiple files in separate processes." << endl;
+				cout << "DAEMON        Executes sourcecode, which is submitted through a socket, with a prelude." << endl;
+				cout << "SUBMIT        Submits sourcecode from a file to a daemon." << endl;
 				cout << "CLS           Clears the content of the terminal." << endl;
 				cout << "CD            Shows the name of the current directory, or changes it." << endl;
 				cout << "LOG           Enables or disables the log for the interpreter." << endl;
+				cout << "ENGINE        Shows or changes the engine, which executes the sourcecode." << endl;
+				cout << "TRANSPILE     Transpiles sourcecode from a file into a C++ program." << endl;
+				cout << "CHECK         Checks the types of the sourcecode from a file without executing it." << endl;
+				cout << "OPTIMIZE      Shows or changes the optimizations, which are done before executing." << endl;
+				cout << "BENCHMARK     Measures the arithmetic kernels, the throughput of channels or the memory of" << endl;
+				cout << "              sessions and suspended executions." << endl;
+				cout << "SHORTCIRCUIT  Shows or changes, whether \"&\" and \"|\" skip operands, that cannot change" << endl;
+				cout << "              the result." << endl;
+				cout << "MEMOIZE       Shows or changes, whether the return values of pure functions are memoized." << endl;
 				cout << "\n";
 			}
 			else if (lsArguments.size() == 1) {
@@ -253,6 +1242,57 @@ int main() {
 					cout << "\tdebugMode - Optional argument indicates wether debug-information should be shown" << endl;
 					cout << "\t            while executing the sourcecode.\n" << endl;
 				}
+				else if (sArgument == "batch") {
+					//Display information about batch-command:
+					SetTextColor(7);
+					cout << "Executes the sourcecode from every file, which is listed in a file (one file per line)," << endl;
+					cout << "simultaneously on multiple threads. Every file is executed with the current engine and" << endl;
+					cout << "optimizations, but with an output and a cache of it's own. Afterwards, the result, the" << endl;
+					cout << "time and the output of every file are shown in the order of the list." << endl;
+					cout << "BATCH [path] [threads]" << endl;
+					cout << "\tpath    - File (and path), in which the files are listed. The listed files are located" << endl;
+					cout << "\t          relative to the current directory." << endl;
+					cout << "\tthreads - Optional number of files, which are executed simultaneously (Default:" << endl;
+					cout << "\t          number of hardware threads).\n" << endl;
+				}
+				else if (sArgument == "shard") {
+					//Display information about shard-command:
+					SetTextColor(7);
+					cout << "Executes the sourcecode from every file, which is listed in a file (one file per line)," << endl;
+					cout << "in multiple worker processes, so that a file, which crashes it's process, cannot take" << endl;
+					cout << "down the other files. A worker, which crashed, is replaced by a new one. Afterwards, the" << endl;
+					cout << "result, the time and the output of every file are shown in the order of the list," << endl;
+					cout << "together with the throughput and the percentiles of the times." << endl;
+					cout << "SHARD [path] [processes]" << endl;
+					cout << "\tpath      - File (and path), in which the files are listed. The listed files are" << endl;
+					cout << "\t            located relative to the current directory." << endl;
+					cout << "\tprocesses - Optional number of worker processes (Default: number of hardware" << endl;
+					cout << "\t            threads).\n" << endl;
+				}
+				else if (sArgument == "daemon") {
+					//Display information about daemon-command:
+					SetTextColor(7);
+					cout << "Prepares the functions of a prelude once and executes the sourcecode, which is submitted" << endl;
+					cout << "through a Unix domain socket (see \"SUBMIT\"), together with these functions, until the" << endl;
+					cout << "daemon is stopped. Every submission is executed with the current engine and optimizations." << endl;
+					cout << "DAEMON [socket] [mode] [prelude]" << endl;
+					cout << "\tsocket  - Path of the socket, on which the daemon listens." << endl;
+					cout << "\tmode    - Optional argument: \"fork\" executes every submission in a process, which is" << endl;
+					cout << "\t          forked from the daemon (default), \"reset\" executes every submission within" << endl;
+					cout << "\t          the daemon with a new interpreter." << endl;
+					cout << "\tprelude - Optional file (and path), whose functions can be called by every submission.\n" << endl;
+				}
+				else if (sArgument == "submit") {
+					//Display information about submit-command:
+					SetTextColor(7);
+					cout << "Submits the sourcecode from a file to a daemon and shows the output, together with the" << endl;
+					cout << "percentiles of the times until the results arrived." << endl;
+					cout << "SUBMIT [socket] [path] [repetitions]" << endl;
+					cout << "\tsocket      - Path of the socket, on which the daemon listens." << endl;
+					cout << "\tpath        - File (and path), in which the sourcecode is located. \"stop\" stops the" << endl;
+					cout << "\t              daemon instead." << endl;
+					cout << "\trepetitions - Optional number of times, the sourcecode is submitted (default 1).\n" << endl;
+				}
 				else if (sArgument == "cls") {
 					//Display information about cls-command:
 					SetTextColor(7);
@@ -276,6 +1316,101 @@ int main() {
 					cout << "\t       events or not. If no argument is given, the command shows if logging" << endl;
 					cout << "\t       is enabled or disabled.\n" << endl;
 				}
+				else if (sArgument == "engine") {
+					//Display information about engine-command:
+					SetTextColor(7);
+					cout << "Shows which engine executes the sourcecode. If the optional argument is passed, the" << endl;
+					cout << "engine is changed." << endl;
+					cout << "ENGINE [engine] [depth|threads]" << endl;
+					cout << "\tengine - Optional argument resembles the new engine. \"interpreter\" evaluates the" << endl;
+					cout << "\t         abstract syntax trees directly, \"closure\" compiles every function into" << endl;
+					cout << "\t         closures before executing it. \"specializing\" executes nodes, which" << endl;
+					cout << "\t         specialize themselves on the types they encounter. \"jit\" compiles" << endl;
+					cout << "\t         numeric functions into native x86-64 code. If the sourcecode cannot" << endl;
+					cout << "\t         be compiled, it is executed by the interpreter. \"continuation\"" << endl;
+					cout << "\t         evaluates the abstract syntax trees without recursion, so that deeply" << endl;
+					cout << "\t         recursive functions do not crash the interpreter. \"parallel\" evaluates" << endl;
+					cout << "\t         expensive arguments of calls, which neither print anything nor change" << endl;
+					cout << "\t         variables, simultaneously on multiple threads." << endl;
+					cout << "\tdepth   - Optional argument for \"continuation\", which resembles the number of" << endl;
+					cout << "\t          functions, that can be executed within each other, before a stack" << endl;
+					cout << "\t          overflow is reported (Default: " << CONTINUATION_DEFAULT_MAXIMUM_DEPTH << ")." << endl;
+					cout << "\tthreads - Optional argument for \"parallel\", which resembles the number of" << endl;
+					cout << "\t          threads, that evaluate arguments (Default: number of hardware threads).\n" << endl;
+				}
+				else if (sArgument == "transpile") {
+					//Display information about transpile-command:
+					SetTextColor(7);
+					cout << "Transpiles sourcecode from a file into a standalone C++ program, which produces the same" << endl;
+					cout << "output as the interpreter." << endl;
+					cout << "TRANSPILE [path] [output] [executable]" << endl;
+					cout << "\tpath       - File (and path), in which the sourcecode is located." << endl;
+					cout << "\toutput     - File (and path), into which the C++ sourcecode is written." << endl;
+					cout << "\texecutable - Optional argument resembles the executable, into which the C++" << endl;
+					cout << "\t             sourcecode is compiled by \"" << TRANSPILER_COMPILER_COMMAND << "\".\n" << endl;
+				}
+				else if (sArgument == "check") {
+					//Display information about check-command:
+					SetTextColor(7);
+					cout << "Checks the types and the number of arguments of every expression in the sourcecode from a" << endl;
+					cout << "file without executing it, and shows every error, that would occur while executing it." << endl;
+					cout << "CHECK [path]" << endl;
+					cout << "\tpath - File (and path), in which the sourcecode is located.\n" << endl;
+				}
+				else if (sArgument == "benchmark") {
+					//Display information about benchmark-command:
+					SetTextColor(7);
+					cout << "Evaluates every kernel, which the type checker can select for an operation, and the" << endl;
+					cout << "generic evaluation of the same operation, and shows the time both needed. With the" << endl;
+					cout << "argument \"channels\", values are sent through a channel by 1 to 16 threads instead, and" << endl;
+					cout << "the number of values per second is shown. With the argument \"sessions\", the memory of" << endl;
+					cout << "simultaneous executions of a generated program is shown, once with a shared program and" << endl;
+					cout << "once with a program for every execution. With the argument \"async\", the memory of" << endl;
+					cout << "executions, which are suspended by an event loop while they wait for the host, is shown." << endl;
+					cout << "BENCHMARK [iterations]" << endl;
+					cout << "BENCHMARK channels [messages]" << endl;
+					cout << "BENCHMARK sessions [sessions]" << endl;
+					cout << "BENCHMARK async [executions]" << endl;
+					cout << "\titerations - Optional number of times, every operation is evaluated (default 100000)." << endl;
+					cout << "\tmessages   - Optional number of values, which are sent with every number of threads" << endl;
+					cout << "\t             (default 1000000)." << endl;
+					cout << "\tsessions   - Optional number of simultaneous executions (default 64)." << endl;
+					cout << "\texecutions - Optional number of suspended executions (default 10000).\n" << endl;
+				}
+				else if (sArgument == "shortcircuit") {
+					//Display information about shortcircuit-command:
+					SetTextColor(7);
+					cout << "Shows whether \"&\" and \"|\" stop evaluating their operands, as soon as an operand is" << endl;
+					cout << "\"nil\" or \"t\" respectively. If the optional argument is passed, the setting is changed." << endl;
+					cout << "SHORTCIRCUIT [setting]" << endl;
+					cout << "\tsetting - \"on\" skips the remaining operands (default), \"off\" evaluates every" << endl;
+					cout << "\t          operand, as earlier versions of the interpreter did.\n" << endl;
+				}
+				else if (sArgument == "memoize") {
+					//Display information about memoize-command:
+					SetTextColor(7);
+					cout << "Shows whether the interpreter memoizes the return values of pure functions, which do not" << endl;
+					cout << "print anything and only call pure functions, together with the statistics of the latest" << endl;
+					cout << "execution. If the optional argument is passed, the setting is changed." << endl;
+					cout << "MEMOIZE [setting]" << endl;
+					cout << "\tsetting - \"on\" or \"off\" enables or disables the memoization (disabled by default)." << endl;
+					cout << "\t          A number changes the maximum number of memoized values (default " << MEMO_DEFAULT_CAPACITY << "), the" << endl;
+					cout << "\t          value, which has not been used for the longest time, is removed first.\n" << endl;
+				}
+				else if (sArgument == "optimize") {
+					//Display information about optimize-command:
+					SetTextColor(7);
+					cout << "Shows the optimization level and every optimization pass, together with the number of" << endl;
+					cout << "nodes it changed and the time it needed during the latest execution. If arguments are" << endl;
+					cout << "passed, the optimization level or a single pass is changed." << endl;
+					cout << "OPTIMIZE [level]" << endl;
+					cout << "OPTIMIZE [pass] [setting]" << endl;
+					cout << "\tlevel   - \"-O0\" executes the sourcecode as it is parsed, \"-O1\" folds operations" << endl;
+					cout << "\t          with constant operands, \"-O2\" runs every pass (default)." << endl;
+					cout << "\tpass    - Name of the pass, which should be changed (\"fold\", \"inline\" or \"simplify\")." << endl;
+					cout << "\tsetting - \"on\" or \"off\" enables or disables the pass, \"dump\" or \"nodump\"" << endl;
+					cout << "\t          shows or hides the abstract syntax trees after the pass.\n" << endl;
+				}
 				else {
 					//Incorrect argument:
 					SetTextColor(12);
@@ -349,7 +1484,153 @@ int main() {
 				continue;
 			}
 			//Execute code:
-			execute(sFile, bDebugMode);
+			execute(sFile, bDebugMode, context, passManager);
+			cout << "\n" << endl;
+		}
+
+		else if (sCommand == "batch") {
+			//Execute multiple files simultaneously:
+			if (lsArguments.empty() || lsArguments.size() > 2) {
+				//Error: incorrect number of arguments:
+				SetTextColor(12);
+				cerr << (lsArguments.empty() ? "Not enough arguments" : "Too many arguments") << ". Type \"HELP batch\" for further information.\n" << endl;
+				logger.addEntry_terminalCommandException(sCommand, lsArguments, lsArguments.empty() ? "Not enough arguments" : "Too many arguments");
+				continue;
+			}
+			unsigned int nBatchThreads = CThreadPool::getHardwareThreads(); //Stores the number of files, which are executed simultaneously.
+			if (lsArguments.size() == 2) {
+				string sThreads = lsArguments[1]; //Stores the number of threads.
+				if (sThreads.empty() || sThreads.size() > 4 || sThreads.find_first_not_of("0123456789") != string::npos || stoi(sThreads) == 0) {
+					//Incorrect number of threads passed:
+					SetTextColor(12);
+					cerr << "The argument \"" << lsArguments[1] << "\" is incorrect. Type \"HELP batch\" for further information.\n" << endl;
+					logger.addEntry_terminalCommandArgException(sCommand, lsArguments, lsArguments[1], "Incorrect argument");
+					continue;
+				}
+				nBatchThreads = stoi(sThreads);
+			}
+			executeBatch(sFilePath != "" ? sFilePath + "/" + lsArguments[0] : lsArguments[0], sFilePath, nBatchThreads, context, passManager);
+			cout << "\n" << endl;
+		}
+
+		else if (sCommand == "shard") {
+			//Execute multiple files in worker processes:
+			if (lsArguments.empty() || lsArguments.size() > 2) {
+				//Error: incorrect number of arguments:
+				SetTextColor(12);
+				cerr << (lsArguments.empty() ? "Not enough arguments" : "Too many arguments") << ". Type \"HELP shard\" for further information.\n" << endl;
+				logger.addEntry_terminalCommandException(sCommand, lsArguments, lsArguments.empty() ? "Not enough arguments" : "Too many arguments");
+				continue;
+			}
+			unsigned int nProcesses = CThreadPool::getHardwareThreads(); //Stores the number of worker processes.
+			if (lsArguments.size() == 2) {
+				string sProcesses = lsArguments[1]; //Stores the number of processes.
+				if (sProcesses.empty() || sProcesses.size() > 4 || sProcesses.find_first_not_of("0123456789") != string::npos || stoi(sProcesses) == 0) {
+					//Incorrect number of processes passed:
+					SetTextColor(12);
+					cerr << "The argument \"" << lsArguments[1] << "\" is incorrect. Type \"HELP shard\" for further information.\n" << endl;
+					logger.addEntry_terminalCommandArgException(sCommand, lsArguments, lsArguments[1], "Incorrect argument");
+					continue;
+				}
+				nProcesses = stoi(sProcesses);
+			}
+			executeSharded(sFilePath != "" ? sFilePath + "/" + lsArguments[0] : lsArguments[0], sFilePath, nProcesses, context, passManager);
+			cout << "\n" << endl;
+		}
+
+		else if (sCommand == "daemon") {
+			//Execute submitted sourcecode:
+			if (lsArguments.empty() || lsArguments.size() > 3) {
+				//Error: incorrect number of arguments:
+				SetTextColor(12);
+				cerr << (lsArguments.empty() ? "Not enough arguments" : "Too many arguments") << ". Type \"HELP daemon\" for further information.\n" << endl;
+				logger.addEntry_terminalCommandException(sCommand, lsArguments, lsArguments.empty() ? "Not enough arguments" : "Too many arguments");
+				continue;
+			}
+			bool bFork = true; //Stores whether every submission is executed by a forked process.
+			if (lsArguments.size() >= 2) {
+				string sMode = lsArguments[1]; //Stores the mode.
+				for_each(sMode.begin(), sMode.end(), [](char& c) {c = ::tolower(c); }); //Convert argument to lowercase.
+				if (sMode != "fork" && sMode != "reset") {
+					//Incorrect mode passed:
+					SetTextColor(12);
+					cerr << "The argument \"" << lsArguments[1] << "\" is incorrect. Type \"HELP daemon\" for further information.\n" << endl;
+					logger.addEntry_terminalCommandArgException(sCommand, lsArguments, lsArguments[1], "Incorrect argument");
+					continue;
+				}
+				bFork = sMode == "fork";
+			}
+			string sPrelude = ""; //Stores the file, whose functions are prepared.
+			if (lsArguments.size() == 3) {
+				sPrelude = sFilePath != "" ? sFilePath + "/" + lsArguments[2] : lsArguments[2];
+			}
+			serveDaemon(lsArguments[0], sPrelude, bFork, context, passManager);
+			cout << "\n" << endl;
+		}
+
+		else if (sCommand == "submit") {
+			//Submit sourcecode to a daemon:
+			if (lsArguments.size() < 2 || lsArguments.size() > 3) {
+				//Error: incorrect number of arguments:
+				SetTextColor(12);
+				cerr << (lsArguments.size() < 2 ? "Not enough arguments" : "Too many arguments") << ". Type \"HELP submit\" for further information.\n" << endl;
+				logger.addEntry_terminalCommandException(sCommand, lsArguments, lsArguments.size() < 2 ? "Not enough arguments" : "Too many arguments");
+				continue;
+			}
+			unsigned int nRepetitions = 1; //Stores the number of times, the sourcecode is submitted.
+			if (lsArguments.size() == 3) {
+				string sRepetitions = lsArguments[2]; //Stores the number of repetitions.
+				if (sRepetitions.empty() || sRepetitions.size() > 9 || sRepetitions.find_first_not_of("0123456789") != string::npos || stoi(sRepetitions) == 0) {
+					//Incorrect number of repetitions passed:
+					SetTextColor(12);
+					cerr << "The argument \"" << lsArguments[2] << "\" is incorrect. Type \"HELP submit\" for further information.\n" << endl;
+					logger.addEntry_terminalCommandArgException(sCommand, lsArguments, lsArguments[2], "Incorrect argument");
+					continue;
+				}
+				nRepetitions = stoi(sRepetitions);
+			}
+			string sArgument = lsArguments[1]; //Stores the file.
+			for_each(sArgument.begin(), sArgument.end(), [](char& c) {c = ::tolower(c); }); //Convert argument to lowercase.
+			if (sArgument == "stop") {
+				submit(lsArguments[0], "", 1, context);
+			}
+			else {
+				submit(lsArguments[0], sFilePath != "" ? sFilePath + "/" + lsArguments[1] : lsArguments[1], nRepetitions, context);
+			}
+			cout << "\n" << endl;
+		}
+
+		else if (sCommand == "transpile") {
+			//Transpile sourcecode:
+			if (lsArguments.size() < 2) {
+				//Error: not enough arguments:
+				SetTextColor(12);
+				cerr << "Not enough arguments. Type \"HELP transpile\" for further information.\n" << endl;
+				logger.addEntry_terminalCommandException(sCommand, lsArguments, "Not enough arguments");
+				continue;
+			}
+			else if (lsArguments.size() > 3) {
+				//Error: too many arguments:
+				SetTextColor(12);
+				cerr << "Too many arguments. Type \"HELP transpile\" for further information.\n" << endl;
+				logger.addEntry_terminalCommandException(sCommand, lsArguments, "Too many arguments");
+				continue;
+			}
+			string sPrefix = sFilePath != "" ? sFilePath + "/" : "";
+			transpile(sPrefix + lsArguments[0], sPrefix + lsArguments[1], lsArguments.size() == 3 ? sPrefix + lsArguments[2] : "", context, passManager);
+			cout << "\n" << endl;
+		}
+
+		else if (sCommand == "check") {
+			//Check sourcecode:
+			if (lsArguments.size() != 1) {
+				//Error: incorrect number of arguments:
+				SetTextColor(12);
+				cerr << (lsArguments.empty() ? "Not enough arguments" : "Too many arguments") << ". Type \"HELP check\" for further information.\n" << endl;
+				logger.addEntry_terminalCommandException(sCommand, lsArguments, lsArguments.empty() ? "Not enough arguments" : "Too many arguments");
+				continue;
+			}
+			check(sFilePath != "" ? sFilePath + "/" + lsArguments[0] : lsArguments[0], context);
 			cout << "\n" << endl;
 		}
 
@@ -452,6 +1733,315 @@ int main() {
 			}
 		}
 
+		else if (sCommand == "engine") {
+			//Show or change the execution engine:
+			if (lsArguments.empty()) {
+				//Show the current engine:
+				SetTextColor(7);
+				cout << "The sourcecode is executed by the " << (context.getExecutionMode() == ExecutionMode::CLOSURE_COMPILATION ? "closure compiler" : context.getExecutionMode() == ExecutionMode::SELF_SPECIALIZATION ? "specializing evaluator" : context.getExecutionMode() == ExecutionMode::NATIVE_COMPILATION ? "JIT compiler" : context.getExecutionMode() == ExecutionMode::EXPLICIT_CONTINUATION ? "continuation evaluator (maximum depth: " + to_string(context.getMaximumDepth()) + ")" : context.getExecutionMode() == ExecutionMode::PARALLEL_EVALUATION ? "interpreter with parallel arguments (threads: " + to_string(context.getThreads()) + ")" : "interpreter") << ".\n" << endl;
+			}
+			else if (lsArguments.size() == 1 || lsArguments.size() == 2) {
+				string sArgument = lsArguments[0]; //Stores the argument.
+				for_each(sArgument.begin(), sArgument.end(), [](char& c) {c = ::tolower(c); }); //Convert argument to lowercase.
+				if (lsArguments.size() == 2 && sArgument != "continuation" && sArgument != "parallel") {
+					//Only the continuation evaluator has a depth and only the parallel interpreter has threads:
+					SetTextColor(12);
+					cerr << "Too many arguments. Type \"HELP engine\" for further information.\n" << endl;
+					logger.addEntry_terminalCommandException(sCommand, lsArguments, "Too many arguments");
+					continue;
+				}
+				if (sArgument == "interpreter") {
+					context.setExecutionMode(ExecutionMode::TREE_WALKING);
+					SetTextColor(7);
+					cout << "The sourcecode is now executed by the interpreter.\n" << endl;
+				}
+				else if (sArgument == "closure") {
+					context.setExecutionMode(ExecutionMode::CLOSURE_COMPILATION);
+					SetTextColor(7);
+					cout << "The sourcecode is now executed by the closure compiler.\n" << endl;
+				}
+				else if (sArgument == "specializing") {
+					context.setExecutionMode(ExecutionMode::SELF_SPECIALIZATION);
+					SetTextColor(7);
+					cout << "The sourcecode is now executed by the specializing evaluator.\n" << endl;
+				}
+				else if (sArgument == "jit") {
+					context.setExecutionMode(ExecutionMode::NATIVE_COMPILATION);
+					SetTextColor(7);
+					cout << "The sourcecode is now executed by the JIT compiler.\n" << endl;
+				}
+				else if (sArgument == "continuation") {
+					if (lsArguments.size() == 2) {
+						string sDepth = lsArguments[1]; //Stores the maximum depth.
+						if (sDepth.empty() || sDepth.size() > 9 || sDepth.find_first_not_of("0123456789") != string::npos || stoi(sDepth) == 0) {
+							//Incorrect depth passed:
+							SetTextColor(12);
+							cerr << "The argument \"" << lsArguments[1] << "\" is incorrect. Type \"HELP engine\" for further information.\n" << endl;
+							logger.addEntry_terminalCommandArgException(sCommand, lsArguments, lsArguments[1], "Incorrect argument");
+							continue;
+						}
+						context.setMaximumDepth(stoi(sDepth));
+					}
+					context.setExecutionMode(ExecutionMode::EXPLICIT_CONTINUATION);
+					SetTextColor(7);
+					cout << "The sourcecode is now executed by the continuation evaluator (maximum depth: " << context.getMaximumDepth() << ").\n" << endl;
+				}
+				else if (sArgument == "parallel") {
+					if (lsArguments.size() == 2) {
+						string sThreads = lsArguments[1]; //Stores the number of threads.
+						if (sThreads.empty() || sThreads.size() > 4 || sThreads.find_first_not_of("0123456789") != string::npos || stoi(sThreads) == 0) {
+							//Incorrect number of threads passed:
+							SetTextColor(12);
+							cerr << "The argument \"" << lsArguments[1] << "\" is incorrect. Type \"HELP engine\" for further information.\n" << endl;
+							logger.addEntry_terminalCommandArgException(sCommand, lsArguments, lsArguments[1], "Incorrect argument");
+							continue;
+						}
+						context.setThreads(stoi(sThreads));
+					}
+					context.setExecutionMode(ExecutionMode::PARALLEL_EVALUATION);
+					SetTextColor(7);
+					cout << "The sourcecode is now executed by the interpreter with parallel arguments (threads: " << context.getThreads() << ").\n" << endl;
+				}
+				else {
+					//Incorrect argument passed:
+					SetTextColor(12);
+					cerr << "The argument \"" << lsArguments[0] << "\" is incorrect. Type \"HELP engine\" for further information.\n" << endl;
+					logger.addEntry_terminalCommandArgException(sCommand, lsArguments, lsArguments[0], "Incorrect argument");
+					continue;
+				}
+			}
+			else {
+				//Incorrect number of arguments passed:
+				SetTextColor(12);
+				cerr << "Too many arguments. Type \"HELP engine\" for further information.\n" << endl;
+				logger.addEntry_terminalCommandException(sCommand, lsArguments, "Too many arguments");
+			}
+		}
+
+		else if (sCommand == "optimize") {
+			//Show or change the optimization passes:
+			if (lsArguments.empty()) {
+				//Show the optimization level and every pass:
+				SetTextColor(7);
+				cout << "Optimization level: -O" << passManager.getOptimizationLevel() << endl;
+				CLinkedList<string> lsPasses = passManager.getPasses();
+				CLinkedList<CPassStatistics> lStatistics = passManager.getStatistics();
+				for (unsigned int i = 0; i < lsPasses.size(); i++) {
+					cout << "\t" << lsPasses[i] << "\t";
+					if (passManager.isDisabled(lsPasses[i])) {
+						cout << "disabled";
+					}
+					else if (passManager.isEnabled(lsPasses[i])) {
+						cout << "enabled";
+					}
+					else {
+						cout << "requires -O" << passManager.getLevel(lsPasses[i]);
+					}
+					if (passManager.isDumped(lsPasses[i])) {
+						cout << ", dumped";
+					}
+					for (unsigned int j = 0; j < lStatistics.size(); j++) {
+						if (lStatistics[j].getName() == lsPasses[i]) {
+							//The pass was run during the latest execution:
+							cout << ", " << lStatistics[j].getChangedNodes() << " nodes changed in " << lStatistics[j].getMicroseconds() << " microseconds";
+						}
+					}
+					cout << endl;
+				}
+				cout << endl;
+			}
+			else if (lsArguments.size() == 1) {
+				//Change the optimization level:
+				string sArgument = lsArguments[0]; //Stores the argument.
+				for_each(sArgument.begin(), sArgument.end(), [](char& c) {c = ::tolower(c); }); //Convert argument to lowercase.
+				if (sArgument == "-o0" || sArgument == "-o1" || sArgument == "-o2") {
+					passManager.setOptimizationLevel(sArgument[2] - '0');
+					SetTextColor(7);
+					cout << "The optimization level has been changed to -O" << passManager.getOptimizationLevel() << ".\n" << endl;
+				}
+				else {
+					//Incorrect argument passed:
+					SetTextColor(12);
+					cerr << "The argument \"" << lsArguments[0] << "\" is incorrect. Type \"HELP optimize\" for further information.\n" << endl;
+					logger.addEntry_terminalCommandArgException(sCommand, lsArguments, lsArguments[0], "Incorrect argument");
+					continue;
+				}
+			}
+			else if (lsArguments.size() == 2) {
+				//Change a single pass:
+				string sPass = lsArguments[0]; //Stores the name of the pass.
+				for_each(sPass.begin(), sPass.end(), [](char& c) {c = ::tolower(c); }); //Convert pass to lowercase.
+				string sSetting = lsArguments[1]; //Stores the new setting of the pass.
+				for_each(sSetting.begin(), sSetting.end(), [](char& c) {c = ::tolower(c); }); //Convert setting to lowercase.
+				if (!passManager.hasPass(sPass)) {
+					//Incorrect pass passed:
+					SetTextColor(12);
+					cerr << "The pass \"" << lsArguments[0] << "\" does not exist. Type \"HELP optimize\" for further information.\n" << endl;
+					logger.addEntry_terminalCommandArgException(sCommand, lsArguments, lsArguments[0], "Incorrect argument");
+					continue;
+				}
+				if (sSetting == "on" || sSetting == "1" || sSetting == "true") {
+					passManager.setDisabled(sPass, false);
+					SetTextColor(7);
+					cout << "The pass \"" << sPass << "\" has been enabled.\n" << endl;
+				}
+				else if (sSetting == "off" || sSetting == "0" || sSetting == "false") {
+					passManager.setDisabled(sPass, true);
+					SetTextColor(7);
+					cout << "The pass \"" << sPass << "\" has been disabled.\n" << endl;
+				}
+				else if (sSetting == "dump") {
+					passManager.setDumped(sPass, true);
+					SetTextColor(7);
+					cout << "The abstract syntax trees are now shown after the pass \"" << sPass << "\".\n" << endl;
+				}
+				else if (sSetting == "nodump") {
+					passManager.setDumped(sPass, false);
+					SetTextColor(7);
+					cout << "The abstract syntax trees are no longer shown after the pass \"" << sPass << "\".\n" << endl;
+				}
+				else {
+					//Incorrect argument passed:
+					SetTextColor(12);
+					cerr << "The argument \"" << lsArguments[1] << "\" is incorrect. Type \"HELP optimize\" for further information.\n" << endl;
+					logger.addEntry_terminalCommandArgException(sCommand, lsArguments, lsArguments[1], "Incorrect argument");
+					continue;
+				}
+			}
+			else {
+				//Incorrect number of arguments passed:
+				SetTextColor(12);
+				cerr << "Too many arguments. Type \"HELP optimize\" for further information.\n" << endl;
+				logger.addEntry_terminalCommandException(sCommand, lsArguments, "Too many arguments");
+			}
+		}
+
+		else if (sCommand == "benchmark") {
+			//Measure the arithmetic kernels, the channels or the memory of sessions or suspended executions:
+			bool bChannels = false; //Stores whether the channels are measured.
+			bool bSessions = false; //Stores whether the memory of sessions is measured.
+			bool bAsync = false; //Stores whether the memory of suspended executions is measured.
+			if (!lsArguments.empty()) {
+				string sArgument = lsArguments[0]; //Stores the argument.
+				for_each(sArgument.begin(), sArgument.end(), [](char& c) {c = ::tolower(c); }); //Convert argument to lowercase.
+				if (sArgument == "channels") {
+					bChannels = true;
+					lsArguments.remove(0);
+				}
+				else if (sArgument == "sessions") {
+					bSessions = true;
+					lsArguments.remove(0);
+				}
+				else if (sArgument == "async") {
+					bAsync = true;
+					lsArguments.remove(0);
+				}
+			}
+			if (lsArguments.size() > 1) {
+				//Error: incorrect number of arguments:
+				SetTextColor(12);
+				cerr << "Too many arguments. Type \"HELP benchmark\" for further information.\n" << endl;
+				logger.addEntry_terminalCommandException(sCommand, lsArguments, "Too many arguments");
+				continue;
+			}
+			unsigned int nIterations = bChannels ? 1000000 : (bSessions ? 64 : (bAsync ? 10000 : 100000)); //Stores the number of iterations, messages, sessions or executions.
+			if (lsArguments.size() == 1) {
+				string sIterations = lsArguments[0]; //Stores the number of iterations.
+				if (sIterations.empty() || sIterations.size() > 9 || sIterations.find_first_not_of("0123456789") != string::npos || stoi(sIterations) == 0) {
+					//Incorrect number passed:
+					SetTextColor(12);
+					cerr << "The argument \"" << lsArguments[0] << "\" is incorrect. Type \"HELP benchmark\" for further information.\n" << endl;
+					logger.addEntry_terminalCommandArgException(sCommand, lsArguments, lsArguments[0], "Incorrect argument");
+					continue;
+				}
+				nIterations = stoi(sIterations);
+			}
+			if (bChannels) {
+				benchmarkChannels(nIterations, logger);
+			}
+			else if (bSessions) {
+				benchmarkSessions(nIterations, context, passManager);
+			}
+			else if (bAsync) {
+				benchmarkAsync(nIterations, context, passManager);
+			}
+			else {
+				benchmark(nIterations, logger);
+			}
+		}
+
+		else if (sCommand == "shortcircuit") {
+			//Show or change whether boolean operations are short-circuited:
+			if (lsArguments.size() == 1) {
+				string sArgument = lsArguments[0]; //Stores the argument.
+				for_each(sArgument.begin(), sArgument.end(), [](char& c) {c = ::tolower(c); }); //Convert argument to lowercase.
+				if (sArgument == "on" || sArgument == "1" || sArgument == "true") {
+					context.setShortCircuit(true);
+				}
+				else if (sArgument == "off" || sArgument == "0" || sArgument == "false") {
+					context.setShortCircuit(false);
+				}
+				else {
+					//Incorrect argument passed:
+					SetTextColor(12);
+					cerr << "The argument \"" << lsArguments[0] << "\" is incorrect. Type \"HELP shortcircuit\" for further information.\n" << endl;
+					logger.addEntry_terminalCommandArgException(sCommand, lsArguments, lsArguments[0], "Incorrect argument");
+					continue;
+				}
+			}
+			else if (lsArguments.size() > 1) {
+				//Incorrect number of arguments passed:
+				SetTextColor(12);
+				cerr << "Too many arguments. Type \"HELP shortcircuit\" for further information.\n" << endl;
+				logger.addEntry_terminalCommandException(sCommand, lsArguments, "Too many arguments");
+				continue;
+			}
+			SetTextColor(7);
+			cout << (context.isShortCircuit() ? "\"&\" and \"|\" skip the remaining operands, once the result is decided.\n" : "\"&\" and \"|\" evaluate every operand.\n") << endl;
+		}
+
+		else if (sCommand == "memoize") {
+			//Show or change the memoization of pure functions:
+			if (lsArguments.size() == 1) {
+				string sArgument = lsArguments[0]; //Stores the argument.
+				for_each(sArgument.begin(), sArgument.end(), [](char& c) {c = ::tolower(c); }); //Convert argument to lowercase.
+				if (sArgument == "on" || sArgument == "true") {
+					memoCache.setEnabled(true);
+				}
+				else if (sArgument == "off" || sArgument == "false") {
+					memoCache.setEnabled(false);
+				}
+				else if (!sArgument.empty() && sArgument.size() <= 9 && sArgument.find_first_not_of("0123456789") == string::npos && stoi(sArgument) > 0) {
+					memoCache.setCapacity(stoi(sArgument));
+				}
+				else {
+					//Incorrect argument passed:
+					SetTextColor(12);
+					cerr << "The argument \"" << lsArguments[0] << "\" is incorrect. Type \"HELP memoize\" for further information.\n" << endl;
+					logger.addEntry_terminalCommandArgException(sCommand, lsArguments, lsArguments[0], "Incorrect argument");
+					continue;
+				}
+			}
+			else if (lsArguments.size() > 1) {
+				//Incorrect number of arguments passed:
+				SetTextColor(12);
+				cerr << "Too many arguments. Type \"HELP memoize\" for further information.\n" << endl;
+				logger.addEntry_terminalCommandException(sCommand, lsArguments, "Too many arguments");
+				continue;
+			}
+			SetTextColor(7);
+			cout << "Memoization is " << (memoCache.isEnabled() ? "enabled" : "disabled") << " (capacity: " << memoCache.getCapacity() << " values)." << endl;
+			if (memoCache.getFunctions() > 0) {
+				//Show the statistics of the latest execution:
+				cout << "\tPure functions: " << memoCache.getPureFunctions() << " of " << memoCache.getFunctions() << endl;
+				cout << "\tHits:           " << memoCache.getHits() << " (" << fixed << setprecision(1) << memoCache.getHitRate() << "%)" << defaultfloat << endl;
+				cout << "\tMisses:         " << memoCache.getMisses() << endl;
+				cout << "\tEvictions:      " << memoCache.getEvictions() << endl;
+				cout << "\tStored values:  " << memoCache.getEntries() << endl;
+			}
+			cout << endl;
+		}
+
 		else {
 			//Incorrect command:
 			SetTextColor(12);